@@ -0,0 +1,105 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief An example that waits for bursts from several radars in one
+ *        epoll loop using the burst ready file descriptors.
+ *
+ * @details While no bursts arrive the loop stays blocked in epoll_wait.
+ *          The process CPU time spent over the idle period is measured
+ *          and checked to be negligible compared to the wall time.
+ */
+#include <stdlib.h>
+#include <sys/epoll.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <platform_check.h>
+#include <platform_log.h>
+
+#include <IRadarApi.hpp>
+
+namespace {
+
+const int kNumSensors = 4;
+const int kWaitTimeoutMs = 500;
+const int kIdlePeriodMs = 2000;
+// The idle loop should not use more than this share of the wall time.
+const double kMaxIdleCpuShare = 0.01;
+
+double ElapsedMs(clockid_t clock_id, const timespec& start) {
+  timespec now;
+  clock_gettime(clock_id, &now);
+  return (now.tv_sec - start.tv_sec) * 1e3 +
+         (now.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  (void) argc;
+  (void) argv;
+  ILOG("Burst ready descriptor polling example");
+
+  int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  QCHECK(epoll_fd >= 0, "Failed to create epoll instance");
+
+  radar_api::IRadarSensor* radars[kNumSensors];
+  for (int i = 0; i < kNumSensors; ++i) {
+    radars[i] = radar_api::CreateRadarSensor(i);
+    QCHECK(radars[i] != nullptr, "Invalid radar handle from driver");
+
+    int fd = -1;
+    RadarReturnCode rc = radars[i]->GetBurstReadyFd(fd);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to get burst ready fd of radar %i", i);
+
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.u32 = i;
+    QCHECK_EQ(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event), 0, "%d",
+        "Failed to add radar %i to epoll", i);
+
+    rc = radars[i]->StartDataStreaming();
+    if (rc != RC_OK) {
+      ILOG("Radar %i did not start streaming (rc %u), it will stay idle",
+          i, rc);
+    }
+  }
+
+  RadarBurstFormat format;
+  std::vector<uint8_t> raw_radar_data;
+  uint64_t bursts_read = 0;
+
+  ILOG("Waiting for bursts for %i ms...", kIdlePeriodMs);
+  timespec wall_start;
+  timespec cpu_start;
+  clock_gettime(CLOCK_MONOTONIC, &wall_start);
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_start);
+  while (ElapsedMs(CLOCK_MONOTONIC, wall_start) < kIdlePeriodMs) {
+    epoll_event events[kNumSensors];
+    int num_events = epoll_wait(epoll_fd, events, kNumSensors,
+                                kWaitTimeoutMs);
+    for (int e = 0; e < num_events; ++e) {
+      radar_api::IRadarSensor* radar = radars[events[e].data.u32];
+      // Drain the radar, the descriptor stays readable until it is empty.
+      while (radar->ReadBurst(format, raw_radar_data, {0, 0}) == RC_OK) {
+        ++bursts_read;
+      }
+    }
+  }
+  double wall_ms = ElapsedMs(CLOCK_MONOTONIC, wall_start);
+  double cpu_ms = ElapsedMs(CLOCK_PROCESS_CPUTIME_ID, cpu_start);
+
+  ILOG("Read %llu bursts, CPU time %.3f ms over %.1f ms",
+      static_cast<unsigned long long>(bursts_read), cpu_ms, wall_ms);
+  if (bursts_read == 0) {
+    QCHECK_LT(cpu_ms, wall_ms * kMaxIdleCpuShare, "%f",
+        "Idle wait is not expected to use CPU");
+  }
+
+  for (int i = 0; i < kNumSensors; ++i) {
+    radars[i]->StopDataStreaming();
+    RadarReturnCode rc = radar_api::DestroyRadarSensor(radars[i]);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to destroy radar instance");
+  }
+  close(epoll_fd);
+}
@@ -0,0 +1,281 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief An example that records bursts into a capture file and reads it
+ *        back.
+ *
+ * @details The simulated radar produces bursts as fast as they are read and
+ *          every burst is handed to the recorder, which writes them from its
+ *          own thread. The capture is then parsed to check the header and
+ *          that every recorded burst is found in order with the same data.
+ *          Ranges of bursts are then found through the index of the capture,
+ *          and the index of a truncated copy is rebuilt and repaired.
+ *
+ *          The capture is written to the path given as the first argument,
+ *          capture.cap by default.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <platform_check.h>
+#include <platform_log.h>
+
+#include <IRadarApi.hpp>
+
+#include <CaptureFormat.hpp>
+#include <CaptureReader.hpp>
+#include <CaptureRecorder.hpp>
+#include <SimRadar.hpp>
+
+namespace {
+
+const int kNumBursts = 500;
+const timespec kReadTimeout = {1, 0};
+
+using MainParams = std::vector<std::pair<RadarMainParam, uint32_t>>;
+
+// FNV-1a hash of the burst data.
+uint64_t Hash(const uint8_t* data, size_t size) {
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ data[i]) * 1099511628211ull;
+  }
+  return hash;
+}
+
+std::vector<uint8_t> ReadFile(const std::string& path) {
+  std::vector<uint8_t> data;
+  FILE* file = fopen(path.c_str(), "rb");
+  QCHECK(file != nullptr, "Failed to open %s", path.c_str());
+  uint8_t buffer[1 << 16];
+  size_t size = 0;
+  while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.insert(data.end(), buffer, buffer + size);
+  }
+  fclose(file);
+  return data;
+}
+
+void WriteFile(const std::string& path, const uint8_t* data, size_t size) {
+  FILE* file = fopen(path.c_str(), "wb");
+  QCHECK(file != nullptr, "Failed to create %s", path.c_str());
+  QCHECK(fwrite(data, 1, size, file) == size, "Failed to write %s",
+         path.c_str());
+  fclose(file);
+}
+
+// Check that the bursts of a range of sequence numbers are found with their
+// recorded data.
+void CheckRange(const radar_utils::CaptureReader& reader, uint32_t first,
+                uint32_t last, const std::vector<uint32_t>& sequence_numbers,
+                const std::vector<uint64_t>& hashes) {
+  std::vector<radar_utils::CaptureIndexEntry> entries;
+  RadarReturnCode rc = reader.FindBySequence(first, last, 0, entries);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to find bursts %u to %u", first, last);
+  auto begin = std::lower_bound(sequence_numbers.begin(),
+                                sequence_numbers.end(), first);
+  auto end = std::upper_bound(begin, sequence_numbers.end(), last);
+  QCHECK(entries.size() == static_cast<size_t>(end - begin),
+         "Found %zu bursts from %u to %u, expected %zu", entries.size(),
+         first, last, static_cast<size_t>(end - begin));
+  radar_utils::CaptureRecordHeader record;
+  const uint8_t* payload = nullptr;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const size_t burst = begin - sequence_numbers.begin() + i;
+    rc = reader.GetRecord(entries[i], record, payload);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to get the record of burst %u",
+              entries[i].sequence_number);
+    QCHECK(record.format.sequence_number == sequence_numbers[burst] &&
+           Hash(payload, record.payload_bytes) == hashes[burst],
+           "Burst %u differs from the recorded burst",
+           entries[i].sequence_number);
+  }
+}
+
+bool FindParam(const radar_utils::CaptureHeader& header, RadarParamGroup group,
+               RadarMainParamId id, uint32_t& value) {
+  for (const radar_utils::CaptureParam& param : header.params) {
+    if (param.kind == radar_utils::CaptureParamKind::kMain &&
+        param.group == group && param.id == id) {
+      value = param.value;
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::string path = argc > 1 ? argv[1] : "capture.cap";
+  ILOG("Capture recording example");
+
+  // A burst of 2 TX x 4 RX antennas, 64 chirps of 256 samples.
+  MainParams main_params = {
+    { {RADAR_PARAM_GROUP_COMMON, RADAR_PARAM_TX_ANTENNA_MASK},       0x3},
+    { {RADAR_PARAM_GROUP_COMMON, RADAR_PARAM_RX_ANTENNA_MASK},       0xf},
+    { {RADAR_PARAM_GROUP_FMCW,   FMCW_PARAM_CHIRP_PERIOD_US},        150},
+    { {RADAR_PARAM_GROUP_FMCW,   FMCW_PARAM_CHIRPS_PER_BURST},       64},
+    { {RADAR_PARAM_GROUP_FMCW,   FMCW_PARAM_SAMPLES_PER_CHIRP},      256},
+  };
+
+  radar_api::IRadarSensor* radar = radar_api::CreateRadarSensor(0);
+  QCHECK(radar != nullptr, "Invalid radar handle from driver");
+  RadarReturnCode rc = radar->TurnOn();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn on the radar");
+
+  const uint8_t slot_id = 0;
+  for (auto& param : main_params) {
+    rc = radar->SetMainParam(slot_id, param.first, param.second);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to set main param %u.%u value %u",
+              param.first.group, param.first.id, param.second);
+  }
+  rc = radar->SetVendorParam(slot_id, SIM_VENDOR_PARAM_REAL_TIME, 0);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn off the real time mode");
+  rc = radar->ActivateConfig(slot_id);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to activate the config slot");
+
+  radar_utils::CaptureRecorderConfig config;
+  config.vendor_params.params = {
+    SIM_VENDOR_PARAM_REAL_TIME, SIM_VENDOR_PARAM_NOISE_LSB,
+    SIM_VENDOR_PARAM_INTERLEAVED, SIM_VENDOR_PARAM_SAMPLE_BITS,
+  };
+  radar_utils::CaptureRecorder recorder(config);
+  rc = recorder.Open(path, *radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to create %s", path.c_str());
+  rc = radar->StartDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to start data streaming");
+
+  ILOG("Recording %i bursts into %s...", kNumBursts, path.c_str());
+  RadarBurstFormat format;
+  std::vector<uint8_t> raw_radar_data;
+  std::vector<uint32_t> sequence_numbers;
+  std::vector<uint64_t> hashes;
+  double total_record_us = 0.0;
+  double max_record_us = 0.0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kNumBursts; ++i) {
+    rc = radar->ReadBurst(format, raw_radar_data, kReadTimeout);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to read burst %i", i);
+    auto record_start = std::chrono::steady_clock::now();
+    rc = recorder.Record(format, raw_radar_data);
+    std::chrono::duration<double, std::micro> record_us =
+        std::chrono::steady_clock::now() - record_start;
+    total_record_us += record_us.count();
+    max_record_us = std::max(max_record_us, record_us.count());
+    if (rc == RC_OK) {
+      sequence_numbers.push_back(format.sequence_number);
+      hashes.push_back(Hash(raw_radar_data.data(), raw_radar_data.size()));
+    } else {
+      QCHECK_EQ(rc, RC_RES_LIMIT, "%d", "Failed to record burst %i", i);
+    }
+  }
+  rc = recorder.Close();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to close %s", path.c_str());
+  std::chrono::duration<double> seconds =
+      std::chrono::steady_clock::now() - start;
+
+  radar_utils::CaptureRecorderStats stats = recorder.GetStats();
+  ILOG("Recorded %llu bursts, dropped %llu, %.1f MB written at %.1f MB/s, "
+       "ring high watermark %.1f MB, %.1f us per record, max %.1f us",
+       static_cast<unsigned long long>(stats.recorded),
+       static_cast<unsigned long long>(stats.dropped),
+       stats.bytes_written / 1e6, stats.bytes_written / 1e6 / seconds.count(),
+       stats.high_watermark_bytes / 1e6, total_record_us / kNumBursts,
+       max_record_us);
+
+  // Read the capture back.
+  std::vector<uint8_t> capture = ReadFile(path);
+  radar_utils::CaptureHeader header;
+  size_t offset = 0;
+  rc = radar_utils::ParseCaptureHeader(capture.data(), capture.size(), header,
+                                       offset);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to parse the capture header");
+  uint32_t chirps = 0;
+  QCHECK(FindParam(header, RADAR_PARAM_GROUP_FMCW, FMCW_PARAM_CHIRPS_PER_BURST,
+                   chirps) && chirps == 64,
+         "Chirps per burst missing from the capture header");
+  ILOG("Capture of %s by %s, API version %u.%u.%u, %zu params",
+       header.name.c_str(), header.vendor.c_str(), header.api_version.major,
+       header.api_version.minor, header.api_version.patch,
+       header.params.size());
+
+  size_t num_records = 0;
+  radar_utils::CaptureRecordHeader record;
+  while (radar_utils::ParseCaptureRecord(capture.data() + offset,
+                                         capture.size() - offset,
+                                         record) == RC_OK &&
+         record.encoding != radar_utils::CaptureEncoding::kIndex) {
+    QCHECK(num_records < hashes.size(), "More records than recorded bursts");
+    QCHECK(record.format.sequence_number == sequence_numbers[num_records] &&
+           Hash(capture.data() + offset + sizeof(record),
+                record.payload_bytes) == hashes[num_records],
+           "Record %zu differs from the recorded burst", num_records);
+    offset += record.record_bytes;
+    ++num_records;
+  }
+  QCHECK(num_records == hashes.size() &&
+         offset + record.record_bytes == capture.size(),
+         "Found %zu records of %zu", num_records, hashes.size());
+  ILOG("Read back %zu records", num_records);
+
+  // Find ranges of bursts through the index.
+  radar_utils::CaptureReader reader;
+  rc = reader.Open(path);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to open %s", path.c_str());
+  QCHECK(!reader.IsIndexRebuilt() &&
+         reader.GetEntries().size() == hashes.size(),
+         "Capture index of %zu bursts missing", hashes.size());
+  const uint32_t first = sequence_numbers.front();
+  const uint32_t last = sequence_numbers.back();
+  CheckRange(reader, first, last, sequence_numbers, hashes);
+  CheckRange(reader, first + 100, first + 199, sequence_numbers, hashes);
+  CheckRange(reader, last + 1, last + 10, sequence_numbers, hashes);
+  const std::vector<radar_utils::CaptureIndexEntry>& entries =
+      reader.GetEntries();
+  std::vector<radar_utils::CaptureIndexEntry> found;
+  rc = reader.FindByTime(entries[10].timestamp_ns, entries[19].timestamp_ns,
+                         radar_utils::kCaptureAnyConfig, found);
+  QCHECK(rc == RC_OK && found.size() >= 10 &&
+         found.front().timestamp_ns == entries[10].timestamp_ns,
+         "Failed to find bursts by time");
+  rc = reader.FindBySequence(first, last, 1, found);
+  QCHECK(rc == RC_OK && found.empty(), "Found bursts of an inactive config");
+  ILOG("Found ranges of bursts through the index");
+
+  // A truncated copy has no index, it is rebuilt and then repaired.
+  QCHECK(entries.size() > 300, "Too few bursts recorded to truncate");
+  const std::string truncated_path = path + ".truncated";
+  const size_t truncated_bytes = static_cast<size_t>(entries[300].offset) + 100;
+  WriteFile(truncated_path, capture.data(), truncated_bytes);
+  reader.Close();
+  rc = reader.Open(truncated_path);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to open %s", truncated_path.c_str());
+  QCHECK(reader.IsIndexRebuilt() && reader.GetEntries().size() == 300,
+         "Rebuilt an index of %zu bursts, expected 300",
+         reader.GetEntries().size());
+  CheckRange(reader, first, sequence_numbers[299], sequence_numbers, hashes);
+  reader.Close();
+  rc = radar_utils::RepairCapture(truncated_path);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to repair %s", truncated_path.c_str());
+  rc = reader.Open(truncated_path);
+  QCHECK(rc == RC_OK && !reader.IsIndexRebuilt() &&
+         reader.GetEntries().size() == 300,
+         "Failed to load the repaired index of %s", truncated_path.c_str());
+  reader.Close();
+  remove(truncated_path.c_str());
+  ILOG("Rebuilt and repaired the index of a truncated capture");
+
+  rc = radar->StopDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to stop radar data streaming");
+  rc = radar->TurnOff();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn the radar off");
+  rc = radar_api::DestroyRadarSensor(radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to destroy radar instance");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,1529 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Benchmarks of the radar-dsp kernels.
+ *
+ * @details Every kernel is run with each SIMD level supported by the CPU.
+ *          The results of the SIMD levels are checked against the scalar
+ *          ones before the throughput is reported. Data rearranging kernels
+ *          are compared with the straightforward loops instead.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <platform_check.h>
+#include <platform_log.h>
+
+#include <Beamformer.hpp>
+#include <BurstCodec.hpp>
+#include <Cfar.hpp>
+#include <ClutterFilter.hpp>
+#include <Fft.hpp>
+#include <FixedRangeFft.hpp>
+#include <RadarCube.hpp>
+#include <RangeDoppler.hpp>
+#include <RangeFft.hpp>
+#include <SamplePacking.hpp>
+#include <SampleUnpack.hpp>
+#include <SimdLevel.hpp>
+#include <SweepProcessor.hpp>
+#include <ThreadPool.hpp>
+#include <Tracker.hpp>
+#include <Window.hpp>
+
+namespace {
+
+const int kRepeats = 20;
+const double kPi = 3.14159265358979323846;
+
+const radar_dsp::SimdLevel kLevels[] = {
+  radar_dsp::SimdLevel::kScalar,
+  radar_dsp::SimdLevel::kSse41,
+  radar_dsp::SimdLevel::kAvx2,
+  radar_dsp::SimdLevel::kAvx512,
+};
+
+// Run a function a few times and get the average duration in seconds.
+template <typename Function>
+double Measure(Function function) {
+  function();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kRepeats; ++i) {
+    function();
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / kRepeats;
+}
+
+std::vector<uint8_t> RandomBytes(size_t size) {
+  std::mt19937 generator(size);
+  std::vector<uint8_t> bytes(size);
+  for (uint8_t& byte : bytes) {
+    byte = static_cast<uint8_t>(generator());
+  }
+  return bytes;
+}
+
+RadarBurstFormat MakeFormat(RadarSampleDType data_type, uint8_t bits,
+                            bool is_big_endian) {
+  RadarBurstFormat format;
+  memset(&format, 0, sizeof(format));
+  format.radar_type = RTYPE_FMCW;
+  format.sample_data_type = data_type;
+  format.bits_per_sample = bits;
+  format.num_channels = 1;
+  format.is_big_endian = is_big_endian;
+  return format;
+}
+
+void BenchmarkUnpack(const char* name, const RadarBurstFormat& format) {
+  // An odd number of samples exercises the scalar tails too.
+  const size_t num_samples = 256 * 1024 + 3;
+  radar_dsp::SampleLayout layout;
+  QCHECK_EQ(radar_dsp::GetSampleLayout(format, layout), RC_OK, "%d",
+            "Unsupported format %s", name);
+  size_t num_floats = num_samples * layout.components;
+  std::vector<uint8_t> data = RandomBytes(num_floats * layout.container_bytes);
+  if (layout.is_float) {
+    // Random bits may be NaNs, which do not compare equal.
+    for (size_t i = 0; i < num_floats; ++i) {
+      double value = static_cast<double>(i % 1000) - 500.0;
+      float float_value = static_cast<float>(value);
+      uint8_t* dst = &data[i * layout.container_bytes];
+      if (layout.container_bytes == 4) {
+        memcpy(dst, &float_value, sizeof(float_value));
+      } else {
+        memcpy(dst, &value, sizeof(value));
+      }
+      if (layout.is_big_endian) {
+        std::reverse(dst, dst + layout.container_bytes);
+      }
+    }
+  }
+
+  std::vector<float> expected(num_floats);
+  std::vector<float> output(num_floats);
+  for (radar_dsp::SimdLevel level : kLevels) {
+    if (level > radar_dsp::DetectSimdLevel()) {
+      continue;
+    }
+    radar_dsp::SetSimdLevel(level);
+    std::vector<float>& result =
+        level == radar_dsp::SimdLevel::kScalar ? expected : output;
+    double seconds = Measure([&] {
+      RadarReturnCode rc = radar_dsp::UnpackSamples(
+          format, data.data(), data.size(), result.data(), 0.5f);
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to unpack %s", name);
+    });
+    QCHECK(memcmp(result.data(), expected.data(),
+                  num_floats * sizeof(float)) == 0,
+           "Unpacking %s with %s differs from scalar", name,
+           radar_dsp::GetSimdLevelName(level));
+    ILOG("unpack %-12s %-8s %8.1f Msamples/s", name,
+         radar_dsp::GetSimdLevelName(level), num_samples / seconds / 1e6);
+  }
+  radar_dsp::SetSimdLevel(radar_dsp::DetectSimdLevel());
+}
+
+void BenchmarkPacking(const char* name, RadarSampleDType data_type,
+                      uint8_t bits, bool is_big_endian) {
+  RadarBurstFormat padded_format = MakeFormat(data_type, bits, is_big_endian);
+  RadarBurstFormat format = padded_format;
+  format.sample_packing = RSAMPLE_PACKING_PACKED;
+  radar_dsp::SampleLayout layout;
+  QCHECK_EQ(radar_dsp::GetSampleLayout(padded_format, layout), RC_OK, "%d",
+            "Unsupported format %s", name);
+
+  // Random components of the packed width, sign-extended when signed.
+  const size_t num_samples = 256 * 1024 + 5;
+  size_t count = num_samples * layout.components;
+  std::vector<uint8_t> padded(count * layout.container_bytes);
+  std::mt19937 generator(bits);
+  int shift = 32 - layout.bits;
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t value = generator() << shift;
+    value = layout.is_signed ? static_cast<uint32_t>(
+                                   static_cast<int32_t>(value) >> shift)
+                             : value >> shift;
+    for (int b = 0; b < layout.container_bytes; ++b) {
+      int byte = is_big_endian ? layout.container_bytes - 1 - b : b;
+      padded[i * layout.container_bytes + byte] =
+          static_cast<uint8_t>(value >> (8 * b));
+    }
+  }
+  std::vector<float> expected_floats(count);
+  RadarReturnCode rc = radar_dsp::UnpackSamples(
+      padded_format, padded.data(), padded.size(), expected_floats.data());
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to unpack padded %s", name);
+
+  std::vector<uint8_t> expected_packed;
+  std::vector<uint8_t> packed;
+  std::vector<uint8_t> expanded;
+  std::vector<float> floats;
+  for (radar_dsp::SimdLevel level : kLevels) {
+    if (level > radar_dsp::DetectSimdLevel()) {
+      continue;
+    }
+    radar_dsp::SetSimdLevel(level);
+    double pack_seconds = Measure([&] {
+      rc = radar_dsp::PackSamples(format, padded.data(), padded.size(),
+                                  packed);
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to pack %s", name);
+    });
+    if (level == radar_dsp::SimdLevel::kScalar) {
+      expected_packed = packed;
+      QCHECK_EQ(packed.size(), radar_dsp::GetBurstBytes(format, num_samples),
+                "%zu", "Unexpected packed size of %s", name);
+    }
+    QCHECK(packed == expected_packed, "Packing %s with %s differs", name,
+           radar_dsp::GetSimdLevelName(level));
+
+    double expand_seconds = Measure([&] {
+      rc = radar_dsp::ExpandSamples(format, packed.data(), packed.size(),
+                                    expanded);
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to expand %s", name);
+    });
+    // Narrow components may fill the padding with an extra one.
+    QCHECK(expanded.size() >= padded.size() &&
+           std::equal(padded.begin(), padded.end(), expanded.begin()),
+           "Expanding %s with %s differs", name,
+           radar_dsp::GetSimdLevelName(level));
+
+    floats.resize(radar_dsp::GetNumSamples(format, packed.size()) *
+                  layout.components);
+    double unpack_seconds = Measure([&] {
+      rc = radar_dsp::UnpackSamples(format, packed.data(), packed.size(),
+                                    floats.data());
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to unpack %s", name);
+    });
+    QCHECK(std::equal(expected_floats.begin(), expected_floats.end(),
+                      floats.begin()),
+           "Unpacking packed %s with %s differs", name,
+           radar_dsp::GetSimdLevelName(level));
+
+    ILOG("packed %-12s %-8s pack %7.1f, expand %7.1f, unpack %7.1f "
+         "Msamples/s, %zu of %zu bytes", name,
+         radar_dsp::GetSimdLevelName(level), num_samples / pack_seconds / 1e6,
+         num_samples / expand_seconds / 1e6,
+         num_samples / unpack_seconds / 1e6, packed.size(), padded.size());
+  }
+  radar_dsp::SetSimdLevel(radar_dsp::DetectSimdLevel());
+}
+
+// Burst of beat tones and noise of noise_lsb, 4 interleaved channels of 128
+// chirps of 256 samples.
+std::vector<uint8_t> MakeCodecBurst(const char* name,
+                                    RadarSampleDType data_type, uint8_t bits,
+                                    bool is_big_endian, bool is_packed,
+                                    double noise_lsb,
+                                    RadarBurstFormat& format) {
+  format = MakeFormat(data_type, bits, is_big_endian);
+  format.num_channels = 4;
+  format.is_channels_interleaved = true;
+  format.custom.fmcw.chirps_per_burst = 128;
+  format.custom.fmcw.samples_per_chirp = 256;
+  radar_dsp::SampleLayout layout;
+  QCHECK_EQ(radar_dsp::GetSampleLayout(format, layout), RC_OK, "%d",
+            "Unsupported format %s", name);
+
+  const size_t num_samples = static_cast<size_t>(format.num_channels) *
+                             format.custom.fmcw.chirps_per_burst *
+                             format.custom.fmcw.samples_per_chirp;
+  const size_t count = num_samples * layout.components;
+  const double full_scale = static_cast<double>(1u << (layout.bits - 1));
+  std::mt19937 generator(bits);
+  std::normal_distribution<double> noise(0.0, noise_lsb);
+  std::vector<uint8_t> data(count * layout.container_bytes);
+  for (size_t i = 0; i < count; ++i) {
+    const size_t sample =
+        i / layout.components / format.num_channels % 256;
+    const size_t channel = i / layout.components % format.num_channels;
+    const double phase = 2.0 * kPi * (0.031 * sample + 0.25 * channel) +
+                         (i % layout.components) * kPi / 2;
+    double value = full_scale * (0.3 * std::cos(phase) +
+                                 0.05 * std::cos(3.7 * phase)) +
+                   noise(generator);
+    if (!layout.is_signed) {
+      value += full_scale;
+    }
+    value = std::max(layout.is_signed ? -full_scale : 0.0,
+                     std::min(value, (layout.is_signed ? 1 : 2) *
+                                         full_scale - 1));
+    const uint32_t component =
+        static_cast<uint32_t>(static_cast<int32_t>(std::lround(value)));
+    for (int b = 0; b < layout.container_bytes; ++b) {
+      int byte = is_big_endian ? layout.container_bytes - 1 - b : b;
+      data[i * layout.container_bytes + byte] =
+          static_cast<uint8_t>(component >> (8 * b));
+    }
+  }
+  if (is_packed) {
+    std::vector<uint8_t> packed;
+    format.sample_packing = RSAMPLE_PACKING_PACKED;
+    QCHECK_EQ(radar_dsp::PackSamples(format, data.data(), data.size(),
+                                     packed), RC_OK, "%d",
+              "Failed to pack %s", name);
+    data.swap(packed);
+  }
+  return data;
+}
+
+void BenchmarkLossless(const char* name, RadarSampleDType data_type,
+                       uint8_t bits, bool is_big_endian, bool is_packed,
+                       double noise_lsb) {
+  RadarBurstFormat format;
+  std::vector<uint8_t> data = MakeCodecBurst(
+      name, data_type, bits, is_big_endian, is_packed, noise_lsb, format);
+  std::vector<uint8_t> expected_encoded;
+  std::vector<uint8_t> encoded;
+  std::vector<uint8_t> decoded(data.size());
+  for (radar_dsp::SimdLevel level : kLevels) {
+    if (level > radar_dsp::DetectSimdLevel()) {
+      continue;
+    }
+    radar_dsp::SetSimdLevel(level);
+    double encode_seconds = Measure([&] {
+      RadarReturnCode rc = radar_dsp::EncodeLossless(
+          format, data.data(), data.size(), encoded);
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to encode %s", name);
+    });
+    if (level == radar_dsp::SimdLevel::kScalar) {
+      expected_encoded = encoded;
+    }
+    QCHECK(encoded == expected_encoded, "Encoding %s with %s differs", name,
+           radar_dsp::GetSimdLevelName(level));
+    double decode_seconds = Measure([&] {
+      RadarReturnCode rc = radar_dsp::DecodeBurst(
+          format, encoded.data(), encoded.size(), decoded.data(),
+          decoded.size());
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to decode %s", name);
+    });
+    QCHECK(decoded == data, "Decoding %s with %s differs", name,
+           radar_dsp::GetSimdLevelName(level));
+    ILOG("lossless %-10s %-8s encode %6.1f, decode %6.1f MB/s, "
+         "%.2f times smaller", name, radar_dsp::GetSimdLevelName(level),
+         data.size() / encode_seconds / 1e6,
+         data.size() / decode_seconds / 1e6,
+         static_cast<double>(data.size()) / encoded.size());
+  }
+  radar_dsp::SetSimdLevel(radar_dsp::DetectSimdLevel());
+}
+
+// Compression of the burst of BenchmarkLossless for an error bound or a
+// target SNR, with the largest error and the SNR measured on the decoded
+// burst.
+void BenchmarkLossy(const char* name, RadarSampleDType data_type,
+                    uint8_t bits, bool is_big_endian, bool is_packed,
+                    double noise_lsb, uint32_t max_error,
+                    float target_snr_db) {
+  RadarBurstFormat format;
+  std::vector<uint8_t> data = MakeCodecBurst(
+      name, data_type, bits, is_big_endian, is_packed, noise_lsb, format);
+  radar_dsp::LossyConfig config;
+  config.max_error = max_error;
+  config.target_snr_db = target_snr_db;
+  std::vector<uint8_t> encoded;
+  std::vector<uint8_t> decoded(data.size());
+  double encode_seconds = Measure([&] {
+    RadarReturnCode rc = radar_dsp::EncodeLossy(format, data.data(),
+                                                data.size(), config, encoded);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to encode %s", name);
+  });
+  double decode_seconds = Measure([&] {
+    RadarReturnCode rc = radar_dsp::DecodeBurst(
+        format, encoded.data(), encoded.size(), decoded.data(),
+        decoded.size());
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to decode %s", name);
+  });
+
+  radar_dsp::SampleLayout layout;
+  radar_dsp::GetSampleLayout(format, layout);
+  const size_t count =
+      radar_dsp::GetNumSamples(format, data.size()) * layout.components;
+  std::vector<float> original(count);
+  std::vector<float> restored(count);
+  radar_dsp::UnpackSamples(format, data.data(), data.size(), original.data());
+  radar_dsp::UnpackSamples(format, decoded.data(), decoded.size(),
+                           restored.data());
+  double mean = 0.0;
+  for (float value : original) {
+    mean += value;
+  }
+  mean /= count;
+  double signal = 0.0;
+  double error = 0.0;
+  float largest_error = 0.0f;
+  for (size_t i = 0; i < count; ++i) {
+    const double difference = restored[i] - original[i];
+    signal += (original[i] - mean) * (original[i] - mean);
+    error += difference * difference;
+    largest_error =
+        std::max(largest_error, std::fabs(restored[i] - original[i]));
+  }
+  QCHECK(max_error == 0 || largest_error <= max_error,
+         "Error of %s is %.0f, larger than %u", name, largest_error,
+         max_error);
+  const double snr_db =
+      error > 0.0 ? 10.0 * std::log10(signal / error) : INFINITY;
+  QCHECK(snr_db >= target_snr_db - 1.0,
+         "SNR of %s is %.1f dB, lower than %.1f dB", name, snr_db,
+         target_snr_db);
+  ILOG("lossy %-10s e %-3u SNR %4.1f dB: encode %6.1f, decode %6.1f MB/s, "
+       "%5.2f times smaller, max error %.0f, SNR %.1f dB", name, max_error,
+       target_snr_db, data.size() / encode_seconds / 1e6,
+       data.size() / decode_seconds / 1e6,
+       static_cast<double>(data.size()) / encoded.size(), largest_error,
+       snr_db);
+}
+
+void BenchmarkTranspose(uint8_t num_channels, uint16_t chirps,
+                        uint16_t samples) {
+  RadarBurstFormat format = MakeFormat(RSAMPLE_DTYPE_CINT, 32, false);
+  format.num_channels = num_channels;
+  format.is_channels_interleaved = true;
+  format.custom.fmcw.chirps_per_burst = chirps;
+  format.custom.fmcw.samples_per_chirp = samples;
+
+  // Several bursts so the data does not stay in cache between repeats.
+  const size_t num_bursts = 64;
+  size_t burst_size = static_cast<size_t>(num_channels) * chirps * samples;
+  std::vector<std::complex<float>> input(burst_size * num_bursts);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = std::complex<float>(static_cast<float>(i), -1.0f);
+  }
+  std::vector<std::complex<float>> expected(input.size());
+  std::vector<std::complex<float>> output(input.size());
+
+  const radar_dsp::CubeLayout layouts[] = {
+    radar_dsp::CubeLayout::kChannelChirpSample,
+    radar_dsp::CubeLayout::kChannelSampleChirp,
+  };
+  for (radar_dsp::CubeLayout layout : layouts) {
+    bool per_chirp = layout == radar_dsp::CubeLayout::kChannelChirpSample;
+    double naive_seconds = Measure([&] {
+      for (size_t b = 0; b < num_bursts; ++b) {
+        const std::complex<float>* src = &input[b * burst_size];
+        std::complex<float>* dst = &expected[b * burst_size];
+        for (size_t ch = 0; ch < num_channels; ++ch) {
+          for (size_t c = 0; c < chirps; ++c) {
+            for (size_t s = 0; s < samples; ++s) {
+              size_t index = per_chirp ? (ch * chirps + c) * samples + s
+                                       : (ch * samples + s) * chirps + c;
+              dst[index] = src[(c * samples + s) * num_channels + ch];
+            }
+          }
+        }
+      }
+    });
+    double seconds = Measure([&] {
+      for (size_t b = 0; b < num_bursts; ++b) {
+        RadarReturnCode rc = radar_dsp::TransposeToCube(
+            format, &input[b * burst_size], burst_size,
+            &output[b * burst_size], layout);
+        QCHECK_EQ(rc, RC_OK, "%d", "Failed to transpose");
+      }
+    });
+    QCHECK(output == expected, "Transposed cube differs");
+    ILOG("transpose %ux%ux%u to %s: naive %.1f us, blocked %.1f us per burst",
+         num_channels, chirps, samples,
+         per_chirp ? "chirps" : "range bins",
+         naive_seconds / num_bursts * 1e6, seconds / num_bursts * 1e6);
+  }
+}
+
+void BenchmarkPlanarUnpack(const char* name, RadarSampleDType data_type,
+                           uint8_t bits, bool packed, uint8_t num_channels) {
+  RadarBurstFormat format = MakeFormat(data_type, bits, false);
+  format.sample_packing = packed ? RSAMPLE_PACKING_PACKED
+                                 : RSAMPLE_PACKING_PADDED;
+  format.num_channels = num_channels;
+  format.is_channels_interleaved = true;
+  format.custom.fmcw.chirps_per_burst = 128;
+  format.custom.fmcw.samples_per_chirp = 256;
+  size_t num_samples = static_cast<size_t>(num_channels) * 128 * 256;
+  std::vector<uint8_t> data = RandomBytes(
+      radar_dsp::GetBurstBytes(format, num_samples));
+
+  std::vector<std::complex<float>> samples;
+  std::vector<std::complex<float>> expected(num_samples);
+  double two_pass_seconds = Measure([&] {
+    radar_dsp::UnpackSamples(format, data, samples);
+    RadarReturnCode rc = radar_dsp::TransposeToCube(
+        format, samples.data(), samples.size(), expected.data(),
+        radar_dsp::CubeLayout::kChannelChirpSample);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to transpose %s", name);
+  });
+  std::vector<std::complex<float>> planar;
+  double planar_seconds = Measure([&] {
+    RadarReturnCode rc = radar_dsp::UnpackSamplesPlanar(format, data,
+                                                        planar);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to unpack %s planar", name);
+  });
+  QCHECK(planar == expected, "Planar unpacking of %s differs", name);
+  ILOG("planar %-8s x%u: unpack and transpose %.1f us, planar %.1f us "
+       "per burst", name, num_channels, two_pass_seconds * 1e6,
+       planar_seconds * 1e6);
+}
+
+// Get the largest difference between two spectra relative to their peak.
+template <typename T>
+float GetRelativeError(const std::vector<T>& result,
+                       const std::vector<T>& expected) {
+  float peak = 0.0f;
+  float error = 0.0f;
+  for (size_t i = 0; i < expected.size(); ++i) {
+    peak = std::max(peak, std::abs(expected[i]));
+    error = std::max(error, std::abs(result[i] - expected[i]));
+  }
+  return peak > 0.0f ? error / peak : error;
+}
+
+void BenchmarkRangeFft(uint8_t num_channels, uint16_t chirps,
+                       uint16_t samples, bool is_complex) {
+  RadarBurstFormat format = is_complex
+      ? MakeFormat(RSAMPLE_DTYPE_CINT, 32, false)
+      : MakeFormat(RSAMPLE_DTYPE_INT, 16, false);
+  format.num_channels = num_channels;
+  format.custom.fmcw.chirps_per_burst = chirps;
+  format.custom.fmcw.samples_per_chirp = samples;
+  const int components = is_complex ? 2 : 1;
+
+  // Several bursts so the data does not stay in cache between repeats.
+  const size_t num_bursts = 16;
+  size_t burst_bytes = static_cast<size_t>(num_channels) * chirps * samples *
+                       components * sizeof(int16_t);
+  std::vector<uint8_t> data = RandomBytes(burst_bytes * num_bursts);
+  radar_dsp::RangeFft range_fft(radar_dsp::WindowType::kHann);
+  radar_dsp::CubeShape shape;
+  std::vector<std::complex<float>> expected;
+  std::vector<std::complex<float>> output;
+
+  // The first burst plans the chirp size.
+  auto start = std::chrono::steady_clock::now();
+  RadarReturnCode rc = range_fft.Process(format, data.data(), burst_bytes,
+                                         expected, shape);
+  std::chrono::duration<double> plan_seconds =
+      std::chrono::steady_clock::now() - start;
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to process the range FFT");
+
+  // Check the first chirp of the scalar FFT against a plain DFT.
+  radar_dsp::SetSimdLevel(radar_dsp::SimdLevel::kScalar);
+  range_fft.Process(format, data.data(), burst_bytes, expected, shape);
+  std::vector<float> samples_float(
+      static_cast<size_t>(num_channels) * chirps * samples * components);
+  radar_dsp::UnpackSamples(format, data.data(), burst_bytes,
+                           samples_float.data());
+  std::vector<float> window = radar_dsp::MakeWindow(
+      radar_dsp::WindowType::kHann, samples);
+  size_t fft_size = radar_dsp::NextPowerOfTwo(samples);
+  std::vector<std::complex<float>> dft(shape.num_samples);
+  for (size_t k = 0; k < dft.size(); ++k) {
+    std::complex<double> sum = 0.0;
+    for (size_t i = 0; i < samples; ++i) {
+      std::complex<double> value =
+          is_complex ? std::complex<double>(samples_float[2 * i],
+                                            samples_float[2 * i + 1])
+                     : std::complex<double>(samples_float[i], 0.0);
+      sum += value * static_cast<double>(window[i]) *
+             std::polar(1.0, -2.0 * kPi * k * i / fft_size);
+    }
+    dft[k] = std::complex<float>(sum);
+  }
+  std::vector<std::complex<float>> first_chirp(
+      expected.begin(), expected.begin() + dft.size());
+  float dft_error = GetRelativeError(first_chirp, dft);
+  QCHECK(dft_error < 1e-5f, "Range FFT differs from the DFT by %g",
+         dft_error);
+
+  for (radar_dsp::SimdLevel level : kLevels) {
+    if (level > radar_dsp::DetectSimdLevel()) {
+      continue;
+    }
+    radar_dsp::SetSimdLevel(level);
+    double seconds = Measure([&] {
+      for (size_t b = 0; b < num_bursts; ++b) {
+        rc = range_fft.Process(format, &data[b * burst_bytes], burst_bytes,
+                               output, shape);
+      }
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to process the range FFT");
+    });
+    // FMA rounds differently, so the levels are not bit exact.
+    range_fft.Process(format, data.data(), burst_bytes, output, shape);
+    float error = GetRelativeError(output, expected);
+    QCHECK(error < 1e-5f, "Range FFT with %s differs by %g",
+           radar_dsp::GetSimdLevelName(level), error);
+    ILOG("range fft %s %ux%ux%u %-8s %7.1f us per burst, %6.2f Mchirps/s, "
+         "first burst %.1f us", is_complex ? "complex" : "real",
+         num_channels, chirps, samples, radar_dsp::GetSimdLevelName(level),
+         seconds / num_bursts * 1e6,
+         num_bursts * num_channels * chirps / seconds / 1e6,
+         plan_seconds.count() * 1e6);
+  }
+  radar_dsp::SetSimdLevel(radar_dsp::DetectSimdLevel());
+}
+
+void BenchmarkFixedRangeFft(uint8_t num_channels, uint16_t chirps,
+                            uint16_t samples, uint8_t bits,
+                            bool is_complex) {
+  RadarBurstFormat format = is_complex
+      ? MakeFormat(RSAMPLE_DTYPE_CINT, 2 * bits, false)
+      : MakeFormat(RSAMPLE_DTYPE_INT, bits, false);
+  format.num_channels = num_channels;
+  format.custom.fmcw.chirps_per_burst = chirps;
+  format.custom.fmcw.samples_per_chirp = samples;
+  const int components = is_complex ? 2 : 1;
+
+  const size_t num_bursts = 16;
+  size_t burst_bytes = static_cast<size_t>(num_channels) * chirps * samples *
+                       components * sizeof(int16_t);
+  std::vector<uint8_t> data = RandomBytes(burst_bytes * num_bursts);
+  radar_dsp::RangeFft range_fft(radar_dsp::WindowType::kHann);
+  radar_dsp::CubeShape shape;
+  std::vector<std::complex<float>> expected;
+  RadarReturnCode rc = range_fft.Process(format, data.data(), burst_bytes,
+                                         expected, shape);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to process the range FFT");
+  double float_seconds = Measure([&] {
+    for (size_t b = 0; b < num_bursts; ++b) {
+      range_fft.Process(format, &data[b * burst_bytes], burst_bytes,
+                        expected, shape);
+    }
+  });
+  range_fft.Process(format, data.data(), burst_bytes, expected, shape);
+
+  // The levels compute the same bits as the scalar kernels, which are
+  // compared with the float path chirp by chirp.
+  radar_dsp::FixedRangeFft fixed_fft(radar_dsp::WindowType::kHann);
+  radar_dsp::FixedRangeCube reference;
+  radar_dsp::FixedRangeCube range_cube;
+  std::vector<std::complex<float>> output;
+  std::vector<uint32_t> power;
+  for (radar_dsp::SimdLevel level : kLevels) {
+    if (level > radar_dsp::DetectSimdLevel()) {
+      continue;
+    }
+    radar_dsp::SetSimdLevel(level);
+    rc = fixed_fft.Process(format, data.data(), burst_bytes, range_cube);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to process the fixed-point FFT");
+    if (level == radar_dsp::SimdLevel::kScalar) {
+      reference = range_cube;
+      radar_dsp::ConvertRangeCube(range_cube, output);
+      float max_error = 0.0f;
+      for (size_t chirp = 0; chirp < range_cube.exponents.size(); ++chirp) {
+        size_t first = chirp * shape.num_samples;
+        std::vector<std::complex<float>> row(
+            output.begin() + first,
+            output.begin() + first + shape.num_samples);
+        std::vector<std::complex<float>> expected_row(
+            expected.begin() + first,
+            expected.begin() + first + shape.num_samples);
+        max_error = std::max(max_error, GetRelativeError(row, expected_row));
+      }
+      QCHECK(max_error < 1e-3f, "Fixed-point FFT differs by %g", max_error);
+      ILOG("fixed range fft %s int%u %ux%ux%u differs by %.1f dB of the peak",
+           is_complex ? "complex" : "real", bits, num_channels, chirps,
+           samples, 20.0 * std::log10(max_error));
+    }
+    QCHECK(range_cube.bins == reference.bins &&
+           range_cube.exponents == reference.exponents,
+           "Fixed-point FFT with %s differs from scalar",
+           radar_dsp::GetSimdLevelName(level));
+
+    double seconds = Measure([&] {
+      for (size_t b = 0; b < num_bursts; ++b) {
+        rc = fixed_fft.Process(format, &data[b * burst_bytes], burst_bytes,
+                               range_cube);
+      }
+    });
+    double power_seconds = Measure([&] {
+      radar_dsp::GetRangePower(range_cube, power);
+    });
+    ILOG("fixed range fft %s int%u %ux%ux%u %-8s %7.1f us per burst, "
+         "float %7.1f us, power %5.1f us", is_complex ? "complex" : "real",
+         bits, num_channels, chirps, samples,
+         radar_dsp::GetSimdLevelName(level), seconds / num_bursts * 1e6,
+         float_seconds / num_bursts * 1e6, power_seconds * 1e6);
+  }
+  radar_dsp::SetSimdLevel(radar_dsp::DetectSimdLevel());
+}
+
+void BenchmarkRangeDoppler(uint8_t num_channels, uint16_t chirps,
+                           uint16_t samples) {
+  RadarBurstFormat format = MakeFormat(RSAMPLE_DTYPE_CINT, 32, false);
+  format.num_channels = num_channels;
+  format.custom.fmcw.chirps_per_burst = chirps;
+  format.custom.fmcw.samples_per_chirp = samples;
+
+  const size_t num_bursts = 8;
+  size_t burst_bytes = static_cast<size_t>(num_channels) * chirps * samples *
+                       2 * sizeof(int16_t);
+  std::vector<uint8_t> data = RandomBytes(burst_bytes * num_bursts);
+  radar_dsp::RangeFft range_fft(radar_dsp::WindowType::kHann);
+  radar_dsp::RangeDoppler range_doppler(radar_dsp::WindowType::kHann,
+                                        radar_dsp::WindowType::kHann, true);
+  radar_dsp::CubeShape range_shape;
+  radar_dsp::CubeShape shape;
+  std::vector<std::complex<float>> range_cube;
+  std::vector<float> expected;
+  std::vector<float> output;
+
+  // Check a range bin of the scalar map against a plain DFT of the chirps.
+  radar_dsp::SetSimdLevel(radar_dsp::SimdLevel::kScalar);
+  RadarReturnCode rc = range_doppler.Process(format, data.data(),
+                                             burst_bytes, expected, shape);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to process the range-Doppler map");
+  range_fft.Process(format, data.data(), burst_bytes, range_cube,
+                    range_shape);
+  std::vector<float> window = radar_dsp::MakeWindow(
+      radar_dsp::WindowType::kHann, chirps);
+  const size_t range_bin = range_shape.num_samples / 3;
+  std::vector<float> dft(shape.num_chirps, 0.0f);
+  for (size_t ch = 0; ch < num_channels; ++ch) {
+    for (size_t d = 0; d < dft.size(); ++d) {
+      double frequency = static_cast<double>(d) - dft.size() / 2;
+      std::complex<double> sum = 0.0;
+      for (size_t c = 0; c < chirps; ++c) {
+        std::complex<double> value(range_cube[
+            (ch * chirps + c) * range_shape.num_samples + range_bin]);
+        sum += value * static_cast<double>(window[c]) *
+               std::polar(1.0, -2.0 * kPi * frequency * c / dft.size());
+      }
+      dft[d] += static_cast<float>(std::abs(sum));
+    }
+  }
+  std::vector<float> row(expected.begin() + range_bin * shape.num_chirps,
+                         expected.begin() + (range_bin + 1) *
+                                                shape.num_chirps);
+  float dft_error = GetRelativeError(row, dft);
+  QCHECK(dft_error < 1e-5f, "Range-Doppler map differs from the DFT by %g",
+         dft_error);
+
+  for (radar_dsp::SimdLevel level : kLevels) {
+    if (level > radar_dsp::DetectSimdLevel()) {
+      continue;
+    }
+    radar_dsp::SetSimdLevel(level);
+    double range_seconds = Measure([&] {
+      for (size_t b = 0; b < num_bursts; ++b) {
+        rc = range_fft.Process(format, &data[b * burst_bytes], burst_bytes,
+                               range_cube, range_shape);
+      }
+    });
+    double seconds = Measure([&] {
+      for (size_t b = 0; b < num_bursts; ++b) {
+        rc = range_doppler.Process(format, &data[b * burst_bytes],
+                                   burst_bytes, output, shape);
+      }
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to process the range-Doppler map");
+    });
+    range_doppler.Process(format, data.data(), burst_bytes, output, shape);
+    float error = GetRelativeError(output, expected);
+    QCHECK(error < 1e-5f, "Range-Doppler map with %s differs by %g",
+           radar_dsp::GetSimdLevelName(level), error);
+    ILOG("range-doppler %ux%ux%u %-8s %7.1f us per burst, range fft %7.1f us",
+         num_channels, chirps, samples, radar_dsp::GetSimdLevelName(level),
+         seconds / num_bursts * 1e6, range_seconds / num_bursts * 1e6);
+  }
+  radar_dsp::SetSimdLevel(radar_dsp::DetectSimdLevel());
+}
+
+// Range-Doppler maps of bursts split across a thread pool, and of whole
+// bursts spread across it, compared with the maps of a single thread.
+void BenchmarkThreadPool(uint8_t num_channels, uint16_t chirps,
+                         uint16_t samples) {
+  RadarBurstFormat format = MakeFormat(RSAMPLE_DTYPE_CINT, 32, false);
+  format.num_channels = num_channels;
+  format.custom.fmcw.chirps_per_burst = chirps;
+  format.custom.fmcw.samples_per_chirp = samples;
+
+  const size_t num_bursts = 8;
+  size_t burst_bytes = static_cast<size_t>(num_channels) * chirps * samples *
+                       2 * sizeof(int16_t);
+  std::vector<uint8_t> data = RandomBytes(burst_bytes * num_bursts);
+  radar_utils::ThreadPoolConfig pool_config;
+  pool_config.num_workers =
+      std::max(2u, std::thread::hardware_concurrency()) - 1;
+  radar_utils::ThreadPool pool(pool_config);
+  const size_t num_threads = pool.GetNumThreads();
+  std::vector<radar_dsp::RangeFft> range_ffts(
+      num_threads, radar_dsp::RangeFft(radar_dsp::WindowType::kHann));
+  std::vector<radar_dsp::RangeDoppler> range_dopplers(
+      num_threads, radar_dsp::RangeDoppler(radar_dsp::WindowType::kHann,
+                                           radar_dsp::WindowType::kHann,
+                                           true));
+
+  // Maps of a single thread.
+  radar_dsp::CubeShape chirp_shape;
+  radar_dsp::CubeShape shape;
+  std::vector<std::vector<float>> expected(num_bursts);
+  for (size_t b = 0; b < num_bursts; ++b) {
+    RadarReturnCode rc = range_dopplers[0].Process(
+        format, &data[b * burst_bytes], burst_bytes, expected[b], shape);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to process the range-Doppler map");
+  }
+  radar_dsp::GetCubeShape(format, chirp_shape);
+  QCHECK(radar_dsp::GetBurstLayout(format) ==
+         radar_dsp::CubeLayout::kChannelChirpSample,
+         "Bursts are not laid out as chirp cubes");
+  const radar_dsp::CubeShape& range_shape = range_dopplers[0].GetRangeShape();
+
+  // Split every burst, chirps for the range FFT and blocks of 8 range bins
+  // for the Doppler FFT.
+  std::vector<std::complex<float>> chirp_cube(chirp_shape.Size());
+  std::vector<std::complex<float>> range_cube(range_shape.Size());
+  std::vector<float> map(shape.Size());
+  const size_t num_rows = static_cast<size_t>(num_channels) * chirps;
+  const size_t num_blocks = (range_shape.num_samples + 7) / 8;
+  auto transform_range = [&](size_t begin, size_t end) {
+    radar_dsp::CubeShape rows = {1, static_cast<uint32_t>(end - begin),
+                                 chirp_shape.num_samples};
+    range_ffts[pool.GetThreadIndex()].Process(
+        rows, &chirp_cube[begin * chirp_shape.num_samples],
+        &range_cube[begin * range_shape.num_samples]);
+  };
+  auto transform_doppler = [&](size_t begin, size_t end) {
+    size_t first_bin = begin * 8;
+    size_t end_bin = std::min<size_t>(end * 8, range_shape.num_samples);
+    range_dopplers[pool.GetThreadIndex()].Process(
+        range_shape, range_cube.data(), map.data(), first_bin,
+        end_bin - first_bin);
+  };
+  auto process_split = [&](size_t b) {
+    radar_dsp::UnpackSamples(format, &data[b * burst_bytes], burst_bytes,
+                             reinterpret_cast<float*>(chirp_cube.data()));
+    pool.ParallelFor(0, num_rows, 0, transform_range);
+    pool.ParallelFor(0, num_blocks, 0, transform_doppler);
+  };
+  for (size_t b = 0; b < num_bursts; ++b) {
+    process_split(b);
+    QCHECK(map == expected[b], "Split map of burst %zu differs", b);
+  }
+  double split_seconds = Measure([&] {
+    for (size_t b = 0; b < num_bursts; ++b) {
+      process_split(b);
+    }
+  });
+
+  // Spread whole bursts, every burst preferably on the same worker.
+  std::vector<std::vector<float>> maps(num_bursts);
+  std::vector<radar_dsp::CubeShape> shapes(num_bursts);
+  auto process_burst = [&](size_t b) {
+    range_dopplers[pool.GetThreadIndex()].Process(
+        format, &data[b * burst_bytes], burst_bytes, maps[b], shapes[b]);
+  };
+  auto process_all = [&] {
+    radar_utils::TaskGroup group;
+    for (size_t b = 0; b < num_bursts; ++b) {
+      pool.Submit(group, process_burst, b, 1 + b % pool.GetNumWorkers());
+    }
+    pool.Wait(group);
+  };
+  process_all();
+  QCHECK(maps == expected, "Maps of the spread bursts differ");
+  double spread_seconds = Measure(process_all);
+
+  double serial_seconds = Measure([&] {
+    for (size_t b = 0; b < num_bursts; ++b) {
+      range_dopplers[0].Process(format, &data[b * burst_bytes], burst_bytes,
+                                map, shape);
+    }
+  });
+  ILOG("thread pool %ux%ux%u %zu threads, one thread %7.1f us per burst, "
+       "split %7.1f us, spread %7.1f us", num_channels, chirps, samples,
+       num_threads, serial_seconds / num_bursts * 1e6,
+       split_seconds / num_bursts * 1e6, spread_seconds / num_bursts * 1e6);
+}
+
+// Gate energy of the straightforward sweep processing of bursts, keeping
+// the background across them.
+void GetGateEnergy(const std::vector<std::complex<float>>& samples,
+                   size_t num_channels, size_t num_sweeps, size_t num_samples,
+                   const radar_dsp::SweepConfig& config, size_t start_offset,
+                   std::vector<std::complex<double>>& background,
+                   std::vector<float>& energy) {
+  const long num_taps = static_cast<long>(config.pulse.size());
+  const long lead = (num_taps - 1) / 2;
+  const size_t first_gate = start_offset / config.gate_bins;
+  const size_t num_gates =
+      (start_offset + num_samples - 1) / config.gate_bins - first_gate + 1;
+  const bool init_background = background.empty();
+  background.resize(num_channels * num_samples);
+  energy.assign(num_channels * num_gates, 0.0f);
+  std::vector<std::complex<double>> filtered(num_samples);
+  for (size_t c = 0; c < num_channels; ++c) {
+    for (size_t s = 0; s < num_sweeps; ++s) {
+      const std::complex<float>* sweep =
+          &samples[(c * num_sweeps + s) * num_samples];
+      for (long n = 0; n < static_cast<long>(num_samples); ++n) {
+        // Without a pulse the sweeps are not filtered.
+        std::complex<double> sum =
+            num_taps > 0 ? 0.0 : std::complex<double>(sweep[n]);
+        for (long j = 0; j < num_taps; ++j) {
+          long i = n + j - lead;
+          if (i >= 0 && i < static_cast<long>(num_samples)) {
+            sum += std::conj(std::complex<double>(config.pulse[j])) *
+                   std::complex<double>(sweep[i]);
+          }
+        }
+        filtered[n] = sum;
+      }
+      for (size_t n = 0; n < num_samples; ++n) {
+        std::complex<double>& b = background[c * num_samples + n];
+        if (init_background && s == 0) {
+          b = filtered[n];
+        }
+        std::complex<double> value = filtered[n] - b;
+        b += static_cast<double>(config.background_weight) * value;
+        energy[c * num_gates + (start_offset + n) / config.gate_bins -
+               first_gate] += static_cast<float>(std::norm(value));
+      }
+    }
+  }
+}
+
+void BenchmarkSweeps(const char* name, RadarType radar_type,
+                     uint8_t num_channels, uint16_t sweeps, uint16_t samples,
+                     size_t num_taps, uint32_t start_offset) {
+  RadarBurstFormat format = MakeFormat(RSAMPLE_DTYPE_CINT, 32, false);
+  format.radar_type = radar_type;
+  format.num_channels = num_channels;
+  if (radar_type == RTYPE_UWB) {
+    format.custom.uwb.sweeps_per_burst = sweeps;
+    format.custom.uwb.samples_per_sweep = samples;
+  } else {
+    format.custom.pusled.sweeps_per_burst = sweeps;
+    format.custom.pusled.samples_per_sweep = samples;
+  }
+
+  const size_t num_bursts = 8;
+  size_t burst_bytes = static_cast<size_t>(num_channels) * sweeps * samples *
+                       2 * sizeof(int16_t);
+  std::vector<uint8_t> data = RandomBytes(burst_bytes * num_bursts);
+  radar_dsp::SweepConfig config;
+  for (size_t j = 0; j < num_taps; ++j) {
+    config.pulse.push_back(std::polar(
+        static_cast<float>(std::sin(kPi * (j + 0.5) / num_taps)),
+        static_cast<float>(kPi * j * j / num_taps)));
+  }
+  config.gate_bins = 4;
+
+  // Check two bursts against the straightforward processing, the second
+  // one subtracting the background left by the first.
+  std::vector<std::complex<double>> background;
+  std::vector<float> expected;
+  std::vector<std::complex<float>> unpacked;
+  for (size_t b = 0; b < 2; ++b) {
+    std::vector<uint8_t> burst(&data[b * burst_bytes],
+                               &data[(b + 1) * burst_bytes]);
+    radar_dsp::UnpackSamples(format, burst, unpacked);
+    GetGateEnergy(unpacked, num_channels, sweeps, samples, config,
+                  start_offset, background, expected);
+  }
+
+  radar_dsp::GateEnergy gates;
+  for (radar_dsp::SimdLevel level : kLevels) {
+    if (level > radar_dsp::DetectSimdLevel()) {
+      continue;
+    }
+    radar_dsp::SetSimdLevel(level);
+    radar_dsp::SweepProcessor processor(config);
+    processor.SetStartOffset(format.config_id, start_offset);
+    RadarReturnCode rc = RC_OK;
+    for (size_t b = 0; b < 2; ++b) {
+      rc = processor.Process(format, &data[b * burst_bytes], burst_bytes,
+                             gates);
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to process the sweeps");
+    }
+    QCHECK_EQ(gates.first_gate, start_offset / config.gate_bins, "%u",
+              "Wrong first gate");
+    float error = GetRelativeError(gates.energy, expected);
+    QCHECK(error < 1e-4f, "Sweeps %s with %s differ by %g", name,
+           radar_dsp::GetSimdLevelName(level), error);
+
+    double seconds = Measure([&] {
+      for (size_t b = 0; b < num_bursts; ++b) {
+        rc = processor.Process(format, &data[b * burst_bytes], burst_bytes,
+                               gates);
+      }
+    });
+    ILOG("sweeps %-6s %ux%ux%u %2zu taps %-8s %7.1f us per burst", name,
+         num_channels, sweeps, samples, num_taps,
+         radar_dsp::GetSimdLevelName(level), seconds / num_bursts * 1e6);
+  }
+  radar_dsp::SetSimdLevel(radar_dsp::DetectSimdLevel());
+}
+
+// Range cubes after the straightforward clutter removal of bursts, keeping
+// the background, or the previous burst for MTI, across them.
+void RemoveClutter(std::vector<std::complex<float>>& cube,
+                   size_t num_channels, size_t num_chirps, size_t num_bins,
+                   const radar_dsp::ClutterConfig& config,
+                   std::vector<std::complex<double>>& background) {
+  const bool is_first = background.empty();
+  std::vector<std::complex<double>> input(cube.begin(), cube.end());
+  if (config.type == radar_dsp::ClutterFilterType::kMti) {
+    const size_t lag = config.mti_lag;
+    for (size_t c = 0; c < num_channels; ++c) {
+      for (size_t n = 0; n < num_chirps; ++n) {
+        for (size_t k = 0; k < num_bins; ++k) {
+          size_t index = (c * num_chirps + n) * num_bins + k;
+          std::complex<double> previous;
+          if (n >= lag) {
+            previous = input[index - lag * num_bins];
+          } else if (is_first) {
+            previous = input[index];
+          } else {
+            previous = background[index + (num_chirps - lag) * num_bins];
+          }
+          cube[index] = std::complex<float>(input[index] - previous);
+        }
+      }
+    }
+    background = input;
+    return;
+  }
+  background.resize(num_channels * num_bins);
+  const double weight = is_first ? 1.0 : config.weight;
+  for (size_t c = 0; c < num_channels; ++c) {
+    for (size_t k = 0; k < num_bins; ++k) {
+      std::complex<double> mean;
+      for (size_t n = 0; n < num_chirps; ++n) {
+        mean += input[(c * num_chirps + n) * num_bins + k];
+      }
+      mean /= static_cast<double>(num_chirps);
+      std::complex<double>& b = background[c * num_bins + k];
+      b += weight * (mean - b);
+      for (size_t n = 0; n < num_chirps; ++n) {
+        size_t index = (c * num_chirps + n) * num_bins + k;
+        cube[index] = std::complex<float>(input[index] - b);
+      }
+    }
+  }
+}
+
+void BenchmarkClutter(const char* name, const radar_dsp::ClutterConfig& config,
+                      uint32_t num_channels, uint32_t chirps, uint32_t bins) {
+  radar_dsp::CubeShape shape;
+  shape.num_channels = num_channels;
+  shape.num_chirps = chirps;
+  shape.num_samples = bins;
+
+  // Static returns of every range bin, plus noise varying chirp by chirp.
+  const size_t num_bursts = 8;
+  std::mt19937 generator(shape.Size());
+  std::normal_distribution<float> noise(0.0f, 0.1f);
+  std::vector<std::complex<float>> clutter(num_channels * bins);
+  for (std::complex<float>& value : clutter) {
+    value = std::complex<float>(10.0f * noise(generator),
+                                10.0f * noise(generator));
+  }
+  std::vector<std::complex<float>> cubes(shape.Size() * num_bursts);
+  for (size_t i = 0; i < cubes.size(); ++i) {
+    size_t channel = i / (chirps * bins) % num_channels;
+    cubes[i] = clutter[channel * bins + i % bins] +
+               std::complex<float>(noise(generator), noise(generator));
+  }
+
+  // Check three bursts, the later ones using the state left by the first.
+  std::vector<std::vector<std::complex<float>>> expected;
+  std::vector<std::complex<double>> background;
+  for (size_t b = 0; b < 3; ++b) {
+    expected.emplace_back(&cubes[b * shape.Size()],
+                          &cubes[(b + 1) * shape.Size()]);
+    RemoveClutter(expected.back(), num_channels, chirps, bins, config,
+                  background);
+  }
+
+  std::vector<std::complex<float>> cube;
+  std::vector<std::complex<float>> work;
+  for (radar_dsp::SimdLevel level : kLevels) {
+    if (level > radar_dsp::DetectSimdLevel()) {
+      continue;
+    }
+    radar_dsp::SetSimdLevel(level);
+    radar_dsp::ClutterFilter filter(config);
+    RadarReturnCode rc = RC_OK;
+    for (size_t b = 0; b < 3; ++b) {
+      cube.assign(&cubes[b * shape.Size()], &cubes[(b + 1) * shape.Size()]);
+      rc = filter.Process(0, shape, cube.data());
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to remove the clutter");
+      float error = GetRelativeError(cube, expected[b]);
+      QCHECK(error < 1e-4f, "Clutter %s with %s differs by %g", name,
+             radar_dsp::GetSimdLevelName(level), error);
+    }
+
+    // The cubes are filtered in place, time a copy to keep them for
+    // the next levels.
+    work = cubes;
+    double seconds = Measure([&] {
+      for (size_t b = 0; b < num_bursts; ++b) {
+        rc = filter.Process(0, shape, &work[b * shape.Size()]);
+      }
+    });
+    ILOG("clutter %-11s %ux%ux%u %-8s %7.1f us per burst", name,
+         num_channels, chirps, bins, radar_dsp::GetSimdLevelName(level),
+         seconds / num_bursts * 1e6);
+  }
+  radar_dsp::SetSimdLevel(radar_dsp::DetectSimdLevel());
+}
+
+// Thresholds of the straightforward CFAR, visiting the whole window of
+// every cell.
+std::vector<float> GetCfarThresholds(const std::vector<float>& map,
+                                     size_t num_range_bins,
+                                     size_t num_doppler_bins,
+                                     const radar_dsp::CfarConfig& config) {
+  const long extent_range = config.guard_range + config.training_range;
+  const long extent_doppler = config.guard_doppler + config.training_doppler;
+  const long num_rows = static_cast<long>(num_range_bins);
+  const long num_cols = static_cast<long>(num_doppler_bins);
+  std::vector<float> thresholds(map.size());
+  std::vector<float> cells;
+  for (long r = 0; r < num_rows; ++r) {
+    for (long d = 0; d < num_cols; ++d) {
+      double leading = 0.0, lagging = 0.0;
+      size_t num_leading = 0, num_lagging = 0;
+      cells.clear();
+      for (long row = std::max(0L, r - extent_range);
+           row <= std::min(num_rows - 1, r + extent_range); ++row) {
+        for (long offset = -extent_doppler; offset <= extent_doppler;
+             ++offset) {
+          if (std::abs(row - r) <= config.guard_range &&
+              std::abs(offset) <= config.guard_doppler) {
+            continue;
+          }
+          float cell = map[row * num_cols + (d + offset + num_cols) % num_cols];
+          cells.push_back(cell);
+          if (row < r || (row == r && offset < 0)) {
+            leading += cell;
+            ++num_leading;
+          } else {
+            lagging += cell;
+            ++num_lagging;
+          }
+        }
+      }
+      if (cells.empty()) {
+        thresholds[r * num_cols + d] = std::numeric_limits<float>::infinity();
+        continue;
+      }
+      double noise = 0.0;
+      double lead = num_leading ? leading / num_leading : 0.0;
+      double lag = num_lagging ? lagging / num_lagging : 0.0;
+      switch (config.type) {
+        case radar_dsp::CfarType::kCellAveraging:
+          noise = (leading + lagging) / cells.size();
+          break;
+        case radar_dsp::CfarType::kGreatestOf:
+          noise = !num_leading ? lag : !num_lagging ? lead
+                                                    : std::max(lead, lag);
+          break;
+        case radar_dsp::CfarType::kSmallestOf:
+          noise = !num_leading ? lag : !num_lagging ? lead
+                                                    : std::min(lead, lag);
+          break;
+        case radar_dsp::CfarType::kOrderedStatistic: {
+          size_t rank = std::min(cells.size() - 1, static_cast<size_t>(
+                                     config.os_rank * cells.size()));
+          std::nth_element(cells.begin(), cells.begin() + rank, cells.end());
+          noise = cells[rank];
+          break;
+        }
+      }
+      thresholds[r * num_cols + d] =
+          config.threshold_scale * static_cast<float>(noise);
+    }
+  }
+  return thresholds;
+}
+
+void BenchmarkCfar(const char* name, radar_dsp::CfarType type,
+                   uint16_t guard, uint16_t training) {
+  const size_t num_range_bins = 256;
+  const size_t num_doppler_bins = 128;
+  radar_dsp::CubeShape shape = {1, num_doppler_bins, num_range_bins};
+
+  // Exponential noise with a few targets, as in a power map.
+  std::mt19937 generator(training);
+  std::exponential_distribution<float> distribution(1.0f);
+  std::vector<float> map(shape.Size());
+  for (float& cell : map) {
+    cell = distribution(generator);
+  }
+  for (size_t i = 0; i < 16; ++i) {
+    map[(i * 13 + 7) * num_doppler_bins + (i * 29) % num_doppler_bins] =
+        100.0f;
+  }
+
+  radar_dsp::CfarConfig config;
+  config.type = type;
+  config.guard_range = config.guard_doppler = guard;
+  config.training_range = config.training_doppler = training;
+  size_t window = 2 * (guard + training) + 1;
+  config.threshold_scale = radar_dsp::GetCaThresholdScale(
+      1e-4, window * window - (2 * guard + 1) * (2 * guard + 1));
+  radar_dsp::CfarDetector detector(config);
+  radar_dsp::CfarDetections detections;
+
+  std::vector<float> expected;
+  double naive_seconds = Measure([&] {
+    expected = GetCfarThresholds(map, num_range_bins, num_doppler_bins,
+                                 config);
+  });
+  for (radar_dsp::SimdLevel level : kLevels) {
+    if (level > radar_dsp::DetectSimdLevel()) {
+      continue;
+    }
+    radar_dsp::SetSimdLevel(level);
+    double seconds = Measure([&] {
+      RadarReturnCode rc = detector.Detect(map.data(), shape, detections);
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to run the CFAR");
+    });
+    float error = GetRelativeError(detector.GetThresholds(), expected);
+    QCHECK(error < 1e-5f, "CFAR %s with %s differs by %g", name,
+           radar_dsp::GetSimdLevelName(level), error);
+    ILOG("cfar %-3s %ux%u window %2zu %-8s naive %8.1f us, %7.1f us per map, "
+         "%zu detections", name, shape.num_samples, shape.num_chirps, window,
+         radar_dsp::GetSimdLevelName(level), naive_seconds * 1e6,
+         seconds * 1e6, detections.Size());
+  }
+  radar_dsp::SetSimdLevel(radar_dsp::DetectSimdLevel());
+}
+
+// A MIMO array with TX antennas spaced by the RX aperture, a third TX
+// antenna above the others adds elevation.
+radar_dsp::VirtualArray MakeVirtualArray(uint32_t num_tx) {
+  const double wavelength = 299792458.0 / 60.5e9;
+  const float tx_x[] = {0.0f, 4.0f, 2.0f};
+  const float tx_y[] = {0.0f, 0.0f, 1.0f};
+  radar_dsp::VirtualArray array;
+  array.num_tx = num_tx;
+  array.num_rx = 4;
+  array.wavelength_m = wavelength;
+  for (uint32_t tx = 0; tx < num_tx; ++tx) {
+    for (uint32_t rx = 0; rx < array.num_rx; ++rx) {
+      array.x.push_back(static_cast<float>((tx_x[tx] + rx) * wavelength / 2));
+      array.y.push_back(static_cast<float>(tx_y[tx] * wavelength / 2));
+      array.z.push_back(0.0f);
+    }
+  }
+  return array;
+}
+
+// Angles of the straightforward beamformer, computing the steering vectors
+// of every direction for every snapshot.
+void GetAngles(const radar_dsp::VirtualArray& array,
+               const radar_dsp::AngleGrid& grid, bool has_elevation,
+               const std::vector<std::complex<float>>& snapshots,
+               std::vector<float>& azimuths, std::vector<float>& elevations) {
+  const size_t num_elements = array.x.size();
+  const int num_az = static_cast<int>(grid.max_azimuth_deg /
+                                      grid.azimuth_step_deg + 1e-3f);
+  const int num_el = has_elevation ? static_cast<int>(
+      grid.max_elevation_deg / grid.elevation_step_deg + 1e-3f) : 0;
+  azimuths.clear();
+  elevations.clear();
+  for (size_t i = 0; i < snapshots.size(); i += num_elements) {
+    float best = -1.0f, best_az = 0.0f, best_el = 0.0f;
+    for (int el = -num_el; el <= num_el; ++el) {
+      for (int az = -num_az; az <= num_az; ++az) {
+        double elevation = el * grid.elevation_step_deg * kPi / 180.0;
+        double azimuth = az * grid.azimuth_step_deg * kPi / 180.0;
+        std::complex<double> sum;
+        for (size_t e = 0; e < num_elements; ++e) {
+          double phase = 2.0 * kPi / array.wavelength_m *
+              (array.x[e] * std::cos(elevation) * std::sin(azimuth) +
+               array.y[e] * std::sin(elevation) +
+               array.z[e] * std::cos(elevation) * std::cos(azimuth));
+          sum += std::polar(1.0, phase) *
+                 std::complex<double>(snapshots[i + e]);
+        }
+        float power = static_cast<float>(std::norm(sum));
+        if (power > best) {
+          best = power;
+          best_az = az * grid.azimuth_step_deg;
+          best_el = el * grid.elevation_step_deg;
+        }
+      }
+    }
+    azimuths.push_back(best_az);
+    elevations.push_back(best_el);
+  }
+}
+
+void BenchmarkBeamformer(uint32_t num_tx, size_t num_snapshots) {
+  const radar_dsp::VirtualArray array = MakeVirtualArray(num_tx);
+  const bool has_elevation = num_tx > 2;
+  const size_t num_elements = array.x.size();
+  radar_dsp::AngleGrid grid;
+  radar_dsp::Beamformer beamformer(grid);
+  RadarReturnCode rc = beamformer.SetArray(0, array);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to set the virtual array");
+
+  // Plane waves from random directions, with some noise.
+  std::mt19937 generator(num_snapshots);
+  std::uniform_real_distribution<float> azimuth(-50.0f, 50.0f);
+  std::uniform_real_distribution<float> elevation(-20.0f, 20.0f);
+  std::normal_distribution<float> noise(0.0f, 0.05f);
+  std::vector<float> azimuths, elevations;
+  std::vector<std::complex<float>> snapshots;
+  for (size_t i = 0; i < num_snapshots; ++i) {
+    azimuths.push_back(azimuth(generator));
+    elevations.push_back(has_elevation ? elevation(generator) : 0.0f);
+    double az = azimuths.back() * kPi / 180.0;
+    double el = elevations.back() * kPi / 180.0;
+    for (size_t e = 0; e < num_elements; ++e) {
+      double phase = -2.0 * kPi / array.wavelength_m *
+          (array.x[e] * std::cos(el) * std::sin(az) +
+           array.y[e] * std::sin(el));
+      snapshots.push_back(
+          std::polar(1.0f, static_cast<float>(phase + i)) +
+          std::complex<float>(noise(generator), noise(generator)));
+    }
+  }
+
+  std::vector<float> naive_azimuths, naive_elevations;
+  double naive_seconds = Measure([&] {
+    GetAngles(array, grid, has_elevation, snapshots, naive_azimuths,
+              naive_elevations);
+  });
+  radar_dsp::AngleEstimates angles;
+  for (radar_dsp::SimdLevel level : kLevels) {
+    if (level > radar_dsp::DetectSimdLevel()) {
+      continue;
+    }
+    radar_dsp::SetSimdLevel(level);
+    double seconds = Measure([&] {
+      rc = beamformer.Estimate(0, snapshots.data(), num_snapshots, angles);
+      QCHECK_EQ(rc, RC_OK, "%d", "Failed to estimate the angles");
+    });
+    QCHECK_EQ(angles.Size(), num_snapshots, "%zu", "Missing angles");
+    for (size_t i = 0; i < num_snapshots; ++i) {
+      // The grid peak is the one of the naive beamformer, interpolated by
+      // less than half a step, and close to the true direction.
+      QCHECK(std::abs(angles.azimuth_deg[i] - naive_azimuths[i]) <=
+                 0.5f * grid.azimuth_step_deg + 1e-3f &&
+             std::abs(angles.elevation_deg[i] - naive_elevations[i]) <=
+                 0.5f * grid.elevation_step_deg + 1e-3f,
+             "Beamformer with %s differs from the naive one at %zu",
+             radar_dsp::GetSimdLevelName(level), i);
+      QCHECK(std::abs(angles.azimuth_deg[i] - azimuths[i]) <
+                 grid.azimuth_step_deg &&
+             std::abs(angles.elevation_deg[i] - elevations[i]) <
+                 grid.elevation_step_deg,
+             "Beamformer with %s misses direction %zu",
+             radar_dsp::GetSimdLevelName(level), i);
+    }
+    ILOG("beamformer %ux4 %-8s naive %7.1f us, %5.1f us per snapshot",
+         num_tx, radar_dsp::GetSimdLevelName(level),
+         naive_seconds / num_snapshots * 1e6, seconds / num_snapshots * 1e6);
+  }
+  radar_dsp::SetSimdLevel(radar_dsp::DetectSimdLevel());
+}
+
+// Tracks of targets moving at constant range and azimuth rates among
+// false alarms, each level compared with the targets and the scalar tracks.
+void BenchmarkTracker(size_t num_targets, size_t num_false_alarms) {
+  const size_t num_bursts = 60;
+  const double burst_period_s = 0.05;
+  radar_dsp::TrackerConfig config;
+  config.burst_period_s = burst_period_s;
+  std::mt19937 generator(num_targets);
+  std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+  std::normal_distribution<float> noise(0.0f, 1.0f);
+  std::vector<float> ranges, velocities, azimuths, azimuth_rates;
+  for (size_t i = 0; i < num_targets; ++i) {
+    ranges.push_back(5.0f + 35.0f * uniform(generator));
+    velocities.push_back(-2.0f + 4.0f * uniform(generator));
+    azimuths.push_back(-50.0f + 100.0f * uniform(generator));
+    azimuth_rates.push_back(-5.0f + 10.0f * uniform(generator));
+  }
+
+  // Every target is detected 9 times out of 10.
+  std::vector<radar_dsp::TargetDetections> bursts(num_bursts);
+  for (size_t b = 0; b < num_bursts; ++b) {
+    float t = static_cast<float>(b * burst_period_s);
+    radar_dsp::TargetDetections& detections = bursts[b];
+    for (size_t i = 0; i < num_targets; ++i) {
+      if (uniform(generator) < 0.1f) {
+        continue;
+      }
+      detections.range_m.push_back(ranges[i] + velocities[i] * t +
+                                   config.range_sigma_m * noise(generator));
+      detections.velocity_mps.push_back(
+          velocities[i] + config.velocity_sigma_mps * noise(generator));
+      detections.azimuth_deg.push_back(
+          azimuths[i] + azimuth_rates[i] * t +
+          config.azimuth_sigma_deg * noise(generator));
+    }
+    for (size_t i = 0; i < num_false_alarms; ++i) {
+      detections.range_m.push_back(50.0f * uniform(generator));
+      detections.velocity_mps.push_back(-5.0f + 10.0f * uniform(generator));
+      detections.azimuth_deg.push_back(-60.0f + 120.0f * uniform(generator));
+    }
+  }
+
+  RadarBurstFormat format = MakeFormat(RSAMPLE_DTYPE_CINT, 32, false);
+  radar_dsp::Tracks expected;
+  for (radar_dsp::SimdLevel level : kLevels) {
+    if (level > radar_dsp::DetectSimdLevel()) {
+      continue;
+    }
+    radar_dsp::SetSimdLevel(level);
+    radar_dsp::Tracks tracks;
+    double seconds = Measure([&] {
+      radar_dsp::Tracker tracker(config);
+      for (size_t b = 0; b < num_bursts; ++b) {
+        format.sequence_number = static_cast<uint32_t>(b);
+        RadarReturnCode rc = tracker.Process(format, bursts[b]);
+        QCHECK_EQ(rc, RC_OK, "%d", "Failed to track burst %zu", b);
+      }
+      tracks = tracker.GetTracks();
+    });
+
+    // Every target has a confirmed track close to it at the last burst.
+    float t = static_cast<float>((num_bursts - 1) * burst_period_s);
+    size_t num_confirmed = 0;
+    for (size_t k = 0; k < tracks.Size(); ++k) {
+      num_confirmed += tracks.is_confirmed[k];
+    }
+    size_t num_tracked = 0;
+    for (size_t i = 0; i < num_targets; ++i) {
+      for (size_t k = 0; k < tracks.Size(); ++k) {
+        if (tracks.is_confirmed[k] &&
+            std::abs(tracks.range_m[k] - ranges[i] - velocities[i] * t) <
+                0.2f &&
+            std::abs(tracks.velocity_mps[k] - velocities[i]) < 0.3f &&
+            std::abs(tracks.azimuth_deg[k] - azimuths[i] -
+                     azimuth_rates[i] * t) < 4.0f) {
+          ++num_tracked;
+          break;
+        }
+      }
+    }
+    // Crossing targets may briefly split into a second track.
+    QCHECK(num_tracked >= num_targets * 98 / 100 &&
+           num_confirmed <= num_targets + num_targets / 20,
+           "Tracker with %s tracks %zu of %zu targets with %zu tracks",
+           radar_dsp::GetSimdLevelName(level), num_tracked, num_targets,
+           num_confirmed);
+    if (level == radar_dsp::SimdLevel::kScalar) {
+      expected = tracks;
+    }
+    QCHECK(tracks.id == expected.id &&
+           GetRelativeError(tracks.range_m, expected.range_m) < 1e-5f &&
+           GetRelativeError(tracks.azimuth_deg, expected.azimuth_deg) < 1e-5f,
+           "Tracks with %s differ from the scalar ones",
+           radar_dsp::GetSimdLevelName(level));
+    ILOG("tracker %zu targets %zu false alarms %-8s %6.1f us per burst, "
+         "%zu confirmed tracks, %zu targets tracked", num_targets,
+         num_false_alarms, radar_dsp::GetSimdLevelName(level),
+         seconds / num_bursts * 1e6, num_confirmed, num_tracked);
+  }
+  radar_dsp::SetSimdLevel(radar_dsp::DetectSimdLevel());
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  (void) argc;
+  (void) argv;
+  ILOG("DSP kernel benchmarks, detected SIMD level %s",
+       radar_dsp::GetSimdLevelName(radar_dsp::DetectSimdLevel()));
+
+  BenchmarkUnpack("uint8", MakeFormat(RSAMPLE_DTYPE_UINT, 8, false));
+  BenchmarkUnpack("int16", MakeFormat(RSAMPLE_DTYPE_INT, 16, false));
+  BenchmarkUnpack("int16 BE", MakeFormat(RSAMPLE_DTYPE_INT, 16, true));
+  BenchmarkUnpack("cint12", MakeFormat(RSAMPLE_DTYPE_CINT, 24, false));
+  BenchmarkUnpack("cuint10 BE", MakeFormat(RSAMPLE_DTYPE_CUINT, 20, true));
+  BenchmarkUnpack("int6", MakeFormat(RSAMPLE_DTYPE_INT, 6, false));
+  BenchmarkUnpack("int24 BE", MakeFormat(RSAMPLE_DTYPE_INT, 24, true));
+  BenchmarkUnpack("cint32", MakeFormat(RSAMPLE_DTYPE_CINT, 64, false));
+  BenchmarkUnpack("uint32 BE", MakeFormat(RSAMPLE_DTYPE_UINT, 32, true));
+  BenchmarkUnpack("cfloat", MakeFormat(RSAMPLE_DTYPE_CFLOAT, 64, false));
+  BenchmarkUnpack("float BE", MakeFormat(RSAMPLE_DTYPE_FLOAT, 32, true));
+  BenchmarkUnpack("double", MakeFormat(RSAMPLE_DTYPE_FLOAT, 64, false));
+
+  BenchmarkPacking("int12", RSAMPLE_DTYPE_INT, 12, false);
+  BenchmarkPacking("cint10", RSAMPLE_DTYPE_CINT, 20, false);
+  BenchmarkPacking("uint14 BE", RSAMPLE_DTYPE_UINT, 14, true);
+  BenchmarkPacking("cint11 BE", RSAMPLE_DTYPE_CINT, 22, true);
+  BenchmarkPacking("uint5", RSAMPLE_DTYPE_UINT, 5, false);
+  BenchmarkPacking("int20 BE", RSAMPLE_DTYPE_INT, 20, true);
+
+  BenchmarkLossless("cint16", RSAMPLE_DTYPE_CINT, 32, false, false, 4.0);
+  BenchmarkLossless("cint12", RSAMPLE_DTYPE_CINT, 24, false, true, 4.0);
+  BenchmarkLossless("int14 BE", RSAMPLE_DTYPE_INT, 14, true, false, 2.0);
+  BenchmarkLossless("uint10", RSAMPLE_DTYPE_UINT, 10, false, true, 1.0);
+  BenchmarkLossless("int8", RSAMPLE_DTYPE_INT, 8, false, false, 0.5);
+
+  BenchmarkLossy("cint16", RSAMPLE_DTYPE_CINT, 32, false, false, 4.0, 8, 0);
+  BenchmarkLossy("cint16", RSAMPLE_DTYPE_CINT, 32, false, false, 4.0, 64, 0);
+  BenchmarkLossy("cint16", RSAMPLE_DTYPE_CINT, 32, false, false, 4.0, 0, 40);
+  BenchmarkLossy("cint16", RSAMPLE_DTYPE_CINT, 32, false, false, 4.0, 0, 30);
+  BenchmarkLossy("cint16", RSAMPLE_DTYPE_CINT, 32, false, false, 4.0, 0, 20);
+  BenchmarkLossy("cint12", RSAMPLE_DTYPE_CINT, 24, false, true, 4.0, 0, 30);
+  BenchmarkLossy("int14 BE", RSAMPLE_DTYPE_INT, 14, true, false, 2.0, 32,
+                 30);
+
+  BenchmarkTranspose(4, 32, 64);
+  BenchmarkTranspose(3, 128, 256);
+  BenchmarkPlanarUnpack("cint16", RSAMPLE_DTYPE_CINT, 32, false, 4);
+  BenchmarkPlanarUnpack("cint12", RSAMPLE_DTYPE_CINT, 24, true, 3);
+
+  BenchmarkRangeFft(4, 32, 64, true);
+  BenchmarkRangeFft(4, 128, 256, true);
+  BenchmarkRangeFft(3, 64, 200, true);
+  BenchmarkRangeFft(4, 128, 512, false);
+
+  BenchmarkFixedRangeFft(4, 128, 256, 16, true);
+  BenchmarkFixedRangeFft(3, 64, 200, 12, true);
+  BenchmarkFixedRangeFft(4, 128, 512, 16, false);
+
+  BenchmarkRangeDoppler(4, 64, 128);
+  BenchmarkRangeDoppler(4, 128, 256);
+  BenchmarkRangeDoppler(3, 100, 256);
+
+  BenchmarkThreadPool(4, 128, 256);
+  BenchmarkThreadPool(8, 512, 512);
+
+  BenchmarkSweeps("pulsed", RTYPE_PULSED, 4, 128, 256, 0, 0);
+  BenchmarkSweeps("pulsed", RTYPE_PULSED, 4, 128, 256, 8, 37);
+  BenchmarkSweeps("uwb", RTYPE_UWB, 4, 128, 256, 16, 10);
+
+  radar_dsp::ClutterConfig exponential;
+  radar_dsp::ClutterConfig mti;
+  mti.type = radar_dsp::ClutterFilterType::kMti;
+  BenchmarkClutter("exponential", exponential, 4, 128, 256);
+  BenchmarkClutter("mti", mti, 4, 128, 256);
+  mti.mti_lag = 3;
+  BenchmarkClutter("mti lag 3", mti, 8, 128, 129);
+
+  const radar_dsp::CfarType ca = radar_dsp::CfarType::kCellAveraging;
+  const radar_dsp::CfarType go = radar_dsp::CfarType::kGreatestOf;
+  const radar_dsp::CfarType so = radar_dsp::CfarType::kSmallestOf;
+  const radar_dsp::CfarType os = radar_dsp::CfarType::kOrderedStatistic;
+  BenchmarkCfar("CA", ca, 1, 4);
+  BenchmarkCfar("CA", ca, 2, 12);
+  BenchmarkCfar("GO", go, 2, 12);
+  BenchmarkCfar("SO", so, 2, 12);
+  BenchmarkCfar("OS", os, 1, 4);
+  BenchmarkCfar("OS", os, 2, 12);
+
+  BenchmarkBeamformer(2, 64);
+  BenchmarkBeamformer(3, 64);
+
+  BenchmarkTracker(32, 8);
+  BenchmarkTracker(256, 32);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,141 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief An example that reads bursts from several radars on one thread
+ *        with asynchronous reads.
+ *
+ * @details Every radar always has one read pending. When a read completes,
+ *          its callback starts the next one, so a single thread serves all
+ *          the radars without blocking on any of them.
+ */
+#include <stdlib.h>
+
+#include <platform_check.h>
+#include <platform_log.h>
+
+#include <AsyncBurstReader.hpp>
+#include <BurstQueue.hpp>
+#include <IRadarApi.hpp>
+
+namespace {
+
+const int kNumSensors = 4;
+const int kReadsPerSensor = 10;
+const timespec kReadTimeout = {0, 200000000};  // 200 ms.
+
+// Keeps one read pending on a radar until enough reads are done.
+class SensorReader {
+ public:
+  SensorReader(radar_api::IRadarSensor* radar,
+               radar_utils::AsyncBurstReader& reader, int id)
+      : radar_(radar), reader_(reader), id_(id), reads_left_(kReadsPerSensor),
+        bursts_(0), timeouts_(0) {}
+
+  void Start(void) {
+    RadarReturnCode rc = reader_.ReadBurstAsync(radar_, format_,
+        raw_radar_data_, kReadTimeout, [this](RadarReturnCode rc) {
+          OnReadDone(rc);
+        });
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to start reading radar %i", id_);
+  }
+
+  int bursts(void) const {
+    return bursts_;
+  }
+
+  int timeouts(void) const {
+    return timeouts_;
+  }
+
+ private:
+  void OnReadDone(RadarReturnCode rc) {
+    if (rc == RC_OK) {
+      ++bursts_;
+      DLOG("Radar %i burst %u size %zu", id_, format_.sequence_number,
+           raw_radar_data_.size());
+    } else if (rc == RC_TIMEOUT) {
+      ++timeouts_;
+    } else {
+      ELOG("Radar %i read failed with rc %u", id_, rc);
+      return;
+    }
+    if (--reads_left_ > 0) {
+      Start();
+    }
+  }
+
+  radar_api::IRadarSensor* radar_;
+  radar_utils::AsyncBurstReader& reader_;
+  int id_;
+  int reads_left_;
+  int bursts_;
+  int timeouts_;
+  RadarBurstFormat format_;
+  std::vector<uint8_t> raw_radar_data_;
+};
+
+// Check the sequence gaps counted by a burst queue, which should not count
+// a burst pushed again or a sequence restarting.
+void CheckSequenceGaps(void) {
+  radar_utils::BurstQueue queue(16, radar_utils::DropPolicy::kDropOldest);
+  RadarBurstFormat format = {};
+  const uint8_t data = 0;
+  for (uint32_t sequence : {10u, 11u, 11u, 14u, 3u, 4u, 6u}) {
+    format.sequence_number = sequence;
+    RadarReturnCode rc = queue.Push(format, &data, sizeof(data));
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to push burst %u", sequence);
+  }
+  radar_utils::BurstQueueStats stats = queue.GetStats();
+  QCHECK(stats.sequence_gaps == 3, "Counted %llu sequence gaps instead of 3",
+         static_cast<unsigned long long>(stats.sequence_gaps));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  (void) argc;
+  (void) argv;
+  ILOG("Asynchronous multi radar reading example");
+  CheckSequenceGaps();
+
+  radar_utils::AsyncBurstReader reader;
+  QCHECK(reader.IsValid(), "Failed to set up the asynchronous reader");
+
+  radar_api::IRadarSensor* radars[kNumSensors];
+  std::vector<SensorReader*> sensor_readers;
+  for (int i = 0; i < kNumSensors; ++i) {
+    radars[i] = radar_api::CreateRadarSensor(i);
+    QCHECK(radars[i] != nullptr, "Invalid radar handle from driver");
+
+    RadarReturnCode rc = reader.AddSensor(radars[i]);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to add radar %i to the reader", i);
+
+    rc = radars[i]->TurnOn();
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn on radar %i", i);
+    rc = radars[i]->ActivateConfig(0);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to activate config of radar %i", i);
+    rc = radars[i]->StartDataStreaming();
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to start streaming radar %i", i);
+    sensor_readers.push_back(new SensorReader(radars[i], reader, i));
+  }
+
+  ILOG("Reading %i bursts from each of %i radars...",
+       kReadsPerSensor, kNumSensors);
+  for (SensorReader* sensor_reader : sensor_readers) {
+    sensor_reader->Start();
+  }
+  RadarReturnCode rc = reader.Run();
+  QCHECK_EQ(rc, RC_OK, "%d", "Asynchronous reading failed");
+
+  for (int i = 0; i < kNumSensors; ++i) {
+    ILOG("Radar %i: %i bursts, %i timeouts", i,
+         sensor_readers[i]->bursts(), sensor_readers[i]->timeouts());
+    delete sensor_readers[i];
+
+    reader.RemoveSensor(radars[i]);
+    radars[i]->StopDataStreaming();
+    radars[i]->TurnOff();
+    rc = radar_api::DestroyRadarSensor(radars[i]);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to destroy radar instance");
+  }
+}
@@ -0,0 +1,236 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief An example that processes the bursts of a high rate config with
+ *        a threaded pipeline.
+ *
+ * @details A few bursts of the simulated radar are recorded into a capture
+ *          first, so synthesizing them does not limit the throughput. The
+ *          replay driver then loops over the capture as fast as the bursts
+ *          are read, copying them from memory. The bursts are read alone to
+ *          measure the source, then processed by a single-threaded loop,
+ *          reading and processing one burst after another, then by
+ *          a pipeline running every stage on its own thread, and last by the
+ *          same pipeline splitting the range and Doppler stages of every
+ *          burst across a thread pool. The throughputs are logged along with
+ *          the counters and the throughput of every pipeline stage.
+ *
+ *          The capture is written to the path given as the first argument,
+ *          pipeline.cap by default.
+ */
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <platform_check.h>
+#include <platform_log.h>
+
+#include <IRadarApi.hpp>
+
+#include <CaptureRecorder.hpp>
+#include <Cfar.hpp>
+#include <Pipeline.hpp>
+#include <RangeDoppler.hpp>
+#include <ReplayRadar.hpp>
+#include <SimRadar.hpp>
+
+namespace {
+
+const int kNumBursts = 200;
+// Bursts in the capture, replayed in a loop.
+const int kNumRecordedBursts = 16;
+const timespec kReadTimeout = {1, 0};
+
+using MainParams = std::vector<std::pair<RadarMainParam, uint32_t>>;
+
+// A burst of 2 TX x 4 RX antennas, 128 chirps of 256 samples.
+const MainParams kMainParams = {
+  { {RADAR_PARAM_GROUP_COMMON, RADAR_PARAM_TX_ANTENNA_MASK},       0x3},
+  { {RADAR_PARAM_GROUP_COMMON, RADAR_PARAM_RX_ANTENNA_MASK},       0xf},
+  { {RADAR_PARAM_GROUP_FMCW,   FMCW_PARAM_CHIRP_PERIOD_US},        150},
+  { {RADAR_PARAM_GROUP_FMCW,   FMCW_PARAM_CHIRPS_PER_BURST},       128},
+  { {RADAR_PARAM_GROUP_FMCW,   FMCW_PARAM_SAMPLES_PER_CHIRP},      256},
+};
+
+double GetSeconds(std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+// Record bursts of the simulated radar without any encoding.
+void Record(const std::string& path) {
+  radar_api::IRadarSensor* radar = radar_api::CreateRadarSensor(0);
+  QCHECK(radar != nullptr, "Invalid radar handle from driver");
+  RadarReturnCode rc = radar->TurnOn();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn on the radar");
+  const uint8_t slot_id = 0;
+  for (auto& param : kMainParams) {
+    rc = radar->SetMainParam(slot_id, param.first, param.second);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to set main param %u.%u value %u",
+              param.first.group, param.first.id, param.second);
+  }
+  rc = radar->SetVendorParam(slot_id, SIM_VENDOR_PARAM_REAL_TIME, 0);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn off the real time mode");
+  rc = radar->ActivateConfig(slot_id);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to activate the config slot");
+
+  radar_utils::CaptureRecorder recorder;
+  rc = recorder.Open(path, *radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to create %s", path.c_str());
+  rc = radar->StartDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to start data streaming");
+  RadarBurstFormat format;
+  std::vector<uint8_t> raw_radar_data;
+  int num_recorded = 0;
+  while (num_recorded < kNumRecordedBursts) {
+    rc = radar->ReadBurst(format, raw_radar_data, kReadTimeout);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to read burst %i", num_recorded);
+    if (recorder.Record(format, raw_radar_data) == RC_OK) {
+      ++num_recorded;
+    }
+  }
+  rc = recorder.Close();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to close %s", path.c_str());
+
+  rc = radar->StopDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to stop radar data streaming");
+  rc = radar->TurnOff();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn the radar off");
+  rc = radar_api::DestroyRadarSensor(radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to destroy radar instance");
+}
+
+// Read the bursts without processing them.
+double RunRead(radar_api::IRadarSensor* radar) {
+  RadarBurstFormat format;
+  std::vector<uint8_t> raw_radar_data;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kNumBursts; ++i) {
+    RadarReturnCode rc = radar->ReadBurst(format, raw_radar_data,
+                                          kReadTimeout);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to read burst %i", i);
+  }
+  return GetSeconds(start);
+}
+
+// Read and process the bursts one after another.
+double RunLoop(radar_api::IRadarSensor* radar,
+               const radar_dsp::PipelineConfig& config) {
+  radar_dsp::RangeDoppler range_doppler(config.range_window,
+                                        config.doppler_window,
+                                        config.integrate_channels,
+                                        config.scale);
+  radar_dsp::CfarDetector detector(config.cfar);
+  RadarBurstFormat format;
+  std::vector<uint8_t> raw_radar_data;
+  std::vector<float> map;
+  radar_dsp::CubeShape shape;
+  radar_dsp::CfarDetections detections;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kNumBursts; ++i) {
+    RadarReturnCode rc = radar->ReadBurst(format, raw_radar_data,
+                                          kReadTimeout);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to read burst %i", i);
+    rc = range_doppler.Process(format, raw_radar_data.data(),
+                               raw_radar_data.size(), map, shape);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to process burst %i", i);
+    rc = detector.Detect(map.data(), shape, detections);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to detect burst %i", i);
+  }
+  return GetSeconds(start);
+}
+
+// Process the bursts with a pipeline.
+double RunPipeline(radar_api::IRadarSensor* radar,
+                   const radar_dsp::PipelineConfig& config) {
+  radar_dsp::Pipeline pipeline(config);
+  radar_dsp::PipelineFrame frame;
+
+  auto start = std::chrono::steady_clock::now();
+  RadarReturnCode rc = pipeline.Start(radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to start the pipeline");
+  size_t num_detections = 0;
+  for (int i = 0; i < kNumBursts; ++i) {
+    rc = pipeline.Pop(frame, kReadTimeout);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to get frame %i", i);
+    QCHECK_EQ(frame.rc, RC_OK, "%d", "Failed to process burst %u",
+              frame.format.sequence_number);
+    num_detections += frame.detections.Size();
+  }
+  double seconds = GetSeconds(start);
+  pipeline.Stop();
+
+  // A stage alone would reach the rate of its busy time, the slowest one
+  // bounds the pipeline.
+  radar_dsp::PipelineStats stats = pipeline.GetStats();
+  for (size_t i = 0; i < radar_dsp::kNumPipelineStages; ++i) {
+    const radar_dsp::PipelineStageStats& stage = stats.stages[i];
+    ILOG("%-7s %4llu frames, %7.1f us per frame, %7.1f frames/s, max "
+         "%7.1f us, blocked %5.1f%%, queue high watermark %u/%u",
+         radar_dsp::GetPipelineStageName(
+             static_cast<radar_dsp::PipelineStage>(i)),
+         static_cast<unsigned long long>(stage.frames),
+         stage.frames ? stage.busy_ns / 1e3 / stage.frames : 0.0,
+         stage.busy_ns ? stage.frames * 1e9 / stage.busy_ns : 0.0,
+         stage.max_ns / 1e3, stage.blocked_ns / 1e7 / seconds,
+         stage.queue.high_watermark, config.queue_depth);
+  }
+  ILOG("End to end %.1f bursts/s, latency %.1f us, max %.1f us, %.1f "
+       "detections per burst", kNumBursts / seconds,
+       stats.last_latency_ns / 1e3, stats.max_latency_ns / 1e3,
+       static_cast<double>(num_detections) / kNumBursts);
+  return seconds;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::string path = argc > 1 ? argv[1] : "pipeline.cap";
+  ILOG("Threaded processing pipeline example");
+
+  ILOG("Recording %i bursts into %s...", kNumRecordedBursts, path.c_str());
+  Record(path);
+
+  radar_api::ReplayConfig replay_config;
+  replay_config.path = path;
+  replay_config.is_real_time = false;
+  replay_config.is_looping = true;
+  radar_api::ReplayRadar radar(0, replay_config);
+  RadarReturnCode rc = radar.TurnOn();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn on the replay of %s",
+            path.c_str());
+  rc = radar.ActivateConfig(0);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to activate the config slot");
+  rc = radar.StartDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to start data streaming");
+
+  radar_dsp::PipelineConfig config;
+  config.cfar.threshold_scale = radar_dsp::GetCaThresholdScale(1e-4, 72);
+
+  ILOG("Reading %i bursts...", kNumBursts);
+  double read_seconds = RunRead(&radar);
+  ILOG("Processing %i bursts in a loop...", kNumBursts);
+  double loop_seconds = RunLoop(&radar, config);
+  ILOG("Processing %i bursts with a pipeline...", kNumBursts);
+  double pipeline_seconds = RunPipeline(&radar, config);
+  config.num_workers = std::max(1u, std::thread::hardware_concurrency() / 2);
+  ILOG("Processing %i bursts with a pipeline and %u workers...", kNumBursts,
+       config.num_workers);
+  double pool_seconds = RunPipeline(&radar, config);
+  ILOG("Read %.1f bursts/s, loop %.1f bursts/s, pipeline %.1f bursts/s, "
+       "with workers %.1f bursts/s", kNumBursts / read_seconds,
+       kNumBursts / loop_seconds, kNumBursts / pipeline_seconds,
+       kNumBursts / pool_seconds);
+
+  rc = radar.StopDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to stop radar data streaming");
+  rc = radar.TurnOff();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn the radar off");
+  return EXIT_SUCCESS;
+}
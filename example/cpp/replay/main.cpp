@@ -0,0 +1,261 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief An example that replays a capture file through the replay driver.
+ *
+ * @details Bursts of the simulated radar are recorded into a capture first,
+ *          compressed without loss.
+ *          The capture is then processed by a pipeline as fast as possible,
+ *          configured from the recorded params, and the throughput is
+ *          compared to the real time burst rate. The bursts are replayed
+ *          once more through burst leases, checking they match the recorded
+ *          ones, and a few of them through the C API in real time, checking
+ *          they follow the recorded burst period.
+ *
+ *          The capture is written to the path given as the first argument,
+ *          replay.cap by default.
+ */
+#include <stdlib.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <platform_check.h>
+#include <platform_log.h>
+
+#include <IRadarApi.hpp>
+#include <IRadarSensor.h>
+
+#include <Cfar.hpp>
+#include <CaptureRecorder.hpp>
+#include <Pipeline.hpp>
+#include <ReplayRadar.hpp>
+#include <SimRadar.hpp>
+
+namespace {
+
+const int kNumBursts = 200;
+const int kNumRealTimeBursts = 10;
+const uint32_t kBurstPeriodUs = 20000;
+const timespec kReadTimeout = {1, 0};
+
+using MainParams = std::vector<std::pair<RadarMainParam, uint32_t>>;
+
+// A burst of 2 TX x 4 RX antennas, 128 chirps of 256 samples.
+const MainParams kMainParams = {
+  { {RADAR_PARAM_GROUP_COMMON, RADAR_PARAM_BURST_PERIOD_US},       20000},
+  { {RADAR_PARAM_GROUP_COMMON, RADAR_PARAM_TX_ANTENNA_MASK},       0x3},
+  { {RADAR_PARAM_GROUP_COMMON, RADAR_PARAM_RX_ANTENNA_MASK},       0xf},
+  { {RADAR_PARAM_GROUP_FMCW,   FMCW_PARAM_CHIRP_PERIOD_US},        150},
+  { {RADAR_PARAM_GROUP_FMCW,   FMCW_PARAM_CHIRPS_PER_BURST},       128},
+  { {RADAR_PARAM_GROUP_FMCW,   FMCW_PARAM_SAMPLES_PER_CHIRP},      256},
+};
+
+double GetSeconds(std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+// FNV-1a hash of the burst data.
+uint64_t Hash(const uint8_t* data, size_t size) {
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ data[i]) * 1099511628211ull;
+  }
+  return hash;
+}
+
+void Configure(radar_api::IRadarSensor& radar, uint8_t slot_id) {
+  RadarReturnCode rc = radar.TurnOn();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn on the radar");
+  for (auto& param : kMainParams) {
+    rc = radar.SetMainParam(slot_id, param.first, param.second);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to set main param %u.%u value %u",
+              param.first.group, param.first.id, param.second);
+  }
+  rc = radar.ActivateConfig(slot_id);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to activate the config slot");
+}
+
+// Record bursts of the simulated radar, keeping the hashes of their data.
+void Record(const std::string& path, std::vector<uint64_t>& hashes) {
+  radar_api::SimRadar radar(0);
+  const uint8_t slot_id = 0;
+  Configure(radar, slot_id);
+  RadarReturnCode rc =
+      radar.SetVendorParam(slot_id, SIM_VENDOR_PARAM_REAL_TIME, 0);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn off the real time mode");
+
+  radar_utils::CaptureRecorderConfig config;
+  config.encoding = radar_utils::CaptureEncoding::kLossless;
+  radar_utils::CaptureRecorder recorder(config);
+  rc = recorder.Open(path, radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to create %s", path.c_str());
+  rc = radar.StartDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to start data streaming");
+  RadarBurstFormat format;
+  std::vector<uint8_t> raw_radar_data;
+  while (hashes.size() < kNumBursts) {
+    rc = radar.ReadBurst(format, raw_radar_data, kReadTimeout);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to read burst %zu", hashes.size());
+    if (recorder.Record(format, raw_radar_data) == RC_OK) {
+      hashes.push_back(Hash(raw_radar_data.data(), raw_radar_data.size()));
+    }
+  }
+  rc = recorder.Close();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to close %s", path.c_str());
+  radar_utils::CaptureRecorderStats stats = recorder.GetStats();
+  ILOG("Recorded %.1f MB of bursts into %.1f MB, %.2f times smaller",
+       stats.raw_bytes / 1e6, stats.payload_bytes / 1e6,
+       static_cast<double>(stats.raw_bytes) / stats.payload_bytes);
+  radar.StopDataStreaming();
+  radar.TurnOff();
+}
+
+// Process the whole capture with a pipeline, configured from the replay.
+double RunPipeline(radar_api::IRadarSensor* radar) {
+  radar_dsp::PipelineConfig config;
+  config.cfar.threshold_scale = radar_dsp::GetCaThresholdScale(1e-4, 72);
+  radar_dsp::Pipeline pipeline(config);
+  radar_dsp::PipelineFrame frame;
+
+  auto start = std::chrono::steady_clock::now();
+  RadarReturnCode rc = radar->StartDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to start data streaming");
+  rc = pipeline.Start(radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to start the pipeline");
+  // The pipeline stops reading at the end of the capture.
+  int num_frames = 0;
+  while ((rc = pipeline.Pop(frame, kReadTimeout)) == RC_OK) {
+    QCHECK_EQ(frame.rc, RC_OK, "%d", "Failed to process burst %u",
+              frame.format.sequence_number);
+    ++num_frames;
+  }
+  QCHECK_EQ(rc, RC_BAD_STATE, "%d", "Failed to get frame %i", num_frames);
+  double seconds = GetSeconds(start);
+  pipeline.Stop();
+  rc = radar->StopDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to stop radar data streaming");
+  QCHECK(num_frames == kNumBursts, "Processed %i bursts of %i", num_frames,
+         kNumBursts);
+  return seconds;
+}
+
+// Replay the capture again through burst leases.
+void CheckBursts(radar_api::IRadarSensor* radar,
+                 const std::vector<uint64_t>& hashes) {
+  RadarReturnCode rc = radar->StartDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to start data streaming");
+  RadarBurstLease lease;
+  size_t num_bursts = 0;
+  while ((rc = radar->AcquireBurst(lease, kReadTimeout)) == RC_OK) {
+    QCHECK(num_bursts < hashes.size() &&
+           Hash(lease.data, lease.size_bytes) == hashes[num_bursts],
+           "Burst %u differs from the recorded one",
+           lease.format.sequence_number);
+    rc = radar->ReleaseBurst(lease);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to release burst %zu", num_bursts);
+    ++num_bursts;
+  }
+  QCHECK_EQ(rc, RC_BAD_STATE, "%d", "Failed to acquire burst %zu",
+            num_bursts);
+  QCHECK(num_bursts == hashes.size(), "Replayed %zu bursts of %zu",
+         num_bursts, hashes.size());
+  rc = radar->StopDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to stop radar data streaming");
+}
+
+// Replay a few bursts through the C API in real time.
+double RunRealTime(uint32_t burst_bytes) {
+  RadarHandle* radar = radarCreate(0);
+  QCHECK(radar != NULL, "Unable to create radar handler");
+  RadarReturnCode rc = radarTurnOn(radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn on the radar");
+  uint32_t chirps = 0;
+  rc = radarGetMainParam(radar, 0,
+      {RADAR_PARAM_GROUP_FMCW, FMCW_PARAM_CHIRPS_PER_BURST}, &chirps);
+  QCHECK(rc == RC_OK && chirps == 128, "Wrong chirps per burst %u", chirps);
+  rc = radarActivateConfig(radar, 0);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to activate the config slot");
+  rc = radarStartDataStreaming(radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to start data streaming");
+
+  std::vector<uint8_t> buffer(burst_bytes);
+  RadarBurstFormat format;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kNumRealTimeBursts; ++i) {
+    uint32_t read_bytes = static_cast<uint32_t>(buffer.size());
+    rc = radarReadBurst(radar, &format, buffer.data(), &read_bytes,
+                        kReadTimeout);
+    QCHECK_EQ(rc, RC_OK, "%d", "Failed to read burst %i", i);
+    QCHECK(read_bytes == burst_bytes, "Burst %i of %u bytes", i, read_bytes);
+  }
+  double seconds = GetSeconds(start);
+
+  rc = radarStopDataStreaming(radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to stop radar data streaming");
+  rc = radarDestroy(radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to destroy radar instance");
+  return seconds;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::string path = argc > 1 ? argv[1] : "replay.cap";
+  ILOG("Capture replay example");
+
+  ILOG("Recording %i bursts into %s...", kNumBursts, path.c_str());
+  std::vector<uint64_t> hashes;
+  Record(path, hashes);
+
+  // The replay driver finds its capture in the environment.
+  setenv("RIPPLE_REPLAY_CAPTURE", path.c_str(), 1);
+  setenv("RIPPLE_REPLAY_REAL_TIME", "0", 1);
+  radar_api::IRadarSensor* radar = radar_api::CreateRadarSensor(0);
+  QCHECK(radar != nullptr, "Failed to open %s", path.c_str());
+  // The recorded values are accepted as they are.
+  Configure(*radar, 0);
+  SensorInfo info;
+  RadarReturnCode rc = radar->GetSensorInfo(info);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to get the sensor info");
+  ILOG("Replaying a capture of %s by %s", info.name, info.vendor);
+
+  ILOG("Processing the capture with a pipeline...");
+  double pipeline_seconds = RunPipeline(radar);
+  double capture_seconds = kNumBursts * kBurstPeriodUs * 1e-6;
+  ILOG("Pipeline %.1f bursts/s, %.1f times real time",
+       kNumBursts / pipeline_seconds, capture_seconds / pipeline_seconds);
+
+  ILOG("Checking the replayed bursts...");
+  auto start = std::chrono::steady_clock::now();
+  CheckBursts(radar, hashes);
+  ILOG("Replayed %i bursts through leases at %.1f bursts/s", kNumBursts,
+       kNumBursts / GetSeconds(start));
+
+  RadarBurstFormat format;
+  std::vector<uint8_t> raw_radar_data;
+  rc = radar->StartDataStreaming();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to start data streaming");
+  rc = radar->ReadBurst(format, raw_radar_data, kReadTimeout);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to read the first burst");
+  radar->StopDataStreaming();
+  rc = radar->TurnOff();
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to turn the radar off");
+  rc = radar_api::DestroyRadarSensor(radar);
+  QCHECK_EQ(rc, RC_OK, "%d", "Failed to destroy radar instance");
+
+  ILOG("Reading %i bursts in real time...", kNumRealTimeBursts);
+  setenv("RIPPLE_REPLAY_REAL_TIME", "1", 1);
+  double real_time_seconds =
+      RunRealTime(static_cast<uint32_t>(raw_radar_data.size()));
+  // The first burst is ready at once.
+  double expected_seconds = (kNumRealTimeBursts - 1) * kBurstPeriodUs * 1e-6;
+  ILOG("Read %i bursts in %.1f ms, %.1f ms expected", kNumRealTimeBursts,
+       real_time_seconds * 1e3, expected_seconds * 1e3);
+  QCHECK(real_time_seconds >= expected_seconds * 0.99,
+         "Bursts replayed faster than the burst period");
+  return EXIT_SUCCESS;
+}
@@ -441,6 +441,21 @@ RadarReturnCode radarStopDataStreaming(RadarHandle* handle);
  */
 RadarReturnCode radarIsBurstReady(RadarHandle* handle, bool* is_ready);
 
+/**
+ * @brief Get a file descriptor that signals pending bursts.
+ *
+ * @details The descriptor becomes readable when at least one burst is ready
+ *        to read and stays readable until all the pending bursts are read.
+ *        It can be waited on with poll/select/epoll together with other
+ *        descriptors. The descriptor is owned by the driver, it must not be
+ *        read from or closed by the application and stays valid until
+ *        the radar instance is destroyed.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param fd a pointer where the file descriptor will be written into.
+ */
+RadarReturnCode radarGetBurstReadyFd(RadarHandle* handle, int* fd);
+
 /**
  * @brief Initiate reading a new burst.
  *
@@ -455,6 +470,121 @@ RadarReturnCode radarIsBurstReady(RadarHandle* handle, bool* is_ready);
 RadarReturnCode radarReadBurst(RadarHandle* handle, RadarBurstFormat* format,
     uint8_t* buffer, uint32_t* read_bytes, struct timespec timeout);
 
+/**
+ * @brief Read all the pending bursts at once.
+ *
+ * @details Waits up to timeout for the first burst and then drains
+ *        the bursts that are already pending without waiting any longer.
+ *        Bursts are written back to back into the arena in the same order
+ *        as their formats. Reading stops when max_count bursts have been
+ *        read or when the next burst does not fit into the arena, which
+ *        leaves it pending for the next call.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param max_count the maximum number of bursts to read.
+ * @param formats an array of max_count elements where burst formats
+ *        will be written into.
+ * @param burst_bytes an array of max_count elements where the size of
+ *        each burst in bytes will be written into.
+ * @param count a pointer where the number of bursts read will be set.
+ * @param arena a pointer where bursts data to write.
+ * @param arena_bytes a pointer where the arena size is set. When function
+ *        finishes, the pointer will have the amount of bytes have been read.
+ * @param timeout the maximum time to wait if no burst is ready.
+ */
+RadarReturnCode radarReadBursts(RadarHandle* handle, uint32_t max_count,
+    RadarBurstFormat* formats, uint32_t* burst_bytes, uint32_t* count,
+    uint8_t* arena, uint32_t* arena_bytes, struct timespec timeout);
+
+/**
+ * @brief Acquire a new burst without copying it out of the driver.
+ *
+ * @details The lease points into driver owned memory and stays valid until
+ *        it is passed back to radarReleaseBurst. The driver can hold
+ *        only a limited number of leases at a time and returns RC_RES_LIMIT
+ *        when all of them are outstanding.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param lease a pointer where the burst view will be written into.
+ * @param timeout the maximum time to wait if the burst frame is not ready.
+ */
+RadarReturnCode radarAcquireBurst(RadarHandle* handle, RadarBurstLease* lease,
+    struct timespec timeout);
+
+/**
+ * @brief Release a burst previously acquired with radarAcquireBurst.
+ *
+ * @details The burst data must not be accessed after this call.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param lease a pointer to the lease to be released.
+ */
+RadarReturnCode radarReleaseBurst(RadarHandle* handle,
+    const RadarBurstLease* lease);
+
+/**
+ * @brief Register a ring of application buffers to receive bursts into.
+ *
+ * @details Once registered, the driver owns every buffer and writes bursts
+ *        directly into them as they arrive. A filled buffer is handed to the
+ *        application with radarWaitBurstBuffer and stays owned by the
+ *        application until it is passed back with radarReturnBurstBuffer.
+ *        When no buffer is owned by the driver, new bursts are dropped and
+ *        counted in RadarBurstBufferStats.
+ *        Buffers can be registered only while data streaming is stopped.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param buffers an array of num_buffers pointers to buffers. Every buffer
+ *        should be aligned to RADAR_BURST_BUFFER_ALIGNMENT bytes.
+ * @param num_buffers the amount of buffers in the ring.
+ * @param buffer_bytes the size of each buffer in bytes.
+ */
+RadarReturnCode radarRegisterBurstBuffers(RadarHandle* handle,
+    uint8_t* const* buffers, uint32_t num_buffers, uint32_t buffer_bytes);
+
+/**
+ * @brief Unregister the ring of application buffers.
+ *
+ * @details Ownership of all the buffers is returned to the application.
+ *        Buffers can be unregistered only while data streaming is stopped.
+ *
+ * @param handle a handler for the radar instance to use.
+ */
+RadarReturnCode radarUnregisterBurstBuffers(RadarHandle* handle);
+
+/**
+ * @brief Wait for the next registered buffer filled with a burst.
+ *
+ * @details The ownership of the buffer is transferred to the application.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param index a pointer where the index of the filled buffer in the
+ *        registered array will be written into.
+ * @param format a pointer where the burst format will be written into.
+ * @param read_bytes a pointer where the amount of bytes written into
+ *        the buffer will be set.
+ * @param timeout the maximum time to wait if no buffer is filled yet.
+ */
+RadarReturnCode radarWaitBurstBuffer(RadarHandle* handle, uint32_t* index,
+    RadarBurstFormat* format, uint32_t* read_bytes, struct timespec timeout);
+
+/**
+ * @brief Return a buffer to the driver to be filled again.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param index the index of the buffer received from radarWaitBurstBuffer.
+ */
+RadarReturnCode radarReturnBurstBuffer(RadarHandle* handle, uint32_t index);
+
+/**
+ * @brief Get counters of the registered buffer ring.
+ *
+ * @param handle a handler for the radar instance to use.
+ * @param stats a pointer where the counters will be written into.
+ */
+RadarReturnCode radarGetBurstBufferStats(RadarHandle* handle,
+    RadarBurstBufferStats* stats);
+
 // Feedback.
 
 /**
@@ -404,6 +404,20 @@ class IRadarSensor {
    */
   virtual RadarReturnCode IsBurstReady(bool& is_ready) = 0;
 
+  /**
+   * @brief Get a file descriptor that signals pending bursts.
+   *
+   * @details The descriptor becomes readable when at least one burst is
+   *          ready to read and stays readable until all the pending bursts
+   *          are read. It can be waited on with poll/select/epoll together
+   *          with other descriptors. The descriptor is owned by the driver,
+   *          it must not be read from or closed by the application and stays
+   *          valid until the radar instance is destroyed.
+   *
+   * @param fd where the file descriptor will be written into.
+   */
+  virtual RadarReturnCode GetBurstReadyFd(int& fd) = 0;
+
   /**
    * @brief Initiate reading a new burst.
    *
@@ -414,6 +428,103 @@ class IRadarSensor {
   virtual RadarReturnCode ReadBurst(RadarBurstFormat& format,
       std::vector<uint8_t>& raw_radar_data, timespec timeout) = 0;
 
+  /**
+   * @brief Read all the pending bursts at once.
+   *
+   * @details Waits up to timeout for the first burst and then drains
+   *          the bursts that are already pending without waiting any longer.
+   *          Bursts are written back to back into the arena in the same
+   *          order as their formats.
+   *
+   * @param max_count the maximum number of bursts to read.
+   * @param formats where burst formats will be written into.
+   * @param burst_bytes where the size of each burst in bytes will be written.
+   * @param arena where bursts data to be written.
+   * @param timeout the maximum time to wait if no burst is ready.
+   */
+  virtual RadarReturnCode ReadBursts(uint32_t max_count,
+      std::vector<RadarBurstFormat>& formats,
+      std::vector<uint32_t>& burst_bytes, std::vector<uint8_t>& arena,
+      timespec timeout) = 0;
+
+  /**
+   * @brief Acquire a new burst without copying it out of the driver.
+   *
+   * @details The lease points into driver owned memory and stays valid until
+   *          it is passed back to ReleaseBurst. The driver can hold only
+   *          a limited number of leases at a time and returns RC_RES_LIMIT
+   *          when all of them are outstanding.
+   *
+   * @param lease where the burst view will be written into.
+   * @param timeout the maximum time to wait if the burst frame is not ready.
+   */
+  virtual RadarReturnCode AcquireBurst(RadarBurstLease& lease,
+      timespec timeout) = 0;
+
+  /**
+   * @brief Release a burst previously acquired with AcquireBurst.
+   *
+   * @details The burst data must not be accessed after this call.
+   *
+   * @param lease the lease to be released.
+   */
+  virtual RadarReturnCode ReleaseBurst(const RadarBurstLease& lease) = 0;
+
+  /**
+   * @brief Register a ring of application buffers to receive bursts into.
+   *
+   * @details Once registered, the driver owns every buffer and writes bursts
+   *          directly into them as they arrive. A filled buffer is handed to
+   *          the application with WaitBurstBuffer and stays owned by the
+   *          application until it is passed back with ReturnBurstBuffer.
+   *          When no buffer is owned by the driver, new bursts are dropped
+   *          and counted in RadarBurstBufferStats.
+   *          Buffers can be registered only while data streaming is stopped.
+   *
+   * @param buffers pointers to buffers. Every buffer should be aligned to
+   *        RADAR_BURST_BUFFER_ALIGNMENT bytes.
+   * @param buffer_bytes the size of each buffer in bytes.
+   */
+  virtual RadarReturnCode RegisterBurstBuffers(
+      const std::vector<uint8_t*>& buffers, uint32_t buffer_bytes) = 0;
+
+  /**
+   * @brief Unregister the ring of application buffers.
+   *
+   * @details Ownership of all the buffers is returned to the application.
+   *          Buffers can be unregistered only while data streaming is stopped.
+   */
+  virtual RadarReturnCode UnregisterBurstBuffers(void) = 0;
+
+  /**
+   * @brief Wait for the next registered buffer filled with a burst.
+   *
+   * @details The ownership of the buffer is transferred to the application.
+   *
+   * @param index where the index of the filled buffer will be written into.
+   * @param format where the burst format will be written into.
+   * @param read_bytes where the amount of bytes written into the buffer
+   *        will be set.
+   * @param timeout the maximum time to wait if no buffer is filled yet.
+   */
+  virtual RadarReturnCode WaitBurstBuffer(uint32_t& index,
+      RadarBurstFormat& format, uint32_t& read_bytes, timespec timeout) = 0;
+
+  /**
+   * @brief Return a buffer to the driver to be filled again.
+   *
+   * @param index the index of the buffer received from WaitBurstBuffer.
+   */
+  virtual RadarReturnCode ReturnBurstBuffer(uint32_t index) = 0;
+
+  /**
+   * @brief Get counters of the registered buffer ring.
+   *
+   * @param stats where the counters will be written into.
+   */
+  virtual RadarReturnCode GetBurstBufferStats(
+      RadarBurstBufferStats& stats) = 0;
+
   // Miscellaneous.
 
   /**
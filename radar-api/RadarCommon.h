@@ -88,6 +88,20 @@ typedef uint32_t RadarSampleDType;
 //! Radar sample data type as complex float.
 #define RSAMPLE_DTYPE_CFLOAT                6
 
+//! A list of ways integer sample components are stored in burst data.
+typedef uint8_t RadarSamplePacking;
+
+//! Every component is padded to 8, 16 or 32 bits, with the value in the
+//! least significant bits. Used by radars that leave the field zeroed.
+#define RSAMPLE_PACKING_PADDED              0
+//! Components follow each other as a stream of bits without padding, e.g.
+//! four 12-bit components take 6 bytes. The first component is in the least
+//! significant bits of the first byte, or in the most significant bits when
+//! is_big_endian is set. The burst data is padded to a whole byte, so
+//! components narrower than a byte may leave room for one more, which
+//! reads as a zero component.
+#define RSAMPLE_PACKING_PACKED              1
+
 //! A list of possible power mode states for radar sensors.
 typedef uint16_t RadarState;
 
@@ -118,6 +132,9 @@ typedef uint32_t RadarLogLevel;
 //! Provide log messages same as for RLOG_INF and debugging info details.
 #define RLOG_DBG                            5
 
+//! Required alignment in bytes for application registered burst buffers.
+#define RADAR_BURST_BUFFER_ALIGNMENT        64
+
 
 //--------------------------------------
 //----- Main Params --------------------
@@ -338,7 +355,7 @@ typedef struct RadarBurstFormat_s {
   uint8_t num_channels;
   uint8_t is_channels_interleaved;
   uint8_t is_big_endian;
-  uint8_t reserved_1;
+  RadarSamplePacking sample_packing;
 
   // Custom radar specific fields.
   union {
@@ -359,6 +376,32 @@ typedef struct RadarBurstFormat_s {
 
 } RadarBurstFormat;
 
+//! A read-only view into a burst that stays in driver owned memory.
+typedef struct RadarBurstLease_s {
+  //! Driver assigned identifier of the lease, used to release it.
+  uint32_t lease_id;
+  //! Size of the burst data in bytes.
+  uint32_t size_bytes;
+  //! A pointer to the burst data. Valid until the lease is released.
+  const uint8_t* data;
+  //! Data format of the leased burst.
+  RadarBurstFormat format;
+} RadarBurstLease;
+
+//! Counters of the application registered burst buffer ring.
+typedef struct RadarBurstBufferStats_s {
+  //! Number of bursts written into registered buffers.
+  uint64_t filled;
+  //! Number of bursts dropped because every buffer was owned by application.
+  uint64_t dropped_no_buffer;
+  //! Number of bursts dropped because they did not fit into a buffer.
+  uint64_t dropped_oversize;
+  //! Number of buffers currently owned by the application.
+  uint32_t app_owned;
+  //! Number of buffers currently owned by the driver, filled or empty.
+  uint32_t driver_owned;
+} RadarBurstBufferStats;
+
 //! A semantic version holder.
 typedef struct Version_s {
   uint8_t major;
@@ -0,0 +1,482 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <Beamformer.hpp>
+
+#include <RangeDoppler.hpp>
+#include <SimdLevel.hpp>
+#include <Window.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+#include <SimdIntrinsics.hpp>
+#endif
+
+namespace radar_dsp {
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+const double kSpeedOfLight = 299792458.0;
+
+// Snapshots beamformed together, sharing the loads of the steering vectors.
+const size_t kBatch = 4;
+// Directions of a table are padded to the widest vector.
+const size_t kDirectionAlignment = 16;
+
+// The power of the kBatch snapshots towards every direction,
+// |sum_e conj(a_e) s_e|^2, with the accumulators of a block of directions
+// kept in registers across the elements.
+//
+// re, im: steering vectors, element major with a stride of num_directions.
+// snapshots: kBatch snapshots of num_elements interleaved complex values.
+// power: kBatch spectra of num_directions.
+struct ScalarKernel {
+  static void Beam(const float* re, const float* im, size_t num_directions,
+                   size_t num_elements, const float* snapshots,
+                   float* power) {
+    for (size_t g = 0; g < num_directions; ++g) {
+      float yr[kBatch] = {};
+      float yi[kBatch] = {};
+      for (size_t e = 0; e < num_elements; ++e) {
+        float ar = re[e * num_directions + g];
+        float ai = im[e * num_directions + g];
+        for (size_t b = 0; b < kBatch; ++b) {
+          float sr = snapshots[2 * (b * num_elements + e)];
+          float si = snapshots[2 * (b * num_elements + e) + 1];
+          yr[b] += ar * sr + ai * si;
+          yi[b] += ar * si - ai * sr;
+        }
+      }
+      for (size_t b = 0; b < kBatch; ++b) {
+        power[b * num_directions + g] = yr[b] * yr[b] + yi[b] * yi[b];
+      }
+    }
+  }
+};
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+
+struct Sse41Kernel {
+  RADAR_DSP_TARGET_SSE41 static void Beam(
+      const float* re, const float* im, size_t num_directions,
+      size_t num_elements, const float* snapshots, float* power) {
+    for (size_t g = 0; g < num_directions; g += 4) {
+      __m128 yr[kBatch], yi[kBatch];
+      for (size_t b = 0; b < kBatch; ++b) {
+        yr[b] = yi[b] = _mm_setzero_ps();
+      }
+      for (size_t e = 0; e < num_elements; ++e) {
+        __m128 ar = _mm_loadu_ps(re + e * num_directions + g);
+        __m128 ai = _mm_loadu_ps(im + e * num_directions + g);
+        for (size_t b = 0; b < kBatch; ++b) {
+          __m128 sr = _mm_set1_ps(snapshots[2 * (b * num_elements + e)]);
+          __m128 si = _mm_set1_ps(snapshots[2 * (b * num_elements + e) + 1]);
+          yr[b] = _mm_add_ps(yr[b], _mm_add_ps(_mm_mul_ps(ar, sr),
+                                               _mm_mul_ps(ai, si)));
+          yi[b] = _mm_add_ps(yi[b], _mm_sub_ps(_mm_mul_ps(ar, si),
+                                               _mm_mul_ps(ai, sr)));
+        }
+      }
+      for (size_t b = 0; b < kBatch; ++b) {
+        _mm_storeu_ps(power + b * num_directions + g,
+                      _mm_add_ps(_mm_mul_ps(yr[b], yr[b]),
+                                 _mm_mul_ps(yi[b], yi[b])));
+      }
+    }
+  }
+};
+
+struct Avx2Kernel {
+  RADAR_DSP_TARGET_AVX2 static void Beam(
+      const float* re, const float* im, size_t num_directions,
+      size_t num_elements, const float* snapshots, float* power) {
+    for (size_t g = 0; g < num_directions; g += 8) {
+      __m256 yr[kBatch], yi[kBatch];
+      for (size_t b = 0; b < kBatch; ++b) {
+        yr[b] = yi[b] = _mm256_setzero_ps();
+      }
+      for (size_t e = 0; e < num_elements; ++e) {
+        __m256 ar = _mm256_loadu_ps(re + e * num_directions + g);
+        __m256 ai = _mm256_loadu_ps(im + e * num_directions + g);
+        for (size_t b = 0; b < kBatch; ++b) {
+          __m256 sr = _mm256_set1_ps(snapshots[2 * (b * num_elements + e)]);
+          __m256 si =
+              _mm256_set1_ps(snapshots[2 * (b * num_elements + e) + 1]);
+          yr[b] = _mm256_fmadd_ps(ar, sr, _mm256_fmadd_ps(ai, si, yr[b]));
+          yi[b] = _mm256_fnmadd_ps(ai, sr, _mm256_fmadd_ps(ar, si, yi[b]));
+        }
+      }
+      for (size_t b = 0; b < kBatch; ++b) {
+        _mm256_storeu_ps(power + b * num_directions + g,
+                         _mm256_fmadd_ps(yr[b], yr[b],
+                                         _mm256_mul_ps(yi[b], yi[b])));
+      }
+    }
+  }
+};
+
+struct Avx512Kernel {
+  RADAR_DSP_TARGET_AVX512 static void Beam(
+      const float* re, const float* im, size_t num_directions,
+      size_t num_elements, const float* snapshots, float* power) {
+    for (size_t g = 0; g < num_directions; g += 16) {
+      __m512 yr[kBatch], yi[kBatch];
+      for (size_t b = 0; b < kBatch; ++b) {
+        yr[b] = yi[b] = _mm512_setzero_ps();
+      }
+      for (size_t e = 0; e < num_elements; ++e) {
+        __m512 ar = _mm512_loadu_ps(re + e * num_directions + g);
+        __m512 ai = _mm512_loadu_ps(im + e * num_directions + g);
+        for (size_t b = 0; b < kBatch; ++b) {
+          __m512 sr = _mm512_set1_ps(snapshots[2 * (b * num_elements + e)]);
+          __m512 si =
+              _mm512_set1_ps(snapshots[2 * (b * num_elements + e) + 1]);
+          yr[b] = _mm512_fmadd_ps(ar, sr, _mm512_fmadd_ps(ai, si, yr[b]));
+          yi[b] = _mm512_fnmadd_ps(ai, sr, _mm512_fmadd_ps(ar, si, yi[b]));
+        }
+      }
+      for (size_t b = 0; b < kBatch; ++b) {
+        _mm512_storeu_ps(power + b * num_directions + g,
+                         _mm512_fmadd_ps(yr[b], yr[b],
+                                         _mm512_mul_ps(yi[b], yi[b])));
+      }
+    }
+  }
+};
+
+#endif  // RADAR_DSP_HAS_X86_SIMD
+
+void Beam(const float* re, const float* im, size_t num_directions,
+          size_t num_elements, const float* snapshots, float* power) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::Beam(re, im, num_directions, num_elements, snapshots,
+                         power);
+      return;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::Beam(re, im, num_directions, num_elements, snapshots,
+                       power);
+      return;
+    case SimdLevel::kSse41:
+      Sse41Kernel::Beam(re, im, num_directions, num_elements, snapshots,
+                        power);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::Beam(re, im, num_directions, num_elements, snapshots, power);
+}
+
+// Get the number of grid points from -max to max.
+size_t GetNumSteps(float max, float step) {
+  if (!(max > 0.0f && step > 0.0f)) {
+    return 1;
+  }
+  return 2 * static_cast<size_t>(max / step + 1e-3f) + 1;
+}
+
+// Offset of the peak of a parabola through three points from the middle.
+float GetPeakOffset(float left, float middle, float right) {
+  float curvature = left - 2.0f * middle + right;
+  if (curvature >= 0.0f) {
+    return 0.0f;
+  }
+  return std::max(-0.5f, std::min(0.5f, 0.5f * (left - right) / curvature));
+}
+
+}  // namespace
+
+struct SteeringTable {
+  SteeringTable(const VirtualArray& virtual_array, const AngleGrid& grid)
+      : array(virtual_array) {
+    const size_t num_elements = array.x.size();
+    bool has_elevation = false;
+    for (size_t e = 1; e < num_elements; ++e) {
+      has_elevation = has_elevation || array.y[e] != array.y[0];
+    }
+    num_azimuths = GetNumSteps(grid.max_azimuth_deg, grid.azimuth_step_deg);
+    num_elevations = has_elevation ? GetNumSteps(grid.max_elevation_deg,
+                                                 grid.elevation_step_deg)
+                                   : 1;
+    azimuth_step_deg = grid.azimuth_step_deg;
+    elevation_step_deg = grid.elevation_step_deg;
+    size_t num_points = num_azimuths * num_elevations;
+    num_directions = (num_points + kDirectionAlignment - 1) /
+                     kDirectionAlignment * kDirectionAlignment;
+
+    // Padding directions have zero steering vectors, so no power.
+    re.assign(num_elements * num_directions, 0.0f);
+    im.assign(num_elements * num_directions, 0.0f);
+    const double wavenumber = 2.0 * kPi / array.wavelength_m;
+    for (size_t el = 0; el < num_elevations; ++el) {
+      double elevation = GetElevation(el) * kPi / 180.0;
+      for (size_t az = 0; az < num_azimuths; ++az) {
+        double azimuth = GetAzimuth(az) * kPi / 180.0;
+        double ux = std::cos(elevation) * std::sin(azimuth);
+        double uy = std::sin(elevation);
+        double uz = std::cos(elevation) * std::cos(azimuth);
+        for (size_t e = 0; e < num_elements; ++e) {
+          double phase = -wavenumber * (array.x[e] * ux + array.y[e] * uy +
+                                        array.z[e] * uz);
+          size_t index = e * num_directions + el * num_azimuths + az;
+          re[index] = static_cast<float>(std::cos(phase));
+          im[index] = static_cast<float>(std::sin(phase));
+        }
+      }
+    }
+  }
+
+  double GetAzimuth(double index) const {
+    return (index - 0.5 * (num_azimuths - 1)) * azimuth_step_deg;
+  }
+
+  double GetElevation(double index) const {
+    return (index - 0.5 * (num_elevations - 1)) * elevation_step_deg;
+  }
+
+  VirtualArray array;
+  size_t num_azimuths;
+  size_t num_elevations;
+  double azimuth_step_deg;
+  double elevation_step_deg;
+  //! Grid points padded to kDirectionAlignment.
+  size_t num_directions;
+  //! Steering vectors, element major.
+  std::vector<float> re;
+  std::vector<float> im;
+};
+
+void AngleEstimates::Clear() {
+  azimuth_deg.clear();
+  elevation_deg.clear();
+  power.clear();
+}
+
+RadarReturnCode GetVirtualArray(radar_api::IRadarSensor& radar,
+                                uint8_t slot_id, VirtualArray& array) {
+  uint32_t tx_mask = 0, rx_mask = 0, lower_mhz = 0, upper_mhz = 0;
+  RadarReturnCode rc = radar.GetMainParam(
+      slot_id, {RADAR_PARAM_GROUP_COMMON, RADAR_PARAM_TX_ANTENNA_MASK},
+      tx_mask);
+  if (rc == RC_OK) {
+    rc = radar.GetMainParam(
+        slot_id, {RADAR_PARAM_GROUP_COMMON, RADAR_PARAM_RX_ANTENNA_MASK},
+        rx_mask);
+  }
+  if (rc == RC_OK) {
+    rc = radar.GetMainParam(
+        slot_id, {RADAR_PARAM_GROUP_FMCW, FMCW_PARAM_LOWER_FREQ_MHZ},
+        lower_mhz);
+  }
+  if (rc == RC_OK) {
+    rc = radar.GetMainParam(
+        slot_id, {RADAR_PARAM_GROUP_FMCW, FMCW_PARAM_UPPER_FREQ_MHZ},
+        upper_mhz);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+
+  std::vector<int32_t> tx_positions, rx_positions;
+  for (uint32_t bit = 0; bit < 32; ++bit) {
+    int32_t x, y, z;
+    if ((tx_mask >> bit) & 1) {
+      rc = radar.GetTxPosition(1u << bit, x, y, z);
+      if (rc != RC_OK) {
+        return rc;
+      }
+      tx_positions.insert(tx_positions.end(), {x, y, z});
+    }
+    if ((rx_mask >> bit) & 1) {
+      rc = radar.GetRxPosition(1u << bit, x, y, z);
+      if (rc != RC_OK) {
+        return rc;
+      }
+      rx_positions.insert(rx_positions.end(), {x, y, z});
+    }
+  }
+  if (tx_positions.empty() || rx_positions.empty() ||
+      lower_mhz + upper_mhz == 0) {
+    return RC_BAD_INPUT;
+  }
+
+  array.num_tx = static_cast<uint32_t>(tx_positions.size() / 3);
+  array.num_rx = static_cast<uint32_t>(rx_positions.size() / 3);
+  array.x.clear();
+  array.y.clear();
+  array.z.clear();
+  for (size_t tx = 0; tx < tx_positions.size(); tx += 3) {
+    for (size_t rx = 0; rx < rx_positions.size(); rx += 3) {
+      // Micrometers to meters.
+      array.x.push_back((tx_positions[tx] + rx_positions[rx]) * 1e-6f);
+      array.y.push_back((tx_positions[tx + 1] + rx_positions[rx + 1]) *
+                        1e-6f);
+      array.z.push_back((tx_positions[tx + 2] + rx_positions[rx + 2]) *
+                        1e-6f);
+    }
+  }
+  double center_hz = 0.5e6 * (static_cast<double>(lower_mhz) + upper_mhz);
+  array.wavelength_m = kSpeedOfLight / center_hz;
+  return RC_OK;
+}
+
+Beamformer::Beamformer(const AngleGrid& grid, WindowType doppler_window)
+    : grid_(grid), doppler_window_type_(doppler_window) {}
+
+Beamformer::~Beamformer() {}
+
+RadarReturnCode Beamformer::SetArray(uint8_t config_id,
+                                     const VirtualArray& array) {
+  size_t num_elements = static_cast<size_t>(array.num_tx) * array.num_rx;
+  if (num_elements == 0 || array.x.size() != num_elements ||
+      array.y.size() != num_elements || array.z.size() != num_elements ||
+      !(array.wavelength_m > 0.0)) {
+    return RC_BAD_INPUT;
+  }
+  std::shared_ptr<const SteeringTable> table =
+      std::make_shared<SteeringTable>(array, grid_);
+  for (auto& entry : tables_) {
+    if (entry.first == config_id) {
+      entry.second = table;
+      return RC_OK;
+    }
+  }
+  tables_.emplace_back(config_id, table);
+  return RC_OK;
+}
+
+RadarReturnCode Beamformer::SetArray(radar_api::IRadarSensor& radar,
+                                     uint8_t slot_id) {
+  VirtualArray array;
+  RadarReturnCode rc = GetVirtualArray(radar, slot_id, array);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  return SetArray(slot_id, array);
+}
+
+const VirtualArray* Beamformer::GetArray(uint8_t config_id) const {
+  const SteeringTable* table = FindTable(config_id);
+  return table != nullptr ? &table->array : nullptr;
+}
+
+const SteeringTable* Beamformer::FindTable(uint8_t config_id) const {
+  for (const auto& entry : tables_) {
+    if (entry.first == config_id) {
+      return entry.second.get();
+    }
+  }
+  return nullptr;
+}
+
+RadarReturnCode Beamformer::GetSnapshots(
+    uint8_t config_id, const CubeShape& range_shape,
+    const std::complex<float>* range_cube, const CfarDetections& detections,
+    std::vector<std::complex<float>>& snapshots) {
+  const SteeringTable* table = FindTable(config_id);
+  if (table == nullptr || range_cube == nullptr ||
+      range_shape.num_channels != table->array.num_rx ||
+      range_shape.Size() == 0) {
+    return RC_BAD_INPUT;
+  }
+  const size_t num_tx = table->array.num_tx;
+  const size_t num_rx = table->array.num_rx;
+  const size_t num_chirps = range_shape.num_chirps;
+  const size_t num_range_bins = range_shape.num_samples;
+  const size_t num_doppler_bins = RangeDoppler::GetNumDopplerBins(num_chirps);
+  if (doppler_twiddles_.size() != num_doppler_bins) {
+    doppler_twiddles_.resize(num_doppler_bins);
+    for (size_t k = 0; k < num_doppler_bins; ++k) {
+      doppler_twiddles_[k] = std::polar(
+          1.0f, static_cast<float>(-2.0 * kPi * k / num_doppler_bins));
+    }
+  }
+  if (doppler_window_.size() != num_chirps) {
+    doppler_window_ = MakeWindow(doppler_window_type_, num_chirps);
+  }
+
+  snapshots.assign(detections.Size() * num_tx * num_rx, 0.0f);
+  for (size_t i = 0; i < detections.Size(); ++i) {
+    size_t range_bin = detections.range_bin[i];
+    size_t doppler_bin = detections.doppler_bin[i];
+    if (range_bin >= num_range_bins || doppler_bin >= num_doppler_bins) {
+      return RC_BAD_INPUT;
+    }
+    // The map has zero velocity in the middle, undo the shift.
+    size_t frequency = (doppler_bin + num_doppler_bins / 2) %
+                       num_doppler_bins;
+    std::complex<float>* snapshot = &snapshots[i * num_tx * num_rx];
+    // Every TX antenna sees the chirps of its turns, their DFT at
+    // the frequency of the detection keeps the phase of the chirp times.
+    for (size_t rx = 0; rx < num_rx; ++rx) {
+      const std::complex<float>* bins =
+          range_cube + rx * num_chirps * num_range_bins + range_bin;
+      for (size_t chirp = 0; chirp < num_chirps; ++chirp) {
+        std::complex<float> twiddle =
+            doppler_twiddles_[(frequency * chirp) % num_doppler_bins];
+        snapshot[(chirp % num_tx) * num_rx + rx] +=
+            bins[chirp * num_range_bins] * twiddle * doppler_window_[chirp];
+      }
+    }
+  }
+  return RC_OK;
+}
+
+RadarReturnCode Beamformer::Estimate(uint8_t config_id,
+                                     const std::complex<float>* snapshots,
+                                     size_t num_snapshots,
+                                     AngleEstimates& angles) {
+  angles.Clear();
+  const SteeringTable* table = FindTable(config_id);
+  if (table == nullptr || (snapshots == nullptr && num_snapshots > 0)) {
+    return RC_BAD_INPUT;
+  }
+  const size_t num_elements = table->array.x.size();
+  const size_t num_directions = table->num_directions;
+  const size_t num_azimuths = table->num_azimuths;
+  const size_t num_points = num_azimuths * table->num_elevations;
+  batch_.resize(2 * kBatch * num_elements);
+  spectra_.resize(kBatch * num_directions);
+  const float* values = reinterpret_cast<const float*>(snapshots);
+
+  for (size_t first = 0; first < num_snapshots; first += kBatch) {
+    size_t batch_size = std::min(kBatch, num_snapshots - first);
+    // The last batch is padded with zero snapshots.
+    std::fill(batch_.begin(), batch_.end(), 0.0f);
+    std::copy(values + 2 * first * num_elements,
+              values + 2 * (first + batch_size) * num_elements,
+              batch_.begin());
+    Beam(table->re.data(), table->im.data(), num_directions, num_elements,
+         batch_.data(), spectra_.data());
+
+    for (size_t b = 0; b < batch_size; ++b) {
+      const float* spectrum = &spectra_[b * num_directions];
+      size_t peak = static_cast<size_t>(
+          std::max_element(spectrum, spectrum + num_points) - spectrum);
+      size_t az = peak % num_azimuths;
+      size_t el = peak / num_azimuths;
+      float az_offset = 0.0f, el_offset = 0.0f;
+      if (az > 0 && az + 1 < num_azimuths) {
+        az_offset = GetPeakOffset(spectrum[peak - 1], spectrum[peak],
+                                  spectrum[peak + 1]);
+      }
+      if (el > 0 && el + 1 < table->num_elevations) {
+        el_offset = GetPeakOffset(spectrum[peak - num_azimuths],
+                                  spectrum[peak],
+                                  spectrum[peak + num_azimuths]);
+      }
+      angles.azimuth_deg.push_back(
+          static_cast<float>(table->GetAzimuth(az + az_offset)));
+      angles.elevation_deg.push_back(
+          static_cast<float>(table->GetElevation(el + el_offset)));
+      angles.power.push_back(spectrum[peak]);
+    }
+  }
+  return RC_OK;
+}
+
+}  // namespace radar_dsp
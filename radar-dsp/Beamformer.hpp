@@ -0,0 +1,202 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Angle of arrival estimation with a MIMO virtual array.
+ *
+ * @details The virtual array of a config slot has one element per pair of
+ *          enabled TX and RX antennas, placed at the sum of their positions
+ *          as returned by GetTxPosition and GetRxPosition. The TX antennas
+ *          are expected to take turns chirp by chirp, in the order of their
+ *          mask bits, and every RX antenna is a channel of the bursts.
+ *
+ *          Steering vectors of an azimuth x elevation grid are computed once
+ *          per config, when the array is set. For each detection, the virtual
+ *          array snapshot is taken from the range cube at its Doppler
+ *          frequency, with the Doppler window of the map, which also
+ *          compensates the motion of the target between the TX turns. The
+ *          snapshots of four detections at a time are then beamformed
+ *          against the whole grid by a SIMD complex matrix-vector kernel,
+ *          and the peak of every spectrum is interpolated.
+ *
+ *          Directions follow the antenna axes: azimuth turns from boresight,
+ *          the z axis, towards x, elevation towards y. The IF phase of
+ *          an element is expected to lag by 2 pi (p . u) / wavelength when
+ *          it is closer to the target by p . u. Arrays without y extent see
+ *          no elevation, their grid only has elevation 0.
+ *
+ *          An instance holds scratch buffers and must be used by one thread
+ *          at a time.
+ *
+ * Example:
+ * ```
+ *   radar_dsp::Beamformer beamformer(radar_dsp::AngleGrid(),
+ *                                    doppler_window);
+ *   RadarReturnCode rc = beamformer.SetArray(*radar, slot_id);
+ *   ...
+ *   beamformer.GetSnapshots(format.config_id, range_doppler.GetRangeShape(),
+ *                           range_doppler.GetRangeCube().data(), detections,
+ *                           snapshots);
+ *   beamformer.Estimate(format.config_id, snapshots.data(),
+ *                       detections.Size(), angles);
+ * ```
+ */
+#ifndef RIPPLE_RADAR_DSP_BEAMFORMER_HPP_
+#define RIPPLE_RADAR_DSP_BEAMFORMER_HPP_
+
+#include <IRadarSensor.hpp>
+#include <RadarCommon.h>
+
+#include <Cfar.hpp>
+#include <RadarCube.hpp>
+#include <Window.hpp>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace radar_dsp {
+
+//! Elements of a MIMO virtual array, element tx * num_rx + rx.
+struct VirtualArray {
+  uint32_t num_tx;
+  uint32_t num_rx;
+  //! Element positions in meters.
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> z;
+  double wavelength_m;
+};
+
+/**
+ * @brief Build the virtual array of a config slot.
+ *
+ * @details Reads the TX and RX antenna masks of the slot and the positions
+ *          of their antennas. The wavelength is taken at the center of
+ *          the FMCW chirps.
+ *
+ * @param radar the radar sensor.
+ * @param slot_id the config slot.
+ * @param array where the virtual array will be written into.
+ *
+ * @return RC_OK, RC_BAD_INPUT if no TX or RX antenna is enabled, or
+ *         the error of the radar reading the masks, positions or
+ *         frequencies.
+ */
+RadarReturnCode GetVirtualArray(radar_api::IRadarSensor& radar,
+                                uint8_t slot_id, VirtualArray& array);
+
+//! Directions the snapshots are beamformed to.
+struct AngleGrid {
+  //! Azimuths from -max_azimuth_deg to max_azimuth_deg.
+  float max_azimuth_deg = 60.0f;
+  float azimuth_step_deg = 1.0f;
+  //! Elevations from -max_elevation_deg to max_elevation_deg.
+  float max_elevation_deg = 30.0f;
+  float elevation_step_deg = 2.0f;
+};
+
+//! Estimated angles as a struct of arrays, one element per snapshot.
+struct AngleEstimates {
+  std::vector<float> azimuth_deg;
+  std::vector<float> elevation_deg;
+  //! Beamformed power at the peak.
+  std::vector<float> power;
+
+  size_t Size() const {
+    return azimuth_deg.size();
+  }
+
+  void Clear();
+};
+
+//! Steering vectors of one config, defined in Beamformer.cpp.
+struct SteeringTable;
+
+class Beamformer {
+ public:
+  /**
+   * @param grid the directions to beamform to.
+   * @param doppler_window the window applied across the chirps by the
+   *        range-Doppler maps of the detections, see RangeDoppler.hpp.
+   */
+  explicit Beamformer(const AngleGrid& grid = AngleGrid(),
+                      WindowType doppler_window = WindowType::kHann);
+  ~Beamformer();
+
+  /**
+   * @brief Set the virtual array of a config and compute its steering
+   *        vectors.
+   *
+   * @param config_id the config_id of the bursts of the array.
+   * @param array the virtual array.
+   *
+   * @return RC_OK or RC_BAD_INPUT for an empty array or a non positive
+   *         wavelength.
+   */
+  RadarReturnCode SetArray(uint8_t config_id, const VirtualArray& array);
+
+  /**
+   * @brief Set the virtual array of a config slot of a radar.
+   *
+   * @details The config_id of the bursts is expected to be the slot_id.
+   */
+  RadarReturnCode SetArray(radar_api::IRadarSensor& radar, uint8_t slot_id);
+
+  //! Get the virtual array of a config, nullptr if none was set.
+  const VirtualArray* GetArray(uint8_t config_id) const;
+
+  /**
+   * @brief Take the virtual array snapshots of detections.
+   *
+   * @param config_id the config_id of the burst.
+   * @param range_shape the dimensions of the range cube, one channel per RX
+   *        antenna of the array.
+   * @param range_cube the range cube the map was computed from, laid out as
+   *        CubeLayout::kChannelChirpSample.
+   * @param detections the detections on the range-Doppler map.
+   * @param snapshots where the snapshots will be written into, one per
+   *        detection of as many elements as the virtual array.
+   *
+   * @return RC_OK, RC_BAD_INPUT if no array is set for the config, or the
+   *         range cube does not match the array or the detections.
+   */
+  RadarReturnCode GetSnapshots(uint8_t config_id,
+                               const CubeShape& range_shape,
+                               const std::complex<float>* range_cube,
+                               const CfarDetections& detections,
+                               std::vector<std::complex<float>>& snapshots);
+
+  /**
+   * @brief Estimate the angles of snapshots.
+   *
+   * @param config_id the config_id of the burst.
+   * @param snapshots the snapshots, one after another.
+   * @param num_snapshots the number of snapshots.
+   * @param angles where the angles will be written into.
+   *
+   * @return RC_OK or RC_BAD_INPUT if no array is set for the config.
+   */
+  RadarReturnCode Estimate(uint8_t config_id,
+                           const std::complex<float>* snapshots,
+                           size_t num_snapshots, AngleEstimates& angles);
+
+ private:
+  const SteeringTable* FindTable(uint8_t config_id) const;
+
+  AngleGrid grid_;
+  WindowType doppler_window_type_;
+  //! Tables of the configs, few enough for a linear search.
+  std::vector<std::pair<uint8_t, std::shared_ptr<const SteeringTable>>>
+      tables_;
+  std::vector<std::complex<float>> doppler_twiddles_;
+  std::vector<float> doppler_window_;
+  std::vector<float> batch_;
+  std::vector<float> spectra_;
+};
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_BEAMFORMER_HPP_
@@ -0,0 +1,1117 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <BurstCodec.hpp>
+
+#include <SamplePacking.hpp>
+#include <SampleUnpack.hpp>
+#include <SimdLevel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+#include <SimdIntrinsics.hpp>
+#endif
+
+namespace radar_dsp {
+
+namespace {
+
+// Version 2 added the Rice coded blocks and the linear predictor, version 1
+// data decodes the same.
+const uint8_t kVersion = 2;
+// Components of a block, packed as 32 components in each of 4 lanes.
+const int kBlockComponents = 128;
+const int kLanes = 4;
+// Blocks converted from and to containers at a time.
+const int kChunkComponents = 16 * kBlockComponents;
+// Distance of the predicted component, larger ones predict from the
+// previous component of the same sample.
+const int kMaxStride = 512;
+// Widest residual, the difference of two 16-bit components.
+const int kMaxBits = 17;
+// Descriptor of a block predicted from the previous sample.
+const uint8_t kPredictedBlock = 0x80;
+// Descriptor of a block of Rice codes, the low bits hold the parameter k
+// instead of the packed width.
+const uint8_t kRiceBlock = 0x40;
+const uint8_t kBlockBits = 0x3f;
+// Quotients of a Rice code from this one on are written as this many ones
+// followed by the value in kMaxBits bits.
+const uint32_t kRiceEscape = 16;
+// Bytes of the size of a Rice coded block, written before its codes.
+const size_t kRiceSizeBytes = 2;
+// Set when signed padding bits are sign-extended instead of zero.
+const uint8_t kSignPadded = 0x01;
+// Set when the residuals are quantized, the error bound of every channel
+// follows the header.
+const uint8_t kQuantized = 0x02;
+// Set when the blocks are predicted by a linear predictor of the burst,
+// which follows the error bounds, instead of the previous sample.
+const uint8_t kLinearPredicted = 0x04;
+// Most previous samples a linear predictor is made of. Beat tones of two
+// targets are cancelled by four.
+const int kMaxOrder = 8;
+// Largest fraction bits of the predictor coefficients.
+const int kMaxCoefficientShift = 14;
+// Number of chunks the linear predictor is fitted to.
+const size_t kFitChunks = 16;
+
+struct EncodedHeader {
+  uint8_t version;
+  uint8_t flags;
+  uint16_t stride;
+  //! Number of components of the burst.
+  uint32_t count;
+};
+
+static_assert(sizeof(EncodedHeader) == 8, "Encoded header layout");
+
+// The quantization steps of the components of a burst.
+struct Quantizer {
+  std::vector<int32_t> steps;
+  bool is_interleaved;
+  size_t components;
+  size_t channel_components;
+  int32_t min_value;
+  int32_t max_value;
+
+  size_t GetChannel(size_t index) const {
+    const size_t num_channels = steps.size();
+    return is_interleaved
+               ? index / components % num_channels
+               : std::min(index / channel_components, num_channels - 1);
+  }
+
+  // Get the steps of the components from first on.
+  void GetSteps(size_t first, size_t num, int32_t* block_steps) const {
+    for (size_t i = 0; i < num; ++i) {
+      block_steps[i] = steps[GetChannel(first + i)];
+    }
+  }
+
+  int32_t Clamp(int64_t value) const {
+    return static_cast<int32_t>(
+        std::max<int64_t>(min_value, std::min<int64_t>(value, max_value)));
+  }
+};
+
+// How components are read from and written to their containers.
+struct ValueLayout {
+  int container_bytes;
+  bool is_big_endian;
+  bool is_signed;
+  int bits;
+  uint32_t mask;
+  uint32_t container_mask;
+};
+
+uint32_t GetMask(int bits) {
+  return bits >= 32 ? ~0u : (1u << bits) - 1;
+}
+
+int32_t SignExtend(uint32_t value, int bits) {
+  int shift = 32 - bits;
+  return static_cast<int32_t>(value << shift) >> shift;
+}
+
+uint32_t ZigZag(int32_t value) {
+  return (static_cast<uint32_t>(value) << 1) ^
+         static_cast<uint32_t>(value >> 31);
+}
+
+uint32_t UnZigZag(uint32_t value) {
+  return (value >> 1) ^ (0u - (value & 1));
+}
+
+int GetWidth(uint32_t value) {
+  int bits = 0;
+  for (; value != 0; value >>= 1) {
+    ++bits;
+  }
+  return bits;
+}
+
+RadarReturnCode GetCodecLayout(const RadarBurstFormat& format,
+                               SampleLayout& layout) {
+  RadarReturnCode rc = GetSampleLayout(format, layout);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  return layout.is_float || layout.bits > 16 ? RC_UNSUPPORTED : RC_OK;
+}
+
+// Number of components of burst data, 0 if it does not hold whole samples.
+size_t GetCount(const RadarBurstFormat& format, const SampleLayout& layout,
+                size_t size_bytes) {
+  size_t num_samples = GetNumSamples(format, size_bytes);
+  if (GetBurstBytes(format, num_samples) != size_bytes) {
+    return 0;
+  }
+  return num_samples * layout.components;
+}
+
+int GetStride(const RadarBurstFormat& format, const SampleLayout& layout) {
+  int stride = layout.components;
+  if (format.is_channels_interleaved && format.num_channels > 1) {
+    stride *= format.num_channels;
+  }
+  return stride <= kMaxStride ? stride : layout.components;
+}
+
+template <int kBytes, bool kSwap>
+uint32_t LoadContainer(const uint8_t* src) {
+  if (kBytes == 1) {
+    return src[0];
+  }
+  return kSwap ? (static_cast<uint32_t>(src[0]) << 8) | src[1]
+               : src[0] | (static_cast<uint32_t>(src[1]) << 8);
+}
+
+template <int kBytes, bool kSwap>
+void StoreContainer(uint8_t* dst, uint32_t value) {
+  if (kBytes == 1) {
+    dst[0] = static_cast<uint8_t>(value);
+  } else if (kSwap) {
+    dst[0] = static_cast<uint8_t>(value >> 8);
+    dst[1] = static_cast<uint8_t>(value);
+  } else {
+    dst[0] = static_cast<uint8_t>(value);
+    dst[1] = static_cast<uint8_t>(value >> 8);
+  }
+}
+
+// Read components, flagging the padding bits that are not zero and the ones
+// that are not sign-extended.
+template <int kBytes, bool kSwap>
+void LoadValues(const ValueLayout& layout, const uint8_t* data, size_t count,
+                int32_t* values, uint32_t& zero_errors,
+                uint32_t& sign_errors) {
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t container = LoadContainer<kBytes, kSwap>(data + i * kBytes);
+    int32_t value = layout.is_signed
+                        ? SignExtend(container & layout.mask, layout.bits)
+                        : static_cast<int32_t>(container & layout.mask);
+    values[i] = value;
+    zero_errors |= container & ~layout.mask;
+    sign_errors |= container ^
+                   (static_cast<uint32_t>(value) & layout.container_mask);
+  }
+}
+
+template <int kBytes, bool kSwap>
+void StoreValues(const ValueLayout& layout, const int32_t* values,
+                 size_t count, bool is_sign_padded, uint8_t* data) {
+  const uint32_t mask = is_sign_padded ? layout.container_mask : layout.mask;
+  for (size_t i = 0; i < count; ++i) {
+    StoreContainer<kBytes, kSwap>(data + i * kBytes,
+                                  static_cast<uint32_t>(values[i]) & mask);
+  }
+}
+
+using LoadFunction = void (*)(const ValueLayout&, const uint8_t*, size_t,
+                              int32_t*, uint32_t&, uint32_t&);
+using StoreFunction = void (*)(const ValueLayout&, const int32_t*, size_t,
+                               bool, uint8_t*);
+
+void GetValueLayout(const SampleLayout& layout, ValueLayout& values,
+                    LoadFunction& load, StoreFunction& store) {
+  values.container_bytes = layout.container_bytes;
+  values.is_big_endian = layout.is_big_endian;
+  values.is_signed = layout.is_signed;
+  values.bits = layout.bits;
+  values.mask = GetMask(layout.bits);
+  values.container_mask = GetMask(layout.container_bytes * 8);
+  if (layout.container_bytes == 1) {
+    load = LoadValues<1, false>;
+    store = StoreValues<1, false>;
+  } else if (layout.is_big_endian) {
+    load = LoadValues<2, true>;
+    store = StoreValues<2, true>;
+  } else {
+    load = LoadValues<2, false>;
+    store = StoreValues<2, false>;
+  }
+}
+
+// Blocks are packed in bits words of 4 lanes, lane l holds the components
+// l, l + 4, l + 8... from the low bits up, so the SIMD kernels only shift
+// whole vectors.
+void PackBlockScalar(const uint32_t* values, int bits, uint8_t* out) {
+  for (int lane = 0; lane < kLanes; ++lane) {
+    uint32_t word = 0;
+    int shift = 0;
+    int index = 0;
+    for (int k = 0; k < kBlockComponents / kLanes; ++k) {
+      uint32_t value = values[k * kLanes + lane];
+      word |= value << shift;
+      shift += bits;
+      if (shift >= 32) {
+        memcpy(out + (index * kLanes + lane) * 4, &word, 4);
+        ++index;
+        shift -= 32;
+        word = shift > 0 ? value >> (bits - shift) : 0;
+      }
+    }
+  }
+}
+
+void UnpackBlockScalar(const uint8_t* in, int bits, uint32_t* values) {
+  if (bits == 0) {
+    memset(values, 0, kBlockComponents * sizeof(*values));
+    return;
+  }
+  const uint32_t mask = GetMask(bits);
+  for (int lane = 0; lane < kLanes; ++lane) {
+    uint32_t word = 0;
+    memcpy(&word, in + lane * 4, 4);
+    int shift = 0;
+    int index = 0;
+    for (int k = 0; k < kBlockComponents / kLanes; ++k) {
+      uint32_t value = word >> shift;
+      shift += bits;
+      if (shift >= 32) {
+        shift -= 32;
+        if (++index < bits) {
+          memcpy(&word, in + (index * kLanes + lane) * 4, 4);
+          if (shift > 0) {
+            value |= word << (bits - shift);
+          }
+        }
+      }
+      values[k * kLanes + lane] = value & mask;
+    }
+  }
+}
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+
+RADAR_DSP_TARGET_SSE41 void PackBlockSse41(const uint32_t* values, int bits,
+                                           uint8_t* out) {
+  __m128i word = _mm_setzero_si128();
+  int shift = 0;
+  for (int k = 0; k < kBlockComponents / kLanes; ++k) {
+    __m128i value = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(values + k * kLanes));
+    word = _mm_or_si128(word, _mm_sll_epi32(value, _mm_cvtsi32_si128(shift)));
+    shift += bits;
+    if (shift >= 32) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out), word);
+      out += sizeof(word);
+      shift -= 32;
+      word = shift > 0
+                 ? _mm_srl_epi32(value, _mm_cvtsi32_si128(bits - shift))
+                 : _mm_setzero_si128();
+    }
+  }
+}
+
+RADAR_DSP_TARGET_SSE41 void UnpackBlockSse41(const uint8_t* in, int bits,
+                                             uint32_t* values) {
+  if (bits == 0) {
+    memset(values, 0, kBlockComponents * sizeof(*values));
+    return;
+  }
+  const __m128i mask = _mm_set1_epi32(static_cast<int>(GetMask(bits)));
+  __m128i word = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+  int shift = 0;
+  int index = 0;
+  for (int k = 0; k < kBlockComponents / kLanes; ++k) {
+    __m128i value = _mm_srl_epi32(word, _mm_cvtsi32_si128(shift));
+    shift += bits;
+    if (shift >= 32) {
+      shift -= 32;
+      if (++index < bits) {
+        word = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(in + index * sizeof(word)));
+        if (shift > 0) {
+          value = _mm_or_si128(
+              value, _mm_sll_epi32(word, _mm_cvtsi32_si128(bits - shift)));
+        }
+      }
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(values + k * kLanes),
+                     _mm_and_si128(value, mask));
+  }
+}
+
+#endif  // RADAR_DSP_HAS_X86_SIMD
+
+using PackFunction = void (*)(const uint32_t*, int, uint8_t*);
+using UnpackFunction = void (*)(const uint8_t*, int, uint32_t*);
+
+PackFunction GetPackFunction(void) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  if (GetSimdLevel() >= SimdLevel::kSse41) {
+    return PackBlockSse41;
+  }
+#endif
+  return PackBlockScalar;
+}
+
+UnpackFunction GetUnpackFunction(void) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  if (GetSimdLevel() >= SimdLevel::kSse41) {
+    return UnpackBlockSse41;
+  }
+#endif
+  return UnpackBlockScalar;
+}
+
+size_t GetBlockBytes(int bits) {
+  return static_cast<size_t>(bits) * kLanes * 4;
+}
+
+// A Rice code is the quotient value >> k in unary, as ones ended by a zero,
+// followed by the k low bits of the value. It takes about log2 of the mean
+// value bits instead of the width of the largest one, which is what
+// quantized residuals gain most from.
+size_t GetRiceBits(const uint32_t* values, int k) {
+  size_t bits = 0;
+  for (int i = 0; i < kBlockComponents; ++i) {
+    const uint32_t quotient = values[i] >> k;
+    bits += quotient < kRiceEscape ? quotient + 1 + k
+                                   : kRiceEscape + kMaxBits;
+  }
+  return bits;
+}
+
+// Choose the parameter with the fewest bits around log2 of the mean value.
+int GetRiceParameter(const uint32_t* values, size_t& min_bits) {
+  uint64_t sum = 0;
+  for (int i = 0; i < kBlockComponents; ++i) {
+    sum += values[i];
+  }
+  const int estimate = GetWidth(static_cast<uint32_t>(
+      sum / kBlockComponents));
+  int best = 0;
+  min_bits = SIZE_MAX;
+  for (int k = std::max(estimate - 2, 0);
+       k <= std::min(estimate, kMaxBits - 1); ++k) {
+    const size_t bits = GetRiceBits(values, k);
+    if (bits < min_bits) {
+      min_bits = bits;
+      best = k;
+    }
+  }
+  return best;
+}
+
+class BitWriter {
+ public:
+  explicit BitWriter(uint8_t* out) : out_(out), bits_(0), count_(0) {}
+
+  // Append the low num bits of value, num is at most 32.
+  void Write(uint32_t value, int num) {
+    bits_ |= static_cast<uint64_t>(value) << count_;
+    count_ += num;
+    while (count_ >= 8) {
+      *out_++ = static_cast<uint8_t>(bits_);
+      bits_ >>= 8;
+      count_ -= 8;
+    }
+  }
+
+  // Write the last partial byte and get the end of the data.
+  uint8_t* Finish() {
+    if (count_ > 0) {
+      *out_++ = static_cast<uint8_t>(bits_);
+    }
+    return out_;
+  }
+
+ private:
+  uint8_t* out_;
+  uint64_t bits_;
+  int count_;
+};
+
+// Count the ones before the first zero, up to kRiceEscape.
+uint32_t CountOnes(uint32_t bits) {
+  bits = ~bits | (1u << kRiceEscape);
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint32_t>(__builtin_ctz(bits));
+#else
+  uint32_t count = 0;
+  while ((bits & 1) == 0) {
+    bits >>= 1;
+    ++count;
+  }
+  return count;
+#endif
+}
+
+// Reads zeros past the end of the data, so corrupt codes are caught by
+// checking the number of bits consumed once decoded.
+class BitReader {
+ public:
+  BitReader(const uint8_t* in, size_t size)
+      : in_(in), end_(in + size), bits_(0), count_(0), consumed_(0) {}
+
+  // Get the next 56 bits at least without consuming them.
+  uint64_t Peek() {
+    if (end_ - in_ >= 8) {
+      uint64_t word = 0;
+      for (int i = 0; i < 8; ++i) {
+        word |= static_cast<uint64_t>(in_[i]) << (8 * i);
+      }
+      bits_ |= word << count_;
+      in_ += (63 - count_) / 8;
+      count_ |= 56;
+    } else {
+      while (count_ <= 56) {
+        const uint64_t byte = in_ < end_ ? *in_++ : 0;
+        bits_ |= byte << count_;
+        count_ += 8;
+      }
+    }
+    return bits_;
+  }
+
+  void Skip(int num) {
+    bits_ >>= num;
+    count_ -= num;
+    consumed_ += num;
+  }
+
+  size_t GetConsumedBits() const {
+    return consumed_;
+  }
+
+ private:
+  const uint8_t* in_;
+  const uint8_t* end_;
+  uint64_t bits_;
+  int count_;
+  size_t consumed_;
+};
+
+uint8_t* WriteRiceBlock(const uint32_t* values, int k, size_t num_bits,
+                        uint8_t* out) {
+  const uint16_t size = static_cast<uint16_t>((num_bits + 7) / 8);
+  memcpy(out, &size, sizeof(size));
+  BitWriter writer(out + kRiceSizeBytes);
+  const uint32_t mask = GetMask(k);
+  for (int i = 0; i < kBlockComponents; ++i) {
+    const uint32_t quotient = values[i] >> k;
+    if (quotient < kRiceEscape) {
+      // The ones and the zero ending them.
+      writer.Write((1u << quotient) - 1, quotient + 1);
+      writer.Write(values[i] & mask, k);
+    } else {
+      writer.Write((1u << kRiceEscape) - 1, kRiceEscape);
+      writer.Write(values[i], kMaxBits);
+    }
+  }
+  return writer.Finish();
+}
+
+// A code takes at most kRiceEscape + kMaxBits bits, so one peek reads it.
+bool ReadRiceBlock(const uint8_t* in, size_t size, int k, uint32_t* values) {
+  BitReader reader(in, size);
+  const uint32_t mask = GetMask(k);
+  for (int i = 0; i < kBlockComponents; ++i) {
+    const uint64_t bits = reader.Peek();
+    const uint32_t quotient = CountOnes(static_cast<uint32_t>(bits));
+    if (quotient < kRiceEscape) {
+      values[i] = (quotient << k) |
+                  (static_cast<uint32_t>(bits >> (quotient + 1)) & mask);
+      reader.Skip(quotient + 1 + k);
+    } else {
+      values[i] =
+          static_cast<uint32_t>(bits >> kRiceEscape) & GetMask(kMaxBits);
+      reader.Skip(kRiceEscape + kMaxBits);
+    }
+  }
+  return reader.GetConsumedBits() <= size * 8;
+}
+
+// Check that the bits past the last packed component are zero, they are not
+// restored.
+bool HasZeroTail(const SampleLayout& layout, const uint8_t* data,
+                 size_t size_bytes, size_t count) {
+  size_t unused = size_bytes * 8 - count * layout.bits;
+  if (unused == 0) {
+    return true;
+  }
+  uint8_t mask = layout.is_big_endian
+                     ? static_cast<uint8_t>((1u << unused) - 1)
+                     : static_cast<uint8_t>(0xff << (8 - unused));
+  return (data[size_bytes - 1] & mask) == 0;
+}
+
+size_t GetNumChannels(const RadarBurstFormat& format) {
+  return std::max<size_t>(format.num_channels, 1);
+}
+
+void InitQuantizer(const RadarBurstFormat& format, const SampleLayout& layout,
+                   size_t count, const std::vector<uint16_t>& errors,
+                   Quantizer& quantizer) {
+  quantizer.steps.resize(errors.size());
+  for (size_t i = 0; i < errors.size(); ++i) {
+    quantizer.steps[i] = 2 * static_cast<int32_t>(errors[i]) + 1;
+  }
+  quantizer.is_interleaved = format.is_channels_interleaved != 0;
+  quantizer.components = layout.components;
+  quantizer.channel_components =
+      std::max<size_t>(count / errors.size(), 1);
+  if (layout.is_signed) {
+    quantizer.min_value = -(1 << (layout.bits - 1));
+    quantizer.max_value = (1 << (layout.bits - 1)) - 1;
+  } else {
+    quantizer.min_value = 0;
+    quantizer.max_value = static_cast<int32_t>(GetMask(layout.bits));
+  }
+}
+
+// Round to the nearest multiple of an odd step.
+int32_t Quantize(int32_t value, int32_t step) {
+  const int32_t half = step / 2;
+  return value >= 0 ? (value + half) / step : -((half - value) / step);
+}
+
+// Predicts a component from the same component of the previous samples,
+// the previous sample alone unless linear predicted.
+struct Predictor {
+  int order;
+  int shift;
+  int16_t coefficients[kMaxOrder];
+  ptrdiff_t stride;
+  int32_t min_value;
+  int32_t max_value;
+
+  // Get the prediction of the component at value, kept within the range
+  // of the components so residuals fit kMaxBits.
+  int32_t Predict(const int32_t* value) const {
+    int64_t sum = 0;
+    for (int j = 0; j < order; ++j) {
+      sum += static_cast<int64_t>(coefficients[j]) * value[-(j + 1) * stride];
+    }
+    sum >>= shift;
+    return static_cast<int32_t>(std::max<int64_t>(
+        min_value, std::min<int64_t>(sum, max_value)));
+  }
+
+  // Number of previous components the prediction reads.
+  size_t History() const {
+    return static_cast<size_t>(order * stride);
+  }
+};
+
+void InitPredictor(const SampleLayout& layout, int stride,
+                   Predictor& predictor) {
+  predictor.order = 1;
+  predictor.shift = 0;
+  predictor.coefficients[0] = 1;
+  predictor.stride = stride;
+  if (layout.is_signed) {
+    predictor.min_value = -(1 << (layout.bits - 1));
+    predictor.max_value = (1 << (layout.bits - 1)) - 1;
+  } else {
+    predictor.min_value = 0;
+    predictor.max_value = static_cast<int32_t>(GetMask(layout.bits));
+  }
+}
+
+// Fit a linear predictor to the autocorrelation of the components with the
+// Levinson-Durbin recursion. Beat tones are the same in every chirp and
+// channel, so one predictor serves the whole burst.
+bool FitPredictor(LoadFunction load, const ValueLayout& value_layout,
+                  const uint8_t* padded, size_t count, double noise_power,
+                  Predictor& predictor) {
+  const int max_order = static_cast<int>(std::min<ptrdiff_t>(
+      kMaxOrder, kMaxStride / predictor.stride));
+  if (max_order < 2 || count < 4 * kChunkComponents) {
+    return false;
+  }
+
+  // A few chunks spread over the burst are enough for the correlations.
+  double correlations[kMaxOrder + 1] = {};
+  const size_t history = static_cast<size_t>(max_order * predictor.stride);
+  const size_t num_chunks = (count + kChunkComponents - 1) / kChunkComponents;
+  const size_t spacing = std::max<size_t>(num_chunks / kFitChunks, 1);
+  int32_t values[kChunkComponents];
+  size_t num_fitted = 0;
+  uint32_t zero_errors = 0;
+  uint32_t sign_errors = 0;
+  for (size_t first = 0; first < count;
+       first += spacing * kChunkComponents) {
+    const size_t chunk = std::min<size_t>(kChunkComponents, count - first);
+    load(value_layout, padded + first * value_layout.container_bytes, chunk,
+         values, zero_errors, sign_errors);
+    for (size_t i = history; i < chunk; ++i) {
+      const double value = values[i];
+      for (int lag = 0; lag <= max_order; ++lag) {
+        correlations[lag] += value * values[i - lag * predictor.stride];
+      }
+      ++num_fitted;
+    }
+  }
+  if (!(correlations[0] > 0.0)) {
+    return false;
+  }
+  // Lossy predictions are made from decoded components, so the predictor is
+  // fitted to components with the quantization noise added.
+  correlations[0] += noise_power * num_fitted;
+
+  // The coefficients and the prediction error of every order. Orders that
+  // take the error down by less than 10% are dropped.
+  double coefficients[kMaxOrder + 1][kMaxOrder] = {};
+  double errors[kMaxOrder + 1];
+  errors[0] = correlations[0];
+  int order = 0;
+  for (int p = 1; p <= max_order; ++p) {
+    double reflection = correlations[p];
+    for (int j = 0; j < p - 1; ++j) {
+      reflection -= coefficients[p - 1][j] * correlations[p - 1 - j];
+    }
+    reflection /= errors[p - 1];
+    for (int j = 0; j < p - 1; ++j) {
+      coefficients[p][j] = coefficients[p - 1][j] -
+                           reflection * coefficients[p - 1][p - 2 - j];
+    }
+    coefficients[p][p - 1] = reflection;
+    errors[p] = errors[p - 1] * (1.0 - reflection * reflection);
+    if (!(errors[p] > 0.0)) {
+      order = p;
+      break;
+    }
+    if (errors[p] < errors[order]) {
+      order = p;
+    }
+  }
+  while (order > 1 && errors[order - 1] <= 1.1 * errors[order]) {
+    --order;
+  }
+  if (order < 2) {
+    return false;
+  }
+
+  double largest = 0.0;
+  for (int j = 0; j < order; ++j) {
+    largest = std::max(largest, std::fabs(coefficients[order][j]));
+  }
+  int shift = kMaxCoefficientShift;
+  while (shift > 0 && largest * (1 << shift) > INT16_MAX) {
+    --shift;
+  }
+  if (largest * (1 << shift) > INT16_MAX) {
+    return false;
+  }
+  predictor.order = order;
+  predictor.shift = shift;
+  for (int j = 0; j < order; ++j) {
+    predictor.coefficients[j] = static_cast<int16_t>(
+        std::lround(coefficients[order][j] * (1 << shift)));
+  }
+  return true;
+}
+
+// Get the error bound of every channel for a lossy config.
+RadarReturnCode GetErrors(const RadarBurstFormat& format,
+                          const SampleLayout& layout, const LossyConfig& config,
+                          LoadFunction load, const ValueLayout& value_layout,
+                          const uint8_t* padded, size_t count,
+                          std::vector<uint16_t>& errors) {
+  if (!(config.target_snr_db >= 0.0f) || config.max_error > kMaxCodecError) {
+    return RC_BAD_INPUT;
+  }
+  const size_t num_channels = GetNumChannels(format);
+  errors.assign(num_channels, static_cast<uint16_t>(config.max_error));
+  if (config.target_snr_db == 0.0f) {
+    return RC_OK;
+  }
+
+  // The variance of the components of every channel.
+  Quantizer channels;
+  InitQuantizer(format, layout, count, errors, channels);
+  std::vector<double> sums(num_channels, 0.0);
+  std::vector<double> squares(num_channels, 0.0);
+  std::vector<size_t> counts(num_channels, 0);
+  int32_t values[kChunkComponents];
+  uint32_t zero_errors = 0;
+  uint32_t sign_errors = 0;
+  for (size_t first = 0; first < count; first += kChunkComponents) {
+    const size_t chunk = std::min<size_t>(kChunkComponents, count - first);
+    load(value_layout, padded + first * layout.container_bytes, chunk, values,
+         zero_errors, sign_errors);
+    for (size_t i = 0; i < chunk; ++i) {
+      const size_t channel = channels.GetChannel(first + i);
+      const double value = values[i];
+      sums[channel] += value;
+      squares[channel] += value * value;
+      ++counts[channel];
+    }
+  }
+
+  // Uniform quantization with a step q adds a noise power of q^2 / 12.
+  const double noise_ratio = std::pow(10.0, -config.target_snr_db / 10.0);
+  for (size_t i = 0; i < num_channels; ++i) {
+    if (counts[i] == 0) {
+      continue;
+    }
+    const double mean = sums[i] / counts[i];
+    const double variance =
+        std::max(squares[i] / counts[i] - mean * mean, 0.0);
+    const double step = std::sqrt(12.0 * variance * noise_ratio);
+    double error = std::floor((step - 1.0) / 2.0);
+    error = std::max(0.0, std::min(error, static_cast<double>(
+                                              kMaxCodecError)));
+    if (config.max_error > 0) {
+      error = std::min(error, static_cast<double>(config.max_error));
+    }
+    errors[i] = static_cast<uint16_t>(error);
+  }
+  return RC_OK;
+}
+
+RadarReturnCode Encode(const RadarBurstFormat& format, const uint8_t* data,
+                       size_t size_bytes, const LossyConfig* config,
+                       std::vector<uint8_t>& encoded) {
+  SampleLayout layout;
+  RadarReturnCode rc = GetCodecLayout(format, layout);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  const size_t count = GetCount(format, layout, size_bytes);
+  if ((count == 0 && size_bytes > 0) || (size_bytes > 0 && data == nullptr) ||
+      count > UINT32_MAX) {
+    return RC_BAD_INPUT;
+  }
+  const uint8_t* padded = data;
+  std::vector<uint8_t> expanded;
+  if (layout.is_packed) {
+    if (!HasZeroTail(layout, data, size_bytes, count)) {
+      return RC_UNSUPPORTED;
+    }
+    rc = ExpandSamples(format, data, size_bytes, expanded);
+    if (rc != RC_OK) {
+      return rc;
+    }
+    padded = expanded.data();
+  }
+
+  ValueLayout value_layout;
+  LoadFunction load = nullptr;
+  StoreFunction store = nullptr;
+  GetValueLayout(layout, value_layout, load, store);
+  std::vector<uint16_t> errors;
+  if (config != nullptr) {
+    rc = GetErrors(format, layout, *config, load, value_layout, padded, count,
+                   errors);
+    if (rc != RC_OK) {
+      return rc;
+    }
+  }
+  const bool is_quantized =
+      std::any_of(errors.begin(), errors.end(),
+                  [](uint16_t error) { return error > 0; });
+  Quantizer quantizer;
+  if (is_quantized) {
+    InitQuantizer(format, layout, count, errors, quantizer);
+  }
+  const PackFunction pack = GetPackFunction();
+  const int stride = GetStride(format, layout);
+  const size_t num_blocks = (count + kBlockComponents - 1) / kBlockComponents;
+  Predictor predictor;
+  InitPredictor(layout, stride, predictor);
+  double noise_power = 0.0;
+  for (int32_t step : quantizer.steps) {
+    noise_power += step * step / 12.0 / quantizer.steps.size();
+  }
+  const bool is_linear = FitPredictor(load, value_layout, padded, count,
+                                      noise_power, predictor);
+  const size_t history = predictor.History();
+
+  EncodedHeader header;
+  header.version = kVersion;
+  header.flags = (is_quantized ? kQuantized : 0) |
+                 (is_linear ? kLinearPredicted : 0);
+  header.stride = static_cast<uint16_t>(stride);
+  header.count = static_cast<uint32_t>(count);
+  const size_t errors_bytes =
+      is_quantized ? errors.size() * sizeof(uint16_t) : 0;
+  const size_t predictor_bytes =
+      is_linear ? 2 + predictor.order * sizeof(int16_t) : 0;
+  encoded.resize(sizeof(header) + errors_bytes + predictor_bytes +
+                 num_blocks + num_blocks * GetBlockBytes(kMaxBits));
+  uint8_t* out = encoded.data() + sizeof(header);
+  if (is_quantized) {
+    memcpy(out, errors.data(), errors_bytes);
+    out += errors_bytes;
+  }
+  if (is_linear) {
+    *out++ = static_cast<uint8_t>(predictor.order);
+    *out++ = static_cast<uint8_t>(predictor.shift);
+    memcpy(out, predictor.coefficients, predictor.order * sizeof(int16_t));
+    out += predictor.order * sizeof(int16_t);
+  }
+  uint8_t* descriptors = out;
+  out = descriptors + num_blocks;
+
+  // The components of a chunk, as decoded, after the last history ones of
+  // the previous chunk, zero before the first.
+  int32_t window[kMaxStride + kChunkComponents];
+  // The original components of a chunk when they are quantized.
+  int32_t originals[kChunkComponents];
+  int32_t steps[kBlockComponents];
+  int32_t raw_values[kBlockComponents];
+  uint32_t residuals[2][kBlockComponents];
+  memset(window, 0, sizeof(window));
+  uint32_t zero_errors = 0;
+  uint32_t sign_errors = 0;
+  size_t block = 0;
+  for (size_t first = 0; first < count; first += kChunkComponents) {
+    const size_t chunk = std::min<size_t>(kChunkComponents, count - first);
+    int32_t* values = window + history;
+    load(value_layout, padded + first * layout.container_bytes, chunk,
+         is_quantized ? originals : values, zero_errors, sign_errors);
+    for (size_t start = 0; start < chunk; start += kBlockComponents) {
+      const size_t num = std::min<size_t>(kBlockComponents, chunk - start);
+      int32_t* block_values = values + start;
+      uint32_t raw_bits = 0;
+      uint32_t predicted_bits = 0;
+      if (is_quantized) {
+        // The prediction is from the decoded components, so the errors do
+        // not add up.
+        const int32_t* block_originals = originals + start;
+        quantizer.GetSteps(first + start, num, steps);
+        for (size_t i = 0; i < num; ++i) {
+          const int32_t step = steps[i];
+          const int32_t raw = Quantize(block_originals[i], step);
+          raw_values[i] = quantizer.Clamp(static_cast<int64_t>(raw) * step);
+          const int32_t prediction = predictor.Predict(block_values + i);
+          const int32_t residual =
+              Quantize(block_originals[i] - prediction, step);
+          block_values[i] = quantizer.Clamp(
+              prediction + static_cast<int64_t>(residual) * step);
+          residuals[0][i] = ZigZag(raw);
+          residuals[1][i] = ZigZag(residual);
+          raw_bits |= residuals[0][i];
+          predicted_bits |= residuals[1][i];
+        }
+      } else {
+        for (size_t i = 0; i < num; ++i) {
+          residuals[0][i] = ZigZag(block_values[i]);
+          residuals[1][i] =
+              ZigZag(block_values[i] - predictor.Predict(block_values + i));
+          raw_bits |= residuals[0][i];
+          predicted_bits |= residuals[1][i];
+        }
+      }
+      for (size_t i = num; i < kBlockComponents; ++i) {
+        residuals[0][i] = 0;
+        residuals[1][i] = 0;
+      }
+      const int bits[2] = {GetWidth(raw_bits), GetWidth(predicted_bits)};
+      const int chosen = bits[1] < bits[0] ? 1 : 0;
+      if (is_quantized && chosen == 0) {
+        memcpy(block_values, raw_values, num * sizeof(*block_values));
+      }
+      const uint8_t predicted = chosen == 1 ? kPredictedBlock : 0;
+      size_t rice_bits = 0;
+      const int k = GetRiceParameter(residuals[chosen], rice_bits);
+      if (kRiceSizeBytes + (rice_bits + 7) / 8 <
+          GetBlockBytes(bits[chosen])) {
+        descriptors[block++] =
+            static_cast<uint8_t>(k | kRiceBlock | predicted);
+        out = WriteRiceBlock(residuals[chosen], k, rice_bits, out);
+      } else {
+        descriptors[block++] = static_cast<uint8_t>(bits[chosen] | predicted);
+        pack(residuals[chosen], bits[chosen], out);
+        out += GetBlockBytes(bits[chosen]);
+      }
+    }
+    if (first + chunk < count) {
+      memmove(window, window + chunk, history * sizeof(*window));
+    }
+  }
+
+  if (zero_errors != 0) {
+    if (!layout.is_signed || sign_errors != 0) {
+      return RC_UNSUPPORTED;
+    }
+    header.flags |= kSignPadded;
+  }
+  memcpy(encoded.data(), &header, sizeof(header));
+  encoded.resize(out - encoded.data());
+  return RC_OK;
+}
+
+}  // namespace
+
+bool IsCodecSupported(const RadarBurstFormat& format) {
+  SampleLayout layout;
+  return GetCodecLayout(format, layout) == RC_OK;
+}
+
+RadarReturnCode EncodeLossless(const RadarBurstFormat& format,
+                               const uint8_t* data, size_t size_bytes,
+                               std::vector<uint8_t>& encoded) {
+  return Encode(format, data, size_bytes, nullptr, encoded);
+}
+
+RadarReturnCode EncodeLossy(const RadarBurstFormat& format,
+                            const uint8_t* data, size_t size_bytes,
+                            const LossyConfig& config,
+                            std::vector<uint8_t>& encoded) {
+  return Encode(format, data, size_bytes, &config, encoded);
+}
+
+RadarReturnCode DecodeBurst(const RadarBurstFormat& format,
+                            const uint8_t* encoded, size_t encoded_bytes,
+                            uint8_t* data, size_t size_bytes) {
+  SampleLayout layout;
+  RadarReturnCode rc = GetCodecLayout(format, layout);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  const size_t count = GetCount(format, layout, size_bytes);
+  EncodedHeader header;
+  if ((count == 0 && size_bytes > 0) || (size_bytes > 0 && data == nullptr) ||
+      encoded == nullptr || encoded_bytes < sizeof(header)) {
+    return RC_BAD_INPUT;
+  }
+  memcpy(&header, encoded, sizeof(header));
+  const bool is_quantized = (header.flags & kQuantized) != 0;
+  const size_t num_blocks = (count + kBlockComponents - 1) / kBlockComponents;
+  const size_t errors_bytes =
+      is_quantized ? GetNumChannels(format) * sizeof(uint16_t) : 0;
+  if (header.version == 0 || header.version > kVersion ||
+      header.count != count ||
+      header.stride == 0 || header.stride > kMaxStride ||
+      encoded_bytes < sizeof(header) + errors_bytes + num_blocks) {
+    return RC_BAD_INPUT;
+  }
+  Quantizer quantizer;
+  if (is_quantized) {
+    std::vector<uint16_t> errors(GetNumChannels(format));
+    memcpy(errors.data(), encoded + sizeof(header), errors_bytes);
+    InitQuantizer(format, layout, count, errors, quantizer);
+  }
+  const uint8_t* descriptors = encoded + sizeof(header) + errors_bytes;
+  Predictor predictor;
+  InitPredictor(layout, header.stride, predictor);
+  if ((header.flags & kLinearPredicted) != 0) {
+    if (descriptors + 2 > encoded + encoded_bytes) {
+      return RC_BAD_INPUT;
+    }
+    predictor.order = descriptors[0];
+    predictor.shift = descriptors[1];
+    const size_t coefficients_bytes = predictor.order * sizeof(int16_t);
+    if (predictor.order < 1 || predictor.order > kMaxOrder ||
+        predictor.shift > kMaxCoefficientShift ||
+        predictor.History() > kMaxStride ||
+        descriptors + 2 + coefficients_bytes > encoded + encoded_bytes) {
+      return RC_BAD_INPUT;
+    }
+    memcpy(predictor.coefficients, descriptors + 2, coefficients_bytes);
+    descriptors += 2 + coefficients_bytes;
+  }
+  const size_t history = predictor.History();
+  size_t expected_bytes = descriptors - encoded + num_blocks;
+  if (expected_bytes > encoded_bytes) {
+    return RC_BAD_INPUT;
+  }
+  for (size_t block = 0; block < num_blocks; ++block) {
+    const int bits = descriptors[block] & kBlockBits;
+    if (bits > kMaxBits) {
+      return RC_BAD_INPUT;
+    }
+    if ((descriptors[block] & kRiceBlock) == 0) {
+      expected_bytes += GetBlockBytes(bits);
+      continue;
+    }
+    uint16_t rice_bytes = 0;
+    if (expected_bytes + kRiceSizeBytes > encoded_bytes) {
+      return RC_BAD_INPUT;
+    }
+    memcpy(&rice_bytes, encoded + expected_bytes, sizeof(rice_bytes));
+    expected_bytes += kRiceSizeBytes + rice_bytes;
+  }
+  if (expected_bytes != encoded_bytes) {
+    return RC_BAD_INPUT;
+  }
+
+  std::vector<uint8_t> padded;
+  uint8_t* output = data;
+  if (layout.is_packed) {
+    padded.resize(count * layout.container_bytes);
+    output = padded.data();
+  }
+  ValueLayout value_layout;
+  LoadFunction load = nullptr;
+  StoreFunction store = nullptr;
+  GetValueLayout(layout, value_layout, load, store);
+  const UnpackFunction unpack = GetUnpackFunction();
+  const bool is_sign_padded = (header.flags & kSignPadded) != 0;
+  const uint8_t* in = descriptors + num_blocks;
+
+  int32_t window[kMaxStride + kChunkComponents];
+  int32_t steps[kBlockComponents];
+  uint32_t residuals[kBlockComponents];
+  memset(window, 0, sizeof(window));
+  size_t block = 0;
+  for (size_t first = 0; first < count; first += kChunkComponents) {
+    const size_t chunk = std::min<size_t>(kChunkComponents, count - first);
+    int32_t* values = window + history;
+    for (size_t start = 0; start < chunk; start += kBlockComponents) {
+      const size_t num = std::min<size_t>(kBlockComponents, chunk - start);
+      const uint8_t descriptor = descriptors[block++];
+      const int bits = descriptor & kBlockBits;
+      const bool is_predicted = (descriptor & kPredictedBlock) != 0;
+      if ((descriptor & kRiceBlock) != 0) {
+        uint16_t rice_bytes = 0;
+        memcpy(&rice_bytes, in, sizeof(rice_bytes));
+        in += kRiceSizeBytes;
+        if (!ReadRiceBlock(in, rice_bytes, bits, residuals)) {
+          return RC_BAD_INPUT;
+        }
+        in += rice_bytes;
+      } else {
+        unpack(in, bits, residuals);
+        in += GetBlockBytes(bits);
+      }
+      int32_t* block_values = values + start;
+      if (is_quantized) {
+        quantizer.GetSteps(first + start, num, steps);
+        for (size_t i = 0; i < num; ++i) {
+          const int64_t prediction =
+              is_predicted ? predictor.Predict(block_values + i) : 0;
+          block_values[i] = quantizer.Clamp(
+              prediction + static_cast<int64_t>(static_cast<int32_t>(
+                               UnZigZag(residuals[i]))) * steps[i]);
+        }
+      } else if (is_predicted) {
+        // Wraps around instead of overflowing on corrupt data.
+        for (size_t i = 0; i < num; ++i) {
+          block_values[i] = static_cast<int32_t>(
+              UnZigZag(residuals[i]) +
+              static_cast<uint32_t>(predictor.Predict(block_values + i)));
+        }
+      } else {
+        for (size_t i = 0; i < num; ++i) {
+          block_values[i] = static_cast<int32_t>(UnZigZag(residuals[i]));
+        }
+      }
+    }
+    store(value_layout, values, chunk, is_sign_padded,
+          output + first * layout.container_bytes);
+    if (first + chunk < count) {
+      memmove(window, window + chunk, history * sizeof(*window));
+    }
+  }
+
+  if (layout.is_packed) {
+    std::vector<uint8_t> packed;
+    rc = PackSamples(format, padded.data(), padded.size(), packed);
+    if (rc != RC_OK || packed.size() != size_bytes) {
+      return RC_BAD_INPUT;
+    }
+    memcpy(data, packed.data(), size_bytes);
+  }
+  return RC_OK;
+}
+
+}  // namespace radar_dsp
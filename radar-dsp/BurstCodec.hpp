@@ -0,0 +1,127 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Compression of integer burst data, lossless or with bounded error.
+ *
+ * @details Meant for recording bursts, see CaptureRecorder.hpp. Every
+ *          component is predicted from the previous samples of its channel
+ *          along fast time, by a linear predictor of up to 8 taps fitted to
+ *          the burst, or the previous sample alone for small bursts. The
+ *          residuals are zig-zag encoded in blocks of 128, each either Rice
+ *          coded with its own parameter or bit-packed with the width of the
+ *          largest one, whichever is smaller. Blocks where the prediction
+ *          does not help, such as noise or tones close to the Nyquist
+ *          frequency, keep the components themselves instead.
+ *
+ *          The lossy codec quantizes the residuals with a step of 2 e + 1
+ *          for an error bound e of the channel, predicting from the decoded
+ *          components, so no decoded component is more than e away from the
+ *          original one. The error bound is either the same for every
+ *          channel, or chosen per channel from the power of its components
+ *          for a target signal to quantization noise ratio. A Rice code
+ *          takes at least one bit per component, so a burst is about 10
+ *          times smaller at 20 dB and 9 times at 30 dB. Bursts are
+ *          encoded and decoded independently, in chunks of a few thousand
+ *          components, so captures are compressed and replayed as they are
+ *          streamed.
+ *
+ *          Integer components of up to 16 bits are supported, padded or
+ *          packed, as chosen by sample_data_type and bits_per_sample. The
+ *          padding bits of signed components are restored as they were,
+ *          zero or sign-extended. The blocks are packed and unpacked with
+ *          SIMD kernels for the instruction set returned by GetSimdLevel, in
+ *          the same layout as the scalar ones.
+ *
+ *          The encoded data is in the byte order of the encoding machine.
+ *          Data encoded before the Rice coded blocks and the linear
+ *          predictor is still decoded.
+ *
+ * Example:
+ * ```
+ *   std::vector<uint8_t> encoded;
+ *   rc = radar_dsp::EncodeLossless(format, raw_radar_data.data(),
+ *                                  raw_radar_data.size(), encoded);
+ *   rc = radar_dsp::DecodeBurst(format, encoded.data(), encoded.size(),
+ *                               raw_radar_data.data(),
+ *                               raw_radar_data.size());
+ * ```
+ */
+#ifndef RIPPLE_RADAR_DSP_BURSTCODEC_HPP_
+#define RIPPLE_RADAR_DSP_BURSTCODEC_HPP_
+
+#include <RadarCommon.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace radar_dsp {
+
+//! Largest error bound of the lossy codec.
+constexpr uint32_t kMaxCodecError = 0xffff;
+
+//! Error allowed by the lossy codec.
+struct LossyConfig {
+  //! The largest difference of a decoded component from the original one,
+  //! in least significant bits. Caps the error bounds chosen for
+  //! target_snr_db unless 0.
+  uint32_t max_error = 0;
+  //! Signal to quantization noise ratio of every channel in dB, from the
+  //! variance of its components. Not used when 0.
+  float target_snr_db = 0.0f;
+};
+
+/**
+ * @brief Check if bursts of a format can be encoded.
+ */
+bool IsCodecSupported(const RadarBurstFormat& format);
+
+/**
+ * @brief Encode burst data without loss.
+ *
+ * @param format the burst format.
+ * @param data the burst data.
+ * @param size_bytes the size of the burst data.
+ * @param encoded where the encoded data will be written into.
+ *
+ * @return RC_OK, RC_UNSUPPORTED if the format is not supported or the
+ *         padding bits are neither zero nor sign-extended, RC_BAD_INPUT if
+ *         the size does not hold whole samples.
+ */
+RadarReturnCode EncodeLossless(const RadarBurstFormat& format,
+                               const uint8_t* data, size_t size_bytes,
+                               std::vector<uint8_t>& encoded);
+
+/**
+ * @brief Encode burst data with a bounded error.
+ *
+ * @param config the error allowed.
+ *
+ * @return same as EncodeLossless, RC_BAD_INPUT for a negative SNR or an
+ *         error bound larger than kMaxCodecError.
+ */
+RadarReturnCode EncodeLossy(const RadarBurstFormat& format,
+                            const uint8_t* data, size_t size_bytes,
+                            const LossyConfig& config,
+                            std::vector<uint8_t>& encoded);
+
+/**
+ * @brief Decode burst data of EncodeLossless or EncodeLossy.
+ *
+ * @param format the burst format, as encoded.
+ * @param encoded the encoded data.
+ * @param encoded_bytes the size of the encoded data.
+ * @param data where the burst data will be written into.
+ * @param size_bytes the size of the burst data.
+ *
+ * @return RC_OK, RC_UNSUPPORTED if the format is not supported,
+ *         RC_BAD_INPUT if the encoded data is corrupt or does not decode
+ *         into size_bytes.
+ */
+RadarReturnCode DecodeBurst(const RadarBurstFormat& format,
+                            const uint8_t* encoded, size_t encoded_bytes,
+                            uint8_t* data, size_t size_bytes);
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_BURSTCODEC_HPP_
@@ -0,0 +1,488 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <Cfar.hpp>
+
+#include <SimdLevel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+#include <SimdIntrinsics.hpp>
+#endif
+
+namespace radar_dsp {
+
+namespace {
+
+// Add weight times the sums of the rectangles of rows top to bottom and
+// columns i + left to i + right of a summed area table to acc[i]. The rows
+// are those of the table, i.e. the rectangle covers the map rows in between.
+struct ScalarKernel {
+  static void AddRects(const double* top, const double* bottom, size_t left,
+                       size_t right, double weight, double* acc, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+      acc[i] += weight * ((bottom[i + right] - top[i + right]) -
+                          (bottom[i + left] - top[i + left]));
+    }
+  }
+};
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+
+struct Sse41Kernel {
+  RADAR_DSP_TARGET_SSE41 static void AddRects(
+      const double* top, const double* bottom, size_t left, size_t right,
+      double weight, double* acc, size_t n) {
+    __m128d w = _mm_set1_pd(weight);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+      __m128d r = _mm_sub_pd(_mm_loadu_pd(bottom + i + right),
+                             _mm_loadu_pd(top + i + right));
+      __m128d l = _mm_sub_pd(_mm_loadu_pd(bottom + i + left),
+                             _mm_loadu_pd(top + i + left));
+      __m128d sum = _mm_add_pd(_mm_loadu_pd(acc + i),
+                               _mm_mul_pd(w, _mm_sub_pd(r, l)));
+      _mm_storeu_pd(acc + i, sum);
+    }
+    ScalarKernel::AddRects(top + i, bottom + i, left, right, weight, acc + i,
+                           n - i);
+  }
+};
+
+struct Avx2Kernel {
+  RADAR_DSP_TARGET_AVX2 static void AddRects(
+      const double* top, const double* bottom, size_t left, size_t right,
+      double weight, double* acc, size_t n) {
+    __m256d w = _mm256_set1_pd(weight);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m256d r = _mm256_sub_pd(_mm256_loadu_pd(bottom + i + right),
+                                _mm256_loadu_pd(top + i + right));
+      __m256d l = _mm256_sub_pd(_mm256_loadu_pd(bottom + i + left),
+                                _mm256_loadu_pd(top + i + left));
+      __m256d sum = _mm256_fmadd_pd(w, _mm256_sub_pd(r, l),
+                                    _mm256_loadu_pd(acc + i));
+      _mm256_storeu_pd(acc + i, sum);
+    }
+    ScalarKernel::AddRects(top + i, bottom + i, left, right, weight, acc + i,
+                           n - i);
+  }
+};
+
+struct Avx512Kernel {
+  RADAR_DSP_TARGET_AVX512 static void AddRects(
+      const double* top, const double* bottom, size_t left, size_t right,
+      double weight, double* acc, size_t n) {
+    __m512d w = _mm512_set1_pd(weight);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      __m512d r = _mm512_sub_pd(_mm512_loadu_pd(bottom + i + right),
+                                _mm512_loadu_pd(top + i + right));
+      __m512d l = _mm512_sub_pd(_mm512_loadu_pd(bottom + i + left),
+                                _mm512_loadu_pd(top + i + left));
+      __m512d sum = _mm512_fmadd_pd(w, _mm512_sub_pd(r, l),
+                                    _mm512_loadu_pd(acc + i));
+      _mm512_storeu_pd(acc + i, sum);
+    }
+    ScalarKernel::AddRects(top + i, bottom + i, left, right, weight, acc + i,
+                           n - i);
+  }
+};
+
+#endif  // RADAR_DSP_HAS_X86_SIMD
+
+void AddRects(const double* top, const double* bottom, size_t left,
+              size_t right, double weight, double* acc, size_t n) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::AddRects(top, bottom, left, right, weight, acc, n);
+      return;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::AddRects(top, bottom, left, right, weight, acc, n);
+      return;
+    case SimdLevel::kSse41:
+      Sse41Kernel::AddRects(top, bottom, left, right, weight, acc, n);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::AddRects(top, bottom, left, right, weight, acc, n);
+}
+
+// Words of ranks per block, and blocks per group, of the ordered statistic.
+const size_t kFanout = 8;
+
+size_t CountBits(uint64_t bits) {
+  bits -= (bits >> 1) & 0x5555555555555555ULL;
+  bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+  bits = (bits + (bits >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  return static_cast<size_t>((bits * 0x0101010101010101ULL) >> 56);
+}
+
+// Rows of the window around a range bin, clipped to the map.
+struct RowRange {
+  RowRange(size_t row, size_t extent, size_t num_rows)
+      : first(row > extent ? row - extent : 0),
+        last(std::min(row + extent, num_rows - 1)) {}
+
+  size_t Size() const {
+    return last - first + 1;
+  }
+
+  size_t first;
+  size_t last;
+};
+
+// Columns of the window of a Doppler bin, from the least to the most
+// included.
+enum class ColumnCells {
+  kNone,
+  //! Training cells of the rows beside the guard cells.
+  kOutsideGuard,
+  kAll,
+};
+
+}  // namespace
+
+void CfarDetections::Clear() {
+  channel.clear();
+  range_bin.clear();
+  doppler_bin.clear();
+  value.clear();
+  noise.clear();
+}
+
+float GetCaThresholdScale(double false_alarm_rate,
+                          size_t num_training_cells) {
+  double n = static_cast<double>(num_training_cells);
+  return static_cast<float>(n * (std::pow(false_alarm_rate, -1.0 / n) - 1.0));
+}
+
+CfarDetector::CfarDetector(const CfarConfig& config) : config_(config) {}
+
+void CfarDetector::AverageCells(const float* map, size_t num_range_bins,
+                                size_t num_doppler_bins, float* thresholds,
+                                float* noise) {
+  const size_t guard = config_.guard_doppler;
+  const size_t training = config_.training_doppler;
+  const size_t extent = guard + training;
+  const size_t width = num_doppler_bins + 2 * extent;
+  const size_t stride = width + 1;
+
+  // The map is padded with the wrapped Doppler bins on both sides, so every
+  // window is a plain rectangle of the table.
+  sums_.assign((num_range_bins + 1) * stride, 0.0);
+  for (size_t row = 0; row < num_range_bins; ++row) {
+    const float* cells = map + row * num_doppler_bins;
+    const double* above = &sums_[row * stride];
+    double* sums = &sums_[(row + 1) * stride];
+    double row_sum = 0.0;
+    for (size_t col = 0; col < width; ++col) {
+      row_sum += cells[(col + num_doppler_bins - extent) % num_doppler_bins];
+      sums[col + 1] = above[col + 1] + row_sum;
+    }
+  }
+
+  // Column offsets of the window from the first padded column of a cell.
+  const size_t all_right = 2 * extent + 1;
+  const size_t guard_left = training;
+  const size_t guard_right = training + 2 * guard + 1;
+  const double all_width = static_cast<double>(all_right);
+  const double guard_width = static_cast<double>(2 * guard + 1);
+  const bool split = config_.type != CfarType::kCellAveraging;
+  const float inf = std::numeric_limits<float>::infinity();
+  leading_.resize(num_doppler_bins);
+  lagging_.resize(num_doppler_bins);
+
+  for (size_t row = 0; row < num_range_bins; ++row) {
+    RowRange rows(row, config_.guard_range + config_.training_range,
+                  num_range_bins);
+    RowRange guard_rows(row, config_.guard_range, num_range_bins);
+    const double* table = sums_.data();
+    auto at = [&](size_t table_row) { return table + table_row * stride; };
+    std::fill(leading_.begin(), leading_.end(), 0.0);
+    double leading_count = 0.0;
+    double lagging_count = 0.0;
+    float* row_thresholds = thresholds + row * num_doppler_bins;
+    float* row_noise = noise + row * num_doppler_bins;
+
+    if (!split) {
+      AddRects(at(rows.first), at(rows.last + 1), 0, all_right, 1.0,
+               leading_.data(), num_doppler_bins);
+      AddRects(at(guard_rows.first), at(guard_rows.last + 1), guard_left,
+               guard_right, -1.0, leading_.data(), num_doppler_bins);
+      leading_count = rows.Size() * all_width - guard_rows.Size() * guard_width;
+      double scale = leading_count > 0.0 ? 1.0 / leading_count : 0.0;
+      for (size_t col = 0; col < num_doppler_bins; ++col) {
+        row_noise[col] = static_cast<float>(leading_[col] * scale);
+      }
+    } else {
+      std::fill(lagging_.begin(), lagging_.end(), 0.0);
+      // Rows before the cell under test, then its Doppler bins below.
+      if (row > rows.first) {
+        AddRects(at(rows.first), at(row), 0, all_right, 1.0,
+                 leading_.data(), num_doppler_bins);
+      }
+      if (row > guard_rows.first) {
+        AddRects(at(guard_rows.first), at(row), guard_left, guard_right,
+                 -1.0, leading_.data(), num_doppler_bins);
+      }
+      // Rows after the cell under test, then its Doppler bins above.
+      if (rows.last > row) {
+        AddRects(at(row + 1), at(rows.last + 1), 0, all_right, 1.0,
+                 lagging_.data(), num_doppler_bins);
+      }
+      if (guard_rows.last > row) {
+        AddRects(at(row + 1), at(guard_rows.last + 1), guard_left,
+                 guard_right, -1.0, lagging_.data(), num_doppler_bins);
+      }
+      if (training > 0) {
+        AddRects(at(row), at(row + 1), 0, guard_left, 1.0, leading_.data(),
+                 num_doppler_bins);
+        AddRects(at(row), at(row + 1), guard_right, all_right, 1.0,
+                 lagging_.data(), num_doppler_bins);
+      }
+      leading_count = (row - rows.first) * all_width -
+                      (row - guard_rows.first) * guard_width + training;
+      lagging_count = (rows.last - row) * all_width -
+                      (guard_rows.last - row) * guard_width + training;
+      double leading_scale = leading_count > 0.0 ? 1.0 / leading_count : 0.0;
+      double lagging_scale = lagging_count > 0.0 ? 1.0 / lagging_count : 0.0;
+      bool greatest = config_.type == CfarType::kGreatestOf;
+      for (size_t col = 0; col < num_doppler_bins; ++col) {
+        double leading = leading_[col] * leading_scale;
+        double lagging = lagging_[col] * lagging_scale;
+        // A half without training cells is left out.
+        double estimate = leading_count == 0.0 ? lagging
+                          : lagging_count == 0.0
+                              ? leading
+                              : greatest ? std::max(leading, lagging)
+                                         : std::min(leading, lagging);
+        row_noise[col] = static_cast<float>(estimate);
+      }
+    }
+
+    if (leading_count + lagging_count <= 0.0) {
+      std::fill(row_thresholds, row_thresholds + num_doppler_bins, inf);
+    } else {
+      for (size_t col = 0; col < num_doppler_bins; ++col) {
+        row_thresholds[col] = config_.threshold_scale * row_noise[col];
+      }
+    }
+  }
+}
+
+void CfarDetector::SortCells(const float* map, size_t map_size) {
+  // A radix sort of the float bits, flipped so they order as unsigned
+  // integers. Being stable, equal cells stay in index order.
+  const size_t kDigitBits = 11;
+  const size_t kNumDigits = static_cast<size_t>(1) << kDigitBits;
+  keys_.resize(map_size);
+  order_.resize(map_size);
+  sorted_.resize(map_size);
+  for (size_t i = 0; i < map_size; ++i) {
+    uint32_t bits;
+    std::memcpy(&bits, &map[i], sizeof(bits));
+    keys_[i] = bits & 0x80000000u ? ~bits : bits | 0x80000000u;
+    order_[i] = static_cast<uint32_t>(i);
+  }
+  digit_offsets_.resize(kNumDigits);
+  for (size_t shift = 0; shift < 32; shift += kDigitBits) {
+    std::fill(digit_offsets_.begin(), digit_offsets_.end(), 0);
+    for (size_t i = 0; i < map_size; ++i) {
+      ++digit_offsets_[(keys_[i] >> shift) & (kNumDigits - 1)];
+    }
+    uint32_t offset = 0;
+    for (uint32_t& digit_offset : digit_offsets_) {
+      uint32_t count = digit_offset;
+      digit_offset = offset;
+      offset += count;
+    }
+    for (uint32_t index : order_) {
+      sorted_[digit_offsets_[(keys_[index] >> shift) & (kNumDigits - 1)]++] =
+          index;
+    }
+    order_.swap(sorted_);
+  }
+}
+
+void CfarDetector::OrderCells(const float* map, size_t num_range_bins,
+                              size_t num_doppler_bins, float* thresholds,
+                              float* noise) {
+  const long guard = config_.guard_doppler;
+  const long extent = guard + config_.training_doppler;
+  const long num_cols = static_cast<long>(num_doppler_bins);
+  const size_t map_size = num_range_bins * num_doppler_bins;
+  const float inf = std::numeric_limits<float>::infinity();
+
+  // Rank every cell of the map once, the training cells are then a set of
+  // ranks. Ranks are bits of words, with the counts of blocks of words, so
+  // a cell joins or leaves in constant time and the cell of an order is
+  // found by counting the bits of a few blocks and words.
+  SortCells(map, map_size);
+  ranks_.resize(map_size);
+  for (size_t i = 0; i < map_size; ++i) {
+    ranks_[order_[i]] = static_cast<uint32_t>(i);
+  }
+  rank_bits_.assign((map_size + 63) / 64, 0);
+  block_counts_.assign((rank_bits_.size() + kFanout - 1) / kFanout, 0);
+  group_counts_.assign((block_counts_.size() + kFanout - 1) / kFanout, 0);
+
+  auto count = [&](uint32_t rank, bool is_in) {
+    int delta = is_in ? 1 : -1;
+    rank_bits_[rank / 64] ^= static_cast<uint64_t>(1) << (rank % 64);
+    block_counts_[rank / 64 / kFanout] += delta;
+    group_counts_[rank / 64 / kFanout / kFanout] += delta;
+  };
+  // Get the index of the cell of an order among the counted ones.
+  auto find = [&](size_t order) {
+    size_t group = 0;
+    for (; group_counts_[group] <= order; ++group) {
+      order -= group_counts_[group];
+    }
+    size_t block = group * kFanout;
+    for (; block_counts_[block] <= order; ++block) {
+      order -= block_counts_[block];
+    }
+    size_t word = block * kFanout;
+    for (size_t bits = CountBits(rank_bits_[word]); bits <= order;
+         bits = CountBits(rank_bits_[++word])) {
+      order -= bits;
+    }
+    uint64_t bits = rank_bits_[word];
+    for (; order > 0; --order) {
+      bits &= bits - 1;
+    }
+    // The position of the lowest bit left.
+    size_t bit = CountBits((bits & (~bits + 1)) - 1);
+    return order_[word * 64 + bit];
+  };
+
+  for (size_t row = 0; row < num_range_bins; ++row) {
+    RowRange rows(row, config_.guard_range + config_.training_range,
+                  num_range_bins);
+    RowRange guard_rows(row, config_.guard_range, num_range_bins);
+
+    // Cells of a column at an offset from the cell under test.
+    auto cells_at = [&](long offset) {
+      offset = offset < 0 ? -offset : offset;
+      return offset > extent  ? ColumnCells::kNone
+             : offset > guard ? ColumnCells::kAll
+                              : ColumnCells::kOutsideGuard;
+    };
+    // Count the cells of a column that join or leave the training cells.
+    auto update = [&](long col, ColumnCells from, ColumnCells to) {
+      if (from == to) {
+        return;
+      }
+      const bool is_in = to > from;
+      const uint32_t* column = ranks_.data() + (col + num_cols) % num_cols;
+      // Rows of the guard cells change from or to kAll, the other rows
+      // from or to kNone.
+      if (from == ColumnCells::kNone || to == ColumnCells::kNone) {
+        for (size_t r = rows.first; r < guard_rows.first; ++r) {
+          count(column[r * num_doppler_bins], is_in);
+        }
+        for (size_t r = guard_rows.last + 1; r <= rows.last; ++r) {
+          count(column[r * num_doppler_bins], is_in);
+        }
+      }
+      if (from == ColumnCells::kAll || to == ColumnCells::kAll) {
+        for (size_t r = guard_rows.first; r <= guard_rows.last; ++r) {
+          count(column[r * num_doppler_bins], is_in);
+        }
+      }
+    };
+
+    // The number of training cells is the same along a row.
+    const size_t num_cells =
+        rows.Size() * (2 * extent + 1) - guard_rows.Size() * (2 * guard + 1);
+    const size_t rank = num_cells == 0 ? 0 : std::min(
+        num_cells - 1, static_cast<size_t>(config_.os_rank * num_cells));
+    float* row_thresholds = thresholds + row * num_doppler_bins;
+    float* row_noise = noise + row * num_doppler_bins;
+    if (num_cells == 0) {
+      std::fill(row_noise, row_noise + num_doppler_bins, 0.0f);
+      std::fill(row_thresholds, row_thresholds + num_doppler_bins, inf);
+      continue;
+    }
+
+    for (long offset = -extent; offset <= extent; ++offset) {
+      update(offset, ColumnCells::kNone, cells_at(offset));
+    }
+    for (long col = 0; col < num_cols; ++col) {
+      float estimate = map[find(rank)];
+      row_noise[col] = estimate;
+      row_thresholds[col] = config_.threshold_scale * estimate;
+      if (col + 1 == num_cols) {
+        break;
+      }
+      // Slide to the next Doppler bin, only the columns at the edges of
+      // the window and of the guard cells change.
+      const long edges[] = {col - extent, col - guard, col + 1 + guard,
+                            col + 1 + extent};
+      for (size_t i = 0; i < 4; ++i) {
+        if (i > 0 && edges[i] == edges[i - 1]) {
+          continue;
+        }
+        update(edges[i], cells_at(edges[i] - col),
+               cells_at(edges[i] - col - 1));
+      }
+    }
+    // Empty the set for the next row.
+    for (long offset = -extent; offset <= extent; ++offset) {
+      update(num_cols - 1 + offset, cells_at(offset), ColumnCells::kNone);
+    }
+  }
+}
+
+RadarReturnCode CfarDetector::Detect(const float* map, const CubeShape& shape,
+                                     CfarDetections& detections) {
+  detections.Clear();
+  const size_t num_range_bins = shape.num_samples;
+  const size_t num_doppler_bins = shape.num_chirps;
+  const size_t window_width =
+      2 * (static_cast<size_t>(config_.guard_doppler) +
+           config_.training_doppler) + 1;
+  if (shape.Size() == 0 || map == nullptr ||
+      window_width > num_doppler_bins ||
+      config_.training_range + config_.training_doppler == 0 ||
+      !(config_.os_rank >= 0.0f && config_.os_rank <= 1.0f)) {
+    return RC_BAD_INPUT;
+  }
+
+  const size_t map_size = num_range_bins * num_doppler_bins;
+  thresholds_.resize(shape.Size());
+  noise_.resize(shape.Size());
+  for (size_t channel = 0; channel < shape.num_channels; ++channel) {
+    const float* cells = map + channel * map_size;
+    float* thresholds = &thresholds_[channel * map_size];
+    float* noise = &noise_[channel * map_size];
+    if (config_.type == CfarType::kOrderedStatistic) {
+      OrderCells(cells, num_range_bins, num_doppler_bins, thresholds, noise);
+    } else {
+      AverageCells(cells, num_range_bins, num_doppler_bins, thresholds,
+                   noise);
+    }
+
+    for (size_t i = 0; i < map_size; ++i) {
+      if (cells[i] > thresholds[i]) {
+        detections.channel.push_back(static_cast<uint16_t>(channel));
+        detections.range_bin.push_back(
+            static_cast<uint32_t>(i / num_doppler_bins));
+        detections.doppler_bin.push_back(
+            static_cast<uint32_t>(i % num_doppler_bins));
+        detections.value.push_back(cells[i]);
+        detections.noise.push_back(noise[i]);
+      }
+    }
+  }
+  return RC_OK;
+}
+
+}  // namespace radar_dsp
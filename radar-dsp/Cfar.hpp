@@ -0,0 +1,174 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Constant false alarm rate detection on range-Doppler maps.
+ *
+ * @details The noise around every cell under test is estimated from
+ *          the training cells of a rectangle of range x Doppler cells, less
+ *          the guard cells next to the cell under test. A cell is detected
+ *          when it is above threshold_scale times the estimate.
+ *
+ *          Doppler wraps around, range is clipped at the edges of the map, so
+ *          cells near the first and last range bins have fewer training
+ *          cells.
+ *
+ *          The cell averaging variants read the rectangle sums from a summed
+ *          area table, so their cost does not depend on the window size.
+ *          For GO and SO, the training cells are split into a leading half,
+ *          the lower range bins and the lower Doppler bins of the same range
+ *          bin, and a lagging half. The ordered statistic variant ranks
+ *          the cells of the map once and keeps the ranks of the training
+ *          cells in a bit set. Sliding along Doppler, only the cells of
+ *          the columns entering and leaving the window are updated, and
+ *          the cell of the wanted order is found by counting bits.
+ *
+ *          An instance holds scratch buffers and must be used by one thread
+ *          at a time.
+ *
+ * Example:
+ * ```
+ *   radar_dsp::CfarConfig config;
+ *   config.type = radar_dsp::CfarType::kCellAveraging;
+ *   config.threshold_scale = radar_dsp::GetCaThresholdScale(1e-4, 40);
+ *   radar_dsp::CfarDetector detector(config);
+ *   radar_dsp::CfarDetections detections;
+ *   RadarReturnCode rc = detector.Detect(map.data(), shape, detections);
+ * ```
+ */
+#ifndef RIPPLE_RADAR_DSP_CFAR_HPP_
+#define RIPPLE_RADAR_DSP_CFAR_HPP_
+
+#include <RadarCommon.h>
+
+#include <RadarCube.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace radar_dsp {
+
+enum class CfarType {
+  //! Mean of all the training cells.
+  kCellAveraging,
+  //! Greater of the means of the leading and lagging halves.
+  kGreatestOf,
+  //! Smaller of the means of the leading and lagging halves.
+  kSmallestOf,
+  //! The training cell of rank os_rank.
+  kOrderedStatistic,
+};
+
+struct CfarConfig {
+  CfarType type = CfarType::kCellAveraging;
+  //! Guard cells on each side of the cell under test.
+  uint16_t guard_range = 1;
+  uint16_t guard_doppler = 1;
+  //! Training cells on each side, beyond the guard cells.
+  uint16_t training_range = 4;
+  uint16_t training_doppler = 4;
+  //! Factor applied to the noise estimate to get the threshold.
+  float threshold_scale = 10.0f;
+  //! Rank of the ordered statistic as a fraction of the training cells,
+  //! between 0 and 1.
+  float os_rank = 0.75f;
+};
+
+//! Detections as a struct of arrays, one element per detected cell.
+struct CfarDetections {
+  //! Channel of the map, 0 for integrated maps.
+  std::vector<uint16_t> channel;
+  std::vector<uint32_t> range_bin;
+  //! Doppler bin, zero velocity being the middle bin of the map.
+  std::vector<uint32_t> doppler_bin;
+  //! Value of the detected cell.
+  std::vector<float> value;
+  //! Noise estimated from the training cells.
+  std::vector<float> noise;
+
+  size_t Size() const {
+    return value.size();
+  }
+
+  void Clear();
+};
+
+/**
+ * @brief Get the threshold scale of a cell averaging CFAR.
+ *
+ * @details Assumes exponentially distributed noise, i.e. a power map.
+ *
+ * @param false_alarm_rate the probability of a false alarm per cell.
+ * @param num_training_cells the number of training cells.
+ */
+float GetCaThresholdScale(double false_alarm_rate, size_t num_training_cells);
+
+class CfarDetector {
+ public:
+  explicit CfarDetector(const CfarConfig& config = CfarConfig());
+
+  const CfarConfig& GetConfig() const {
+    return config_;
+  }
+
+  void SetConfig(const CfarConfig& config) {
+    config_ = config;
+  }
+
+  /**
+   * @brief Detect the cells of range-Doppler maps.
+   *
+   * @param map the maps laid out as CubeLayout::kChannelSampleChirp, as
+   *        written by RangeDoppler.
+   * @param shape the dimensions of the maps, num_samples being the range bins
+   *        and num_chirps the Doppler bins.
+   * @param detections where the detections will be written into.
+   *
+   * @return RC_OK, RC_BAD_INPUT for an empty shape, a null map, a window
+   *         wider than the Doppler bins, no training cells or an os_rank
+   *         outside [0, 1].
+   */
+  RadarReturnCode Detect(const float* map, const CubeShape& shape,
+                         CfarDetections& detections);
+
+  /**
+   * @brief Get the thresholds of the last maps detected.
+   *
+   * @details Laid out as the maps, infinite for cells without training
+   *          cells.
+   */
+  const std::vector<float>& GetThresholds() const {
+    return thresholds_;
+  }
+
+ private:
+  void AverageCells(const float* map, size_t num_range_bins,
+                    size_t num_doppler_bins, float* thresholds,
+                    float* noise);
+  void SortCells(const float* map, size_t map_size);
+  void OrderCells(const float* map, size_t num_range_bins,
+                  size_t num_doppler_bins, float* thresholds, float* noise);
+
+  CfarConfig config_;
+  std::vector<float> thresholds_;
+  std::vector<float> noise_;
+  //! Summed area table of the Doppler wrapped map.
+  std::vector<double> sums_;
+  std::vector<double> leading_;
+  std::vector<double> lagging_;
+  //! Cells of the map sorted by value, and the rank of every cell.
+  std::vector<uint32_t> order_;
+  std::vector<uint32_t> ranks_;
+  std::vector<uint32_t> keys_;
+  std::vector<uint32_t> sorted_;
+  std::vector<uint32_t> digit_offsets_;
+  //! Ranks of the training cells as bits, and their counts per block of
+  //! words and per group of blocks.
+  std::vector<uint64_t> rank_bits_;
+  std::vector<uint32_t> block_counts_;
+  std::vector<uint32_t> group_counts_;
+};
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_CFAR_HPP_
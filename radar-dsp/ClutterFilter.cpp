@@ -0,0 +1,323 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <ClutterFilter.hpp>
+
+#include <SimdLevel.hpp>
+
+#include <algorithm>
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+#include <SimdIntrinsics.hpp>
+#endif
+
+namespace radar_dsp {
+
+namespace {
+
+// Element-wise kernels over the interleaved components of rows of range
+// bins, sum += x, x -= background, and x -= previous with previous = x.
+struct ScalarKernel {
+  static void Accumulate(const float* x, float* sum, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      sum[i] += x[i];
+    }
+  }
+
+  static void Subtract(float* x, const float* background, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      x[i] -= background[i];
+    }
+  }
+
+  static void Difference(float* x, float* previous, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      float value = x[i];
+      x[i] = value - previous[i];
+      previous[i] = value;
+    }
+  }
+};
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+
+struct Sse41Kernel {
+  RADAR_DSP_TARGET_SSE41 static void Accumulate(const float* x, float* sum,
+                                                size_t size) {
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+      _mm_storeu_ps(sum + i, _mm_add_ps(_mm_loadu_ps(sum + i),
+                                        _mm_loadu_ps(x + i)));
+    }
+    ScalarKernel::Accumulate(x + i, sum + i, size - i);
+  }
+
+  RADAR_DSP_TARGET_SSE41 static void Subtract(float* x,
+                                              const float* background,
+                                              size_t size) {
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+      _mm_storeu_ps(x + i, _mm_sub_ps(_mm_loadu_ps(x + i),
+                                      _mm_loadu_ps(background + i)));
+    }
+    ScalarKernel::Subtract(x + i, background + i, size - i);
+  }
+
+  RADAR_DSP_TARGET_SSE41 static void Difference(float* x, float* previous,
+                                                size_t size) {
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+      __m128 value = _mm_loadu_ps(x + i);
+      _mm_storeu_ps(x + i, _mm_sub_ps(value, _mm_loadu_ps(previous + i)));
+      _mm_storeu_ps(previous + i, value);
+    }
+    ScalarKernel::Difference(x + i, previous + i, size - i);
+  }
+};
+
+struct Avx2Kernel {
+  RADAR_DSP_TARGET_AVX2 static void Accumulate(const float* x, float* sum,
+                                               size_t size) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+      _mm256_storeu_ps(sum + i, _mm256_add_ps(_mm256_loadu_ps(sum + i),
+                                              _mm256_loadu_ps(x + i)));
+    }
+    ScalarKernel::Accumulate(x + i, sum + i, size - i);
+  }
+
+  RADAR_DSP_TARGET_AVX2 static void Subtract(float* x,
+                                             const float* background,
+                                             size_t size) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+      _mm256_storeu_ps(x + i, _mm256_sub_ps(_mm256_loadu_ps(x + i),
+                                            _mm256_loadu_ps(background + i)));
+    }
+    ScalarKernel::Subtract(x + i, background + i, size - i);
+  }
+
+  RADAR_DSP_TARGET_AVX2 static void Difference(float* x, float* previous,
+                                               size_t size) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+      __m256 value = _mm256_loadu_ps(x + i);
+      _mm256_storeu_ps(x + i,
+                       _mm256_sub_ps(value, _mm256_loadu_ps(previous + i)));
+      _mm256_storeu_ps(previous + i, value);
+    }
+    ScalarKernel::Difference(x + i, previous + i, size - i);
+  }
+};
+
+struct Avx512Kernel {
+  RADAR_DSP_TARGET_AVX512 static void Accumulate(const float* x, float* sum,
+                                                 size_t size) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+      _mm512_storeu_ps(sum + i, _mm512_add_ps(_mm512_loadu_ps(sum + i),
+                                              _mm512_loadu_ps(x + i)));
+    }
+    ScalarKernel::Accumulate(x + i, sum + i, size - i);
+  }
+
+  RADAR_DSP_TARGET_AVX512 static void Subtract(float* x,
+                                               const float* background,
+                                               size_t size) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+      _mm512_storeu_ps(x + i, _mm512_sub_ps(_mm512_loadu_ps(x + i),
+                                            _mm512_loadu_ps(background + i)));
+    }
+    ScalarKernel::Subtract(x + i, background + i, size - i);
+  }
+
+  RADAR_DSP_TARGET_AVX512 static void Difference(float* x, float* previous,
+                                                 size_t size) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+      __m512 value = _mm512_loadu_ps(x + i);
+      _mm512_storeu_ps(x + i,
+                       _mm512_sub_ps(value, _mm512_loadu_ps(previous + i)));
+      _mm512_storeu_ps(previous + i, value);
+    }
+    ScalarKernel::Difference(x + i, previous + i, size - i);
+  }
+};
+
+#endif  // RADAR_DSP_HAS_X86_SIMD
+
+void Accumulate(const std::complex<float>* x, std::complex<float>* sum,
+                size_t size) {
+  const float* input = reinterpret_cast<const float*>(x);
+  float* output = reinterpret_cast<float*>(sum);
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::Accumulate(input, output, 2 * size);
+      return;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::Accumulate(input, output, 2 * size);
+      return;
+    case SimdLevel::kSse41:
+      Sse41Kernel::Accumulate(input, output, 2 * size);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::Accumulate(input, output, 2 * size);
+}
+
+void Subtract(std::complex<float>* x, const std::complex<float>* background,
+              size_t size) {
+  float* output = reinterpret_cast<float*>(x);
+  const float* input = reinterpret_cast<const float*>(background);
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::Subtract(output, input, 2 * size);
+      return;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::Subtract(output, input, 2 * size);
+      return;
+    case SimdLevel::kSse41:
+      Sse41Kernel::Subtract(output, input, 2 * size);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::Subtract(output, input, 2 * size);
+}
+
+void Difference(std::complex<float>* x, std::complex<float>* previous,
+                size_t size) {
+  float* output = reinterpret_cast<float*>(x);
+  float* state = reinterpret_cast<float*>(previous);
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::Difference(output, state, 2 * size);
+      return;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::Difference(output, state, 2 * size);
+      return;
+    case SimdLevel::kSse41:
+      Sse41Kernel::Difference(output, state, 2 * size);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::Difference(output, state, 2 * size);
+}
+
+bool IsSameShape(const CubeShape& a, const CubeShape& b) {
+  return a.num_channels == b.num_channels && a.num_chirps == b.num_chirps &&
+         a.num_samples == b.num_samples;
+}
+
+}  // namespace
+
+ClutterFilter::ClutterFilter(const ClutterConfig& config) : config_(config) {}
+
+void ClutterFilter::Reset(uint8_t config_id) {
+  for (auto& entry : states_) {
+    if (entry.first == config_id) {
+      entry.second.has_background = false;
+    }
+  }
+}
+
+void ClutterFilter::Reset() {
+  for (auto& entry : states_) {
+    entry.second.has_background = false;
+  }
+}
+
+ClutterFilter::ConfigState& ClutterFilter::GetState(uint8_t config_id,
+                                                    const CubeShape& shape) {
+  ConfigState* state = nullptr;
+  for (auto& entry : states_) {
+    if (entry.first == config_id) {
+      state = &entry.second;
+      break;
+    }
+  }
+  if (state == nullptr) {
+    states_.emplace_back(config_id, ConfigState());
+    state = &states_.back().second;
+    state->shape = CubeShape();
+  }
+  if (!IsSameShape(state->shape, shape)) {
+    size_t rows = config_.type == ClutterFilterType::kMti ? config_.mti_lag
+                                                          : 1;
+    state->shape = shape;
+    state->background.assign(
+        rows * shape.num_channels * shape.num_samples, 0.0f);
+    state->has_background = false;
+  }
+  return *state;
+}
+
+RadarReturnCode ClutterFilter::Process(uint8_t config_id,
+                                       const CubeShape& shape,
+                                       std::complex<float>* range_cube) {
+  if (shape.Size() == 0 || range_cube == nullptr ||
+      !(config_.weight >= 0.0f && config_.weight <= 1.0f) ||
+      config_.mti_lag == 0) {
+    return RC_BAD_INPUT;
+  }
+  ConfigState& state = GetState(config_id, shape);
+  const size_t num_channels = shape.num_channels;
+  const size_t num_chirps = shape.num_chirps;
+  const size_t num_bins = shape.num_samples;
+
+  if (config_.type == ClutterFilterType::kMti) {
+    const size_t lag = config_.mti_lag;
+    if (!state.has_background) {
+      state.first_row = 0;
+    }
+    for (size_t channel = 0; channel < num_channels; ++channel) {
+      std::complex<float>* rows =
+          &state.background[channel * lag * num_bins];
+      for (size_t chirp = 0; chirp < num_chirps; ++chirp) {
+        std::complex<float>* x =
+            range_cube + (channel * num_chirps + chirp) * num_bins;
+        // Rows hold the last lag chirps, the oldest at first_row.
+        std::complex<float>* previous =
+            rows + (state.first_row + chirp) % lag * num_bins;
+        if (!state.has_background && chirp < lag) {
+          std::copy(x, x + num_bins, previous);
+        }
+        Difference(x, previous, num_bins);
+      }
+    }
+    state.first_row = (state.first_row + num_chirps) % lag;
+    state.has_background = true;
+    return RC_OK;
+  }
+
+  sums_.resize(num_bins);
+  const float scale = 1.0f / num_chirps;
+  const float weight = state.has_background ? config_.weight : 1.0f;
+  for (size_t channel = 0; channel < num_channels; ++channel) {
+    std::complex<float>* channel_cube =
+        range_cube + channel * num_chirps * num_bins;
+    std::complex<float>* background = &state.background[channel * num_bins];
+    std::fill(sums_.begin(), sums_.end(), 0.0f);
+    for (size_t chirp = 0; chirp < num_chirps; ++chirp) {
+      Accumulate(channel_cube + chirp * num_bins, sums_.data(), num_bins);
+    }
+    for (size_t bin = 0; bin < num_bins; ++bin) {
+      background[bin] += weight * (sums_[bin] * scale - background[bin]);
+    }
+    for (size_t chirp = 0; chirp < num_chirps; ++chirp) {
+      Subtract(channel_cube + chirp * num_bins, background, num_bins);
+    }
+  }
+  state.has_background = true;
+  return RC_OK;
+}
+
+}  // namespace radar_dsp
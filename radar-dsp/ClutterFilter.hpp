@@ -0,0 +1,121 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Static clutter removal across bursts.
+ *
+ * @details Removes what does not move from range cubes, in place, with
+ *          a background of every channel and range bin that is updated
+ *          incrementally on every burst, so neither the memory nor the cost
+ *          grow with the time the background is averaged over.
+ *
+ *          The exponential variant averages the mean of the chirps of every
+ *          burst into the background, weighting the new burst by weight, and
+ *          subtracts the background from every chirp. With a weight of 1 it
+ *          removes the mean of every burst.
+ *
+ *          The moving target indication variant is a two pulse canceller
+ *          along the chirps, subtracting from every chirp the one mti_lag
+ *          chirps before it, the last chirps of the previous burst for
+ *          the first ones. With TX antennas taking turns chirp by chirp,
+ *          mti_lag is the number of TX antennas so the same antennas are
+ *          compared.
+ *
+ *          The state is kept per config_id, so bursts of several configs can
+ *          be interleaved. It is allocated by the first burst of a config, or
+ *          when the shape of its bursts changes, nothing is allocated
+ *          afterwards.
+ *
+ *          An instance holds scratch buffers and must be used by one thread
+ *          at a time.
+ *
+ * Example:
+ * ```
+ *   radar_dsp::ClutterFilter clutter_filter;
+ *   range_fft.Process(format, raw_radar_data.data(), raw_radar_data.size(),
+ *                     range_cube, shape);
+ *   RadarReturnCode rc = clutter_filter.Process(format.config_id, shape,
+ *                                               range_cube.data());
+ * ```
+ */
+#ifndef RIPPLE_RADAR_DSP_CLUTTERFILTER_HPP_
+#define RIPPLE_RADAR_DSP_CLUTTERFILTER_HPP_
+
+#include <RadarCommon.h>
+
+#include <RadarCube.hpp>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace radar_dsp {
+
+enum class ClutterFilterType {
+  //! Exponential average of the bursts.
+  kExponential,
+  //! Moving target indication, a two pulse canceller.
+  kMti,
+};
+
+struct ClutterConfig {
+  ClutterFilterType type = ClutterFilterType::kExponential;
+  //! Weight of every burst in the exponential average, between 0 and 1.
+  float weight = 0.1f;
+  //! Chirps between the chirps subtracted by the MTI variant.
+  uint32_t mti_lag = 1;
+};
+
+class ClutterFilter {
+ public:
+  explicit ClutterFilter(const ClutterConfig& config = ClutterConfig());
+
+  const ClutterConfig& GetConfig() const {
+    return config_;
+  }
+
+  /**
+   * @brief Remove the clutter of a range cube in place.
+   *
+   * @param config_id the config_id of the burst.
+   * @param shape the dimensions of the cube.
+   * @param range_cube the range bins laid out as
+   *        CubeLayout::kChannelChirpSample, as written by RangeFft.
+   *
+   * @return RC_OK or RC_BAD_INPUT for an empty shape, a null cube, a weight
+   *         outside [0, 1] or a lag of 0.
+   */
+  RadarReturnCode Process(uint8_t config_id, const CubeShape& shape,
+                          std::complex<float>* range_cube);
+
+  //! Forget the background of a config.
+  void Reset(uint8_t config_id);
+
+  //! Forget the backgrounds of all configs.
+  void Reset();
+
+ private:
+  // State of the bursts of one config.
+  struct ConfigState {
+    CubeShape shape;
+    //! The background of every channel for the exponential variant,
+    //! the last mti_lag chirps of every channel for the MTI variant.
+    std::vector<std::complex<float>> background;
+    //! Whether background holds a burst yet.
+    bool has_background = false;
+    //! Row of the oldest chirp for the MTI variant.
+    size_t first_row = 0;
+  };
+
+  ConfigState& GetState(uint8_t config_id, const CubeShape& shape);
+
+  ClutterConfig config_;
+  //! States of the configs, few enough for a linear search.
+  std::vector<std::pair<uint8_t, ConfigState>> states_;
+  std::vector<std::complex<float>> sums_;
+};
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_CLUTTERFILTER_HPP_
@@ -0,0 +1,234 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <Fft.hpp>
+
+#include <SimdLevel.hpp>
+
+#include <cmath>
+#include <utility>
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+#include <SimdIntrinsics.hpp>
+#endif
+
+namespace radar_dsp {
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+
+// The first two stages of blocks of four points, their twiddles are 1 and
+// -i so they need no multiplications.
+void FirstStages(float* data, size_t size) {
+  for (size_t block = 0; block < size; block += 4) {
+    float* x = data + 2 * block;
+    float ar = x[0] + x[2], ai = x[1] + x[3];
+    float br = x[0] - x[2], bi = x[1] - x[3];
+    float cr = x[4] + x[6], ci = x[5] + x[7];
+    float dr = x[4] - x[6], di = x[5] - x[7];
+    x[0] = ar + cr;
+    x[1] = ai + ci;
+    x[4] = ar - cr;
+    x[5] = ai - ci;
+    // -i * d = di - i * dr.
+    x[2] = br + di;
+    x[3] = bi - dr;
+    x[6] = br - di;
+    x[7] = bi + dr;
+  }
+}
+
+// A radix-2 stage combines the points half apart in every block of
+// 2 * half points. The twiddles point to the half twiddles of the stage.
+struct ScalarKernel {
+  static void Stage(float* data, size_t size, size_t half,
+                    const float* twiddles) {
+    for (size_t block = 0; block < size; block += 2 * half) {
+      float* a = data + 2 * block;
+      float* b = a + 2 * half;
+      for (size_t j = 0; j < 2 * half; j += 2) {
+        float wr = twiddles[j];
+        float wi = twiddles[j + 1];
+        float tr = b[j] * wr - b[j + 1] * wi;
+        float ti = b[j] * wi + b[j + 1] * wr;
+        b[j] = a[j] - tr;
+        b[j + 1] = a[j + 1] - ti;
+        a[j] += tr;
+        a[j + 1] += ti;
+      }
+    }
+  }
+};
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+
+// Vectors of interleaved complex numbers are multiplied as
+// (br wr - bi wi, bi wr + br wi) with the real and imaginary parts of
+// the twiddles duplicated and the parts of b swapped.
+
+struct Sse41Kernel {
+  RADAR_DSP_TARGET_SSE41 static void Stage(float* data, size_t size,
+                                           size_t half,
+                                           const float* twiddles) {
+    for (size_t block = 0; block < size; block += 2 * half) {
+      float* a = data + 2 * block;
+      float* b = a + 2 * half;
+      for (size_t j = 0; j < 2 * half; j += 4) {
+        __m128 w = _mm_loadu_ps(twiddles + j);
+        __m128 vb = _mm_loadu_ps(b + j);
+        __m128 va = _mm_loadu_ps(a + j);
+        __m128 swapped = _mm_shuffle_ps(vb, vb, 0xb1);
+        __m128 t = _mm_addsub_ps(_mm_mul_ps(vb, _mm_moveldup_ps(w)),
+                                 _mm_mul_ps(swapped, _mm_movehdup_ps(w)));
+        _mm_storeu_ps(b + j, _mm_sub_ps(va, t));
+        _mm_storeu_ps(a + j, _mm_add_ps(va, t));
+      }
+    }
+  }
+};
+
+struct Avx2Kernel {
+  RADAR_DSP_TARGET_AVX2 static void Stage(float* data, size_t size,
+                                          size_t half,
+                                          const float* twiddles) {
+    for (size_t block = 0; block < size; block += 2 * half) {
+      float* a = data + 2 * block;
+      float* b = a + 2 * half;
+      for (size_t j = 0; j < 2 * half; j += 8) {
+        __m256 w = _mm256_loadu_ps(twiddles + j);
+        __m256 vb = _mm256_loadu_ps(b + j);
+        __m256 va = _mm256_loadu_ps(a + j);
+        __m256 swapped = _mm256_permute_ps(vb, 0xb1);
+        __m256 t = _mm256_fmaddsub_ps(
+            vb, _mm256_moveldup_ps(w),
+            _mm256_mul_ps(swapped, _mm256_movehdup_ps(w)));
+        _mm256_storeu_ps(b + j, _mm256_sub_ps(va, t));
+        _mm256_storeu_ps(a + j, _mm256_add_ps(va, t));
+      }
+    }
+  }
+};
+
+struct Avx512Kernel {
+  RADAR_DSP_TARGET_AVX512 static void Stage(float* data, size_t size,
+                                            size_t half,
+                                            const float* twiddles) {
+    if (half < 8) {
+      Avx2Kernel::Stage(data, size, half, twiddles);
+      return;
+    }
+    for (size_t block = 0; block < size; block += 2 * half) {
+      float* a = data + 2 * block;
+      float* b = a + 2 * half;
+      for (size_t j = 0; j < 2 * half; j += 16) {
+        __m512 w = _mm512_loadu_ps(twiddles + j);
+        __m512 vb = _mm512_loadu_ps(b + j);
+        __m512 va = _mm512_loadu_ps(a + j);
+        __m512 swapped = _mm512_permute_ps(vb, 0xb1);
+        __m512 t = _mm512_fmaddsub_ps(
+            vb, _mm512_moveldup_ps(w),
+            _mm512_mul_ps(swapped, _mm512_movehdup_ps(w)));
+        _mm512_storeu_ps(b + j, _mm512_sub_ps(va, t));
+        _mm512_storeu_ps(a + j, _mm512_add_ps(va, t));
+      }
+    }
+  }
+};
+
+#endif  // RADAR_DSP_HAS_X86_SIMD
+
+// The vector kernels run stages of at least 4 butterflies per block.
+template <typename Kernel>
+void Transform(float* data, size_t size, const float* twiddles) {
+  if (size < 4) {
+    for (size_t half = 1; half < size; half *= 2) {
+      ScalarKernel::Stage(data, size, half, twiddles + 2 * half);
+    }
+    return;
+  }
+  FirstStages(data, size);
+  for (size_t half = 4; half < size; half *= 2) {
+    Kernel::Stage(data, size, half, twiddles + 2 * half);
+  }
+}
+
+}  // namespace
+
+bool IsPowerOfTwo(size_t size) {
+  return size != 0 && (size & (size - 1)) == 0;
+}
+
+size_t NextPowerOfTwo(size_t size) {
+  size_t power = 1;
+  while (power < size) {
+    power *= 2;
+  }
+  return power;
+}
+
+FftPlan::FftPlan(size_t size)
+    : size_(size), bit_reverse_(size), twiddles_(size) {
+  int bits = 0;
+  while ((static_cast<size_t>(1) << bits) < size) {
+    ++bits;
+  }
+  for (size_t i = 0; i < size; ++i) {
+    uint32_t reversed = 0;
+    for (int b = 0; b < bits; ++b) {
+      reversed |= ((i >> b) & 1) << (bits - 1 - b);
+    }
+    bit_reverse_[i] = reversed;
+  }
+  for (size_t half = 1; half < size; half *= 2) {
+    for (size_t j = 0; j < half; ++j) {
+      double angle = -kPi * j / half;
+      twiddles_[half + j] = std::complex<float>(
+          static_cast<float>(std::cos(angle)),
+          static_cast<float>(std::sin(angle)));
+    }
+  }
+}
+
+void FftPlan::TransformBitReversed(std::complex<float>* data) const {
+  float* points = reinterpret_cast<float*>(data);
+  const float* twiddles = reinterpret_cast<const float*>(twiddles_.data());
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Transform<Avx512Kernel>(points, size_, twiddles);
+      return;
+    case SimdLevel::kAvx2:
+      Transform<Avx2Kernel>(points, size_, twiddles);
+      return;
+    case SimdLevel::kSse41:
+      Transform<Sse41Kernel>(points, size_, twiddles);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  Transform<ScalarKernel>(points, size_, twiddles);
+}
+
+void FftPlan::Forward(std::complex<float>* data) const {
+  for (size_t i = 0; i < size_; ++i) {
+    if (i < bit_reverse_[i]) {
+      std::swap(data[i], data[bit_reverse_[i]]);
+    }
+  }
+  TransformBitReversed(data);
+}
+
+void FftPlan::Inverse(std::complex<float>* data) const {
+  // ifft(x) = conj(fft(conj(x))) / n.
+  for (size_t i = 0; i < size_; ++i) {
+    data[i] = std::conj(data[i]);
+  }
+  Forward(data);
+  float scale = 1.0f / size_;
+  for (size_t i = 0; i < size_; ++i) {
+    data[i] = std::conj(data[i]) * scale;
+  }
+}
+
+}  // namespace radar_dsp
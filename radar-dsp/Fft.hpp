@@ -0,0 +1,83 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Complex FFT of power of two sizes.
+ *
+ * @details A radix-2 decimation in time FFT. The first two stages are done
+ *          at once without multiplications, the following ones run
+ *          the butterflies of a block with the SIMD instruction set returned
+ *          by GetSimdLevel. Twiddles of every stage are stored contiguously,
+ *          so the vector kernels load them without gathers.
+ *
+ *          A plan holds the tables of one size and is immutable, so it can
+ *          be shared by threads.
+ */
+#ifndef RIPPLE_RADAR_DSP_FFT_HPP_
+#define RIPPLE_RADAR_DSP_FFT_HPP_
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace radar_dsp {
+
+//! Check if a size is a power of two.
+bool IsPowerOfTwo(size_t size);
+
+//! Get the smallest power of two not below a size.
+size_t NextPowerOfTwo(size_t size);
+
+class FftPlan {
+ public:
+  /**
+   * @param size the number of points, must be a power of two.
+   */
+  explicit FftPlan(size_t size);
+
+  size_t Size() const {
+    return size_;
+  }
+
+  /**
+   * @brief Get the bit reversed position of every point.
+   *
+   * @details Callers that rearrange their input anyway, applying a window
+   *          for example, can write it straight into the bit reversed
+   *          order and use TransformBitReversed.
+   */
+  const std::vector<uint32_t>& BitReverse() const {
+    return bit_reverse_;
+  }
+
+  /**
+   * @brief Forward transform of points in bit reversed order, in place.
+   *
+   * @param data Size() points, the spectrum in natural order on return.
+   */
+  void TransformBitReversed(std::complex<float>* data) const;
+
+  /**
+   * @brief Forward transform in place.
+   *
+   * @param data Size() points.
+   */
+  void Forward(std::complex<float>* data) const;
+
+  /**
+   * @brief Inverse transform in place, scaled by 1 / Size().
+   *
+   * @param data Size() points.
+   */
+  void Inverse(std::complex<float>* data) const;
+
+ private:
+  size_t size_;
+  std::vector<uint32_t> bit_reverse_;
+  //! exp(-2 pi i j / (2 h)) for the stage of half size h at index h + j.
+  std::vector<std::complex<float>> twiddles_;
+};
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_FFT_HPP_
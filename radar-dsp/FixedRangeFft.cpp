@@ -0,0 +1,995 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <FixedRangeFft.hpp>
+
+#include <RangeFft.hpp>
+#include <SampleUnpack.hpp>
+#include <SimdLevel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+#include <SimdIntrinsics.hpp>
+#endif
+
+namespace radar_dsp {
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+
+// Largest component of a range bin, and the Q15 scale of the window and
+// twiddles. Components are kept symmetric, never reaching -32768, so their
+// absolute values fit in 16 bits.
+const int kMaxComponent = 32767;
+const double kQ15 = 32767.0;
+
+int16_t Saturate(int32_t value) {
+  return static_cast<int16_t>(
+      std::min(std::max(value, -kMaxComponent), kMaxComponent));
+}
+
+// Divide by 2^shift rounding half away from zero, so the rounding of
+// the shifts does not bias the DC bin.
+int32_t RoundShift(int32_t value, int shift) {
+  if (shift == 0) {
+    return value;
+  }
+  const int32_t half = 1 << (shift - 1);
+  return value >= 0 ? (value + half) >> shift : -((half - value) >> shift);
+}
+
+// Multiply by a Q15 coefficient rounding to nearest, as _mm_mulhrs_epi16
+// does.
+int32_t MultiplyQ15(int32_t value, int32_t coefficient) {
+  return (value * coefficient + (1 << 14)) >> 15;
+}
+
+// Bits to shift out before the first two stages, which grow components up
+// to 4 times.
+int GetFirstShift(int max) {
+  return max <= 8191 ? 0 : max <= 16382 ? 1 : max <= 32765 ? 2 : 3;
+}
+
+// Bits to shift out before a radix-2 stage. Components of a + w b stay
+// within max + sqrt(2) max, below 28000 so they never saturate.
+int GetStageShift(int max) {
+  return max <= 11584 ? 0 : max <= 23169 ? 1 : 2;
+}
+
+uint16_t LoadComponent(const uint8_t* data, size_t index,
+                       bool is_big_endian) {
+  const uint8_t* bytes = data + 2 * index;
+  return is_big_endian ? static_cast<uint16_t>((bytes[0] << 8) | bytes[1])
+                       : static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+}
+
+// The first two stages of blocks of four points, after dividing them by
+// 2^shift. Their twiddles are 1 and -i so they need no multiplications.
+//
+// A radix-2 stage combines the points half apart in every block of
+// 2 * half points, after dividing them by 2^shift. The twiddles point to
+// the pairs (wr, wr) and (-wi, wi) of the stage, so w b is b times
+// the first ones plus b with its parts swapped times the second ones.
+//
+// The window moves components of up to 16 bits to the top of their 16 bits
+// and multiplies them by Q15 coefficients.
+//
+// All return the largest component of their output.
+struct ScalarKernel {
+  static int FirstStages(int16_t* data, size_t size, int shift) {
+    int max = 0;
+    for (size_t block = 0; block < size; block += 4) {
+      int16_t* x = data + 2 * block;
+      int32_t v[8];
+      for (int i = 0; i < 8; ++i) {
+        v[i] = RoundShift(static_cast<int32_t>(x[i]), shift);
+      }
+      int32_t ar = v[0] + v[2], ai = v[1] + v[3];
+      int32_t br = v[0] - v[2], bi = v[1] - v[3];
+      int32_t cr = v[4] + v[6], ci = v[5] + v[7];
+      int32_t dr = v[4] - v[6], di = v[5] - v[7];
+      x[0] = Saturate(ar + cr);
+      x[1] = Saturate(ai + ci);
+      x[4] = Saturate(ar - cr);
+      x[5] = Saturate(ai - ci);
+      // -i * d = di - i * dr.
+      x[2] = Saturate(br + di);
+      x[3] = Saturate(bi - dr);
+      x[6] = Saturate(br - di);
+      x[7] = Saturate(bi + dr);
+      for (int i = 0; i < 8; ++i) {
+        max = std::max(max, std::abs(static_cast<int>(x[i])));
+      }
+    }
+    return max;
+  }
+
+  static int Stage(int16_t* data, size_t size, size_t half,
+                   const int16_t* twiddles_re, const int16_t* twiddles_im,
+                   int shift) {
+    int max = 0;
+    for (size_t block = 0; block < size; block += 2 * half) {
+      int16_t* a = data + 2 * block;
+      int16_t* b = a + 2 * half;
+      for (size_t j = 0; j < 2 * half; j += 2) {
+        int32_t ar = RoundShift(static_cast<int32_t>(a[j]), shift);
+        int32_t ai = RoundShift(static_cast<int32_t>(a[j + 1]), shift);
+        int32_t br = RoundShift(static_cast<int32_t>(b[j]), shift);
+        int32_t bi = RoundShift(static_cast<int32_t>(b[j + 1]), shift);
+        int32_t tr = MultiplyQ15(br, twiddles_re[j]) +
+                     MultiplyQ15(bi, twiddles_im[j]);
+        int32_t ti = MultiplyQ15(bi, twiddles_re[j + 1]) +
+                     MultiplyQ15(br, twiddles_im[j + 1]);
+        a[j] = Saturate(ar + tr);
+        a[j + 1] = Saturate(ai + ti);
+        b[j] = Saturate(ar - tr);
+        b[j + 1] = Saturate(ai - ti);
+        max = std::max(max, std::max(std::abs(static_cast<int>(a[j])),
+                                     std::abs(static_cast<int>(a[j + 1]))));
+        max = std::max(max, std::max(std::abs(static_cast<int>(b[j])),
+                                     std::abs(static_cast<int>(b[j + 1]))));
+      }
+    }
+    return max;
+  }
+
+  static int Window(const uint8_t* samples, const int16_t* window,
+                    size_t size, int up_shift, int16_t* output) {
+    int max = 0;
+    for (size_t i = 0; i < size; ++i) {
+      uint16_t sample;
+      memcpy(&sample, samples + 2 * i, sizeof(sample));
+      int32_t value = static_cast<int16_t>(
+          static_cast<uint16_t>(sample << up_shift));
+      output[i] = static_cast<int16_t>(
+          (value * window[i] + (1 << 14)) >> 15);
+      max = std::max(max, std::abs(static_cast<int>(output[i])));
+    }
+    return max;
+  }
+
+  static void Split(const int16_t* z, size_t size, const int16_t* twiddles_a,
+                    const int16_t* twiddles_b, int shift, size_t first,
+                    int16_t* output) {
+    for (size_t k = first; k <= size / 2; ++k) {
+      const int16_t* high = z + 2 * (size - k);
+      int32_t ar = RoundShift(static_cast<int32_t>(z[2 * k]), shift);
+      int32_t ai = RoundShift(static_cast<int32_t>(z[2 * k + 1]), shift);
+      int32_t br = RoundShift(static_cast<int32_t>(high[0]), shift);
+      int32_t bi = -RoundShift(static_cast<int32_t>(high[1]), shift);
+      int32_t er = ar + br, ei = ai + bi;
+      int32_t dr = ar - br, di = ai - bi;
+      int32_t rr = MultiplyQ15(di, twiddles_a[2 * k]) +
+                   MultiplyQ15(dr, twiddles_b[2 * k]);
+      int32_t ri = MultiplyQ15(dr, twiddles_a[2 * k + 1]) +
+                   MultiplyQ15(di, twiddles_b[2 * k + 1]);
+      output[2 * (size - k)] = static_cast<int16_t>(er - rr);
+      output[2 * (size - k) + 1] = static_cast<int16_t>(ri - ei);
+      output[2 * k] = static_cast<int16_t>(er + rr);
+      output[2 * k + 1] = static_cast<int16_t>(ei + ri);
+    }
+  }
+
+  static void Power(const int16_t* bins, size_t size, uint32_t* power) {
+    for (size_t i = 0; i < size; ++i) {
+      int32_t re = bins[2 * i], im = bins[2 * i + 1];
+      power[i] = static_cast<uint32_t>(re * re) +
+                 static_cast<uint32_t>(im * im);
+    }
+  }
+};
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+
+int GetMax(const uint16_t* values, size_t size) {
+  return *std::max_element(values, values + size);
+}
+
+// The first stages hold a block of four points per 128 bits. Shifted
+// points are at most 8191, so none of the additions overflows.
+
+struct Sse41Kernel {
+  // Divide by 2^shift, scale being 2^(15 - shift), rounding the absolute
+  // values with _mm_mulhrs_epi16.
+  RADAR_DSP_TARGET_SSE41 static __m128i RoundShift(__m128i value,
+                                                   __m128i scale) {
+    return _mm_sign_epi16(_mm_mulhrs_epi16(_mm_abs_epi16(value), scale),
+                          value);
+  }
+
+  RADAR_DSP_TARGET_SSE41 static int FirstStages(int16_t* data, size_t size,
+                                                int shift) {
+    const __m128i scale =
+        _mm_set1_epi16(static_cast<int16_t>(1 << (15 - std::max(shift, 1))));
+    // Points (p0 p1 p2 p3) into (p0 + p1, p0 - p1, p2 + p3, p2 - p3), then
+    // (a b c d) into (a + c, b - i d, a - c, b + i d).
+    const __m128i first_signs = _mm_setr_epi16(1, 1, -1, -1, 1, 1, -1, -1);
+    const __m128i second_order = _mm_setr_epi8(
+        8, 9, 10, 11, 14, 15, 12, 13, 8, 9, 10, 11, 14, 15, 12, 13);
+    const __m128i second_signs = _mm_setr_epi16(1, 1, 1, -1, -1, -1, -1, 1);
+    __m128i max = _mm_setzero_si128();
+    for (size_t block = 0; block < size; block += 4) {
+      __m128i* x = reinterpret_cast<__m128i*>(data + 2 * block);
+      __m128i v = _mm_loadu_si128(x);
+      if (shift != 0) {
+        v = RoundShift(v, scale);
+      }
+      __m128i first = _mm_add_epi16(
+          _mm_shuffle_epi32(v, 0xa0),
+          _mm_sign_epi16(_mm_shuffle_epi32(v, 0xf5), first_signs));
+      __m128i second = _mm_adds_epi16(
+          _mm_shuffle_epi32(first, 0x44),
+          _mm_sign_epi16(_mm_shuffle_epi8(first, second_order),
+                         second_signs));
+      _mm_storeu_si128(x, second);
+      max = _mm_max_epu16(max, _mm_abs_epi16(second));
+    }
+    uint16_t values[8];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(values), max);
+    return GetMax(values, 8);
+  }
+
+  RADAR_DSP_TARGET_SSE41 static int Stage(int16_t* data, size_t size,
+                                          size_t half,
+                                          const int16_t* twiddles_re,
+                                          const int16_t* twiddles_im,
+                                          int shift) {
+    const __m128i swap = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9,
+                                       14, 15, 12, 13);
+    const __m128i scale =
+        _mm_set1_epi16(static_cast<int16_t>(1 << (15 - std::max(shift, 1))));
+    __m128i max = _mm_setzero_si128();
+    for (size_t block = 0; block < size; block += 2 * half) {
+      int16_t* a = data + 2 * block;
+      int16_t* b = a + 2 * half;
+      for (size_t j = 0; j < 2 * half; j += 8) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<__m128i*>(a + j));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<__m128i*>(b + j));
+        if (shift != 0) {
+          va = RoundShift(va, scale);
+          vb = RoundShift(vb, scale);
+        }
+        __m128i t = _mm_add_epi16(
+            _mm_mulhrs_epi16(vb, _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(twiddles_re + j))),
+            _mm_mulhrs_epi16(_mm_shuffle_epi8(vb, swap), _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(twiddles_im + j))));
+        __m128i sum = _mm_adds_epi16(va, t);
+        __m128i difference = _mm_subs_epi16(va, t);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(a + j), sum);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(b + j), difference);
+        max = _mm_max_epu16(max, _mm_max_epu16(_mm_abs_epi16(sum),
+                                               _mm_abs_epi16(difference)));
+      }
+    }
+    uint16_t values[8];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(values), max);
+    return GetMax(values, 8);
+  }
+
+  RADAR_DSP_TARGET_SSE41 static int Window(const uint8_t* samples,
+                                           const int16_t* window, size_t size,
+                                           int up_shift, int16_t* output) {
+    const __m128i count = _mm_cvtsi32_si128(up_shift);
+    __m128i max = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+      __m128i v = _mm_sll_epi16(_mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(samples + 2 * i)), count);
+      v = _mm_mulhrs_epi16(v, _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(window + i)));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), v);
+      max = _mm_max_epu16(max, _mm_abs_epi16(v));
+    }
+    uint16_t values[8];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(values), max);
+    return std::max(GetMax(values, 8),
+                    ScalarKernel::Window(samples + 2 * i, window + i,
+                                         size - i, up_shift, output + i));
+  }
+
+  RADAR_DSP_TARGET_SSE41 static void Split(const int16_t* z, size_t size,
+                                           const int16_t* twiddles_a,
+                                           const int16_t* twiddles_b,
+                                           int shift, size_t first,
+                                           int16_t* output) {
+    const __m128i scale = _mm_set1_epi16(static_cast<int16_t>(
+        1 << (15 - std::max(shift, 1))));
+    const __m128i conjugate = _mm_setr_epi16(1, -1, 1, -1, 1, -1, 1, -1);
+    const __m128i swap = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9,
+                                       14, 15, 12, 13);
+    size_t k = first;
+    for (; k + 4 <= size / 2; k += 4) {
+      __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+          z + 2 * k));
+      // Points size - k down to size - k - 3.
+      __m128i vb = _mm_shuffle_epi32(_mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(z + 2 * (size - k - 3))), 0x1b);
+      if (shift != 0) {
+        va = RoundShift(va, scale);
+        vb = RoundShift(vb, scale);
+      }
+      vb = _mm_sign_epi16(vb, conjugate);
+      __m128i e = _mm_add_epi16(va, vb);
+      __m128i d = _mm_sub_epi16(va, vb);
+      __m128i rotated = _mm_add_epi16(
+          _mm_mulhrs_epi16(_mm_shuffle_epi8(d, swap), _mm_loadu_si128(
+              reinterpret_cast<const __m128i*>(twiddles_a + 2 * k))),
+          _mm_mulhrs_epi16(d, _mm_loadu_si128(
+              reinterpret_cast<const __m128i*>(twiddles_b + 2 * k))));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 2 * k),
+                       _mm_add_epi16(e, rotated));
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(output + 2 * (size - k - 3)),
+          _mm_shuffle_epi32(_mm_sign_epi16(_mm_sub_epi16(e, rotated),
+                                           conjugate), 0x1b));
+    }
+    ScalarKernel::Split(z, size, twiddles_a, twiddles_b, shift, k, output);
+  }
+
+  RADAR_DSP_TARGET_SSE41 static void Power(const int16_t* bins, size_t size,
+                                           uint32_t* power) {
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+          bins + 2 * i));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(power + i),
+                       _mm_madd_epi16(v, v));
+    }
+    ScalarKernel::Power(bins + 2 * i, size - i, power + i);
+  }
+};
+
+struct Avx2Kernel {
+  RADAR_DSP_TARGET_AVX2 static __m256i RoundShift(__m256i value,
+                                                  __m256i scale) {
+    return _mm256_sign_epi16(
+        _mm256_mulhrs_epi16(_mm256_abs_epi16(value), scale), value);
+  }
+
+  RADAR_DSP_TARGET_AVX2 static int FirstStages(int16_t* data, size_t size,
+                                               int shift) {
+    if (size < 8) {
+      return Sse41Kernel::FirstStages(data, size, shift);
+    }
+    const __m256i scale = _mm256_set1_epi16(
+        static_cast<int16_t>(1 << (15 - std::max(shift, 1))));
+    const __m256i first_signs = _mm256_setr_epi16(
+        1, 1, -1, -1, 1, 1, -1, -1, 1, 1, -1, -1, 1, 1, -1, -1);
+    const __m256i second_order = _mm256_setr_epi8(
+        8, 9, 10, 11, 14, 15, 12, 13, 8, 9, 10, 11, 14, 15, 12, 13,
+        8, 9, 10, 11, 14, 15, 12, 13, 8, 9, 10, 11, 14, 15, 12, 13);
+    const __m256i second_signs = _mm256_setr_epi16(
+        1, 1, 1, -1, -1, -1, -1, 1, 1, 1, 1, -1, -1, -1, -1, 1);
+    __m256i max = _mm256_setzero_si256();
+    for (size_t block = 0; block < size; block += 8) {
+      __m256i* x = reinterpret_cast<__m256i*>(data + 2 * block);
+      __m256i v = _mm256_loadu_si256(x);
+      if (shift != 0) {
+        v = RoundShift(v, scale);
+      }
+      __m256i first = _mm256_add_epi16(
+          _mm256_shuffle_epi32(v, 0xa0),
+          _mm256_sign_epi16(_mm256_shuffle_epi32(v, 0xf5), first_signs));
+      __m256i second = _mm256_adds_epi16(
+          _mm256_shuffle_epi32(first, 0x44),
+          _mm256_sign_epi16(_mm256_shuffle_epi8(first, second_order),
+                            second_signs));
+      _mm256_storeu_si256(x, second);
+      max = _mm256_max_epu16(max, _mm256_abs_epi16(second));
+    }
+    uint16_t values[16];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), max);
+    return GetMax(values, 16);
+  }
+
+  RADAR_DSP_TARGET_AVX2 static int Stage(int16_t* data, size_t size,
+                                         size_t half,
+                                         const int16_t* twiddles_re,
+                                         const int16_t* twiddles_im,
+                                         int shift) {
+    if (half < 8) {
+      return Sse41Kernel::Stage(data, size, half, twiddles_re, twiddles_im,
+                                shift);
+    }
+    const __m256i swap = _mm256_setr_epi8(
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    const __m256i scale = _mm256_set1_epi16(
+        static_cast<int16_t>(1 << (15 - std::max(shift, 1))));
+    __m256i max = _mm256_setzero_si256();
+    for (size_t block = 0; block < size; block += 2 * half) {
+      int16_t* a = data + 2 * block;
+      int16_t* b = a + 2 * half;
+      for (size_t j = 0; j < 2 * half; j += 16) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<__m256i*>(a + j));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<__m256i*>(b + j));
+        if (shift != 0) {
+          va = RoundShift(va, scale);
+          vb = RoundShift(vb, scale);
+        }
+        __m256i t = _mm256_add_epi16(
+            _mm256_mulhrs_epi16(vb, _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(twiddles_re + j))),
+            _mm256_mulhrs_epi16(_mm256_shuffle_epi8(vb, swap),
+                                _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(twiddles_im + j))));
+        __m256i sum = _mm256_adds_epi16(va, t);
+        __m256i difference = _mm256_subs_epi16(va, t);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + j), sum);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + j), difference);
+        max = _mm256_max_epu16(
+            max, _mm256_max_epu16(_mm256_abs_epi16(sum),
+                                  _mm256_abs_epi16(difference)));
+      }
+    }
+    uint16_t values[16];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), max);
+    return GetMax(values, 16);
+  }
+
+  RADAR_DSP_TARGET_AVX2 static int Window(const uint8_t* samples,
+                                          const int16_t* window, size_t size,
+                                          int up_shift, int16_t* output) {
+    const __m128i count = _mm_cvtsi32_si128(up_shift);
+    __m256i max = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+      __m256i v = _mm256_sll_epi16(_mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(samples + 2 * i)), count);
+      v = _mm256_mulhrs_epi16(v, _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(window + i)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), v);
+      max = _mm256_max_epu16(max, _mm256_abs_epi16(v));
+    }
+    uint16_t values[16];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), max);
+    return std::max(GetMax(values, 16),
+                    Sse41Kernel::Window(samples + 2 * i, window + i,
+                                        size - i, up_shift, output + i));
+  }
+
+  RADAR_DSP_TARGET_AVX2 static void Split(const int16_t* z, size_t size,
+                                          const int16_t* twiddles_a,
+                                          const int16_t* twiddles_b,
+                                          int shift, size_t first,
+                                          int16_t* output) {
+    const __m256i scale = _mm256_set1_epi16(static_cast<int16_t>(
+        1 << (15 - std::max(shift, 1))));
+    const __m256i conjugate = _mm256_setr_epi16(
+        1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1);
+    const __m256i swap = _mm256_setr_epi8(
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    size_t k = first;
+    for (; k + 8 <= size / 2; k += 8) {
+      __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+          z + 2 * k));
+      __m256i vb = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(z + 2 * (size - k - 7))),
+          reverse);
+      if (shift != 0) {
+        va = RoundShift(va, scale);
+        vb = RoundShift(vb, scale);
+      }
+      vb = _mm256_sign_epi16(vb, conjugate);
+      __m256i e = _mm256_add_epi16(va, vb);
+      __m256i d = _mm256_sub_epi16(va, vb);
+      __m256i rotated = _mm256_add_epi16(
+          _mm256_mulhrs_epi16(_mm256_shuffle_epi8(d, swap),
+                              _mm256_loadu_si256(
+              reinterpret_cast<const __m256i*>(twiddles_a + 2 * k))),
+          _mm256_mulhrs_epi16(d, _mm256_loadu_si256(
+              reinterpret_cast<const __m256i*>(twiddles_b + 2 * k))));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 2 * k),
+                          _mm256_add_epi16(e, rotated));
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(output + 2 * (size - k - 7)),
+          _mm256_permutevar8x32_epi32(
+              _mm256_sign_epi16(_mm256_sub_epi16(e, rotated), conjugate),
+              reverse));
+    }
+    Sse41Kernel::Split(z, size, twiddles_a, twiddles_b, shift, k, output);
+  }
+
+  RADAR_DSP_TARGET_AVX2 static void Power(const int16_t* bins, size_t size,
+                                          uint32_t* power) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+      __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+          bins + 2 * i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(power + i),
+                          _mm256_madd_epi16(v, v));
+    }
+    ScalarKernel::Power(bins + 2 * i, size - i, power + i);
+  }
+};
+
+// AVX-512 has no _mm512_sign_epi16, its first stages are the AVX2 ones.
+struct Avx512Kernel {
+  RADAR_DSP_TARGET_AVX512 static __m512i RoundShift(__m512i value,
+                                                    __m512i scale) {
+    __m512i rounded = _mm512_mulhrs_epi16(_mm512_abs_epi16(value), scale);
+    return _mm512_mask_sub_epi16(rounded, _mm512_movepi16_mask(value),
+                                 _mm512_setzero_si512(), rounded);
+  }
+
+  RADAR_DSP_TARGET_AVX512 static int FirstStages(int16_t* data, size_t size,
+                                                 int shift) {
+    return Avx2Kernel::FirstStages(data, size, shift);
+  }
+
+  RADAR_DSP_TARGET_AVX512 static int Stage(int16_t* data, size_t size,
+                                           size_t half,
+                                           const int16_t* twiddles_re,
+                                           const int16_t* twiddles_im,
+                                           int shift) {
+    if (half < 16) {
+      return Avx2Kernel::Stage(data, size, half, twiddles_re, twiddles_im,
+                               shift);
+    }
+    const __m512i swap = _mm512_broadcast_i32x4(_mm_setr_epi8(
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13));
+    const __m512i scale = _mm512_set1_epi16(
+        static_cast<int16_t>(1 << (15 - std::max(shift, 1))));
+    __m512i max = _mm512_setzero_si512();
+    for (size_t block = 0; block < size; block += 2 * half) {
+      int16_t* a = data + 2 * block;
+      int16_t* b = a + 2 * half;
+      for (size_t j = 0; j < 2 * half; j += 32) {
+        __m512i va = _mm512_loadu_si512(a + j);
+        __m512i vb = _mm512_loadu_si512(b + j);
+        if (shift != 0) {
+          va = RoundShift(va, scale);
+          vb = RoundShift(vb, scale);
+        }
+        __m512i t = _mm512_add_epi16(
+            _mm512_mulhrs_epi16(vb, _mm512_loadu_si512(twiddles_re + j)),
+            _mm512_mulhrs_epi16(_mm512_shuffle_epi8(vb, swap),
+                                _mm512_loadu_si512(twiddles_im + j)));
+        __m512i sum = _mm512_adds_epi16(va, t);
+        __m512i difference = _mm512_subs_epi16(va, t);
+        _mm512_storeu_si512(a + j, sum);
+        _mm512_storeu_si512(b + j, difference);
+        max = _mm512_max_epu16(
+            max, _mm512_max_epu16(_mm512_abs_epi16(sum),
+                                  _mm512_abs_epi16(difference)));
+      }
+    }
+    uint16_t values[32];
+    _mm512_storeu_si512(values, max);
+    return GetMax(values, 32);
+  }
+
+  RADAR_DSP_TARGET_AVX512 static int Window(const uint8_t* samples,
+                                            const int16_t* window,
+                                            size_t size, int up_shift,
+                                            int16_t* output) {
+    const __m128i count = _mm_cvtsi32_si128(up_shift);
+    __m512i max = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+      __m512i v = _mm512_sll_epi16(_mm512_loadu_si512(samples + 2 * i),
+                                   count);
+      v = _mm512_mulhrs_epi16(v, _mm512_loadu_si512(window + i));
+      _mm512_storeu_si512(output + i, v);
+      max = _mm512_max_epu16(max, _mm512_abs_epi16(v));
+    }
+    uint16_t values[32];
+    _mm512_storeu_si512(values, max);
+    return std::max(GetMax(values, 32),
+                    Avx2Kernel::Window(samples + 2 * i, window + i,
+                                       size - i, up_shift, output + i));
+  }
+
+  RADAR_DSP_TARGET_AVX512 static void Split(const int16_t* z, size_t size,
+                                            const int16_t* twiddles_a,
+                                            const int16_t* twiddles_b,
+                                            int shift, size_t first,
+                                            int16_t* output) {
+    const __m512i scale = _mm512_set1_epi16(static_cast<int16_t>(
+        1 << (15 - std::max(shift, 1))));
+    const __mmask32 imaginary = 0xaaaaaaaa;
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i swap = _mm512_broadcast_i32x4(_mm_setr_epi8(
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13));
+    const __m512i reverse = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8,
+                                              7, 6, 5, 4, 3, 2, 1, 0);
+    size_t k = first;
+    for (; k + 16 <= size / 2; k += 16) {
+      __m512i va = _mm512_loadu_si512(z + 2 * k);
+      __m512i vb = _mm512_permutexvar_epi32(
+          reverse, _mm512_loadu_si512(z + 2 * (size - k - 15)));
+      if (shift != 0) {
+        va = RoundShift(va, scale);
+        vb = RoundShift(vb, scale);
+      }
+      vb = _mm512_mask_sub_epi16(vb, imaginary, zero, vb);
+      __m512i e = _mm512_add_epi16(va, vb);
+      __m512i d = _mm512_sub_epi16(va, vb);
+      __m512i rotated = _mm512_add_epi16(
+          _mm512_mulhrs_epi16(_mm512_shuffle_epi8(d, swap),
+                              _mm512_loadu_si512(twiddles_a + 2 * k)),
+          _mm512_mulhrs_epi16(d, _mm512_loadu_si512(twiddles_b + 2 * k)));
+      _mm512_storeu_si512(output + 2 * k, _mm512_add_epi16(e, rotated));
+      __m512i high = _mm512_sub_epi16(e, rotated);
+      high = _mm512_mask_sub_epi16(high, imaginary, zero, high);
+      _mm512_storeu_si512(output + 2 * (size - k - 15),
+                          _mm512_permutexvar_epi32(reverse, high));
+    }
+    Avx2Kernel::Split(z, size, twiddles_a, twiddles_b, shift, k, output);
+  }
+
+  RADAR_DSP_TARGET_AVX512 static void Power(const int16_t* bins, size_t size,
+                                            uint32_t* power) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+      __m512i v = _mm512_loadu_si512(bins + 2 * i);
+      _mm512_storeu_si512(power + i, _mm512_madd_epi16(v, v));
+    }
+    ScalarKernel::Power(bins + 2 * i, size - i, power + i);
+  }
+};
+
+#endif  // RADAR_DSP_HAS_X86_SIMD
+
+// Transform points in bit reversed order in place, max being their largest
+// component. Return the bits shifted out, and the largest component of
+// the spectrum in max. The vector kernels run stages of at least 4
+// butterflies per block.
+template <typename Kernel>
+int Transform(int16_t* data, size_t size, const int16_t* twiddles_re,
+              const int16_t* twiddles_im, int& max) {
+  int exponent = 0;
+  size_t half = 1;
+  if (size >= 4) {
+    int shift = GetFirstShift(max);
+    max = Kernel::FirstStages(data, size, shift);
+    exponent += shift;
+    half = 4;
+  }
+  for (; half < size; half *= 2) {
+    int shift = GetStageShift(max);
+    max = (half < 4 ? ScalarKernel::Stage : Kernel::Stage)(
+        data, size, half, twiddles_re + 2 * half, twiddles_im + 2 * half,
+        shift);
+    exponent += shift;
+  }
+  return exponent;
+}
+
+int TransformBitReversed(int16_t* data, size_t size,
+                         const int16_t* twiddles_re,
+                         const int16_t* twiddles_im, int& max) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      return Transform<Avx512Kernel>(data, size, twiddles_re, twiddles_im,
+                                     max);
+    case SimdLevel::kAvx2:
+      return Transform<Avx2Kernel>(data, size, twiddles_re, twiddles_im,
+                                   max);
+    case SimdLevel::kSse41:
+      return Transform<Sse41Kernel>(data, size, twiddles_re, twiddles_im,
+                                    max);
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  return Transform<ScalarKernel>(data, size, twiddles_re, twiddles_im, max);
+}
+
+int Window(const uint8_t* samples, const int16_t* window, size_t size,
+           int up_shift, int16_t* output) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      return Avx512Kernel::Window(samples, window, size, up_shift, output);
+    case SimdLevel::kAvx2:
+      return Avx2Kernel::Window(samples, window, size, up_shift, output);
+    case SimdLevel::kSse41:
+      return Sse41Kernel::Window(samples, window, size, up_shift, output);
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  return ScalarKernel::Window(samples, window, size, up_shift, output);
+}
+
+void GetPower(const int16_t* bins, size_t size, uint32_t* power) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::Power(bins, size, power);
+      return;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::Power(bins, size, power);
+      return;
+    case SimdLevel::kSse41:
+      Sse41Kernel::Power(bins, size, power);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::Power(bins, size, power);
+}
+
+int16_t ToQ15(double value) {
+  return Saturate(static_cast<int32_t>(std::lround(value * kQ15)));
+}
+
+}  // namespace
+
+struct FixedRangePlan {
+  FixedRangePlan(size_t num_samples, bool is_complex, WindowType window_type)
+      : size(RangeFft::GetNumRangeBins(num_samples, is_complex)),
+        bit_reverse(size),
+        twiddles_re(2 * size),
+        twiddles_im(2 * size) {
+    int bits = 0;
+    while ((static_cast<size_t>(1) << bits) < size) {
+      ++bits;
+    }
+    for (size_t i = 0; i < size; ++i) {
+      uint32_t reversed = 0;
+      for (int b = 0; b < bits; ++b) {
+        reversed |= ((i >> b) & 1) << (bits - 1 - b);
+      }
+      bit_reverse[i] = reversed;
+    }
+    for (size_t half = 1; half < size; half *= 2) {
+      for (size_t j = 0; j < half; ++j) {
+        double angle = -kPi * j / half;
+        size_t index = 2 * (half + j);
+        twiddles_re[index] = ToQ15(std::cos(angle));
+        twiddles_re[index + 1] = ToQ15(std::cos(angle));
+        twiddles_im[index] = ToQ15(-std::sin(angle));
+        twiddles_im[index + 1] = ToQ15(std::sin(angle));
+      }
+    }
+
+    // The window is scaled to a peak of 1 to keep the precision of
+    // the samples, gain scales it back.
+    std::vector<float> coefficients = MakeWindow(window_type, num_samples);
+    float peak = *std::max_element(coefficients.begin(), coefficients.end());
+    const size_t components = is_complex ? 2 : 1;
+    window.resize(num_samples * components);
+    for (size_t i = 0; i < window.size(); ++i) {
+      window[i] = ToQ15(coefficients[i / components] / peak);
+    }
+    gain = static_cast<float>(peak * 32768.0 / kQ15);
+
+    if (!is_complex) {
+      // W^k = exp(-2 pi i k / n) of the real FFT of n = 2 * size.
+      split_twiddles_a.resize(2 * (size / 2 + 1));
+      split_twiddles_b.resize(2 * (size / 2 + 1));
+      for (size_t k = 0; k <= size / 2; ++k) {
+        double angle = -kPi * k / size;
+        split_twiddles_a[2 * k] = ToQ15(std::cos(angle));
+        split_twiddles_a[2 * k + 1] = ToQ15(-std::cos(angle));
+        split_twiddles_b[2 * k] = ToQ15(std::sin(angle));
+        split_twiddles_b[2 * k + 1] = ToQ15(std::sin(angle));
+      }
+    }
+  }
+
+  //! Points of the complex FFT.
+  size_t size;
+  std::vector<uint32_t> bit_reverse;
+  //! Pairs (wr, wr) and (-wi, wi) of the twiddle exp(-2 pi i j / (2 h)) of
+  //! the stage of half size h at index 2 (h + j), in Q15.
+  std::vector<int16_t> twiddles_re;
+  std::vector<int16_t> twiddles_im;
+  //! Window of every component in Q15, and the scale of its peak.
+  std::vector<int16_t> window;
+  float gain;
+  //! Pairs (wr, -wr) and (wi, wi) of the twiddles W^k splitting
+  //! the spectrum of real chirps, in Q15.
+  std::vector<int16_t> split_twiddles_a;
+  std::vector<int16_t> split_twiddles_b;
+};
+
+namespace {
+
+// Plans shared by all the instances. They are never freed, there are only
+// as many as there are chirp sizes in use.
+std::shared_ptr<const FixedRangePlan> GetSharedPlan(uint64_t key,
+                                                    size_t num_samples,
+                                                    bool is_complex,
+                                                    WindowType window) {
+  static std::mutex mutex;
+  static std::map<uint64_t, std::shared_ptr<const FixedRangePlan>> plans;
+  std::lock_guard<std::mutex> lock(mutex);
+  std::shared_ptr<const FixedRangePlan>& plan = plans[key];
+  if (!plan) {
+    plan = std::make_shared<FixedRangePlan>(num_samples, is_complex, window);
+  }
+  return plan;
+}
+
+// Split the spectra of the even and odd samples of a real chirp, E and O,
+// packed in the spectrum z of size points, into X[k] = E[k] + W^k O[k] and
+// X[n - k] = conj(E[k] - W^k O[k]) like RangeFft. Return the bits shifted
+// out.
+int SplitSpectrum(const int16_t* z, size_t size, const FixedRangePlan& plan,
+                  int max, int16_t* output) {
+  const int shift = GetStageShift(max);
+  output[0] = Saturate(RoundShift(static_cast<int32_t>(z[0]) + z[1], shift));
+  output[1] = 0;
+  const int16_t* twiddles_a = plan.split_twiddles_a.data();
+  const int16_t* twiddles_b = plan.split_twiddles_b.data();
+  // Halving E and O is folded into the shift.
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::Split(z, size, twiddles_a, twiddles_b, shift + 1, 1,
+                          output);
+      return shift;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::Split(z, size, twiddles_a, twiddles_b, shift + 1, 1,
+                        output);
+      return shift;
+    case SimdLevel::kSse41:
+      Sse41Kernel::Split(z, size, twiddles_a, twiddles_b, shift + 1, 1,
+                         output);
+      return shift;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::Split(z, size, twiddles_a, twiddles_b, shift + 1, 1, output);
+  return shift;
+}
+
+}  // namespace
+
+FixedRangeFft::FixedRangeFft(WindowType window) : window_(window) {}
+
+FixedRangeFft::~FixedRangeFft() {}
+
+bool FixedRangeFft::IsSupported(const RadarBurstFormat& format) {
+  SampleLayout layout;
+  return format.radar_type == RTYPE_FMCW &&
+         GetSampleLayout(format, layout) == RC_OK && layout.is_signed &&
+         !layout.is_float && !layout.is_packed &&
+         layout.container_bytes == 2;
+}
+
+const FixedRangePlan& FixedRangeFft::GetPlan(size_t num_samples,
+                                             bool is_complex) {
+  uint64_t key = static_cast<uint64_t>(num_samples) |
+                 (static_cast<uint64_t>(is_complex) << 32) |
+                 (static_cast<uint64_t>(window_) << 33);
+  for (const auto& plan : plans_) {
+    if (plan.first == key) {
+      return *plan.second;
+    }
+  }
+  plans_.emplace_back(key, GetSharedPlan(key, num_samples, is_complex,
+                                         window_));
+  return *plans_.back().second;
+}
+
+RadarReturnCode FixedRangeFft::Process(const RadarBurstFormat& format,
+                                       const uint8_t* data, size_t size_bytes,
+                                       FixedRangeCube& range_cube) {
+  CubeShape shape;
+  SampleLayout layout;
+  if (!IsSupported(format) || GetCubeShape(format, shape) != RC_OK ||
+      GetSampleLayout(format, layout) != RC_OK) {
+    return RC_UNSUPPORTED;
+  }
+  if (shape.Size() == 0 || data == nullptr ||
+      shape.Size() * layout.components * 2 != size_bytes) {
+    return RC_BAD_INPUT;
+  }
+  const bool is_complex = layout.components == 2;
+  const FixedRangePlan& plan = GetPlan(shape.num_samples, is_complex);
+  const size_t num_samples = shape.num_samples;
+  const size_t num_bins = plan.size;
+  const size_t num_chirps = shape.num_chirps;
+  const uint32_t* bit_reverse = plan.bit_reverse.data();
+  const int16_t* window = plan.window.data();
+  const bool is_big_endian = layout.is_big_endian;
+  const bool is_interleaved =
+      GetBurstLayout(format) == CubeLayout::kChirpSampleChannel;
+  // Components are moved up to the top of their 16 bits, which
+  // sign-extends them and leaves the FFT the most precision.
+  const int up_shift = 16 - layout.bits;
+
+  range_cube.shape = shape;
+  range_cube.shape.num_samples = static_cast<uint32_t>(num_bins);
+  range_cube.gain = plan.gain;
+  range_cube.exponents.resize(static_cast<size_t>(shape.num_channels) *
+                              num_chirps);
+  range_cube.bins.resize(2 * range_cube.shape.Size());
+  scratch_.resize(2 * num_bins);
+  // An odd number of real samples is padded with a zero.
+  const size_t num_components = num_samples * layout.components;
+  const size_t num_points = (num_components + 1) / 2;
+  samples_.resize(num_components);
+  row_.assign(2 * num_points, 0);
+
+  for (size_t channel = 0; channel < shape.num_channels; ++channel) {
+    for (size_t chirp = 0; chirp < num_chirps; ++chirp) {
+      const size_t index = channel * num_chirps + chirp;
+      // Samples of the chirp are stride samples apart in the burst.
+      size_t first, stride;
+      if (is_interleaved) {
+        first = chirp * num_samples * shape.num_channels + channel;
+        stride = shape.num_channels;
+      } else {
+        first = index * num_samples;
+        stride = 1;
+      }
+      int16_t* output = &range_cube.bins[2 * index * num_bins];
+      int16_t* z = is_complex ? output : scratch_.data();
+
+      // Samples of other layouts are gathered into a contiguous little
+      // endian row first.
+      const uint8_t* samples = data + 2 * first * layout.components;
+      if (is_big_endian || stride != 1) {
+        for (size_t i = 0; i < num_components; ++i) {
+          size_t sample = first + i / layout.components * stride;
+          samples_[i] = LoadComponent(
+              data, sample * layout.components + i % layout.components,
+              is_big_endian);
+        }
+        samples = reinterpret_cast<const uint8_t*>(samples_.data());
+      }
+      int max = Window(samples, window, num_components, up_shift,
+                       row_.data());
+
+      // Move pairs of components into the bit reversed order, zero padded.
+      // Real chirps put even samples into the real parts and odd ones into
+      // the imaginary parts of a half size complex FFT.
+      for (size_t m = 0; m < num_points; ++m) {
+        memcpy(z + 2 * bit_reverse[m], &row_[2 * m], 2 * sizeof(int16_t));
+      }
+      for (size_t m = num_points; m < num_bins; ++m) {
+        z[2 * bit_reverse[m]] = 0;
+        z[2 * bit_reverse[m] + 1] = 0;
+      }
+      int exponent = TransformBitReversed(z, num_bins,
+                                          plan.twiddles_re.data(),
+                                          plan.twiddles_im.data(), max);
+      if (!is_complex) {
+        exponent += SplitSpectrum(z, num_bins, plan,
+                                  max, output);
+      }
+      range_cube.exponents[index] = static_cast<int8_t>(exponent - up_shift);
+    }
+  }
+  return RC_OK;
+}
+
+void GetRangePower(const FixedRangeCube& range_cube,
+                   std::vector<uint32_t>& power) {
+  power.resize(range_cube.bins.size() / 2);
+  GetPower(range_cube.bins.data(), power.size(), power.data());
+}
+
+void ConvertRangeCube(const FixedRangeCube& range_cube,
+                      std::vector<std::complex<float>>& output) {
+  const size_t num_bins = range_cube.shape.num_samples;
+  output.resize(range_cube.bins.size() / 2);
+  for (size_t chirp = 0; chirp < range_cube.exponents.size(); ++chirp) {
+    float scale = std::ldexp(range_cube.gain, range_cube.exponents[chirp]);
+    const int16_t* bins = &range_cube.bins[2 * chirp * num_bins];
+    std::complex<float>* row = &output[chirp * num_bins];
+    for (size_t k = 0; k < num_bins; ++k) {
+      row[k] = std::complex<float>(bins[2 * k] * scale,
+                                   bins[2 * k + 1] * scale);
+    }
+  }
+}
+
+}  // namespace radar_dsp
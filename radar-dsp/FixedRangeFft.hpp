@@ -0,0 +1,127 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Fixed-point range processing of 16-bit FMCW bursts.
+ *
+ * @details Windows and transforms the chirps of bursts of signed integer
+ *          samples of up to 16 bits in 16-bit containers, RSAMPLE_DTYPE_CINT
+ *          or RSAMPLE_DTYPE_INT, without converting them to float, so
+ *          the range cube takes half the memory traffic of the float one.
+ *
+ *          Samples are read straight from the burst data, windowed with Q15
+ *          coefficients and transformed in int16 with block floating point:
+ *          before every stage the largest component decides how many bits
+ *          the stage shifts out, just enough for its butterflies not to
+ *          overflow, and every chirp carries the exponent of its shifts.
+ *          Butterflies multiply by Q15 twiddles with rounding and shift
+ *          rounding half away from zero, so the errors do not pile up in
+ *          the DC bin, vectorized for the instruction set returned by
+ *          GetSimdLevel. Every level gives the same bits.
+ *
+ *          Range bin k of chirp c is bins[k] * 2^exponents[c] * gain, in
+ *          the scale of the output of RangeFft for the same burst. For noise
+ *          at full scale the range bins are within 1e-3, -60 dB, of
+ *          the largest one of the chirp, closer for tones.
+ *
+ *          Plans are shared by all the instances like those of RangeFft.
+ *          An instance holds scratch buffers and must be used by one thread
+ *          at a time.
+ *
+ * Example:
+ * ```
+ *   radar_dsp::FixedRangeFft range_fft(radar_dsp::WindowType::kHann);
+ *   radar_dsp::FixedRangeCube range_cube;
+ *   RadarReturnCode rc = range_fft.Process(format, raw_radar_data.data(),
+ *                                          raw_radar_data.size(),
+ *                                          range_cube);
+ *   std::vector<uint32_t> power;
+ *   radar_dsp::GetRangePower(range_cube, power);
+ * ```
+ */
+#ifndef RIPPLE_RADAR_DSP_FIXEDRANGEFFT_HPP_
+#define RIPPLE_RADAR_DSP_FIXEDRANGEFFT_HPP_
+
+#include <RadarCommon.h>
+
+#include <RadarCube.hpp>
+#include <Window.hpp>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace radar_dsp {
+
+//! Tables of one chirp size, defined in FixedRangeFft.cpp.
+struct FixedRangePlan;
+
+//! A range cube in block floating point.
+struct FixedRangeCube {
+  //! Dimensions of the cube, num_samples being the number of range bins.
+  CubeShape shape;
+  //! Scale of the window.
+  float gain;
+  //! Exponent of every chirp, laid out as channel x chirp.
+  std::vector<int8_t> exponents;
+  //! Range bins laid out as CubeLayout::kChannelChirpSample, with
+  //! interleaved real and imaginary parts.
+  std::vector<int16_t> bins;
+};
+
+class FixedRangeFft {
+ public:
+  explicit FixedRangeFft(WindowType window = WindowType::kHann);
+  ~FixedRangeFft();
+
+  //! Check if the samples of a burst can be processed in fixed point.
+  static bool IsSupported(const RadarBurstFormat& format);
+
+  /**
+   * @brief Transform the chirps of a burst into range bins.
+   *
+   * @param format the burst format.
+   * @param data the burst data.
+   * @param size_bytes the size of the burst data.
+   * @param range_cube where the range cube will be written into.
+   *
+   * @return RC_OK, RC_UNSUPPORTED for bursts other than FMCW ones of signed
+   *         integers of up to 16 bits in 16-bit containers, RC_BAD_INPUT if
+   *         the size does not match the format.
+   */
+  RadarReturnCode Process(const RadarBurstFormat& format, const uint8_t* data,
+                          size_t size_bytes, FixedRangeCube& range_cube);
+
+ private:
+  const FixedRangePlan& GetPlan(size_t num_samples, bool is_complex);
+
+  WindowType window_;
+  //! Plans used by this instance, few enough for a linear search.
+  std::vector<std::pair<uint64_t, std::shared_ptr<const FixedRangePlan>>>
+      plans_;
+  std::vector<uint16_t> samples_;
+  std::vector<int16_t> row_;
+  std::vector<int16_t> scratch_;
+};
+
+/**
+ * @brief Get the power of the range bins of a cube.
+ *
+ * @details The power of range bin k of chirp c is
+ *          power[k] * 4^exponents[c] * gain^2, it is exact in 32 bits.
+ *
+ * @param range_cube the range cube.
+ * @param power where the channel x chirp x range bin power will be written.
+ */
+void GetRangePower(const FixedRangeCube& range_cube,
+                   std::vector<uint32_t>& power);
+
+//! Convert a range cube to float, as written by RangeFft.
+void ConvertRangeCube(const FixedRangeCube& range_cube,
+                      std::vector<std::complex<float>>& output);
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_FIXEDRANGEFFT_HPP_
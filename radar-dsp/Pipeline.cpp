@@ -0,0 +1,380 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <Pipeline.hpp>
+
+#include <SamplePacking.hpp>
+#include <SampleUnpack.hpp>
+
+#include <algorithm>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace radar_dsp {
+
+namespace {
+
+// How long a stage waits before checking if it has to stop. Closing
+// the queues wakes up the stages right away, this is a safety net only.
+const timespec kQueueTimeout = {1, 0};
+
+// Range bins of a Doppler task, a multiple of the blocks RangeDoppler
+// transposes together.
+const size_t kDopplerTaskBins = 8;
+
+const char* const kStageNames[kNumPipelineStages] = {
+  "read", "unpack", "range", "doppler", "detect",
+};
+
+uint64_t GetNanoseconds(std::chrono::steady_clock::duration duration) {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+
+void Add(std::atomic<uint64_t>& counter, uint64_t value) {
+  counter.store(counter.load(std::memory_order_relaxed) + value,
+                std::memory_order_relaxed);
+}
+
+void SetLastAndMax(std::atomic<uint64_t>& last, std::atomic<uint64_t>& max,
+                   uint64_t value) {
+  last.store(value, std::memory_order_relaxed);
+  if (value > max.load(std::memory_order_relaxed)) {
+    max.store(value, std::memory_order_relaxed);
+  }
+}
+
+radar_utils::ThreadPool* CreateThreadPool(const PipelineConfig& config) {
+  if (config.num_workers == 0) {
+    return nullptr;
+  }
+  radar_utils::ThreadPoolConfig pool_config;
+  pool_config.num_workers = config.num_workers;
+  // The range and Doppler stages split their bursts at the same time.
+  pool_config.num_outside_threads = 2;
+  if (config.first_cpu >= 0) {
+    pool_config.first_cpu =
+        config.first_cpu + static_cast<int>(kNumPipelineStages);
+  }
+  return new radar_utils::ThreadPool(pool_config);
+}
+
+}  // namespace
+
+const char* GetPipelineStageName(PipelineStage stage) {
+  size_t index = static_cast<size_t>(stage);
+  return index < kNumPipelineStages ? kStageNames[index] : "unknown";
+}
+
+Pipeline::Pipeline(const PipelineConfig& config)
+    : config_(config),
+      pool_(CreateThreadPool(config)),
+      range_ffts_(pool_ ? pool_->GetNumThreads() : 1,
+                  RangeFft(config.range_window)),
+      clutter_filter_(config.clutter),
+      range_dopplers_(range_ffts_.size(),
+                      RangeDoppler(config.range_window, config.doppler_window,
+                                   config.integrate_channels, config.scale)),
+      detector_(config.cfar) {}
+
+Pipeline::~Pipeline() {
+  Stop();
+}
+
+RadarReturnCode Pipeline::Start(radar_api::IRadarSensor* radar) {
+  if (radar == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  if (!threads_.empty()) {
+    return RC_BAD_STATE;
+  }
+  stopping_.store(false);
+  for (size_t i = 0; i < kNumPipelineStages; ++i) {
+    // Only the reader may drop, the stages always wait for each other.
+    queues_[i].reset(new FrameQueue(
+        config_.queue_depth,
+        i == 0 ? config_.policy : radar_utils::DropPolicy::kBlock));
+    StageCounters& counters = counters_[i];
+    counters.frames.store(0);
+    counters.errors.store(0);
+    counters.busy_ns.store(0);
+    counters.last_ns.store(0);
+    counters.max_ns.store(0);
+    counters.blocked_ns.store(0);
+  }
+  last_latency_ns_.store(0);
+  max_latency_ns_.store(0);
+
+  threads_.emplace_back(&Pipeline::Read, this, radar);
+  threads_.emplace_back(&Pipeline::Run, this, PipelineStage::kUnpack,
+                        &Pipeline::Unpack);
+  threads_.emplace_back(&Pipeline::Run, this, PipelineStage::kRange,
+                        &Pipeline::TransformRange);
+  threads_.emplace_back(&Pipeline::Run, this, PipelineStage::kDoppler,
+                        &Pipeline::TransformDoppler);
+  threads_.emplace_back(&Pipeline::Run, this, PipelineStage::kDetect,
+                        &Pipeline::Detect);
+  return RC_OK;
+}
+
+void Pipeline::Stop() {
+  if (threads_.empty()) {
+    return;
+  }
+  stopping_.store(true);
+  for (auto& queue : queues_) {
+    queue->Close();
+  }
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+  threads_.clear();
+}
+
+RadarReturnCode Pipeline::Pop(PipelineFrame& frame, timespec timeout) {
+  FrameQueue* output = queues_[kNumPipelineStages - 1].get();
+  if (output == nullptr) {
+    return RC_BAD_STATE;
+  }
+  return output->Pop(frame, timeout);
+}
+
+PipelineStats Pipeline::GetStats() const {
+  PipelineStats stats;
+  for (size_t i = 0; i < kNumPipelineStages; ++i) {
+    const StageCounters& counters = counters_[i];
+    PipelineStageStats& stage = stats.stages[i];
+    stage.frames = counters.frames.load(std::memory_order_relaxed);
+    stage.errors = counters.errors.load(std::memory_order_relaxed);
+    stage.busy_ns = counters.busy_ns.load(std::memory_order_relaxed);
+    stage.last_ns = counters.last_ns.load(std::memory_order_relaxed);
+    stage.max_ns = counters.max_ns.load(std::memory_order_relaxed);
+    stage.blocked_ns = counters.blocked_ns.load(std::memory_order_relaxed);
+    stage.queue = queues_[i] ? queues_[i]->GetStats()
+                             : radar_utils::QueueStats();
+  }
+  stats.last_latency_ns = last_latency_ns_.load(std::memory_order_relaxed);
+  stats.max_latency_ns = max_latency_ns_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void Pipeline::Read(radar_api::IRadarSensor* radar) {
+  PinThread(PipelineStage::kRead);
+  StageCounters& counters = counters_[0];
+  PipelineFrame frame;
+  while (!stopping_.load(std::memory_order_relaxed)) {
+    auto start = std::chrono::steady_clock::now();
+    RadarReturnCode rc = radar->ReadBurst(frame.format, frame.data,
+                                          config_.read_timeout);
+    if (rc == RC_TIMEOUT) {
+      continue;
+    }
+    if (rc == RC_BAD_STATE) {
+      // The streaming has stopped.
+      break;
+    }
+    frame.read_time = std::chrono::steady_clock::now();
+    uint64_t elapsed_ns = GetNanoseconds(frame.read_time - start);
+    Add(counters.frames, 1);
+    Add(counters.busy_ns, elapsed_ns);
+    SetLastAndMax(counters.last_ns, counters.max_ns, elapsed_ns);
+    if (rc != RC_OK) {
+      Add(counters.errors, 1);
+      continue;
+    }
+    frame.rc = RC_OK;
+    if (!Forward(PipelineStage::kRead, frame)) {
+      break;
+    }
+  }
+  queues_[0]->Close();
+}
+
+void Pipeline::Run(PipelineStage stage, StageFunction function) {
+  PinThread(stage);
+  const size_t index = static_cast<size_t>(stage);
+  StageCounters& counters = counters_[index];
+  FrameQueue& input = *queues_[index - 1];
+  PipelineFrame frame;
+  while (true) {
+    RadarReturnCode rc = input.Pop(frame, kQueueTimeout);
+    if (rc == RC_BAD_STATE) {
+      break;
+    }
+    if (rc != RC_OK) {
+      continue;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (frame.rc == RC_OK) {
+      frame.rc = (this->*function)(frame);
+      if (frame.rc != RC_OK) {
+        Add(counters.errors, 1);
+      }
+    }
+    auto end = std::chrono::steady_clock::now();
+    uint64_t elapsed_ns = GetNanoseconds(end - start);
+    Add(counters.frames, 1);
+    Add(counters.busy_ns, elapsed_ns);
+    SetLastAndMax(counters.last_ns, counters.max_ns, elapsed_ns);
+    if (index == kNumPipelineStages - 1) {
+      SetLastAndMax(last_latency_ns_, max_latency_ns_,
+                    GetNanoseconds(end - frame.read_time));
+    }
+    if (!Forward(stage, frame)) {
+      break;
+    }
+  }
+  queues_[index]->Close();
+}
+
+bool Pipeline::Forward(PipelineStage stage, PipelineFrame& frame) {
+  const size_t index = static_cast<size_t>(stage);
+  auto start = std::chrono::steady_clock::now();
+  RadarReturnCode rc = queues_[index]->Push(frame, kQueueTimeout);
+  while (rc == RC_TIMEOUT && !stopping_.load(std::memory_order_relaxed)) {
+    rc = queues_[index]->Push(frame, kQueueTimeout);
+  }
+  Add(counters_[index].blocked_ns,
+      GetNanoseconds(std::chrono::steady_clock::now() - start));
+  // A frame dropped by the drop policy is not an error of the stage.
+  return rc == RC_OK || rc == RC_RES_LIMIT;
+}
+
+void Pipeline::PinThread(PipelineStage stage) {
+#ifdef __linux__
+  if (config_.first_cpu < 0) {
+    return;
+  }
+  unsigned num_cpus = std::max(1u, std::thread::hardware_concurrency());
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET((config_.first_cpu + static_cast<unsigned>(stage)) % num_cpus,
+          &cpus);
+  // Pinning is a hint, the stage runs anywhere if it fails.
+  pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+#else
+  (void) stage;
+#endif
+}
+
+RadarReturnCode Pipeline::Unpack(PipelineFrame& frame) {
+  const RadarBurstFormat& format = frame.format;
+  if (format.radar_type != RTYPE_FMCW) {
+    return RC_UNSUPPORTED;
+  }
+  SampleLayout layout;
+  RadarReturnCode rc = GetCubeShape(format, frame.chirp_shape);
+  if (rc == RC_OK) {
+    rc = GetSampleLayout(format, layout);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  const size_t num_samples = frame.chirp_shape.Size();
+  if (num_samples == 0 ||
+      GetBurstBytes(format, num_samples) != frame.data.size()) {
+    return RC_BAD_INPUT;
+  }
+  frame.is_complex = layout.components == 2;
+
+  // Packed bursts may unpack into an extra sample from their padding.
+  const size_t num_unpacked =
+      GetNumSamples(format, frame.data.size()) * layout.components;
+  const bool is_transposed =
+      GetBurstLayout(format) != CubeLayout::kChannelChirpSample;
+  std::vector<float>& unpacked = is_transposed ? samples_ : frame.chirps;
+  unpacked.resize(num_unpacked);
+  rc = UnpackSamples(format, frame.data.data(), frame.data.size(),
+                     unpacked.data());
+  if (rc != RC_OK) {
+    return rc;
+  }
+  frame.chirps.resize(num_samples * layout.components);
+  if (!is_transposed) {
+    return RC_OK;
+  }
+  if (frame.is_complex) {
+    return TransposeToCube(
+        format, reinterpret_cast<const std::complex<float>*>(samples_.data()),
+        num_samples,
+        reinterpret_cast<std::complex<float>*>(frame.chirps.data()),
+        CubeLayout::kChannelChirpSample);
+  }
+  return TransposeToCube(format, samples_.data(), num_samples,
+                         frame.chirps.data(),
+                         CubeLayout::kChannelChirpSample);
+}
+
+RadarReturnCode Pipeline::TransformRange(PipelineFrame& frame) {
+  const CubeShape& chirp_shape = frame.chirp_shape;
+  frame.range_shape = chirp_shape;
+  frame.range_shape.num_samples = static_cast<uint32_t>(
+      RangeFft::GetNumRangeBins(chirp_shape.num_samples, frame.is_complex));
+  frame.range_cube.resize(frame.range_shape.Size());
+  const size_t row_size = chirp_shape.num_samples * (frame.is_complex ? 2 : 1);
+  const size_t num_rows =
+      static_cast<size_t>(chirp_shape.num_channels) * chirp_shape.num_chirps;
+  std::atomic<int> result(RC_OK);
+  // The chirps of all the channels are independent rows.
+  auto transform = [&](size_t begin, size_t end) {
+    RangeFft& range_fft = range_ffts_[pool_ ? pool_->GetThreadIndex() : 0];
+    CubeShape shape = {1, static_cast<uint32_t>(end - begin),
+                       chirp_shape.num_samples};
+    const float* chirps = frame.chirps.data() + begin * row_size;
+    std::complex<float>* range_bins =
+        frame.range_cube.data() + begin * frame.range_shape.num_samples;
+    RadarReturnCode rc =
+        frame.is_complex
+            ? range_fft.Process(
+                  shape, reinterpret_cast<const std::complex<float>*>(chirps),
+                  range_bins)
+            : range_fft.Process(shape, chirps, range_bins);
+    if (rc != RC_OK) {
+      result.store(rc);
+    }
+  };
+  if (pool_) {
+    pool_->ParallelFor(0, num_rows, 0, transform);
+  } else {
+    transform(0, num_rows);
+  }
+  RadarReturnCode rc = static_cast<RadarReturnCode>(result.load());
+  if (rc != RC_OK || !config_.remove_clutter) {
+    return rc;
+  }
+  return clutter_filter_.Process(frame.format.config_id, frame.range_shape,
+                                 frame.range_cube.data());
+}
+
+RadarReturnCode Pipeline::TransformDoppler(PipelineFrame& frame) {
+  range_dopplers_[0].GetMapShape(frame.range_shape, frame.map_shape);
+  frame.map.resize(frame.map_shape.Size());
+  if (!pool_) {
+    return range_dopplers_[0].Process(frame.range_shape,
+                                      frame.range_cube.data(),
+                                      frame.map.data());
+  }
+  const size_t num_bins = frame.range_shape.num_samples;
+  const size_t num_tasks = (num_bins + kDopplerTaskBins - 1) / kDopplerTaskBins;
+  std::atomic<int> result(RC_OK);
+  pool_->ParallelFor(0, num_tasks, 0, [&](size_t begin, size_t end) {
+    size_t first_bin = begin * kDopplerTaskBins;
+    RadarReturnCode rc = range_dopplers_[pool_->GetThreadIndex()].Process(
+        frame.range_shape, frame.range_cube.data(), frame.map.data(),
+        first_bin, std::min(end * kDopplerTaskBins, num_bins) - first_bin);
+    if (rc != RC_OK) {
+      result.store(rc);
+    }
+  });
+  return static_cast<RadarReturnCode>(result.load());
+}
+
+RadarReturnCode Pipeline::Detect(PipelineFrame& frame) {
+  return detector_.Detect(frame.map.data(), frame.map_shape,
+                          frame.detections);
+}
+
+}  // namespace radar_dsp
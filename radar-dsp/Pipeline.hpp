@@ -0,0 +1,258 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief A multi-threaded burst processing pipeline.
+ *
+ * @details Bursts read from a radar go through the unpack, range FFT,
+ *          Doppler and detection stages, each on its own thread. Stages are
+ *          connected by bounded lock-free queues of frames. A frame owns
+ *          the buffers of every stage and is swapped through the queues, so
+ *          frames are recycled from the application back to the reader and
+ *          nothing is allocated once the buffers have grown to the burst
+ *          size. The range stage optionally removes the static clutter of
+ *          the range cubes with a ClutterFilter.
+ *
+ *          With num_workers set, the range and Doppler stages split every
+ *          burst across the workers of a ThreadPool, chirps for the range
+ *          FFT and range bins for the Doppler FFT, trading cores for
+ *          the latency of bursts too large for one core.
+ *
+ *          All the queues between the stages block when full. When
+ *          the application or a stage falls behind, the queues fill up
+ *          towards the reader, which then stops calling ReadBurst until
+ *          there is space, and the bursts pile up in the driver instead.
+ *          With a drop policy other than kBlock the reader drops bursts
+ *          itself and keeps the driver drained.
+ *
+ *          Every stage counts its frames, its processing time and the time
+ *          it has been blocked by the next stage, along with the occupancy of
+ *          the queue it feeds.
+ *
+ *          A frame that fails in a stage skips the next ones and is
+ *          delivered with the error.
+ *
+ * Example:
+ * ```
+ *   radar_dsp::Pipeline pipeline(config);
+ *   RadarReturnCode rc = pipeline.Start(radar);
+ *   radar_dsp::PipelineFrame frame;
+ *   while (pipeline.Pop(frame, {1, 0}) == RC_OK) {
+ *     // Use frame.detections, frame.map...
+ *   }
+ *   pipeline.Stop();
+ * ```
+ *
+ * @note Start, Stop and Pop must be called from the same thread.
+ */
+#ifndef RIPPLE_RADAR_DSP_PIPELINE_HPP_
+#define RIPPLE_RADAR_DSP_PIPELINE_HPP_
+
+#include <IRadarSensor.hpp>
+#include <RadarCommon.h>
+
+#include <Cfar.hpp>
+#include <ClutterFilter.hpp>
+#include <RadarCube.hpp>
+#include <RangeDoppler.hpp>
+#include <RangeFft.hpp>
+#include <SpscQueue.hpp>
+#include <ThreadPool.hpp>
+#include <Window.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace radar_dsp {
+
+enum class PipelineStage {
+  //! Reads bursts from the radar.
+  kRead,
+  //! Unpacks the samples into a chirp cube.
+  kUnpack,
+  //! Transforms the chirps into range bins.
+  kRange,
+  //! Computes the range-Doppler map.
+  kDoppler,
+  //! Detects the cells of the map.
+  kDetect,
+};
+
+//! Number of stages of a pipeline.
+constexpr size_t kNumPipelineStages = 5;
+
+//! Get the name of a stage.
+const char* GetPipelineStageName(PipelineStage stage);
+
+struct PipelineConfig {
+  //! Frames queued after every stage.
+  uint32_t queue_depth = 4;
+  //! What the reader does when the first stage is full.
+  radar_utils::DropPolicy policy = radar_utils::DropPolicy::kBlock;
+  //! Timeout of every ReadBurst, bounds the time Stop waits for the reader.
+  timespec read_timeout = {0, 100000000};  // 100 ms.
+  WindowType range_window = WindowType::kHann;
+  WindowType doppler_window = WindowType::kHann;
+  //! Whether the channels are integrated into a single map.
+  bool integrate_channels = true;
+  DopplerMapScale scale = DopplerMapScale::kPower;
+  //! Whether the static clutter is removed from the range cubes.
+  bool remove_clutter = false;
+  ClutterConfig clutter;
+  CfarConfig cfar;
+  //! Workers splitting the bursts of the range and Doppler stages, 0 to
+  //! process every burst on the thread of its stage.
+  uint32_t num_workers = 0;
+  //! Pin the stages, then the workers, to consecutive CPUs from this one, -1
+  //! not to pin them. Only supported on Linux.
+  int first_cpu = -1;
+};
+
+//! A burst and the output of every stage.
+struct PipelineFrame {
+  //! RC_OK or the error of the stage the frame failed in.
+  RadarReturnCode rc = RC_OK;
+  RadarBurstFormat format;
+  std::vector<uint8_t> data;
+  //! Unpacked chirps laid out as CubeLayout::kChannelChirpSample, with
+  //! interleaved real and imaginary parts for complex samples.
+  CubeShape chirp_shape;
+  bool is_complex = false;
+  std::vector<float> chirps;
+  CubeShape range_shape;
+  std::vector<std::complex<float>> range_cube;
+  CubeShape map_shape;
+  std::vector<float> map;
+  CfarDetections detections;
+  //! When ReadBurst returned the burst.
+  std::chrono::steady_clock::time_point read_time;
+};
+
+//! Counters of a stage.
+struct PipelineStageStats {
+  //! Frames processed, including the failed ones.
+  uint64_t frames;
+  //! Frames that failed in the stage.
+  uint64_t errors;
+  //! Total processing time, the time spent in ReadBurst for the reader.
+  uint64_t busy_ns;
+  //! Processing time of the last frame and the longest one.
+  uint64_t last_ns;
+  uint64_t max_ns;
+  //! Time spent waiting for space in the queue the stage feeds.
+  uint64_t blocked_ns;
+  //! Counters of the queue the stage feeds.
+  radar_utils::QueueStats queue;
+};
+
+//! Pipeline counters.
+struct PipelineStats {
+  PipelineStageStats stages[kNumPipelineStages];
+  //! Latency from ReadBurst to the frame being queued for the application,
+  //! of the last frame and the longest one.
+  uint64_t last_latency_ns;
+  uint64_t max_latency_ns;
+};
+
+class Pipeline {
+ public:
+  explicit Pipeline(const PipelineConfig& config = PipelineConfig());
+  ~Pipeline();
+
+  Pipeline(const Pipeline&) = delete;
+  Pipeline& operator=(const Pipeline&) = delete;
+
+  /**
+   * @brief Start reading and processing the bursts of a radar.
+   *
+   * @details The radar is expected to be streaming. Reading ends when Stop is
+   *          called or ReadBurst returns RC_BAD_STATE, the frames already
+   *          read are processed and delivered.
+   *
+   * @param radar the radar to read from. Must outlive the pipeline or until
+   *        Stop returns.
+   *
+   * @return RC_OK, RC_BAD_INPUT for a null radar, RC_BAD_STATE if already
+   *         started.
+   */
+  RadarReturnCode Start(radar_api::IRadarSensor* radar);
+
+  /**
+   * @brief Stop the threads. Frames still queued are dropped.
+   *
+   * @details Frames already delivered to the queue of the application can
+   *          still be popped.
+   */
+  void Stop();
+
+  /**
+   * @brief Pop the oldest processed frame.
+   *
+   * @details The frame is swapped out of the pipeline, its previous buffers
+   *          are recycled to the reader.
+   *
+   * @param frame where the frame will be swapped into.
+   * @param timeout the maximum time to wait for a frame.
+   *
+   * @return RC_OK, RC_TIMEOUT if no frame was processed in time,
+   *         RC_BAD_STATE if the pipeline is not running and has no frames
+   *         left.
+   */
+  RadarReturnCode Pop(PipelineFrame& frame, timespec timeout);
+
+  //! Get a snapshot of the counters, can be called from any thread.
+  PipelineStats GetStats() const;
+
+ private:
+  using FrameQueue = radar_utils::SpscQueue<PipelineFrame>;
+  using StageFunction = RadarReturnCode (Pipeline::*)(PipelineFrame& frame);
+
+  // Written by the thread of the stage only.
+  struct StageCounters {
+    std::atomic<uint64_t> frames{0};
+    std::atomic<uint64_t> errors{0};
+    std::atomic<uint64_t> busy_ns{0};
+    std::atomic<uint64_t> last_ns{0};
+    std::atomic<uint64_t> max_ns{0};
+    std::atomic<uint64_t> blocked_ns{0};
+    char padding[radar_utils::kCacheLineBytes];
+  };
+
+  void Read(radar_api::IRadarSensor* radar);
+  void Run(PipelineStage stage, StageFunction function);
+  bool Forward(PipelineStage stage, PipelineFrame& frame);
+  void PinThread(PipelineStage stage);
+
+  RadarReturnCode Unpack(PipelineFrame& frame);
+  RadarReturnCode TransformRange(PipelineFrame& frame);
+  RadarReturnCode TransformDoppler(PipelineFrame& frame);
+  RadarReturnCode Detect(PipelineFrame& frame);
+
+  const PipelineConfig config_;
+  //! The queue fed by every stage, the last one feeds the application.
+  std::unique_ptr<FrameQueue> queues_[kNumPipelineStages];
+  StageCounters counters_[kNumPipelineStages];
+  std::atomic<uint64_t> last_latency_ns_{0};
+  std::atomic<uint64_t> max_latency_ns_{0};
+  std::atomic<bool> stopping_{false};
+  std::vector<std::thread> threads_;
+
+  std::unique_ptr<radar_utils::ThreadPool> pool_;
+
+  // Stage state, each used by the thread of its stage only, or per thread
+  // index of the pool for the split stages.
+  std::vector<float> samples_;
+  std::vector<RangeFft> range_ffts_;
+  ClutterFilter clutter_filter_;
+  std::vector<RangeDoppler> range_dopplers_;
+  CfarDetector detector_;
+};
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_PIPELINE_HPP_
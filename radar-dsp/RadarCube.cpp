@@ -0,0 +1,196 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <RadarCube.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace radar_dsp {
+
+namespace {
+
+// Number of elements in a tile, sized so the touched lines of the input and
+// the output fit into L1 together.
+const size_t kTileElements = 1024;
+// Smallest tile side, so a tile covers whole cache lines.
+const size_t kMinTileSide = 16;
+
+enum Dim {
+  kChannel = 0,
+  kChirp = 1,
+  kSample = 2,
+};
+
+// Get the dimensions of a layout from the slowest to the fastest varying.
+void GetOrder(CubeLayout layout, int order[3]) {
+  order[0] = kChannel, order[1] = kChirp, order[2] = kSample;
+  switch (layout) {
+    case CubeLayout::kChannelChirpSample:
+      break;
+    case CubeLayout::kChannelSampleChirp:
+      order[1] = kSample, order[2] = kChirp;
+      break;
+    case CubeLayout::kChirpChannelSample:
+      order[0] = kChirp, order[1] = kChannel;
+      break;
+    case CubeLayout::kChirpSampleChannel:
+      order[0] = kChirp, order[1] = kSample, order[2] = kChannel;
+      break;
+  }
+}
+
+// Get the element strides of every dimension of a layout.
+void GetStrides(const size_t dims[3], const int order[3], size_t strides[3]) {
+  strides[order[2]] = 1;
+  strides[order[1]] = dims[order[2]];
+  strides[order[0]] = dims[order[2]] * dims[order[1]];
+}
+
+// Write output[j * output_stride + i] = input[i * input_stride + j] for
+// i < rows and j < cols, one tile at a time.
+template <typename T>
+void TransposeBlocked(const T* input, size_t input_stride, T* output,
+                      size_t output_stride, size_t rows, size_t cols) {
+  size_t tile_rows = std::min(rows, kMinTileSide);
+  size_t tile_cols = std::min(
+      cols, std::max(kMinTileSide, kTileElements / tile_rows));
+  if (tile_cols < kMinTileSide && rows > tile_rows) {
+    // Few columns, make the tile taller instead.
+    tile_rows = std::min(rows, kTileElements / tile_cols);
+  }
+
+  for (size_t row_start = 0; row_start < rows; row_start += tile_rows) {
+    size_t row_end = std::min(rows, row_start + tile_rows);
+    for (size_t col_start = 0; col_start < cols; col_start += tile_cols) {
+      size_t col_end = std::min(cols, col_start + tile_cols);
+      for (size_t i = row_start; i < row_end; ++i) {
+        const T* src = input + i * input_stride;
+        T* dst = output + i;
+        for (size_t j = col_start; j < col_end; ++j) {
+          dst[j * output_stride] = src[j];
+        }
+      }
+    }
+  }
+}
+
+template <typename T>
+void Permute(const CubeShape& shape, const T* input, CubeLayout input_layout,
+             T* output, CubeLayout output_layout) {
+  size_t dims[3] = {shape.num_channels, shape.num_chirps, shape.num_samples};
+  int input_order[3];
+  int output_order[3];
+  GetOrder(input_layout, input_order);
+  GetOrder(output_layout, output_order);
+  size_t input_strides[3];
+  size_t output_strides[3];
+  GetStrides(dims, input_order, input_strides);
+  GetStrides(dims, output_order, output_strides);
+
+  int input_fast = input_order[2];
+  int output_fast = output_order[2];
+  if (input_fast == output_fast) {
+    // Whole rows stay contiguous, copy them in the output order.
+    int outer = output_order[0];
+    int inner = output_order[1];
+    size_t row_bytes = dims[output_fast] * sizeof(T);
+    for (size_t a = 0; a < dims[outer]; ++a) {
+      for (size_t b = 0; b < dims[inner]; ++b) {
+        memcpy(output + a * output_strides[outer] + b * output_strides[inner],
+               input + a * input_strides[outer] + b * input_strides[inner],
+               row_bytes);
+      }
+    }
+    return;
+  }
+
+  int third = 3 - input_fast - output_fast;
+  for (size_t t = 0; t < dims[third]; ++t) {
+    TransposeBlocked(input + t * input_strides[third],
+                     input_strides[output_fast],
+                     output + t * output_strides[third],
+                     output_strides[input_fast],
+                     dims[output_fast], dims[input_fast]);
+  }
+}
+
+template <typename T>
+RadarReturnCode TransposeSamples(const RadarBurstFormat& format,
+                                 const T* samples, size_t num_samples,
+                                 T* cube, CubeLayout layout) {
+  CubeShape shape;
+  RadarReturnCode rc = GetCubeShape(format, shape);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (num_samples != shape.Size() ||
+      (num_samples > 0 && (samples == nullptr || cube == nullptr))) {
+    return RC_BAD_INPUT;
+  }
+  Permute(shape, samples, GetBurstLayout(format), cube, layout);
+  return RC_OK;
+}
+
+}  // namespace
+
+RadarReturnCode GetCubeShape(const RadarBurstFormat& format,
+                             CubeShape& shape) {
+  shape.num_channels = format.num_channels;
+  switch (format.radar_type) {
+    case RTYPE_FMCW:
+      shape.num_chirps = format.custom.fmcw.chirps_per_burst;
+      shape.num_samples = format.custom.fmcw.samples_per_chirp;
+      return RC_OK;
+    case RTYPE_PULSED:
+      shape.num_chirps = format.custom.pusled.sweeps_per_burst;
+      shape.num_samples = format.custom.pusled.samples_per_sweep;
+      return RC_OK;
+    case RTYPE_UWB:
+      shape.num_chirps = format.custom.uwb.sweeps_per_burst;
+      shape.num_samples = format.custom.uwb.samples_per_sweep;
+      return RC_OK;
+  }
+  return RC_UNSUPPORTED;
+}
+
+CubeLayout GetBurstLayout(const RadarBurstFormat& format) {
+  return format.is_channels_interleaved ? CubeLayout::kChirpSampleChannel
+                                        : CubeLayout::kChannelChirpSample;
+}
+
+RadarReturnCode TransposeToCube(const RadarBurstFormat& format,
+                                const float* samples, size_t num_samples,
+                                float* cube, CubeLayout layout) {
+  return TransposeSamples(format, samples, num_samples, cube, layout);
+}
+
+RadarReturnCode TransposeToCube(const RadarBurstFormat& format,
+                                const std::complex<float>* samples,
+                                size_t num_samples,
+                                std::complex<float>* cube, CubeLayout layout) {
+  return TransposeSamples(format, samples, num_samples, cube, layout);
+}
+
+void TransposeCube(const CubeShape& shape, const float* input,
+                   CubeLayout input_layout, float* output,
+                   CubeLayout output_layout) {
+  Permute(shape, input, input_layout, output, output_layout);
+}
+
+void TransposeCube(const CubeShape& shape, const std::complex<float>* input,
+                   CubeLayout input_layout, std::complex<float>* output,
+                   CubeLayout output_layout) {
+  Permute(shape, input, input_layout, output, output_layout);
+}
+
+void TransposeMatrix(const float* input, size_t rows, size_t cols,
+                     float* output) {
+  TransposeBlocked(input, cols, output, rows, rows, cols);
+}
+
+void TransposeMatrix(const std::complex<float>* input, size_t rows,
+                     size_t cols, std::complex<float>* output) {
+  TransposeBlocked(input, cols, output, rows, rows, cols);
+}
+
+}  // namespace radar_dsp
@@ -0,0 +1,134 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Rearranging burst samples into a radar cube.
+ *
+ * @details A burst holds num_channels channels of chirps, or sweeps for
+ *          the pulsed and UWB radars, of samples. When is_channels_interleaved
+ *          is set the samples of all channels follow each other, so the burst
+ *          is laid out as chirp x sample x channel, otherwise as
+ *          channel x chirp x sample.
+ *
+ *          The cube is written in one cache-blocked pass, so neither the
+ *          reads nor the writes stride across more cache lines than fit
+ *          into L1.
+ *
+ * Example:
+ * ```
+ *   radar_dsp::UnpackSamples(format, raw_radar_data, samples);
+ *   radar_dsp::TransposeToCube(format, samples.data(), samples.size(),
+ *                              cube.data(),
+ *                              radar_dsp::CubeLayout::kChannelChirpSample);
+ * ```
+ */
+#ifndef RIPPLE_RADAR_DSP_RADARCUBE_HPP_
+#define RIPPLE_RADAR_DSP_RADARCUBE_HPP_
+
+#include <RadarCommon.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+namespace radar_dsp {
+
+//! Order of the cube dimensions, from the slowest to the fastest varying.
+enum class CubeLayout {
+  //! Chirps of every channel contiguous, for the range FFT.
+  kChannelChirpSample,
+  //! Samples of a range bin contiguous across chirps, for the Doppler FFT.
+  kChannelSampleChirp,
+  //! Channels of a chirp next to each other.
+  kChirpChannelSample,
+  //! Channels interleaved per sample, as sent by interleaving radars.
+  kChirpSampleChannel,
+};
+
+//! Dimensions of a radar cube.
+struct CubeShape {
+  uint32_t num_channels;
+  //! Chirps for FMCW radars, sweeps for pulsed and UWB radars.
+  uint32_t num_chirps;
+  //! Samples per chirp or sweep.
+  uint32_t num_samples;
+
+  //! Number of samples in the cube.
+  size_t Size() const {
+    return static_cast<size_t>(num_channels) * num_chirps * num_samples;
+  }
+};
+
+/**
+ * @brief Get the cube dimensions of a burst.
+ *
+ * @param format the burst format.
+ * @param shape where the dimensions will be written into.
+ *
+ * @return RC_OK or RC_UNSUPPORTED for an unknown radar type.
+ */
+RadarReturnCode GetCubeShape(const RadarBurstFormat& format,
+                             CubeShape& shape);
+
+/**
+ * @brief Get the layout the samples of a burst are sent in.
+ */
+CubeLayout GetBurstLayout(const RadarBurstFormat& format);
+
+/**
+ * @brief Rearrange unpacked burst samples into a cube.
+ *
+ * @param format the burst format the samples were unpacked from.
+ * @param samples the unpacked samples.
+ * @param num_samples the number of samples, must match the cube size.
+ * @param cube where the cube will be written into. Must not overlap samples.
+ * @param layout the layout of the cube.
+ *
+ * @return RC_OK, RC_BAD_INPUT if the sample count does not match the format,
+ *         RC_UNSUPPORTED for an unknown radar type.
+ */
+RadarReturnCode TransposeToCube(const RadarBurstFormat& format,
+                                const float* samples, size_t num_samples,
+                                float* cube, CubeLayout layout);
+
+//! Same as above for complex samples.
+RadarReturnCode TransposeToCube(const RadarBurstFormat& format,
+                                const std::complex<float>* samples,
+                                size_t num_samples,
+                                std::complex<float>* cube, CubeLayout layout);
+
+/**
+ * @brief Rearrange a cube into another layout.
+ *
+ * @param shape the cube dimensions.
+ * @param input the cube to rearrange.
+ * @param input_layout the layout of the input.
+ * @param output where the rearranged cube will be written into.
+ * @param output_layout the layout of the output.
+ */
+void TransposeCube(const CubeShape& shape, const float* input,
+                   CubeLayout input_layout, float* output,
+                   CubeLayout output_layout);
+
+//! Same as above for complex samples.
+void TransposeCube(const CubeShape& shape, const std::complex<float>* input,
+                   CubeLayout input_layout, std::complex<float>* output,
+                   CubeLayout output_layout);
+
+/**
+ * @brief Transpose a row-major matrix with cache blocking.
+ *
+ * @param input the matrix of rows x cols elements.
+ * @param rows the number of rows of the input.
+ * @param cols the number of columns of the input.
+ * @param output where the cols x rows transposed matrix will be written.
+ */
+void TransposeMatrix(const float* input, size_t rows, size_t cols,
+                     float* output);
+
+//! Same as above for complex samples.
+void TransposeMatrix(const std::complex<float>* input, size_t rows,
+                     size_t cols, std::complex<float>* output);
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_RADARCUBE_HPP_
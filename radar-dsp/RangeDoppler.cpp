@@ -0,0 +1,156 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <RangeDoppler.hpp>
+
+#include <Fft.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace radar_dsp {
+
+struct DopplerPlan {
+  DopplerPlan(size_t num_chirps, WindowType window_type)
+      : fft(NextPowerOfTwo(num_chirps)),
+        window(MakeWindow(window_type, num_chirps)) {}
+
+  FftPlan fft;
+  std::vector<float> window;
+};
+
+namespace {
+
+// Range bins transformed together, 8 complex floats are one cache line.
+const size_t kBlockBins = 8;
+
+// Write, or add, the cells of n Doppler bins.
+void StoreCells(const std::complex<float>* bins, size_t n,
+                DopplerMapScale scale, bool accumulate, float* cells) {
+  const float* points = reinterpret_cast<const float*>(bins);
+  for (size_t i = 0; i < n; ++i) {
+    float re = points[2 * i];
+    float im = points[2 * i + 1];
+    float value = re * re + im * im;
+    if (scale == DopplerMapScale::kMagnitude) {
+      value = std::sqrt(value);
+    }
+    cells[i] = accumulate ? cells[i] + value : value;
+  }
+}
+
+}  // namespace
+
+RangeDoppler::RangeDoppler(WindowType range_window, WindowType doppler_window,
+                           bool integrate_channels, DopplerMapScale scale)
+    : range_fft_(range_window),
+      doppler_window_(doppler_window),
+      integrate_channels_(integrate_channels),
+      scale_(scale),
+      range_shape_() {}
+
+RangeDoppler::~RangeDoppler() {}
+
+size_t RangeDoppler::GetNumDopplerBins(size_t num_chirps) {
+  return NextPowerOfTwo(num_chirps);
+}
+
+void RangeDoppler::GetMapShape(const CubeShape& range_shape,
+                               CubeShape& shape) const {
+  shape.num_channels = integrate_channels_ ? 1 : range_shape.num_channels;
+  shape.num_chirps =
+      static_cast<uint32_t>(GetNumDopplerBins(range_shape.num_chirps));
+  shape.num_samples = range_shape.num_samples;
+}
+
+const DopplerPlan& RangeDoppler::GetPlan(size_t num_chirps) {
+  for (const auto& plan : plans_) {
+    if (plan.first == num_chirps) {
+      return *plan.second;
+    }
+  }
+  plans_.emplace_back(num_chirps, std::make_shared<DopplerPlan>(
+                                      num_chirps, doppler_window_));
+  return *plans_.back().second;
+}
+
+RadarReturnCode RangeDoppler::Process(const CubeShape& range_shape,
+                                      const std::complex<float>* range_cube,
+                                      float* map) {
+  return Process(range_shape, range_cube, map, 0, range_shape.num_samples);
+}
+
+RadarReturnCode RangeDoppler::Process(const CubeShape& range_shape,
+                                      const std::complex<float>* range_cube,
+                                      float* map, size_t first_bin,
+                                      size_t num_bins) {
+  if (range_shape.Size() == 0 || range_cube == nullptr || map == nullptr ||
+      num_bins == 0 || first_bin >= range_shape.num_samples ||
+      num_bins > range_shape.num_samples - first_bin) {
+    return RC_BAD_INPUT;
+  }
+  const DopplerPlan& plan = GetPlan(range_shape.num_chirps);
+  const size_t num_chirps = range_shape.num_chirps;
+  const size_t num_range_bins = range_shape.num_samples;
+  const size_t num_doppler_bins = plan.fft.Size();
+  const size_t half = num_doppler_bins / 2;
+  const uint32_t* bit_reverse = plan.fft.BitReverse().data();
+  const float* window = plan.window.data();
+  const size_t channel_size = num_chirps * num_range_bins;
+  scratch_.resize(kBlockBins * num_doppler_bins);
+
+  for (size_t channel = 0; channel < range_shape.num_channels; ++channel) {
+    const std::complex<float>* chirps = range_cube + channel * channel_size;
+    bool accumulate = integrate_channels_ && channel > 0;
+    float* channel_map =
+        map + (integrate_channels_ ? 0 : channel) * num_range_bins *
+                  num_doppler_bins;
+
+    const size_t end_bin = first_bin + num_bins;
+    for (size_t first = first_bin; first < end_bin; first += kBlockBins) {
+      size_t block_bins = std::min(kBlockBins, end_bin - first);
+      // Transpose a block of range bins into the slow time rows, windowed
+      // and in bit reversed order. Each chirp contributes one cache line.
+      for (size_t c = 0; c < num_chirps; ++c) {
+        const std::complex<float>* input = chirps + c * num_range_bins + first;
+        std::complex<float>* output = &scratch_[bit_reverse[c]];
+        for (size_t b = 0; b < block_bins; ++b) {
+          output[b * num_doppler_bins] = input[b] * window[c];
+        }
+      }
+
+      for (size_t b = 0; b < block_bins; ++b) {
+        std::complex<float>* z = &scratch_[b * num_doppler_bins];
+        for (size_t i = num_chirps; i < num_doppler_bins; ++i) {
+          z[bit_reverse[i]] = 0.0f;
+        }
+        plan.fft.TransformBitReversed(z);
+        // Negative velocities first, zero velocity at the middle.
+        float* cells = channel_map + (first + b) * num_doppler_bins;
+        StoreCells(z + half, num_doppler_bins - half, scale_, accumulate,
+                   cells);
+        StoreCells(z, half, scale_, accumulate,
+                   cells + num_doppler_bins - half);
+      }
+    }
+  }
+  return RC_OK;
+}
+
+RadarReturnCode RangeDoppler::Process(const RadarBurstFormat& format,
+                                      const uint8_t* data, size_t size_bytes,
+                                      std::vector<float>& map,
+                                      CubeShape& shape) {
+  if (format.radar_type != RTYPE_FMCW) {
+    return RC_UNSUPPORTED;
+  }
+  RadarReturnCode rc = range_fft_.Process(format, data, size_bytes,
+                                          range_cube_, range_shape_);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  GetMapShape(range_shape_, shape);
+  map.resize(shape.Size());
+  return Process(range_shape_, range_cube_.data(), map.data());
+}
+
+}  // namespace radar_dsp
@@ -0,0 +1,165 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Range-Doppler maps of FMCW bursts.
+ *
+ * @details After the range FFT, every range bin of a channel is transformed
+ *          across the chirps_per_burst chirps of the burst. Blocks of eight
+ *          range bins, one cache line per chirp, are transposed into slow
+ *          time rows that stay in L1, windowed and bit reversed on the way,
+ *          so the Doppler FFT never strides across the chirps.
+ *
+ *          Chirps are zero padded to the next power of two. The map is laid
+ *          out as CubeLayout::kChannelSampleChirp, range bins by Doppler bins,
+ *          with zero velocity at the middle Doppler bin, so rows can be
+ *          handed to the detectors as they are.
+ *
+ *          The channels can be integrated non-coherently into a single map
+ *          by summing their magnitudes, or powers.
+ *
+ *          An instance holds scratch buffers and must be used by one thread
+ *          at a time.
+ *
+ * Example:
+ * ```
+ *   radar_dsp::RangeDoppler range_doppler;
+ *   radar_dsp::CubeShape shape;
+ *   std::vector<float> map;
+ *   RadarReturnCode rc = range_doppler.Process(format, raw_radar_data.data(),
+ *                                              raw_radar_data.size(), map,
+ *                                              shape);
+ *   // map[range_bin * shape.num_chirps + doppler_bin]
+ * ```
+ */
+#ifndef RIPPLE_RADAR_DSP_RANGEDOPPLER_HPP_
+#define RIPPLE_RADAR_DSP_RANGEDOPPLER_HPP_
+
+#include <RadarCommon.h>
+
+#include <RadarCube.hpp>
+#include <RangeFft.hpp>
+#include <Window.hpp>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace radar_dsp {
+
+//! Values of the range-Doppler map cells.
+enum class DopplerMapScale {
+  //! |X|, linear amplitude.
+  kMagnitude,
+  //! |X|^2, for square law detectors.
+  kPower,
+};
+
+//! Tables of one chirp count, defined in RangeDoppler.cpp.
+struct DopplerPlan;
+
+class RangeDoppler {
+ public:
+  /**
+   * @param range_window the window applied to the samples of a chirp.
+   * @param doppler_window the window applied across the chirps.
+   * @param integrate_channels whether all channels are summed into a single
+   *        map, otherwise one map per channel is produced.
+   * @param scale the values of the map cells.
+   */
+  explicit RangeDoppler(WindowType range_window = WindowType::kHann,
+                        WindowType doppler_window = WindowType::kHann,
+                        bool integrate_channels = true,
+                        DopplerMapScale scale = DopplerMapScale::kMagnitude);
+  ~RangeDoppler();
+
+  /**
+   * @brief Get the number of Doppler bins of a burst.
+   *
+   * @param num_chirps the number of chirps per burst.
+   */
+  static size_t GetNumDopplerBins(size_t num_chirps);
+
+  /**
+   * @brief Get the dimensions of the map of a range cube.
+   *
+   * @param range_shape the dimensions of the range cube.
+   * @param shape where the dimensions of the map will be written into,
+   *        num_samples being the range bins and num_chirps the Doppler bins.
+   */
+  void GetMapShape(const CubeShape& range_shape, CubeShape& shape) const;
+
+  /**
+   * @brief Transform a range cube into a range-Doppler map.
+   *
+   * @param range_shape the dimensions of the range cube.
+   * @param range_cube the range bins laid out as
+   *        CubeLayout::kChannelChirpSample, as written by RangeFft.
+   * @param map where the map will be written into, see GetMapShape for its
+   *        dimensions.
+   *
+   * @return RC_OK or RC_BAD_INPUT for an empty shape or null buffers.
+   */
+  RadarReturnCode Process(const CubeShape& range_shape,
+                          const std::complex<float>* range_cube, float* map);
+
+  /**
+   * @brief Transform some range bins of a range cube, to split a burst
+   *        across threads with an instance per thread.
+   *
+   * @details Only the cells of range bins first_bin to
+   *          first_bin + num_bins - 1 of the map are written.
+   *
+   * @return RC_OK or RC_BAD_INPUT for an empty shape, null buffers or range
+   *         bins outside the cube.
+   */
+  RadarReturnCode Process(const CubeShape& range_shape,
+                          const std::complex<float>* range_cube, float* map,
+                          size_t first_bin, size_t num_bins);
+
+  /**
+   * @brief Unpack a burst and compute its range-Doppler map.
+   *
+   * @param format the burst format.
+   * @param data the burst data.
+   * @param size_bytes the size of the burst data.
+   * @param map where the map will be written into.
+   * @param shape where the dimensions of the map will be written into.
+   *
+   * @return RC_OK, RC_UNSUPPORTED for formats that can not be unpacked,
+   *         RC_BAD_INPUT if the size does not match the format.
+   */
+  RadarReturnCode Process(const RadarBurstFormat& format, const uint8_t* data,
+                          size_t size_bytes, std::vector<float>& map,
+                          CubeShape& shape);
+
+  //! Get the range cube of the last burst processed from its format.
+  const std::vector<std::complex<float>>& GetRangeCube() const {
+    return range_cube_;
+  }
+
+  //! Get the dimensions of the range cube of the last burst processed from
+  //! its format.
+  const CubeShape& GetRangeShape() const {
+    return range_shape_;
+  }
+
+ private:
+  const DopplerPlan& GetPlan(size_t num_chirps);
+
+  RangeFft range_fft_;
+  WindowType doppler_window_;
+  bool integrate_channels_;
+  DopplerMapScale scale_;
+  //! Plans used by this instance, few enough for a linear search.
+  std::vector<std::pair<size_t, std::shared_ptr<const DopplerPlan>>> plans_;
+  CubeShape range_shape_;
+  std::vector<std::complex<float>> range_cube_;
+  std::vector<std::complex<float>> scratch_;
+};
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_RANGEDOPPLER_HPP_
@@ -0,0 +1,225 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <RangeFft.hpp>
+
+#include <Fft.hpp>
+#include <SamplePacking.hpp>
+#include <SampleUnpack.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+
+namespace radar_dsp {
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+
+// Get the number of points of the complex FFT of a chirp.
+size_t GetFftSize(size_t num_samples, bool is_complex) {
+  size_t size = NextPowerOfTwo(num_samples);
+  return is_complex ? size : std::max<size_t>(size, 2) / 2;
+}
+
+}  // namespace
+
+struct RangePlan {
+  RangePlan(size_t num_samples, bool is_complex, WindowType window_type)
+      : fft(GetFftSize(num_samples, is_complex)),
+        window(MakeWindow(window_type, num_samples)) {
+    if (!is_complex) {
+      // W^k = exp(-2 pi i k / n) of the real FFT of n = 2 * fft.Size().
+      size_t half = fft.Size();
+      twiddles.resize(half / 2 + 1);
+      for (size_t k = 0; k < twiddles.size(); ++k) {
+        double angle = -kPi * k / half;
+        twiddles[k] = std::complex<float>(
+            static_cast<float>(std::cos(angle)),
+            static_cast<float>(std::sin(angle)));
+      }
+    }
+  }
+
+  FftPlan fft;
+  std::vector<float> window;
+  //! Twiddles splitting the spectrum of real chirps.
+  std::vector<std::complex<float>> twiddles;
+};
+
+namespace {
+
+// Plans shared by all the instances. They are never freed, there are only
+// as many as there are chirp sizes in use.
+std::shared_ptr<const RangePlan> GetSharedPlan(uint64_t key,
+                                               size_t num_samples,
+                                               bool is_complex,
+                                               WindowType window) {
+  static std::mutex mutex;
+  static std::map<uint64_t, std::shared_ptr<const RangePlan>> plans;
+  std::lock_guard<std::mutex> lock(mutex);
+  std::shared_ptr<const RangePlan>& plan = plans[key];
+  if (!plan) {
+    plan = std::make_shared<RangePlan>(num_samples, is_complex, window);
+  }
+  return plan;
+}
+
+}  // namespace
+
+RangeFft::RangeFft(WindowType window) : window_(window) {}
+
+RangeFft::~RangeFft() {}
+
+size_t RangeFft::GetNumRangeBins(size_t num_samples, bool is_complex) {
+  return GetFftSize(num_samples, is_complex);
+}
+
+const RangePlan& RangeFft::GetPlan(size_t num_samples, bool is_complex) {
+  uint64_t key = static_cast<uint64_t>(num_samples) |
+                 (static_cast<uint64_t>(is_complex) << 32) |
+                 (static_cast<uint64_t>(window_) << 33);
+  for (const auto& plan : plans_) {
+    if (plan.first == key) {
+      return *plan.second;
+    }
+  }
+  plans_.emplace_back(key, GetSharedPlan(key, num_samples, is_complex,
+                                         window_));
+  return *plans_.back().second;
+}
+
+RadarReturnCode RangeFft::Process(const CubeShape& shape,
+                                  const std::complex<float>* chirps,
+                                  std::complex<float>* range_bins) {
+  if (shape.Size() == 0 || chirps == nullptr || range_bins == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  const RangePlan& plan = GetPlan(shape.num_samples, true);
+  const size_t num_samples = shape.num_samples;
+  const size_t num_bins = plan.fft.Size();
+  const uint32_t* bit_reverse = plan.fft.BitReverse().data();
+  const float* window = plan.window.data();
+  const size_t num_chirps =
+      static_cast<size_t>(shape.num_channels) * shape.num_chirps;
+
+  for (size_t chirp = 0; chirp < num_chirps; ++chirp) {
+    const std::complex<float>* input = chirps + chirp * num_samples;
+    std::complex<float>* output = range_bins + chirp * num_bins;
+    // Window the samples into the bit reversed order, zero padded.
+    for (size_t i = 0; i < num_samples; ++i) {
+      output[bit_reverse[i]] = input[i] * window[i];
+    }
+    for (size_t i = num_samples; i < num_bins; ++i) {
+      output[bit_reverse[i]] = 0.0f;
+    }
+    plan.fft.TransformBitReversed(output);
+  }
+  return RC_OK;
+}
+
+RadarReturnCode RangeFft::Process(const CubeShape& shape, const float* chirps,
+                                  std::complex<float>* range_bins) {
+  if (shape.Size() == 0 || chirps == nullptr || range_bins == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  const RangePlan& plan = GetPlan(shape.num_samples, false);
+  const size_t num_samples = shape.num_samples;
+  const size_t num_bins = plan.fft.Size();
+  const uint32_t* bit_reverse = plan.fft.BitReverse().data();
+  const float* window = plan.window.data();
+  const std::complex<float>* twiddles = plan.twiddles.data();
+  const size_t num_chirps =
+      static_cast<size_t>(shape.num_channels) * shape.num_chirps;
+  scratch_.resize(num_bins);
+  std::complex<float>* z = scratch_.data();
+
+  for (size_t chirp = 0; chirp < num_chirps; ++chirp) {
+    // Even samples go into the real parts and odd ones into the imaginary
+    // parts of a half size complex FFT.
+    const float* input = chirps + chirp * num_samples;
+    for (size_t m = 0; m < num_bins; ++m) {
+      size_t even = 2 * m;
+      float re = even < num_samples ? input[even] * window[even] : 0.0f;
+      float im = even + 1 < num_samples ? input[even + 1] * window[even + 1]
+                                        : 0.0f;
+      z[bit_reverse[m]] = std::complex<float>(re, im);
+    }
+    plan.fft.TransformBitReversed(z);
+
+    // Split the spectra of the even and odd samples, E and O, and combine
+    // them into X[k] = E[k] + W^k O[k] and X[n - k] = conj(E[k] - W^k O[k]).
+    std::complex<float>* output = range_bins + chirp * num_bins;
+    output[0] = std::complex<float>(z[0].real() + z[0].imag(), 0.0f);
+    for (size_t k = 1; k <= num_bins / 2; ++k) {
+      std::complex<float> a = z[k];
+      std::complex<float> b = std::conj(z[num_bins - k]);
+      std::complex<float> even = 0.5f * (a + b);
+      std::complex<float> diff = 0.5f * (a - b);
+      // W^k O[k] with O[k] = (a - b) / 2i, spelled out so it does not go
+      // through the NaN checks of the complex multiplication.
+      float wr = twiddles[k].real(), wi = twiddles[k].imag();
+      std::complex<float> rotated(wr * diff.imag() + wi * diff.real(),
+                                  wi * diff.imag() - wr * diff.real());
+      output[num_bins - k] = std::conj(even - rotated);
+      output[k] = even + rotated;
+    }
+  }
+  return RC_OK;
+}
+
+RadarReturnCode RangeFft::Process(const RadarBurstFormat& format,
+                                  const uint8_t* data, size_t size_bytes,
+                                  std::vector<std::complex<float>>& range_cube,
+                                  CubeShape& shape) {
+  CubeShape input_shape;
+  SampleLayout layout;
+  RadarReturnCode rc = GetCubeShape(format, input_shape);
+  if (rc == RC_OK) {
+    rc = GetSampleLayout(format, layout);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (input_shape.Size() == 0 ||
+      GetBurstBytes(format, input_shape.Size()) != size_bytes) {
+    return RC_BAD_INPUT;
+  }
+  bool is_complex = layout.components == 2;
+
+  // Packed bursts may unpack into an extra sample from their padding.
+  samples_.resize(GetNumSamples(format, size_bytes) * layout.components);
+  rc = UnpackSamples(format, data, size_bytes, samples_.data());
+  if (rc != RC_OK) {
+    return rc;
+  }
+  const float* chirps = samples_.data();
+  if (GetBurstLayout(format) != CubeLayout::kChannelChirpSample) {
+    cube_.resize(input_shape.Size() * layout.components);
+    if (is_complex) {
+      TransposeToCube(
+          format, reinterpret_cast<const std::complex<float>*>(chirps),
+          input_shape.Size(), reinterpret_cast<std::complex<float>*>(
+              cube_.data()), CubeLayout::kChannelChirpSample);
+    } else {
+      TransposeToCube(format, chirps, input_shape.Size(), cube_.data(),
+                      CubeLayout::kChannelChirpSample);
+    }
+    chirps = cube_.data();
+  }
+
+  shape = input_shape;
+  shape.num_samples =
+      static_cast<uint32_t>(GetNumRangeBins(input_shape.num_samples,
+                                            is_complex));
+  range_cube.resize(shape.Size());
+  if (is_complex) {
+    return Process(input_shape,
+                   reinterpret_cast<const std::complex<float>*>(chirps),
+                   range_cube.data());
+  }
+  return Process(input_shape, chirps, range_cube.data());
+}
+
+}  // namespace radar_dsp
@@ -0,0 +1,113 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Range processing of FMCW bursts.
+ *
+ * @details Windows every chirp of a burst and transforms it into range bins
+ *          with one batched FFT pass. Chirps are zero padded to the next
+ *          power of two. Real chirps of N points are transformed with
+ *          a complex FFT of N / 2 points and give N / 2 range bins, complex
+ *          chirps give N range bins.
+ *
+ *          Windows, bit reversal tables and twiddles are planned once per
+ *          samples_per_chirp and shared by all the instances. Every instance
+ *          also keeps the plans it used, so switching between config slots
+ *          takes neither a replan nor a lock.
+ *
+ *          An instance holds scratch buffers and must be used by one thread
+ *          at a time.
+ *
+ * Example:
+ * ```
+ *   radar_dsp::RangeFft range_fft(radar_dsp::WindowType::kHann);
+ *   radar_dsp::CubeShape shape;
+ *   std::vector<std::complex<float>> range_cube;
+ *   RadarReturnCode rc = range_fft.Process(format, raw_radar_data.data(),
+ *                                          raw_radar_data.size(),
+ *                                          range_cube, shape);
+ * ```
+ */
+#ifndef RIPPLE_RADAR_DSP_RANGEFFT_HPP_
+#define RIPPLE_RADAR_DSP_RANGEFFT_HPP_
+
+#include <RadarCommon.h>
+
+#include <RadarCube.hpp>
+#include <Window.hpp>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace radar_dsp {
+
+//! Tables of one chirp size, defined in RangeFft.cpp.
+struct RangePlan;
+
+class RangeFft {
+ public:
+  explicit RangeFft(WindowType window = WindowType::kHann);
+  ~RangeFft();
+
+  /**
+   * @brief Get the number of range bins of a chirp.
+   *
+   * @param num_samples the number of samples per chirp.
+   * @param is_complex whether the samples are complex.
+   */
+  static size_t GetNumRangeBins(size_t num_samples, bool is_complex);
+
+  /**
+   * @brief Transform complex chirps into range bins.
+   *
+   * @param shape the dimensions of the chirps.
+   * @param chirps the samples laid out as CubeLayout::kChannelChirpSample.
+   * @param range_bins where the channel x chirp x range bin cube will be
+   *        written into. Must not overlap the chirps.
+   *
+   * @return RC_OK or RC_BAD_INPUT for an empty shape or null buffers.
+   */
+  RadarReturnCode Process(const CubeShape& shape,
+                          const std::complex<float>* chirps,
+                          std::complex<float>* range_bins);
+
+  //! Same as above for real chirps.
+  RadarReturnCode Process(const CubeShape& shape, const float* chirps,
+                          std::complex<float>* range_bins);
+
+  /**
+   * @brief Unpack a burst and transform its chirps into range bins.
+   *
+   * @param format the burst format.
+   * @param data the burst data.
+   * @param size_bytes the size of the burst data.
+   * @param range_cube where the channel x chirp x range bin cube will be
+   *        written into.
+   * @param shape where the dimensions of the range cube will be written
+   *        into, num_samples being the number of range bins.
+   *
+   * @return RC_OK, RC_UNSUPPORTED for formats that can not be unpacked,
+   *         RC_BAD_INPUT if the size does not match the format.
+   */
+  RadarReturnCode Process(const RadarBurstFormat& format, const uint8_t* data,
+                          size_t size_bytes,
+                          std::vector<std::complex<float>>& range_cube,
+                          CubeShape& shape);
+
+ private:
+  const RangePlan& GetPlan(size_t num_samples, bool is_complex);
+
+  WindowType window_;
+  //! Plans used by this instance, few enough for a linear search.
+  std::vector<std::pair<uint64_t, std::shared_ptr<const RangePlan>>> plans_;
+  std::vector<float> samples_;
+  std::vector<float> cube_;
+  std::vector<std::complex<float>> scratch_;
+};
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_RANGEFFT_HPP_
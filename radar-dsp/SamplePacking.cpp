@@ -0,0 +1,457 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <SamplePacking.hpp>
+
+#include <SimdLevel.hpp>
+
+#include <cstring>
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+#include <SimdIntrinsics.hpp>
+#endif
+
+namespace radar_dsp {
+
+namespace {
+
+// The SIMD kernels work on groups of 8 components, which take bits bytes.
+const int kGroupComponents = 8;
+// Bytes loaded or stored per group, the group is padded by the next one.
+const size_t kGroupLoadBytes = 16;
+
+uint32_t GetMask(int bits) {
+  return bits >= 32 ? ~0u : (1u << bits) - 1;
+}
+
+int32_t SignExtend(uint32_t value, int bits) {
+  int shift = 32 - bits;
+  return static_cast<int32_t>(value << shift) >> shift;
+}
+
+// Read a packed component starting at a bit of the stream.
+uint32_t ReadBits(const uint8_t* data, size_t bit, int bits,
+                  bool msb_first) {
+  const uint8_t* src = data + bit / 8;
+  int shift = static_cast<int>(bit % 8);
+  int num_bytes = (shift + bits + 7) / 8;
+  uint64_t window = 0;
+  if (msb_first) {
+    for (int i = 0; i < num_bytes; ++i) {
+      window = (window << 8) | src[i];
+    }
+    window >>= num_bytes * 8 - shift - bits;
+  } else {
+    for (int i = 0; i < num_bytes; ++i) {
+      window |= static_cast<uint64_t>(src[i]) << (8 * i);
+    }
+    window >>= shift;
+  }
+  return static_cast<uint32_t>(window) & GetMask(bits);
+}
+
+// Write a packed component into a zeroed stream.
+void WriteBits(uint8_t* data, size_t bit, int bits, bool msb_first,
+               uint32_t value) {
+  uint8_t* dst = data + bit / 8;
+  int shift = static_cast<int>(bit % 8);
+  int num_bytes = (shift + bits + 7) / 8;
+  uint64_t window = value & GetMask(bits);
+  if (msb_first) {
+    window <<= num_bytes * 8 - shift - bits;
+    for (int i = 0; i < num_bytes; ++i) {
+      dst[i] |= static_cast<uint8_t>(window >> (8 * (num_bytes - 1 - i)));
+    }
+  } else {
+    window <<= shift;
+    for (int i = 0; i < num_bytes; ++i) {
+      dst[i] |= static_cast<uint8_t>(window >> (8 * i));
+    }
+  }
+}
+
+uint32_t LoadContainer(const uint8_t* src, int bytes, bool big_endian) {
+  uint32_t value = 0;
+  for (int i = 0; i < bytes; ++i) {
+    int byte = big_endian ? bytes - 1 - i : i;
+    value |= static_cast<uint32_t>(src[byte]) << (8 * i);
+  }
+  return value;
+}
+
+void StoreContainer(uint8_t* dst, int bytes, bool big_endian,
+                    uint32_t value) {
+  for (int i = 0; i < bytes; ++i) {
+    int byte = big_endian ? bytes - 1 - i : i;
+    dst[byte] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+// Component at index of the stream, sign-extended when signed.
+uint32_t ReadComponent(const SampleLayout& layout, const uint8_t* data,
+                       size_t index) {
+  uint32_t value = ReadBits(data, index * layout.bits, layout.bits,
+                            layout.is_big_endian);
+  if (layout.is_signed) {
+    return static_cast<uint32_t>(SignExtend(value, layout.bits));
+  }
+  return value;
+}
+
+bool HasSimdGroups(const SampleLayout& layout) {
+  return layout.bits > 8 && layout.bits < 16;
+}
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+
+// Shuffles and shifts of a group of components. Every component is read
+// through a 24-bit window of the 3 bytes it overlaps, placed in the low
+// bytes of a 32-bit lane.
+struct GroupTables {
+  // Indices of the window bytes of every component, for unpacking.
+  int8_t window[kGroupComponents * 4];
+  // Left shift moving a component to the top of its lane when unpacking.
+  int32_t unpack_shift[kGroupComponents];
+  // Indices of the lane bytes gathered into every byte of the group when
+  // packing, per half of the group and per window byte.
+  int8_t gather[2][3][16];
+  // Multiplier moving a component to its place in the window when packing.
+  int32_t pack_multiplier[kGroupComponents];
+};
+
+void InitGroupTables(int bits, bool msb_first, GroupTables& tables) {
+  memset(tables.gather, -1, sizeof(tables.gather));
+  for (int i = 0; i < kGroupComponents; ++i) {
+    int offset = i * bits / 8;
+    int shift = i * bits % 8;
+    int8_t* window = &tables.window[i * 4];
+    int half = i / 4;
+    int lane_byte = (i % 4) * 4;
+    for (int k = 0; k < 3; ++k) {
+      // Window byte k, counted from the least significant one.
+      int byte = msb_first ? offset + 2 - k : offset + k;
+      window[k] = static_cast<int8_t>(byte);
+      tables.gather[half][k][byte] = static_cast<int8_t>(lane_byte + k);
+    }
+    window[3] = -1;
+    if (msb_first) {
+      tables.unpack_shift[i] = 8 + shift;
+      tables.pack_multiplier[i] = 1 << (24 - shift - bits);
+    } else {
+      tables.unpack_shift[i] = 32 - bits - shift;
+      tables.pack_multiplier[i] = 1 << shift;
+    }
+  }
+}
+
+// Extract a group of components into two vectors of 4 lanes. Signed
+// components are sign-extended, unsigned ones zero-extended.
+RADAR_DSP_TARGET_SSE41 inline void UnpackGroupSse41(
+    const uint8_t* src, const __m128i window[2], const __m128i multiplier[2],
+    const __m128i& shift, bool is_signed, __m128i lanes[2]) {
+  __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  for (int half = 0; half < 2; ++half) {
+    // Multiplying is the only per lane left shift before AVX2.
+    __m128i lane = _mm_mullo_epi32(_mm_shuffle_epi8(bytes, window[half]),
+                                   multiplier[half]);
+    lanes[half] = is_signed ? _mm_sra_epi32(lane, shift)
+                            : _mm_srl_epi32(lane, shift);
+  }
+}
+
+struct Sse41Tables {
+  RADAR_DSP_TARGET_SSE41 explicit Sse41Tables(const GroupTables& tables) {
+    for (int half = 0; half < 2; ++half) {
+      window[half] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(&tables.window[half * 16]));
+      int32_t multipliers[4];
+      for (int i = 0; i < 4; ++i) {
+        multipliers[i] = static_cast<int32_t>(
+            1u << tables.unpack_shift[half * 4 + i]);
+      }
+      unpack_multiplier[half] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(multipliers));
+      pack_multiplier[half] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(
+              &tables.pack_multiplier[half * 4]));
+      for (int k = 0; k < 3; ++k) {
+        gather[half][k] = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(tables.gather[half][k]));
+      }
+    }
+  }
+
+  __m128i window[2];
+  __m128i unpack_multiplier[2];
+  __m128i pack_multiplier[2];
+  __m128i gather[2][3];
+};
+
+RADAR_DSP_TARGET_SSE41 size_t UnpackGroupsSse41(
+    const SampleLayout& layout, const GroupTables& group_tables,
+    const uint8_t* data, size_t num_groups, float* output, float scale) {
+  Sse41Tables tables(group_tables);
+  const __m128i shift = _mm_cvtsi32_si128(32 - layout.bits);
+  const __m128 scale_vector = _mm_set1_ps(scale);
+  for (size_t group = 0; group < num_groups; ++group) {
+    __m128i lanes[2];
+    UnpackGroupSse41(data + group * layout.bits, tables.window,
+                     tables.unpack_multiplier, shift, layout.is_signed,
+                     lanes);
+    float* dst = output + group * kGroupComponents;
+    _mm_storeu_ps(dst, _mm_mul_ps(_mm_cvtepi32_ps(lanes[0]), scale_vector));
+    _mm_storeu_ps(dst + 4,
+                  _mm_mul_ps(_mm_cvtepi32_ps(lanes[1]), scale_vector));
+  }
+  return num_groups;
+}
+
+RADAR_DSP_TARGET_AVX2 size_t UnpackGroupsAvx2(
+    const SampleLayout& layout, const GroupTables& tables,
+    const uint8_t* data, size_t num_groups, float* output, float scale) {
+  const __m256i window = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i*>(tables.window));
+  const __m256i unpack_shift = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i*>(tables.unpack_shift));
+  const __m128i shift = _mm_cvtsi32_si128(32 - layout.bits);
+  const __m256 scale_vector = _mm256_set1_ps(scale);
+  for (size_t group = 0; group < num_groups; ++group) {
+    // Both halves shuffle within their own copy of the group bytes.
+    __m256i bytes = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(data + group * layout.bits)));
+    __m256i lanes = _mm256_sllv_epi32(_mm256_shuffle_epi8(bytes, window),
+                                      unpack_shift);
+    lanes = layout.is_signed ? _mm256_sra_epi32(lanes, shift)
+                             : _mm256_srl_epi32(lanes, shift);
+    _mm256_storeu_ps(output + group * kGroupComponents,
+                     _mm256_mul_ps(_mm256_cvtepi32_ps(lanes), scale_vector));
+  }
+  return num_groups;
+}
+
+RADAR_DSP_TARGET_SSE41 size_t ExpandGroupsSse41(
+    const SampleLayout& layout, const GroupTables& group_tables,
+    const uint8_t* data, size_t num_groups, uint8_t* output) {
+  Sse41Tables tables(group_tables);
+  const __m128i shift = _mm_cvtsi32_si128(32 - layout.bits);
+  const __m128i swap16 = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+                                       9, 8, 11, 10, 13, 12, 15, 14);
+  for (size_t group = 0; group < num_groups; ++group) {
+    __m128i lanes[2];
+    UnpackGroupSse41(data + group * layout.bits, tables.window,
+                     tables.unpack_multiplier, shift, layout.is_signed,
+                     lanes);
+    __m128i containers = layout.is_signed
+                             ? _mm_packs_epi32(lanes[0], lanes[1])
+                             : _mm_packus_epi32(lanes[0], lanes[1]);
+    if (layout.is_big_endian) {
+      containers = _mm_shuffle_epi8(containers, swap16);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(
+                         output + group * kGroupComponents * 2),
+                     containers);
+  }
+  return num_groups;
+}
+
+RADAR_DSP_TARGET_SSE41 size_t PackGroupsSse41(
+    const SampleLayout& layout, const GroupTables& group_tables,
+    const uint8_t* padded, size_t num_groups, uint8_t* output) {
+  Sse41Tables tables(group_tables);
+  const __m128i mask = _mm_set1_epi32(static_cast<int>(GetMask(layout.bits)));
+  const __m128i swap16 = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+                                       9, 8, 11, 10, 13, 12, 15, 14);
+  for (size_t group = 0; group < num_groups; ++group) {
+    __m128i containers = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+        padded + group * kGroupComponents * 2));
+    if (layout.is_big_endian) {
+      containers = _mm_shuffle_epi8(containers, swap16);
+    }
+    __m128i lanes[2] = {
+      _mm_cvtepu16_epi32(containers),
+      _mm_cvtepu16_epi32(_mm_srli_si128(containers, 8)),
+    };
+    __m128i packed = _mm_setzero_si128();
+    for (int half = 0; half < 2; ++half) {
+      __m128i lane = _mm_mullo_epi32(_mm_and_si128(lanes[half], mask),
+                                     tables.pack_multiplier[half]);
+      for (int k = 0; k < 3; ++k) {
+        packed = _mm_or_si128(packed,
+                              _mm_shuffle_epi8(lane, tables.gather[half][k]));
+      }
+    }
+    // The bytes past the group are zero and get filled by the next group.
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + group * layout.bits),
+                     packed);
+  }
+  return num_groups;
+}
+
+#endif  // RADAR_DSP_HAS_X86_SIMD
+
+// Get the number of groups the SIMD kernels can process without touching
+// bytes past the packed data of the given size.
+size_t GetNumSimdGroups(const SampleLayout& layout, size_t count,
+                        size_t packed_bytes) {
+  if (!HasSimdGroups(layout) || GetSimdLevel() == SimdLevel::kScalar ||
+      packed_bytes < kGroupLoadBytes) {
+    return 0;
+  }
+  size_t num_groups = count / kGroupComponents;
+  size_t max_groups = (packed_bytes - kGroupLoadBytes) / layout.bits + 1;
+  return num_groups < max_groups ? num_groups : max_groups;
+}
+
+RadarReturnCode GetPackedLayout(const RadarBurstFormat& format,
+                                SampleLayout& layout) {
+  if (format.sample_packing != RSAMPLE_PACKING_PACKED) {
+    return RC_UNSUPPORTED;
+  }
+  RadarReturnCode rc = GetSampleLayout(format, layout);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  // Whole byte components are packed the same as they are padded.
+  return layout.is_float ? RC_UNSUPPORTED : RC_OK;
+}
+
+}  // namespace
+
+size_t GetBurstBytes(const RadarBurstFormat& format, size_t num_samples) {
+  SampleLayout layout;
+  if (GetSampleLayout(format, layout) != RC_OK) {
+    return 0;
+  }
+  size_t count = num_samples * layout.components;
+  if (layout.is_packed) {
+    return (count * layout.bits + 7) / 8;
+  }
+  return count * layout.container_bytes;
+}
+
+RadarReturnCode PackSamples(const RadarBurstFormat& format,
+                            const uint8_t* padded, size_t padded_bytes,
+                            uint8_t* packed, size_t packed_bytes) {
+  SampleLayout layout;
+  RadarReturnCode rc = GetPackedLayout(format, layout);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  size_t sample_bytes = layout.container_bytes * layout.components;
+  if (padded_bytes % sample_bytes != 0 ||
+      (padded_bytes > 0 && (padded == nullptr || packed == nullptr))) {
+    return RC_BAD_INPUT;
+  }
+  size_t count = padded_bytes / layout.container_bytes;
+  if (packed_bytes != GetBurstBytes(format, count / layout.components)) {
+    return RC_BAD_INPUT;
+  }
+  if (!layout.is_packed) {
+    memcpy(packed, padded, padded_bytes);
+    return RC_OK;
+  }
+  memset(packed, 0, packed_bytes);
+
+  size_t done = 0;
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  size_t num_groups = GetNumSimdGroups(layout, count, packed_bytes);
+  if (num_groups > 0) {
+    GroupTables tables;
+    InitGroupTables(layout.bits, layout.is_big_endian, tables);
+    done = PackGroupsSse41(layout, tables, padded, num_groups, packed) *
+           kGroupComponents;
+  }
+#endif
+  for (size_t i = done; i < count; ++i) {
+    uint32_t value = LoadContainer(padded + i * layout.container_bytes,
+                                   layout.container_bytes,
+                                   layout.is_big_endian);
+    WriteBits(packed, i * layout.bits, layout.bits, layout.is_big_endian,
+              value);
+  }
+  return RC_OK;
+}
+
+RadarReturnCode PackSamples(const RadarBurstFormat& format,
+                            const uint8_t* padded, size_t padded_bytes,
+                            std::vector<uint8_t>& packed) {
+  SampleLayout layout;
+  RadarReturnCode rc = GetPackedLayout(format, layout);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  size_t sample_bytes = layout.container_bytes * layout.components;
+  if (padded_bytes % sample_bytes != 0) {
+    return RC_BAD_INPUT;
+  }
+  packed.resize(GetBurstBytes(format, padded_bytes / sample_bytes));
+  return PackSamples(format, padded, padded_bytes, packed.data(),
+                     packed.size());
+}
+
+RadarReturnCode ExpandSamples(const RadarBurstFormat& format,
+                              const uint8_t* packed, size_t packed_bytes,
+                              std::vector<uint8_t>& padded) {
+  SampleLayout layout;
+  RadarReturnCode rc = GetPackedLayout(format, layout);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  size_t num_samples = GetNumSamples(format, packed_bytes);
+  if (GetBurstBytes(format, num_samples) != packed_bytes ||
+      (packed_bytes > 0 && packed == nullptr)) {
+    return RC_BAD_INPUT;
+  }
+  size_t count = num_samples * layout.components;
+  padded.resize(count * layout.container_bytes);
+  if (!layout.is_packed) {
+    memcpy(padded.data(), packed, packed_bytes);
+    return RC_OK;
+  }
+
+  size_t done = 0;
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  size_t num_groups = GetNumSimdGroups(layout, count, packed_bytes);
+  if (num_groups > 0) {
+    GroupTables tables;
+    InitGroupTables(layout.bits, layout.is_big_endian, tables);
+    done = ExpandGroupsSse41(layout, tables, packed, num_groups,
+                             padded.data()) * kGroupComponents;
+  }
+#endif
+  for (size_t i = done; i < count; ++i) {
+    StoreContainer(padded.data() + i * layout.container_bytes,
+                   layout.container_bytes, layout.is_big_endian,
+                   ReadComponent(layout, packed, i));
+  }
+  return RC_OK;
+}
+
+void UnpackPackedComponents(const SampleLayout& layout, const uint8_t* data,
+                            size_t count, float* output, float scale) {
+  size_t done = 0;
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  size_t packed_bytes = (count * layout.bits + 7) / 8;
+  size_t num_groups = GetNumSimdGroups(layout, count, packed_bytes);
+  if (num_groups > 0) {
+    GroupTables tables;
+    InitGroupTables(layout.bits, layout.is_big_endian, tables);
+    // AVX-512 has no wider shuffle without VBMI, the AVX2 kernel is used.
+    if (GetSimdLevel() >= SimdLevel::kAvx2) {
+      done = UnpackGroupsAvx2(layout, tables, data, num_groups, output,
+                              scale);
+    } else {
+      done = UnpackGroupsSse41(layout, tables, data, num_groups, output,
+                               scale);
+    }
+    done *= kGroupComponents;
+  }
+#endif
+  for (size_t i = done; i < count; ++i) {
+    uint32_t value = ReadComponent(layout, data, i);
+    output[i] = (layout.is_signed ? static_cast<float>(
+                                        static_cast<int32_t>(value))
+                                  : static_cast<float>(value)) * scale;
+  }
+}
+
+}  // namespace radar_dsp
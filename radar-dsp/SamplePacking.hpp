@@ -0,0 +1,99 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Packing of integer samples narrower than their containers.
+ *
+ * @details ADCs commonly produce 10, 12 or 14-bit samples. Sending them as
+ *          RSAMPLE_PACKING_PACKED bursts instead of padding them to 16 bits
+ *          saves up to 37.5% of the bandwidth. Drivers pack the padded
+ *          samples with PackSamples, consumers unpack them straight into
+ *          floats with UnpackSamples or expand them back to padded integers
+ *          with ExpandSamples.
+ *
+ *          Components of 9 to 15 bits are packed and unpacked eight at
+ *          a time with SIMD kernels, the rest with scalar code.
+ */
+#ifndef RIPPLE_RADAR_DSP_SAMPLEPACKING_HPP_
+#define RIPPLE_RADAR_DSP_SAMPLEPACKING_HPP_
+
+#include <RadarCommon.h>
+
+#include <SampleUnpack.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace radar_dsp {
+
+/**
+ * @brief Get the size of burst data holding a number of samples.
+ *
+ * @param format the burst format, packed or padded.
+ * @param num_samples the number of samples.
+ *
+ * @return the size in bytes or 0 if the format is unsupported.
+ */
+size_t GetBurstBytes(const RadarBurstFormat& format, size_t num_samples);
+
+/**
+ * @brief Pack padded integer samples.
+ *
+ * @param format the format of the packed burst. The padded samples have
+ *        the same format with RSAMPLE_PACKING_PADDED.
+ * @param padded the padded samples.
+ * @param padded_bytes the size of the padded samples.
+ * @param packed where the packed burst data will be written into.
+ *
+ * @return RC_OK, RC_UNSUPPORTED if the format is not a packed integer one,
+ *         RC_BAD_INPUT if the size is not a multiple of the sample size.
+ */
+RadarReturnCode PackSamples(const RadarBurstFormat& format,
+                            const uint8_t* padded, size_t padded_bytes,
+                            std::vector<uint8_t>& packed);
+
+/**
+ * @brief Pack padded integer samples into a buffer.
+ *
+ * @param packed_bytes the size of the buffer, GetBurstBytes of the samples.
+ *
+ * @return same as above, RC_BAD_INPUT if the buffer size does not match.
+ */
+RadarReturnCode PackSamples(const RadarBurstFormat& format,
+                            const uint8_t* padded, size_t padded_bytes,
+                            uint8_t* packed, size_t packed_bytes);
+
+/**
+ * @brief Expand packed integer samples into padded ones.
+ *
+ * @details Signed components are sign-extended to the container size.
+ *
+ * @param format the format of the packed burst. The padded samples have
+ *        the same format with RSAMPLE_PACKING_PADDED.
+ * @param packed the packed burst data.
+ * @param packed_bytes the size of the packed burst data.
+ * @param padded where the padded samples will be written into.
+ *
+ * @return same as PackSamples.
+ */
+RadarReturnCode ExpandSamples(const RadarBurstFormat& format,
+                              const uint8_t* packed, size_t packed_bytes,
+                              std::vector<uint8_t>& padded);
+
+/**
+ * @brief Unpack packed integer components into floats.
+ *
+ * @details Used by UnpackSamples for packed layouts.
+ *
+ * @param layout the packed layout of the components.
+ * @param data the packed burst data.
+ * @param count the number of components to unpack.
+ * @param output where count floats will be written into.
+ * @param scale a factor every component is multiplied by.
+ */
+void UnpackPackedComponents(const SampleLayout& layout, const uint8_t* data,
+                            size_t count, float* output, float scale);
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_SAMPLEPACKING_HPP_
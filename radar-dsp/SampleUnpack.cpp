@@ -0,0 +1,624 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <SampleUnpack.hpp>
+
+#include <SamplePacking.hpp>
+#include <SimdLevel.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+#include <SimdIntrinsics.hpp>
+#endif
+
+namespace radar_dsp {
+
+namespace {
+
+struct UnpackArgs {
+  const uint8_t* src;
+  float* dst;
+  // Number of components to unpack.
+  size_t count;
+  float scale;
+  int bits;
+};
+
+// Compilers turn these into single byte swap instructions.
+uint16_t ByteSwap(uint16_t value) {
+  return static_cast<uint16_t>((value >> 8) | (value << 8));
+}
+
+uint32_t ByteSwap(uint32_t value) {
+  return (value >> 24) | ((value >> 8) & 0xff00u) |
+         ((value << 8) & 0xff0000u) | (value << 24);
+}
+
+uint64_t ByteSwap(uint64_t value) {
+  uint64_t low = ByteSwap(static_cast<uint32_t>(value));
+  return (low << 32) | ByteSwap(static_cast<uint32_t>(value >> 32));
+}
+
+template <typename T>
+T Load(const uint8_t* src, bool swap) {
+  T value;
+  memcpy(&value, src, sizeof(value));
+  return swap ? ByteSwap(value) : value;
+}
+
+void UnpackScalar(const SampleLayout& layout, const UnpackArgs& args) {
+  const uint8_t* src = args.src;
+  bool swap = layout.is_big_endian;
+  if (layout.is_float) {
+    for (size_t i = 0; i < args.count; ++i, src += layout.container_bytes) {
+      if (layout.container_bytes == 4) {
+        uint32_t bits = Load<uint32_t>(src, swap);
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        args.dst[i] = value * args.scale;
+      } else {
+        uint64_t bits = Load<uint64_t>(src, swap);
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        args.dst[i] = static_cast<float>(value) * args.scale;
+      }
+    }
+    return;
+  }
+
+  int shift = 32 - args.bits;
+  uint32_t mask = shift == 0 ? ~0u : (1u << args.bits) - 1;
+  for (size_t i = 0; i < args.count; ++i, src += layout.container_bytes) {
+    uint32_t raw;
+    if (layout.container_bytes == 1) {
+      raw = *src;
+    } else if (layout.container_bytes == 2) {
+      raw = Load<uint16_t>(src, swap);
+    } else {
+      raw = Load<uint32_t>(src, swap);
+    }
+    float value;
+    if (layout.is_signed) {
+      value = static_cast<float>(static_cast<int32_t>(raw << shift) >> shift);
+    } else {
+      value = static_cast<float>(raw & mask);
+    }
+    args.dst[i] = value * args.scale;
+  }
+}
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+
+// The integer kernels zero-extend components to 32 bits, or sign-extend
+// them when they fill the container, then sign-extend or mask the padded
+// ones. They return the number of components unpacked, the remainder is
+// left to the scalar kernel.
+
+struct Sse41Kernel {
+  template <int kBytes, bool kSigned, bool kSwap, bool kPadded>
+  RADAR_DSP_TARGET_SSE41 static size_t UnpackInt(const UnpackArgs& args) {
+    const __m128i swap16 = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+                                         9, 8, 11, 10, 13, 12, 15, 14);
+    const __m128i swap32 = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                         11, 10, 9, 8, 15, 14, 13, 12);
+    const __m128i shift = _mm_cvtsi32_si128(32 - args.bits);
+    const __m128i mask = _mm_set1_epi32(
+        static_cast<int>(args.bits == 32 ? ~0u : (1u << args.bits) - 1));
+    const __m128 scale = _mm_set1_ps(args.scale);
+    const bool sign_extend_load = kSigned && !kPadded;
+
+    size_t i = 0;
+    for (; i + 4 <= args.count; i += 4) {
+      const uint8_t* src = args.src + i * kBytes;
+      __m128i value;
+      if (kBytes == 1) {
+        int32_t raw;
+        memcpy(&raw, src, sizeof(raw));
+        value = _mm_cvtsi32_si128(raw);
+        value = sign_extend_load ? _mm_cvtepi8_epi32(value)
+                                 : _mm_cvtepu8_epi32(value);
+      } else if (kBytes == 2) {
+        value = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+        if (kSwap) {
+          value = _mm_shuffle_epi8(value, swap16);
+        }
+        value = sign_extend_load ? _mm_cvtepi16_epi32(value)
+                                 : _mm_cvtepu16_epi32(value);
+      } else {
+        value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        if (kSwap) {
+          value = _mm_shuffle_epi8(value, swap32);
+        }
+      }
+
+      __m128 result;
+      if (kPadded && kSigned) {
+        value = _mm_sra_epi32(_mm_sll_epi32(value, shift), shift);
+      } else if (kPadded) {
+        value = _mm_and_si128(value, mask);
+      }
+      if (kBytes == 4 && !kSigned && !kPadded) {
+        // Only signed integers can be converted, split into 16 bit halves.
+        __m128 high = _mm_cvtepi32_ps(_mm_srli_epi32(value, 16));
+        __m128 low = _mm_cvtepi32_ps(
+            _mm_and_si128(value, _mm_set1_epi32(0xffff)));
+        result = _mm_add_ps(_mm_mul_ps(high, _mm_set1_ps(65536.0f)), low);
+      } else {
+        result = _mm_cvtepi32_ps(value);
+      }
+      _mm_storeu_ps(args.dst + i, _mm_mul_ps(result, scale));
+    }
+    return i;
+  }
+
+  template <bool kSwap>
+  RADAR_DSP_TARGET_SSE41 static size_t UnpackFloat(const UnpackArgs& args) {
+    const __m128i swap32 = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                         11, 10, 9, 8, 15, 14, 13, 12);
+    const __m128 scale = _mm_set1_ps(args.scale);
+    size_t i = 0;
+    for (; i + 4 <= args.count; i += 4) {
+      __m128i value = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(args.src + i * 4));
+      if (kSwap) {
+        value = _mm_shuffle_epi8(value, swap32);
+      }
+      _mm_storeu_ps(args.dst + i,
+                    _mm_mul_ps(_mm_castsi128_ps(value), scale));
+    }
+    return i;
+  }
+};
+
+struct Avx2Kernel {
+  template <int kBytes, bool kSigned, bool kSwap, bool kPadded>
+  RADAR_DSP_TARGET_AVX2 static size_t UnpackInt(const UnpackArgs& args) {
+    const __m128i swap16 = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+                                         9, 8, 11, 10, 13, 12, 15, 14);
+    const __m256i swap32 = _mm256_setr_epi8(
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m128i shift = _mm_cvtsi32_si128(32 - args.bits);
+    const __m256i mask = _mm256_set1_epi32(
+        static_cast<int>(args.bits == 32 ? ~0u : (1u << args.bits) - 1));
+    const __m256 scale = _mm256_set1_ps(args.scale);
+    const bool sign_extend_load = kSigned && !kPadded;
+
+    size_t i = 0;
+    for (; i + 8 <= args.count; i += 8) {
+      const uint8_t* src = args.src + i * kBytes;
+      __m256i value;
+      if (kBytes == 1) {
+        __m128i raw = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+        value = sign_extend_load ? _mm256_cvtepi8_epi32(raw)
+                                 : _mm256_cvtepu8_epi32(raw);
+      } else if (kBytes == 2) {
+        __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        if (kSwap) {
+          raw = _mm_shuffle_epi8(raw, swap16);
+        }
+        value = sign_extend_load ? _mm256_cvtepi16_epi32(raw)
+                                 : _mm256_cvtepu16_epi32(raw);
+      } else {
+        value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+        if (kSwap) {
+          value = _mm256_shuffle_epi8(value, swap32);
+        }
+      }
+
+      __m256 result;
+      if (kPadded && kSigned) {
+        value = _mm256_sra_epi32(_mm256_sll_epi32(value, shift), shift);
+      } else if (kPadded) {
+        value = _mm256_and_si256(value, mask);
+      }
+      if (kBytes == 4 && !kSigned && !kPadded) {
+        __m256 high = _mm256_cvtepi32_ps(_mm256_srli_epi32(value, 16));
+        __m256 low = _mm256_cvtepi32_ps(
+            _mm256_and_si256(value, _mm256_set1_epi32(0xffff)));
+        result = _mm256_add_ps(
+            _mm256_mul_ps(high, _mm256_set1_ps(65536.0f)), low);
+      } else {
+        result = _mm256_cvtepi32_ps(value);
+      }
+      _mm256_storeu_ps(args.dst + i, _mm256_mul_ps(result, scale));
+    }
+    return i;
+  }
+
+  template <bool kSwap>
+  RADAR_DSP_TARGET_AVX2 static size_t UnpackFloat(const UnpackArgs& args) {
+    const __m256i swap32 = _mm256_setr_epi8(
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m256 scale = _mm256_set1_ps(args.scale);
+    size_t i = 0;
+    for (; i + 8 <= args.count; i += 8) {
+      __m256i value = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(args.src + i * 4));
+      if (kSwap) {
+        value = _mm256_shuffle_epi8(value, swap32);
+      }
+      _mm256_storeu_ps(args.dst + i,
+                       _mm256_mul_ps(_mm256_castsi256_ps(value), scale));
+    }
+    return i;
+  }
+};
+
+struct Avx512Kernel {
+  template <int kBytes, bool kSigned, bool kSwap, bool kPadded>
+  RADAR_DSP_TARGET_AVX512 static size_t UnpackInt(const UnpackArgs& args) {
+    const __m256i swap16 = _mm256_setr_epi8(
+        1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+        1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const __m512i swap32 = _mm512_broadcast_i32x4(_mm_setr_epi8(
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    const __m128i shift = _mm_cvtsi32_si128(32 - args.bits);
+    const __m512i mask = _mm512_set1_epi32(
+        static_cast<int>(args.bits == 32 ? ~0u : (1u << args.bits) - 1));
+    const __m512 scale = _mm512_set1_ps(args.scale);
+    const bool sign_extend_load = kSigned && !kPadded;
+
+    size_t i = 0;
+    for (; i + 16 <= args.count; i += 16) {
+      const uint8_t* src = args.src + i * kBytes;
+      __m512i value;
+      if (kBytes == 1) {
+        __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        value = sign_extend_load ? _mm512_cvtepi8_epi32(raw)
+                                 : _mm512_cvtepu8_epi32(raw);
+      } else if (kBytes == 2) {
+        __m256i raw = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(src));
+        if (kSwap) {
+          raw = _mm256_shuffle_epi8(raw, swap16);
+        }
+        value = sign_extend_load ? _mm512_cvtepi16_epi32(raw)
+                                 : _mm512_cvtepu16_epi32(raw);
+      } else {
+        value = _mm512_loadu_si512(src);
+        if (kSwap) {
+          value = _mm512_shuffle_epi8(value, swap32);
+        }
+      }
+
+      __m512 result;
+      if (kPadded && kSigned) {
+        value = _mm512_sra_epi32(_mm512_sll_epi32(value, shift), shift);
+      } else if (kPadded) {
+        value = _mm512_and_si512(value, mask);
+      }
+      if (kBytes == 4 && !kSigned && !kPadded) {
+        result = _mm512_cvtepu32_ps(value);
+      } else {
+        result = _mm512_cvtepi32_ps(value);
+      }
+      _mm512_storeu_ps(args.dst + i, _mm512_mul_ps(result, scale));
+    }
+    return i;
+  }
+
+  template <bool kSwap>
+  RADAR_DSP_TARGET_AVX512 static size_t UnpackFloat(const UnpackArgs& args) {
+    const __m512i swap32 = _mm512_broadcast_i32x4(_mm_setr_epi8(
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    const __m512 scale = _mm512_set1_ps(args.scale);
+    size_t i = 0;
+    for (; i + 16 <= args.count; i += 16) {
+      __m512i value = _mm512_loadu_si512(args.src + i * 4);
+      if (kSwap) {
+        value = _mm512_shuffle_epi8(value, swap32);
+      }
+      _mm512_storeu_ps(args.dst + i,
+                       _mm512_mul_ps(_mm512_castsi512_ps(value), scale));
+    }
+    return i;
+  }
+};
+
+// Turn the layout into template arguments of the kernels.
+
+template <typename Kernel, int kBytes, bool kSigned, bool kSwap>
+size_t UnpackIntPadded(const UnpackArgs& args) {
+  if (args.bits < kBytes * 8) {
+    return Kernel::template UnpackInt<kBytes, kSigned, kSwap, true>(args);
+  }
+  return Kernel::template UnpackInt<kBytes, kSigned, kSwap, false>(args);
+}
+
+template <typename Kernel, int kBytes, bool kSigned>
+size_t UnpackIntSwap(const SampleLayout& layout, const UnpackArgs& args) {
+  if (kBytes > 1 && layout.is_big_endian) {
+    return UnpackIntPadded<Kernel, kBytes, kSigned, true>(args);
+  }
+  return UnpackIntPadded<Kernel, kBytes, kSigned, false>(args);
+}
+
+template <typename Kernel, int kBytes>
+size_t UnpackIntSigned(const SampleLayout& layout, const UnpackArgs& args) {
+  if (layout.is_signed) {
+    return UnpackIntSwap<Kernel, kBytes, true>(layout, args);
+  }
+  return UnpackIntSwap<Kernel, kBytes, false>(layout, args);
+}
+
+template <typename Kernel>
+size_t UnpackVector(const SampleLayout& layout, const UnpackArgs& args) {
+  if (layout.is_float) {
+    if (layout.container_bytes != 4) {
+      return 0;
+    }
+    return layout.is_big_endian ? Kernel::template UnpackFloat<true>(args)
+                                : Kernel::template UnpackFloat<false>(args);
+  }
+  switch (layout.container_bytes) {
+    case 1:
+      return UnpackIntSigned<Kernel, 1>(layout, args);
+    case 2:
+      return UnpackIntSigned<Kernel, 2>(layout, args);
+    case 4:
+      return UnpackIntSigned<Kernel, 4>(layout, args);
+  }
+  return 0;
+}
+
+#endif  // RADAR_DSP_HAS_X86_SIMD
+
+// Samples converted at once by UnpackSamplesPlanar, small enough for the
+// tile to stay in L1 while it is de-interleaved.
+constexpr size_t kTileSamples = 2048;
+
+RadarReturnCode CheckBurst(const RadarBurstFormat& format,
+                           const uint8_t* data, size_t size_bytes,
+                           const float* output, SampleLayout& layout,
+                           size_t& num_samples) {
+  RadarReturnCode rc = GetSampleLayout(format, layout);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (size_bytes > 0 && (data == nullptr || output == nullptr)) {
+    return RC_BAD_INPUT;
+  }
+  num_samples = GetNumSamples(format, size_bytes);
+  if (layout.is_packed) {
+    return GetBurstBytes(format, num_samples) == size_bytes ? RC_OK
+                                                            : RC_BAD_INPUT;
+  }
+  return size_bytes % (layout.container_bytes * layout.components) == 0
+             ? RC_OK
+             : RC_BAD_INPUT;
+}
+
+void UnpackComponents(const SampleLayout& layout, const uint8_t* data,
+                      size_t count, float* output, float scale) {
+  if (layout.is_packed) {
+    UnpackPackedComponents(layout, data, count, output, scale);
+    return;
+  }
+
+  UnpackArgs args;
+  args.src = data;
+  args.dst = output;
+  args.count = count;
+  args.scale = scale;
+  args.bits = layout.bits;
+
+  size_t done = 0;
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      done = UnpackVector<Avx512Kernel>(layout, args);
+      break;
+    case SimdLevel::kAvx2:
+      done = UnpackVector<Avx2Kernel>(layout, args);
+      break;
+    case SimdLevel::kSse41:
+      done = UnpackVector<Sse41Kernel>(layout, args);
+      break;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  args.src += done * layout.container_bytes;
+  args.dst += done;
+  args.count -= done;
+  UnpackScalar(layout, args);
+}
+
+// Scatter a tile of interleaved samples, starting with channel 0, to the
+// runs of every channel. The channel count is small, so the loads stride
+// within the tile only.
+template <int kComponents>
+void Deinterleave(const float* tile, size_t count, size_t num_channels,
+                  size_t channel_samples, float* output) {
+  size_t per_channel = count / num_channels;
+  for (size_t channel = 0; channel < num_channels; ++channel) {
+    const float* src = tile + channel * kComponents;
+    float* dst = output + channel * channel_samples * kComponents;
+    for (size_t i = 0; i < per_channel; ++i) {
+      for (int k = 0; k < kComponents; ++k) {
+        dst[i * kComponents + k] = src[i * num_channels * kComponents + k];
+      }
+    }
+  }
+}
+
+}  // namespace
+
+RadarReturnCode GetSampleLayout(const RadarBurstFormat& format,
+                                SampleLayout& layout) {
+  switch (format.sample_data_type) {
+    case RSAMPLE_DTYPE_INT:
+    case RSAMPLE_DTYPE_UINT:
+    case RSAMPLE_DTYPE_FLOAT:
+      layout.components = 1;
+      break;
+    case RSAMPLE_DTYPE_CINT:
+    case RSAMPLE_DTYPE_CUINT:
+    case RSAMPLE_DTYPE_CFLOAT:
+      layout.components = 2;
+      break;
+    default:
+      return RC_UNSUPPORTED;
+  }
+  if (format.bits_per_sample == 0 ||
+      format.bits_per_sample % layout.components != 0) {
+    return RC_UNSUPPORTED;
+  }
+  layout.bits = format.bits_per_sample / layout.components;
+  layout.is_signed = format.sample_data_type == RSAMPLE_DTYPE_INT ||
+                     format.sample_data_type == RSAMPLE_DTYPE_CINT;
+  layout.is_float = format.sample_data_type == RSAMPLE_DTYPE_FLOAT ||
+                    format.sample_data_type == RSAMPLE_DTYPE_CFLOAT;
+  layout.is_big_endian = format.is_big_endian != 0;
+  layout.is_packed = false;
+
+  if (format.sample_packing == RSAMPLE_PACKING_PACKED) {
+    if (layout.is_float) {
+      return RC_UNSUPPORTED;
+    }
+    // Packed whole bytes are laid out the same as padded ones.
+    layout.is_packed = layout.bits != 8 && layout.bits != 16 &&
+                       layout.bits != 32;
+  } else if (format.sample_packing != RSAMPLE_PACKING_PADDED) {
+    return RC_UNSUPPORTED;
+  }
+
+  if (layout.is_float) {
+    if (layout.bits != 32 && layout.bits != 64) {
+      return RC_UNSUPPORTED;
+    }
+    layout.container_bytes = layout.bits / 8;
+  } else if (layout.bits <= 8) {
+    layout.container_bytes = 1;
+  } else if (layout.bits <= 16) {
+    layout.container_bytes = 2;
+  } else if (layout.bits <= 32) {
+    layout.container_bytes = 4;
+  } else {
+    return RC_UNSUPPORTED;
+  }
+  return RC_OK;
+}
+
+size_t GetNumSamples(const RadarBurstFormat& format, size_t size_bytes) {
+  SampleLayout layout;
+  if (GetSampleLayout(format, layout) != RC_OK) {
+    return 0;
+  }
+  if (layout.is_packed) {
+    return size_bytes * 8 / layout.bits / layout.components;
+  }
+  return size_bytes / (layout.container_bytes * layout.components);
+}
+
+RadarReturnCode UnpackSamples(const RadarBurstFormat& format,
+                              const uint8_t* data, size_t size_bytes,
+                              float* output, float scale) {
+  SampleLayout layout;
+  size_t num_samples = 0;
+  RadarReturnCode rc = CheckBurst(format, data, size_bytes, output, layout,
+                                  num_samples);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  UnpackComponents(layout, data, num_samples * layout.components, output,
+                   scale);
+  return RC_OK;
+}
+
+RadarReturnCode UnpackSamplesPlanar(const RadarBurstFormat& format,
+                                    const uint8_t* data, size_t size_bytes,
+                                    float* output, float scale) {
+  if (!format.is_channels_interleaved || format.num_channels <= 1) {
+    return UnpackSamples(format, data, size_bytes, output, scale);
+  }
+  SampleLayout layout;
+  size_t num_samples = 0;
+  RadarReturnCode rc = CheckBurst(format, data, size_bytes, output, layout,
+                                  num_samples);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  size_t num_channels = format.num_channels;
+  if (num_samples % num_channels != 0) {
+    return RC_BAD_INPUT;
+  }
+
+  // Tiles start on a byte for the packed layouts and hold whole samples of
+  // every channel.
+  const size_t tile_step = 8 * num_channels;
+  const size_t tile_samples = kTileSamples / tile_step * tile_step;
+  const size_t channel_samples = num_samples / num_channels;
+  float tile[kTileSamples * 2];
+  for (size_t start = 0; start < num_samples; start += tile_samples) {
+    size_t count = std::min(tile_samples, num_samples - start);
+    size_t offset = layout.is_packed
+                        ? start * layout.components * layout.bits / 8
+                        : start * layout.components * layout.container_bytes;
+    UnpackComponents(layout, data + offset, count * layout.components, tile,
+                     scale);
+    float* dst = output + start / num_channels * layout.components;
+    if (layout.components == 2) {
+      Deinterleave<2>(tile, count, num_channels, channel_samples, dst);
+    } else {
+      Deinterleave<1>(tile, count, num_channels, channel_samples, dst);
+    }
+  }
+  return RC_OK;
+}
+
+RadarReturnCode UnpackSamples(const RadarBurstFormat& format,
+                              const std::vector<uint8_t>& data,
+                              std::vector<float>& output, float scale) {
+  SampleLayout layout;
+  RadarReturnCode rc = GetSampleLayout(format, layout);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (layout.components != 1) {
+    return RC_BAD_INPUT;
+  }
+  output.resize(GetNumSamples(format, data.size()));
+  return UnpackSamples(format, data.data(), data.size(), output.data(),
+                       scale);
+}
+
+RadarReturnCode UnpackSamples(const RadarBurstFormat& format,
+                              const std::vector<uint8_t>& data,
+                              std::vector<std::complex<float>>& output,
+                              float scale) {
+  SampleLayout layout;
+  RadarReturnCode rc = GetSampleLayout(format, layout);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (layout.components != 2) {
+    return RC_BAD_INPUT;
+  }
+  output.resize(GetNumSamples(format, data.size()));
+  // std::complex<float> is laid out as an array of two floats.
+  return UnpackSamples(format, data.data(), data.size(),
+                       reinterpret_cast<float*>(output.data()), scale);
+}
+
+RadarReturnCode UnpackSamplesPlanar(const RadarBurstFormat& format,
+                                    const std::vector<uint8_t>& data,
+                                    std::vector<std::complex<float>>& output,
+                                    float scale) {
+  SampleLayout layout;
+  RadarReturnCode rc = GetSampleLayout(format, layout);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (layout.components != 2) {
+    return RC_BAD_INPUT;
+  }
+  output.resize(GetNumSamples(format, data.size()));
+  return UnpackSamplesPlanar(format, data.data(), data.size(),
+                             reinterpret_cast<float*>(output.data()), scale);
+}
+
+}  // namespace radar_dsp
@@ -0,0 +1,144 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Conversion of raw burst samples into float samples.
+ *
+ * @details Decodes burst data of any RadarBurstFormat sample data type into
+ *          float samples, or complex float samples for the complex types,
+ *          keeping the order of the samples in the burst, or planar with one
+ *          contiguous run per channel. The conversion is vectorized for the
+ *          instruction set returned by GetSimdLevel.
+ *
+ *          Integer components narrower than their container are expected in
+ *          the least significant bits, padded up to 8, 16 or 32 bits, unless
+ *          the burst is RSAMPLE_PACKING_PACKED. Signed ones are sign-extended
+ *          from bits_per_sample.
+ *
+ * Example:
+ * ```
+ *   std::vector<std::complex<float>> samples;
+ *   RadarReturnCode rc = radar_dsp::UnpackSamples(format, raw_radar_data,
+ *                                                 samples);
+ * ```
+ */
+#ifndef RIPPLE_RADAR_DSP_SAMPLEUNPACK_HPP_
+#define RIPPLE_RADAR_DSP_SAMPLEUNPACK_HPP_
+
+#include <RadarCommon.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace radar_dsp {
+
+//! How a sample component is stored in the burst data.
+struct SampleLayout {
+  //! Number of components per sample, 2 for the complex types.
+  uint8_t components;
+  //! Size of a padded component in the burst data.
+  uint8_t container_bytes;
+  //! Number of significant bits of a component.
+  uint8_t bits;
+  bool is_signed;
+  bool is_float;
+  bool is_big_endian;
+  //! Set when components are packed without padding.
+  bool is_packed;
+};
+
+/**
+ * @brief Get the layout of the samples described by a burst format.
+ *
+ * @details For the complex types bits_per_sample covers both the real and
+ *          the imaginary part.
+ *
+ * @param format the burst format.
+ * @param layout where the sample layout will be written into.
+ *
+ * @return RC_OK or RC_UNSUPPORTED if the samples can not be unpacked.
+ */
+RadarReturnCode GetSampleLayout(const RadarBurstFormat& format,
+                                SampleLayout& layout);
+
+/**
+ * @brief Get the number of samples in a burst.
+ *
+ * @param format the burst format.
+ * @param size_bytes the size of the burst data.
+ *
+ * @return the number of samples or 0 if the format is unsupported.
+ */
+size_t GetNumSamples(const RadarBurstFormat& format, size_t size_bytes);
+
+/**
+ * @brief Unpack burst data into float components.
+ *
+ * @param format the burst format.
+ * @param data the burst data.
+ * @param size_bytes the size of the burst data.
+ * @param output where GetNumSamples times components floats will be written.
+ * @param scale a factor every component is multiplied by.
+ *
+ * @return RC_OK, RC_UNSUPPORTED if the format can not be unpacked,
+ *         RC_BAD_INPUT if the size does not hold whole samples.
+ */
+RadarReturnCode UnpackSamples(const RadarBurstFormat& format,
+                              const uint8_t* data, size_t size_bytes,
+                              float* output, float scale = 1.0f);
+
+/**
+ * @brief Unpack burst data of a real sample data type.
+ *
+ * @return same as above, RC_BAD_INPUT for the complex types.
+ */
+RadarReturnCode UnpackSamples(const RadarBurstFormat& format,
+                              const std::vector<uint8_t>& data,
+                              std::vector<float>& output,
+                              float scale = 1.0f);
+
+/**
+ * @brief Unpack burst data of a complex sample data type.
+ *
+ * @return same as above, RC_BAD_INPUT for the real types.
+ */
+RadarReturnCode UnpackSamples(const RadarBurstFormat& format,
+                              const std::vector<uint8_t>& data,
+                              std::vector<std::complex<float>>& output,
+                              float scale = 1.0f);
+
+/**
+ * @brief Unpack burst data into one contiguous run per channel.
+ *
+ * @details Samples of bursts with is_channels_interleaved set are converted
+ *          in tiles that fit into L1 and scattered to their channel from
+ *          there, which saves a separate pass of TransposeToCube. Other
+ *          bursts are already planar and unpacked as by UnpackSamples.
+ *
+ * @param format the burst format.
+ * @param data the burst data.
+ * @param size_bytes the size of the burst data.
+ * @param output where GetNumSamples times components floats will be written.
+ * @param scale a factor every component is multiplied by.
+ *
+ * @return same as UnpackSamples, RC_BAD_INPUT if the samples can not be
+ *         split evenly between the channels.
+ */
+RadarReturnCode UnpackSamplesPlanar(const RadarBurstFormat& format,
+                                    const uint8_t* data, size_t size_bytes,
+                                    float* output, float scale = 1.0f);
+
+/**
+ * @brief Unpack burst data of a complex sample data type per channel.
+ *
+ * @return same as above, RC_BAD_INPUT for the real types.
+ */
+RadarReturnCode UnpackSamplesPlanar(const RadarBurstFormat& format,
+                                    const std::vector<uint8_t>& data,
+                                    std::vector<std::complex<float>>& output,
+                                    float scale = 1.0f);
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_SAMPLEUNPACK_HPP_
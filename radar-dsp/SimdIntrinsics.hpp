@@ -0,0 +1,24 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Includes the x86 intrinsics used by the SIMD kernels.
+ *
+ * @note Only to be included by kernel sources when RADAR_DSP_HAS_X86_SIMD
+ *       is defined.
+ */
+#ifndef RIPPLE_RADAR_DSP_SIMDINTRINSICS_HPP_
+#define RIPPLE_RADAR_DSP_SIMDINTRINSICS_HPP_
+
+#if defined(__GNUC__) && !defined(__clang__)
+// The AVX-512 intrinsics of some GCC versions start from undefined vectors,
+// which is reported as an uninitialized use once they are inlined.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+#else
+#include <immintrin.h>
+#endif
+
+#endif  // RIPPLE_RADAR_DSP_SIMDINTRINSICS_HPP_
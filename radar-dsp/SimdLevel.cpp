@@ -0,0 +1,67 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <SimdLevel.hpp>
+
+#include <atomic>
+
+namespace radar_dsp {
+
+namespace {
+
+// The level set by SetSimdLevel, or -1 when not set.
+std::atomic<int> forced_level(-1);
+
+}  // namespace
+
+SimdLevel DetectSimdLevel(void) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  static const SimdLevel detected = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512vl")) {
+      return SimdLevel::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+      return SimdLevel::kAvx2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+      return SimdLevel::kSse41;
+    }
+    return SimdLevel::kScalar;
+  }();
+  return detected;
+#else
+  return SimdLevel::kScalar;
+#endif
+}
+
+SimdLevel GetSimdLevel(void) {
+  int level = forced_level.load(std::memory_order_relaxed);
+  return level < 0 ? DetectSimdLevel() : static_cast<SimdLevel>(level);
+}
+
+void SetSimdLevel(SimdLevel level) {
+  SimdLevel detected = DetectSimdLevel();
+  if (level > detected) {
+    level = detected;
+  }
+  forced_level.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+const char* GetSimdLevelName(SimdLevel level) {
+  switch (level) {
+    case SimdLevel::kScalar:
+      return "scalar";
+    case SimdLevel::kSse41:
+      return "SSE4.1";
+    case SimdLevel::kAvx2:
+      return "AVX2";
+    case SimdLevel::kAvx512:
+      return "AVX-512";
+  }
+  return "unknown";
+}
+
+}  // namespace radar_dsp
@@ -0,0 +1,61 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Runtime selection of the SIMD instruction set used by the kernels.
+ *
+ * @details Kernels are built for every supported instruction set with
+ *          function target attributes and the best one for the running CPU
+ *          is picked at runtime, so binaries do not need -march flags.
+ */
+#ifndef RIPPLE_RADAR_DSP_SIMDLEVEL_HPP_
+#define RIPPLE_RADAR_DSP_SIMDLEVEL_HPP_
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+//! Set when x86 SIMD kernels are built.
+#define RADAR_DSP_HAS_X86_SIMD 1
+#define RADAR_DSP_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define RADAR_DSP_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define RADAR_DSP_TARGET_AVX512 \
+  __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma")))
+#endif
+
+namespace radar_dsp {
+
+//! Instruction sets, in increasing order of capability.
+enum class SimdLevel {
+  kScalar,
+  kSse41,
+  kAvx2,
+  kAvx512,
+};
+
+/**
+ * @brief Get the best instruction set supported by the CPU.
+ */
+SimdLevel DetectSimdLevel(void);
+
+/**
+ * @brief Get the instruction set used by the kernels.
+ *
+ * @details The detected level unless lowered by SetSimdLevel.
+ */
+SimdLevel GetSimdLevel(void);
+
+/**
+ * @brief Limit the instruction set used by the kernels.
+ *
+ * @details Meant for benchmarks and for checking the SIMD kernels against
+ *          the scalar ones. Levels not supported by the CPU are lowered to
+ *          the detected one.
+ *
+ * @param level the maximum level to use.
+ */
+void SetSimdLevel(SimdLevel level);
+
+//! Get a printable name of the level.
+const char* GetSimdLevelName(SimdLevel level);
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_SIMDLEVEL_HPP_
@@ -0,0 +1,451 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <SweepProcessor.hpp>
+
+#include <SamplePacking.hpp>
+#include <SampleUnpack.hpp>
+#include <SimdLevel.hpp>
+
+#include <algorithm>
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+#include <SimdIntrinsics.hpp>
+#endif
+
+namespace radar_dsp {
+
+namespace {
+
+// Rows are padded to the widest vector.
+const size_t kRowAlignment = 16;
+
+// Correlate a row with a pulse, y[n] = sum_j conj(h[j]) x[n + j], where x
+// is padded so that x[n + j] lines up the center of the pulse with n.
+//
+// x_re, x_im: num_outputs + num_taps - 1 components, a multiple of the
+//             vector width past num_outputs readable.
+// h_re, h_im: num_taps components of the pulse.
+// y_re, y_im: num_outputs components, a multiple of the vector width.
+//
+// Subtract the background from a row and integrate its energy,
+// o = y - b, b += weight * o, energy += |o|^2, y = o.
+struct ScalarKernel {
+  static void Correlate(const float* x_re, const float* x_im,
+                        const float* h_re, const float* h_im,
+                        size_t num_taps, size_t num_outputs, float* y_re,
+                        float* y_im) {
+    for (size_t n = 0; n < num_outputs; ++n) {
+      float re = 0.0f, im = 0.0f;
+      for (size_t j = 0; j < num_taps; ++j) {
+        re += h_re[j] * x_re[n + j] + h_im[j] * x_im[n + j];
+        im += h_re[j] * x_im[n + j] - h_im[j] * x_re[n + j];
+      }
+      y_re[n] = re;
+      y_im[n] = im;
+    }
+  }
+
+  static void Subtract(float* y_re, float* y_im, float* b_re, float* b_im,
+                       float weight, float* energy, size_t size) {
+    for (size_t n = 0; n < size; ++n) {
+      float re = y_re[n] - b_re[n];
+      float im = y_im[n] - b_im[n];
+      b_re[n] += weight * re;
+      b_im[n] += weight * im;
+      energy[n] += re * re + im * im;
+      y_re[n] = re;
+      y_im[n] = im;
+    }
+  }
+};
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+
+struct Sse41Kernel {
+  RADAR_DSP_TARGET_SSE41 static void Correlate(
+      const float* x_re, const float* x_im, const float* h_re,
+      const float* h_im, size_t num_taps, size_t num_outputs, float* y_re,
+      float* y_im) {
+    for (size_t n = 0; n < num_outputs; n += 4) {
+      __m128 re = _mm_setzero_ps();
+      __m128 im = _mm_setzero_ps();
+      for (size_t j = 0; j < num_taps; ++j) {
+        __m128 hr = _mm_set1_ps(h_re[j]);
+        __m128 hi = _mm_set1_ps(h_im[j]);
+        __m128 xr = _mm_loadu_ps(x_re + n + j);
+        __m128 xi = _mm_loadu_ps(x_im + n + j);
+        re = _mm_add_ps(re, _mm_add_ps(_mm_mul_ps(hr, xr),
+                                       _mm_mul_ps(hi, xi)));
+        im = _mm_add_ps(im, _mm_sub_ps(_mm_mul_ps(hr, xi),
+                                       _mm_mul_ps(hi, xr)));
+      }
+      _mm_storeu_ps(y_re + n, re);
+      _mm_storeu_ps(y_im + n, im);
+    }
+  }
+
+  RADAR_DSP_TARGET_SSE41 static void Subtract(
+      float* y_re, float* y_im, float* b_re, float* b_im, float weight,
+      float* energy, size_t size) {
+    __m128 w = _mm_set1_ps(weight);
+    for (size_t n = 0; n < size; n += 4) {
+      __m128 br = _mm_loadu_ps(b_re + n);
+      __m128 bi = _mm_loadu_ps(b_im + n);
+      __m128 re = _mm_sub_ps(_mm_loadu_ps(y_re + n), br);
+      __m128 im = _mm_sub_ps(_mm_loadu_ps(y_im + n), bi);
+      _mm_storeu_ps(b_re + n, _mm_add_ps(br, _mm_mul_ps(w, re)));
+      _mm_storeu_ps(b_im + n, _mm_add_ps(bi, _mm_mul_ps(w, im)));
+      __m128 power = _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+      _mm_storeu_ps(energy + n, _mm_add_ps(_mm_loadu_ps(energy + n), power));
+      _mm_storeu_ps(y_re + n, re);
+      _mm_storeu_ps(y_im + n, im);
+    }
+  }
+};
+
+struct Avx2Kernel {
+  RADAR_DSP_TARGET_AVX2 static void Correlate(
+      const float* x_re, const float* x_im, const float* h_re,
+      const float* h_im, size_t num_taps, size_t num_outputs, float* y_re,
+      float* y_im) {
+    for (size_t n = 0; n < num_outputs; n += 8) {
+      __m256 re = _mm256_setzero_ps();
+      __m256 im = _mm256_setzero_ps();
+      for (size_t j = 0; j < num_taps; ++j) {
+        __m256 hr = _mm256_set1_ps(h_re[j]);
+        __m256 hi = _mm256_set1_ps(h_im[j]);
+        __m256 xr = _mm256_loadu_ps(x_re + n + j);
+        __m256 xi = _mm256_loadu_ps(x_im + n + j);
+        re = _mm256_fmadd_ps(hr, xr, _mm256_fmadd_ps(hi, xi, re));
+        im = _mm256_fnmadd_ps(hi, xr, _mm256_fmadd_ps(hr, xi, im));
+      }
+      _mm256_storeu_ps(y_re + n, re);
+      _mm256_storeu_ps(y_im + n, im);
+    }
+  }
+
+  RADAR_DSP_TARGET_AVX2 static void Subtract(
+      float* y_re, float* y_im, float* b_re, float* b_im, float weight,
+      float* energy, size_t size) {
+    __m256 w = _mm256_set1_ps(weight);
+    for (size_t n = 0; n < size; n += 8) {
+      __m256 br = _mm256_loadu_ps(b_re + n);
+      __m256 bi = _mm256_loadu_ps(b_im + n);
+      __m256 re = _mm256_sub_ps(_mm256_loadu_ps(y_re + n), br);
+      __m256 im = _mm256_sub_ps(_mm256_loadu_ps(y_im + n), bi);
+      _mm256_storeu_ps(b_re + n, _mm256_fmadd_ps(w, re, br));
+      _mm256_storeu_ps(b_im + n, _mm256_fmadd_ps(w, im, bi));
+      __m256 sum = _mm256_fmadd_ps(re, re, _mm256_loadu_ps(energy + n));
+      _mm256_storeu_ps(energy + n, _mm256_fmadd_ps(im, im, sum));
+      _mm256_storeu_ps(y_re + n, re);
+      _mm256_storeu_ps(y_im + n, im);
+    }
+  }
+};
+
+struct Avx512Kernel {
+  RADAR_DSP_TARGET_AVX512 static void Correlate(
+      const float* x_re, const float* x_im, const float* h_re,
+      const float* h_im, size_t num_taps, size_t num_outputs, float* y_re,
+      float* y_im) {
+    for (size_t n = 0; n < num_outputs; n += 16) {
+      __m512 re = _mm512_setzero_ps();
+      __m512 im = _mm512_setzero_ps();
+      for (size_t j = 0; j < num_taps; ++j) {
+        __m512 hr = _mm512_set1_ps(h_re[j]);
+        __m512 hi = _mm512_set1_ps(h_im[j]);
+        __m512 xr = _mm512_loadu_ps(x_re + n + j);
+        __m512 xi = _mm512_loadu_ps(x_im + n + j);
+        re = _mm512_fmadd_ps(hr, xr, _mm512_fmadd_ps(hi, xi, re));
+        im = _mm512_fnmadd_ps(hi, xr, _mm512_fmadd_ps(hr, xi, im));
+      }
+      _mm512_storeu_ps(y_re + n, re);
+      _mm512_storeu_ps(y_im + n, im);
+    }
+  }
+
+  RADAR_DSP_TARGET_AVX512 static void Subtract(
+      float* y_re, float* y_im, float* b_re, float* b_im, float weight,
+      float* energy, size_t size) {
+    __m512 w = _mm512_set1_ps(weight);
+    for (size_t n = 0; n < size; n += 16) {
+      __m512 br = _mm512_loadu_ps(b_re + n);
+      __m512 bi = _mm512_loadu_ps(b_im + n);
+      __m512 re = _mm512_sub_ps(_mm512_loadu_ps(y_re + n), br);
+      __m512 im = _mm512_sub_ps(_mm512_loadu_ps(y_im + n), bi);
+      _mm512_storeu_ps(b_re + n, _mm512_fmadd_ps(w, re, br));
+      _mm512_storeu_ps(b_im + n, _mm512_fmadd_ps(w, im, bi));
+      __m512 sum = _mm512_fmadd_ps(re, re, _mm512_loadu_ps(energy + n));
+      _mm512_storeu_ps(energy + n, _mm512_fmadd_ps(im, im, sum));
+      _mm512_storeu_ps(y_re + n, re);
+      _mm512_storeu_ps(y_im + n, im);
+    }
+  }
+};
+
+#endif  // RADAR_DSP_HAS_X86_SIMD
+
+void Correlate(const float* x_re, const float* x_im, const float* h_re,
+               const float* h_im, size_t num_taps, size_t num_outputs,
+               float* y_re, float* y_im) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::Correlate(x_re, x_im, h_re, h_im, num_taps, num_outputs,
+                              y_re, y_im);
+      return;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::Correlate(x_re, x_im, h_re, h_im, num_taps, num_outputs,
+                            y_re, y_im);
+      return;
+    case SimdLevel::kSse41:
+      Sse41Kernel::Correlate(x_re, x_im, h_re, h_im, num_taps, num_outputs,
+                             y_re, y_im);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::Correlate(x_re, x_im, h_re, h_im, num_taps, num_outputs,
+                          y_re, y_im);
+}
+
+void Subtract(float* y_re, float* y_im, float* b_re, float* b_im,
+              float weight, float* energy, size_t size) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::Subtract(y_re, y_im, b_re, b_im, weight, energy, size);
+      return;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::Subtract(y_re, y_im, b_re, b_im, weight, energy, size);
+      return;
+    case SimdLevel::kSse41:
+      Sse41Kernel::Subtract(y_re, y_im, b_re, b_im, weight, energy, size);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::Subtract(y_re, y_im, b_re, b_im, weight, energy, size);
+}
+
+void Split(const std::complex<float>* samples, size_t size, float* re,
+           float* im) {
+  for (size_t n = 0; n < size; ++n) {
+    re[n] = samples[n].real();
+    im[n] = samples[n].imag();
+  }
+}
+
+void Split(const float* samples, size_t size, float* re, float* im) {
+  std::copy(samples, samples + size, re);
+  std::fill(im, im + size, 0.0f);
+}
+
+}  // namespace
+
+SweepProcessor::SweepProcessor(const SweepConfig& config) : config_(config) {
+  for (const std::complex<float>& tap : config_.pulse) {
+    pulse_re_.push_back(tap.real());
+    pulse_im_.push_back(tap.imag());
+  }
+}
+
+void SweepProcessor::SetStartOffset(uint8_t config_id,
+                                    uint32_t start_offset) {
+  GetState(config_id).start_offset = start_offset;
+}
+
+RadarReturnCode SweepProcessor::SetStartOffset(radar_api::IRadarSensor& radar,
+                                               uint8_t slot_id) {
+  SensorInfo info;
+  RadarReturnCode rc = radar.GetSensorInfo(info);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  RadarMainParam param;
+  if (info.radar_type == RTYPE_PULSED) {
+    param = {RADAR_PARAM_GROUP_PULSED, PULSED_PARAM_START_OFFSET};
+  } else if (info.radar_type == RTYPE_UWB) {
+    param = {RADAR_PARAM_GROUP_UWB, UWB_PARAM_START_OFFSET};
+  } else {
+    return RC_UNSUPPORTED;
+  }
+  uint32_t start_offset = 0;
+  rc = radar.GetMainParam(slot_id, param, start_offset);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  SetStartOffset(slot_id, start_offset);
+  return RC_OK;
+}
+
+void SweepProcessor::ResetBackground() {
+  for (auto& entry : states_) {
+    entry.second.background.clear();
+  }
+}
+
+SweepProcessor::ConfigState& SweepProcessor::GetState(uint8_t config_id) {
+  for (auto& entry : states_) {
+    if (entry.first == config_id) {
+      return entry.second;
+    }
+  }
+  states_.emplace_back(config_id, ConfigState());
+  return states_.back().second;
+}
+
+RadarReturnCode SweepProcessor::Process(uint8_t config_id,
+                                        const CubeShape& shape,
+                                        const std::complex<float>* sweeps,
+                                        GateEnergy& gates) {
+  return ProcessSweeps(config_id, shape, sweeps, gates);
+}
+
+RadarReturnCode SweepProcessor::Process(uint8_t config_id,
+                                        const CubeShape& shape,
+                                        const float* sweeps,
+                                        GateEnergy& gates) {
+  return ProcessSweeps(config_id, shape, sweeps, gates);
+}
+
+template <typename Sample>
+RadarReturnCode SweepProcessor::ProcessSweeps(uint8_t config_id,
+                                              const CubeShape& shape,
+                                              const Sample* sweeps,
+                                              GateEnergy& gates) {
+  if (shape.Size() == 0 || sweeps == nullptr || config_.gate_bins == 0 ||
+      !(config_.background_weight >= 0.0f &&
+        config_.background_weight <= 1.0f)) {
+    return RC_BAD_INPUT;
+  }
+  ConfigState& state = GetState(config_id);
+  const size_t num_channels = shape.num_channels;
+  const size_t num_sweeps = shape.num_chirps;
+  const size_t num_samples = shape.num_samples;
+  const size_t stride = (num_samples + kRowAlignment - 1) / kRowAlignment *
+                        kRowAlignment;
+  const size_t num_taps = pulse_re_.size();
+  // Taps before the center of the pulse, which lines up with the output.
+  const size_t lead = num_taps > 0 ? (num_taps - 1) / 2 : 0;
+  const size_t padded = stride + (num_taps > 0 ? num_taps - 1 : 0);
+  const float weight = config_.background_weight;
+
+  // Without a subtraction the background stays zero.
+  const bool init_background =
+      state.background.size() != 2 * num_channels * stride;
+  if (init_background) {
+    state.background.assign(2 * num_channels * stride, 0.0f);
+  }
+  input_.assign(2 * padded, 0.0f);
+  output_.assign(2 * stride, 0.0f);
+  energy_.assign(num_channels * stride, 0.0f);
+  sweeps_.resize(shape.Size());
+  float* x_re = input_.data();
+  float* x_im = x_re + padded;
+  float* y_re = output_.data();
+  float* y_im = y_re + stride;
+
+  for (size_t channel = 0; channel < num_channels; ++channel) {
+    float* b_re = &state.background[2 * channel * stride];
+    float* b_im = b_re + stride;
+    float* energy = &energy_[channel * stride];
+    for (size_t sweep = 0; sweep < num_sweeps; ++sweep) {
+      const size_t row = channel * num_sweeps + sweep;
+      const Sample* samples = sweeps + row * num_samples;
+      if (num_taps > 0) {
+        Split(samples, num_samples, x_re + lead, x_im + lead);
+        Correlate(x_re, x_im, pulse_re_.data(), pulse_im_.data(), num_taps,
+                  stride, y_re, y_im);
+        // The pulse tails spill into the padding.
+        std::fill(y_re + num_samples, y_re + stride, 0.0f);
+        std::fill(y_im + num_samples, y_im + stride, 0.0f);
+      } else {
+        Split(samples, num_samples, y_re, y_im);
+      }
+      if (init_background && sweep == 0 && weight > 0.0f) {
+        std::copy(y_re, y_re + stride, b_re);
+        std::copy(y_im, y_im + stride, b_im);
+      }
+      Subtract(y_re, y_im, b_re, b_im, weight, energy, stride);
+
+      std::complex<float>* output = &sweeps_[row * num_samples];
+      for (size_t n = 0; n < num_samples; ++n) {
+        output[n] = std::complex<float>(y_re[n], y_im[n]);
+      }
+    }
+  }
+
+  // Gates are aligned on the range bins from the pulse.
+  const size_t gate_bins = config_.gate_bins;
+  const size_t first_bin = state.start_offset;
+  const size_t first_gate = first_bin / gate_bins;
+  const size_t num_gates =
+      (first_bin + num_samples - 1) / gate_bins - first_gate + 1;
+  gates.num_channels = static_cast<uint32_t>(num_channels);
+  gates.num_gates = static_cast<uint32_t>(num_gates);
+  gates.first_gate = static_cast<uint32_t>(first_gate);
+  gates.energy.assign(num_channels * num_gates, 0.0f);
+  for (size_t channel = 0; channel < num_channels; ++channel) {
+    const float* energy = &energy_[channel * stride];
+    float* gate_energy = &gates.energy[channel * num_gates];
+    for (size_t n = 0; n < num_samples; ++n) {
+      gate_energy[(first_bin + n) / gate_bins - first_gate] += energy[n];
+    }
+  }
+  return RC_OK;
+}
+
+RadarReturnCode SweepProcessor::Process(const RadarBurstFormat& format,
+                                        const uint8_t* data,
+                                        size_t size_bytes,
+                                        GateEnergy& gates) {
+  if (format.radar_type != RTYPE_PULSED && format.radar_type != RTYPE_UWB) {
+    return RC_UNSUPPORTED;
+  }
+  CubeShape shape;
+  SampleLayout layout;
+  RadarReturnCode rc = GetCubeShape(format, shape);
+  if (rc == RC_OK) {
+    rc = GetSampleLayout(format, layout);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (shape.Size() == 0 ||
+      GetBurstBytes(format, shape.Size()) != size_bytes) {
+    return RC_BAD_INPUT;
+  }
+  bool is_complex = layout.components == 2;
+
+  // Packed bursts may unpack into an extra sample from their padding.
+  samples_.resize(GetNumSamples(format, size_bytes) * layout.components);
+  rc = UnpackSamples(format, data, size_bytes, samples_.data());
+  if (rc != RC_OK) {
+    return rc;
+  }
+  const float* sweeps = samples_.data();
+  if (GetBurstLayout(format) != CubeLayout::kChannelChirpSample) {
+    cube_.resize(shape.Size() * layout.components);
+    if (is_complex) {
+      TransposeToCube(
+          format, reinterpret_cast<const std::complex<float>*>(sweeps),
+          shape.Size(), reinterpret_cast<std::complex<float>*>(
+              cube_.data()), CubeLayout::kChannelChirpSample);
+    } else {
+      TransposeToCube(format, sweeps, shape.Size(), cube_.data(),
+                      CubeLayout::kChannelChirpSample);
+    }
+    sweeps = cube_.data();
+  }
+  if (is_complex) {
+    return Process(format.config_id, shape,
+                   reinterpret_cast<const std::complex<float>*>(sweeps),
+                   gates);
+  }
+  return Process(format.config_id, shape, sweeps, gates);
+}
+
+}  // namespace radar_dsp
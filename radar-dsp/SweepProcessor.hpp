@@ -0,0 +1,183 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Sweep processing of pulsed and UWB bursts.
+ *
+ * @details Impulse radars sample the echo of every pulse directly, so
+ *          the samples of a sweep are range bins already. Every sweep is
+ *          correlated with the pulse template, a matched filter aligned so
+ *          sample n stays range bin n. The static background of every
+ *          channel and range bin is then tracked with an exponential average
+ *          across sweeps and bursts, and subtracted. What is left is summed as
+ *          energy per range gate over the sweeps of the burst.
+ *
+ *          Sweeps start start_offset samples after the pulse, as set with
+ *          PULSED_PARAM_START_OFFSET or UWB_PARAM_START_OFFSET. Sample i of
+ *          a sweep is range bin start_offset + i, and gates are aligned on
+ *          these absolute range bins, so gates keep their range whatever
+ *          the offset of the config.
+ *
+ *          Every row is split into real and imaginary parts, filtered,
+ *          background subtracted and integrated by SIMD kernels while it is
+ *          in L1. The start offset and background are kept per config_id.
+ *
+ *          An instance holds scratch buffers and must be used by one thread
+ *          at a time.
+ *
+ * Example:
+ * ```
+ *   radar_dsp::SweepConfig config;
+ *   config.pulse = pulse_template;
+ *   radar_dsp::SweepProcessor processor(config);
+ *   processor.SetStartOffset(*radar, slot_id);
+ *   radar_dsp::GateEnergy gates;
+ *   RadarReturnCode rc = processor.Process(format, raw_radar_data.data(),
+ *                                          raw_radar_data.size(), gates);
+ * ```
+ */
+#ifndef RIPPLE_RADAR_DSP_SWEEPPROCESSOR_HPP_
+#define RIPPLE_RADAR_DSP_SWEEPPROCESSOR_HPP_
+
+#include <IRadarSensor.hpp>
+#include <RadarCommon.h>
+
+#include <RadarCube.hpp>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace radar_dsp {
+
+struct SweepConfig {
+  //! Pulse template the sweeps are correlated with, none to skip
+  //! the matched filter.
+  std::vector<std::complex<float>> pulse;
+  //! Weight of every sweep in the background average, between 0 and 1,
+  //! 0 to keep the background.
+  float background_weight = 0.05f;
+  //! Range bins per gate.
+  uint32_t gate_bins = 1;
+};
+
+//! Energy of the range gates of a burst.
+struct GateEnergy {
+  uint32_t num_channels;
+  uint32_t num_gates;
+  //! Absolute index of the first gate, gate g covering range bins from
+  //! (first_gate + g) * gate_bins.
+  uint32_t first_gate;
+  //! Energy laid out as channel x gate.
+  std::vector<float> energy;
+};
+
+class SweepProcessor {
+ public:
+  explicit SweepProcessor(const SweepConfig& config = SweepConfig());
+
+  const SweepConfig& GetConfig() const {
+    return config_;
+  }
+
+  /**
+   * @brief Set the start offset of the sweeps of a config.
+   *
+   * @param config_id the config_id of the bursts.
+   * @param start_offset the range bin of the first sample of every sweep.
+   */
+  void SetStartOffset(uint8_t config_id, uint32_t start_offset);
+
+  /**
+   * @brief Read the start offset of a config slot of a pulsed or UWB radar.
+   *
+   * @details The config_id of the bursts is expected to be the slot_id.
+   *
+   * @return RC_OK, RC_UNSUPPORTED for other radar types, or the error of
+   *         the radar.
+   */
+  RadarReturnCode SetStartOffset(radar_api::IRadarSensor& radar,
+                                 uint8_t slot_id);
+
+  //! Forget the backgrounds of all configs.
+  void ResetBackground();
+
+  /**
+   * @brief Process the sweeps of a burst.
+   *
+   * @param config_id the config_id of the burst.
+   * @param shape the dimensions of the sweeps.
+   * @param sweeps the samples laid out as CubeLayout::kChannelChirpSample.
+   * @param gates where the gate energy will be written into.
+   *
+   * @return RC_OK or RC_BAD_INPUT for an empty shape, a null buffer, no gate
+   *         bins or a background weight outside [0, 1].
+   */
+  RadarReturnCode Process(uint8_t config_id, const CubeShape& shape,
+                          const std::complex<float>* sweeps,
+                          GateEnergy& gates);
+
+  //! Same as above for real samples.
+  RadarReturnCode Process(uint8_t config_id, const CubeShape& shape,
+                          const float* sweeps, GateEnergy& gates);
+
+  /**
+   * @brief Unpack a pulsed or UWB burst and process its sweeps.
+   *
+   * @param format the burst format.
+   * @param data the burst data.
+   * @param size_bytes the size of the burst data.
+   * @param gates where the gate energy will be written into.
+   *
+   * @return RC_OK, RC_UNSUPPORTED for FMCW bursts or formats that can not
+   *         be unpacked, RC_BAD_INPUT if the size does not match the format.
+   */
+  RadarReturnCode Process(const RadarBurstFormat& format, const uint8_t* data,
+                          size_t size_bytes, GateEnergy& gates);
+
+  /**
+   * @brief Get the sweeps of the last burst after filtering and background
+   *        subtraction.
+   *
+   * @details Laid out as CubeLayout::kChannelChirpSample, with the shape of
+   *          the sweeps of the burst.
+   */
+  const std::vector<std::complex<float>>& GetSweeps() const {
+    return sweeps_;
+  }
+
+ private:
+  // State of the bursts of one config.
+  struct ConfigState {
+    uint32_t start_offset = 0;
+    //! Background of every channel, split real and imaginary rows of
+    //! stride samples each, empty until the first burst.
+    std::vector<float> background;
+    uint32_t num_channels = 0;
+    size_t stride = 0;
+  };
+
+  ConfigState& GetState(uint8_t config_id);
+  template <typename Sample>
+  RadarReturnCode ProcessSweeps(uint8_t config_id, const CubeShape& shape,
+                                const Sample* sweeps, GateEnergy& gates);
+
+  SweepConfig config_;
+  //! Pulse template split into real and imaginary parts.
+  std::vector<float> pulse_re_;
+  std::vector<float> pulse_im_;
+  //! States of the configs, few enough for a linear search.
+  std::vector<std::pair<uint8_t, ConfigState>> states_;
+  std::vector<std::complex<float>> sweeps_;
+  std::vector<float> samples_;
+  std::vector<float> cube_;
+  //! Padded input and output rows, and the energy of every range bin.
+  std::vector<float> input_;
+  std::vector<float> output_;
+  std::vector<float> energy_;
+};
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_SWEEPPROCESSOR_HPP_
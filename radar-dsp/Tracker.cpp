@@ -0,0 +1,718 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <Tracker.hpp>
+
+#include <Fft.hpp>
+#include <RangeDoppler.hpp>
+#include <SimdLevel.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+#include <SimdIntrinsics.hpp>
+#endif
+
+namespace radar_dsp {
+
+namespace {
+
+const double kSpeedOfLight = 299792458.0;
+
+// Kernels over the arrays of n tracks. Every level evaluates the same
+// expressions, they only differ by the rounding of the multiply-adds
+// the compiler may fuse.
+//
+// Predict moves one 2 x 2 block of the state of every track, a value x, its
+// rate and their covariances, dt forward with white acceleration noise of
+// q1 = q dt, q2 = q dt^2 / 2 and q3 = q dt^3 / 3.
+//
+// Invert computes the inverse innovation covariances of the tracks from
+// their predicted covariances and the measurement variances.
+//
+// Distance computes the squared Mahalanobis distances of one detection to
+// every track.
+struct ScalarKernel {
+  static void Predict(float* x, float* rate, float* p00, float* p01,
+                      float* p11, size_t n, float dt, float q1, float q2,
+                      float q3) {
+    for (size_t i = 0; i < n; ++i) {
+      float t = p01[i] + dt * p11[i];
+      x[i] = x[i] + dt * rate[i];
+      p00[i] = (p00[i] + dt * (p01[i] + t)) + q3;
+      p01[i] = t + q2;
+      p11[i] = p11[i] + q1;
+    }
+  }
+
+  static void Invert(const float* prr, const float* prv, const float* pvv,
+                     const float* paa, size_t n, float var_r, float var_v,
+                     float var_a, float* irr, float* irv2, float* ivv,
+                     float* iaa) {
+    for (size_t i = 0; i < n; ++i) {
+      float srr = prr[i] + var_r;
+      float svv = pvv[i] + var_v;
+      float inverse = 1.0f / (srr * svv - prv[i] * prv[i]);
+      irr[i] = svv * inverse;
+      irv2[i] = -(prv[i] + prv[i]) * inverse;
+      ivv[i] = srr * inverse;
+      iaa[i] = 1.0f / (paa[i] + var_a);
+    }
+  }
+
+  static void Distance(const float* r, const float* v, const float* a,
+                       const float* irr, const float* irv2, const float* ivv,
+                       const float* iaa, size_t n, float r0, float v0,
+                       float a0, float* distances) {
+    for (size_t i = 0; i < n; ++i) {
+      float dr = r0 - r[i];
+      float dv = v0 - v[i];
+      float da = a0 - a[i];
+      distances[i] = (dr * (irr[i] * dr + irv2[i] * dv) +
+                      dv * (ivv[i] * dv)) + da * (iaa[i] * da);
+    }
+  }
+};
+
+#ifdef RADAR_DSP_HAS_X86_SIMD
+
+struct Sse41Kernel {
+  RADAR_DSP_TARGET_SSE41 static void Predict(float* x, float* rate,
+                                             float* p00, float* p01,
+                                             float* p11, size_t n, float dt,
+                                             float q1, float q2, float q3) {
+    const __m128 vdt = _mm_set1_ps(dt);
+    const __m128 vq1 = _mm_set1_ps(q1);
+    const __m128 vq2 = _mm_set1_ps(q2);
+    const __m128 vq3 = _mm_set1_ps(q3);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128 c01 = _mm_loadu_ps(p01 + i);
+      __m128 c11 = _mm_loadu_ps(p11 + i);
+      __m128 t = _mm_add_ps(c01, _mm_mul_ps(vdt, c11));
+      _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i),
+                                      _mm_mul_ps(vdt, _mm_loadu_ps(rate + i))));
+      _mm_storeu_ps(p00 + i, _mm_add_ps(
+          _mm_add_ps(_mm_loadu_ps(p00 + i),
+                     _mm_mul_ps(vdt, _mm_add_ps(c01, t))), vq3));
+      _mm_storeu_ps(p01 + i, _mm_add_ps(t, vq2));
+      _mm_storeu_ps(p11 + i, _mm_add_ps(c11, vq1));
+    }
+    ScalarKernel::Predict(x + i, rate + i, p00 + i, p01 + i, p11 + i, n - i,
+                          dt, q1, q2, q3);
+  }
+
+  RADAR_DSP_TARGET_SSE41 static void Invert(
+      const float* prr, const float* prv, const float* pvv, const float* paa,
+      size_t n, float var_r, float var_v, float var_a, float* irr,
+      float* irv2, float* ivv, float* iaa) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128 srr = _mm_add_ps(_mm_loadu_ps(prr + i), _mm_set1_ps(var_r));
+      __m128 svv = _mm_add_ps(_mm_loadu_ps(pvv + i), _mm_set1_ps(var_v));
+      __m128 srv = _mm_loadu_ps(prv + i);
+      __m128 inverse = _mm_div_ps(one, _mm_sub_ps(_mm_mul_ps(srr, svv),
+                                                  _mm_mul_ps(srv, srv)));
+      _mm_storeu_ps(irr + i, _mm_mul_ps(svv, inverse));
+      _mm_storeu_ps(irv2 + i, _mm_mul_ps(
+          _mm_sub_ps(zero, _mm_add_ps(srv, srv)), inverse));
+      _mm_storeu_ps(ivv + i, _mm_mul_ps(srr, inverse));
+      _mm_storeu_ps(iaa + i, _mm_div_ps(one, _mm_add_ps(
+          _mm_loadu_ps(paa + i), _mm_set1_ps(var_a))));
+    }
+    ScalarKernel::Invert(prr + i, prv + i, pvv + i, paa + i, n - i, var_r,
+                         var_v, var_a, irr + i, irv2 + i, ivv + i, iaa + i);
+  }
+
+  RADAR_DSP_TARGET_SSE41 static void Distance(
+      const float* r, const float* v, const float* a, const float* irr,
+      const float* irv2, const float* ivv, const float* iaa, size_t n,
+      float r0, float v0, float a0, float* distances) {
+    const __m128 vr0 = _mm_set1_ps(r0);
+    const __m128 vv0 = _mm_set1_ps(v0);
+    const __m128 va0 = _mm_set1_ps(a0);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128 dr = _mm_sub_ps(vr0, _mm_loadu_ps(r + i));
+      __m128 dv = _mm_sub_ps(vv0, _mm_loadu_ps(v + i));
+      __m128 da = _mm_sub_ps(va0, _mm_loadu_ps(a + i));
+      __m128 range = _mm_mul_ps(dr, _mm_add_ps(
+          _mm_mul_ps(_mm_loadu_ps(irr + i), dr),
+          _mm_mul_ps(_mm_loadu_ps(irv2 + i), dv)));
+      __m128 velocity = _mm_mul_ps(dv, _mm_mul_ps(_mm_loadu_ps(ivv + i), dv));
+      __m128 azimuth = _mm_mul_ps(da, _mm_mul_ps(_mm_loadu_ps(iaa + i), da));
+      _mm_storeu_ps(distances + i,
+                    _mm_add_ps(_mm_add_ps(range, velocity), azimuth));
+    }
+    ScalarKernel::Distance(r + i, v + i, a + i, irr + i, irv2 + i, ivv + i,
+                           iaa + i, n - i, r0, v0, a0, distances + i);
+  }
+};
+
+struct Avx2Kernel {
+  RADAR_DSP_TARGET_AVX2 static void Predict(float* x, float* rate,
+                                            float* p00, float* p01,
+                                            float* p11, size_t n, float dt,
+                                            float q1, float q2, float q3) {
+    const __m256 vdt = _mm256_set1_ps(dt);
+    const __m256 vq1 = _mm256_set1_ps(q1);
+    const __m256 vq2 = _mm256_set1_ps(q2);
+    const __m256 vq3 = _mm256_set1_ps(q3);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      __m256 c01 = _mm256_loadu_ps(p01 + i);
+      __m256 c11 = _mm256_loadu_ps(p11 + i);
+      __m256 t = _mm256_add_ps(c01, _mm256_mul_ps(vdt, c11));
+      _mm256_storeu_ps(x + i, _mm256_add_ps(
+          _mm256_loadu_ps(x + i), _mm256_mul_ps(vdt, _mm256_loadu_ps(
+              rate + i))));
+      _mm256_storeu_ps(p00 + i, _mm256_add_ps(
+          _mm256_add_ps(_mm256_loadu_ps(p00 + i),
+                        _mm256_mul_ps(vdt, _mm256_add_ps(c01, t))), vq3));
+      _mm256_storeu_ps(p01 + i, _mm256_add_ps(t, vq2));
+      _mm256_storeu_ps(p11 + i, _mm256_add_ps(c11, vq1));
+    }
+    Sse41Kernel::Predict(x + i, rate + i, p00 + i, p01 + i, p11 + i, n - i,
+                         dt, q1, q2, q3);
+  }
+
+  RADAR_DSP_TARGET_AVX2 static void Invert(
+      const float* prr, const float* prv, const float* pvv, const float* paa,
+      size_t n, float var_r, float var_v, float var_a, float* irr,
+      float* irv2, float* ivv, float* iaa) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      __m256 srr = _mm256_add_ps(_mm256_loadu_ps(prr + i),
+                                 _mm256_set1_ps(var_r));
+      __m256 svv = _mm256_add_ps(_mm256_loadu_ps(pvv + i),
+                                 _mm256_set1_ps(var_v));
+      __m256 srv = _mm256_loadu_ps(prv + i);
+      __m256 inverse = _mm256_div_ps(
+          one, _mm256_sub_ps(_mm256_mul_ps(srr, svv),
+                             _mm256_mul_ps(srv, srv)));
+      _mm256_storeu_ps(irr + i, _mm256_mul_ps(svv, inverse));
+      _mm256_storeu_ps(irv2 + i, _mm256_mul_ps(
+          _mm256_sub_ps(zero, _mm256_add_ps(srv, srv)), inverse));
+      _mm256_storeu_ps(ivv + i, _mm256_mul_ps(srr, inverse));
+      _mm256_storeu_ps(iaa + i, _mm256_div_ps(one, _mm256_add_ps(
+          _mm256_loadu_ps(paa + i), _mm256_set1_ps(var_a))));
+    }
+    Sse41Kernel::Invert(prr + i, prv + i, pvv + i, paa + i, n - i, var_r,
+                        var_v, var_a, irr + i, irv2 + i, ivv + i, iaa + i);
+  }
+
+  RADAR_DSP_TARGET_AVX2 static void Distance(
+      const float* r, const float* v, const float* a, const float* irr,
+      const float* irv2, const float* ivv, const float* iaa, size_t n,
+      float r0, float v0, float a0, float* distances) {
+    const __m256 vr0 = _mm256_set1_ps(r0);
+    const __m256 vv0 = _mm256_set1_ps(v0);
+    const __m256 va0 = _mm256_set1_ps(a0);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      __m256 dr = _mm256_sub_ps(vr0, _mm256_loadu_ps(r + i));
+      __m256 dv = _mm256_sub_ps(vv0, _mm256_loadu_ps(v + i));
+      __m256 da = _mm256_sub_ps(va0, _mm256_loadu_ps(a + i));
+      __m256 range = _mm256_mul_ps(dr, _mm256_add_ps(
+          _mm256_mul_ps(_mm256_loadu_ps(irr + i), dr),
+          _mm256_mul_ps(_mm256_loadu_ps(irv2 + i), dv)));
+      __m256 velocity = _mm256_mul_ps(
+          dv, _mm256_mul_ps(_mm256_loadu_ps(ivv + i), dv));
+      __m256 azimuth = _mm256_mul_ps(
+          da, _mm256_mul_ps(_mm256_loadu_ps(iaa + i), da));
+      _mm256_storeu_ps(distances + i, _mm256_add_ps(
+          _mm256_add_ps(range, velocity), azimuth));
+    }
+    Sse41Kernel::Distance(r + i, v + i, a + i, irr + i, irv2 + i, ivv + i,
+                          iaa + i, n - i, r0, v0, a0, distances + i);
+  }
+};
+
+struct Avx512Kernel {
+  RADAR_DSP_TARGET_AVX512 static void Predict(float* x, float* rate,
+                                              float* p00, float* p01,
+                                              float* p11, size_t n, float dt,
+                                              float q1, float q2, float q3) {
+    const __m512 vdt = _mm512_set1_ps(dt);
+    const __m512 vq1 = _mm512_set1_ps(q1);
+    const __m512 vq2 = _mm512_set1_ps(q2);
+    const __m512 vq3 = _mm512_set1_ps(q3);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+      __m512 c01 = _mm512_loadu_ps(p01 + i);
+      __m512 c11 = _mm512_loadu_ps(p11 + i);
+      __m512 t = _mm512_add_ps(c01, _mm512_mul_ps(vdt, c11));
+      _mm512_storeu_ps(x + i, _mm512_add_ps(
+          _mm512_loadu_ps(x + i), _mm512_mul_ps(vdt, _mm512_loadu_ps(
+              rate + i))));
+      _mm512_storeu_ps(p00 + i, _mm512_add_ps(
+          _mm512_add_ps(_mm512_loadu_ps(p00 + i),
+                        _mm512_mul_ps(vdt, _mm512_add_ps(c01, t))), vq3));
+      _mm512_storeu_ps(p01 + i, _mm512_add_ps(t, vq2));
+      _mm512_storeu_ps(p11 + i, _mm512_add_ps(c11, vq1));
+    }
+    Avx2Kernel::Predict(x + i, rate + i, p00 + i, p01 + i, p11 + i, n - i,
+                        dt, q1, q2, q3);
+  }
+
+  RADAR_DSP_TARGET_AVX512 static void Invert(
+      const float* prr, const float* prv, const float* pvv, const float* paa,
+      size_t n, float var_r, float var_v, float var_a, float* irr,
+      float* irv2, float* ivv, float* iaa) {
+    const __m512 one = _mm512_set1_ps(1.0f);
+    const __m512 zero = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+      __m512 srr = _mm512_add_ps(_mm512_loadu_ps(prr + i),
+                                 _mm512_set1_ps(var_r));
+      __m512 svv = _mm512_add_ps(_mm512_loadu_ps(pvv + i),
+                                 _mm512_set1_ps(var_v));
+      __m512 srv = _mm512_loadu_ps(prv + i);
+      __m512 inverse = _mm512_div_ps(
+          one, _mm512_sub_ps(_mm512_mul_ps(srr, svv),
+                             _mm512_mul_ps(srv, srv)));
+      _mm512_storeu_ps(irr + i, _mm512_mul_ps(svv, inverse));
+      _mm512_storeu_ps(irv2 + i, _mm512_mul_ps(
+          _mm512_sub_ps(zero, _mm512_add_ps(srv, srv)), inverse));
+      _mm512_storeu_ps(ivv + i, _mm512_mul_ps(srr, inverse));
+      _mm512_storeu_ps(iaa + i, _mm512_div_ps(one, _mm512_add_ps(
+          _mm512_loadu_ps(paa + i), _mm512_set1_ps(var_a))));
+    }
+    Avx2Kernel::Invert(prr + i, prv + i, pvv + i, paa + i, n - i, var_r,
+                       var_v, var_a, irr + i, irv2 + i, ivv + i, iaa + i);
+  }
+
+  RADAR_DSP_TARGET_AVX512 static void Distance(
+      const float* r, const float* v, const float* a, const float* irr,
+      const float* irv2, const float* ivv, const float* iaa, size_t n,
+      float r0, float v0, float a0, float* distances) {
+    const __m512 vr0 = _mm512_set1_ps(r0);
+    const __m512 vv0 = _mm512_set1_ps(v0);
+    const __m512 va0 = _mm512_set1_ps(a0);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+      __m512 dr = _mm512_sub_ps(vr0, _mm512_loadu_ps(r + i));
+      __m512 dv = _mm512_sub_ps(vv0, _mm512_loadu_ps(v + i));
+      __m512 da = _mm512_sub_ps(va0, _mm512_loadu_ps(a + i));
+      __m512 range = _mm512_mul_ps(dr, _mm512_add_ps(
+          _mm512_mul_ps(_mm512_loadu_ps(irr + i), dr),
+          _mm512_mul_ps(_mm512_loadu_ps(irv2 + i), dv)));
+      __m512 velocity = _mm512_mul_ps(
+          dv, _mm512_mul_ps(_mm512_loadu_ps(ivv + i), dv));
+      __m512 azimuth = _mm512_mul_ps(
+          da, _mm512_mul_ps(_mm512_loadu_ps(iaa + i), da));
+      _mm512_storeu_ps(distances + i, _mm512_add_ps(
+          _mm512_add_ps(range, velocity), azimuth));
+    }
+    Avx2Kernel::Distance(r + i, v + i, a + i, irr + i, irv2 + i, ivv + i,
+                         iaa + i, n - i, r0, v0, a0, distances + i);
+  }
+};
+
+#endif  // RADAR_DSP_HAS_X86_SIMD
+
+void PredictBlock(float* x, float* rate, float* p00, float* p01, float* p11,
+                  size_t n, float dt, float q) {
+  const float q1 = q * dt;
+  const float q2 = q1 * dt * 0.5f;
+  const float q3 = q1 * dt * dt * (1.0f / 3.0f);
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::Predict(x, rate, p00, p01, p11, n, dt, q1, q2, q3);
+      return;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::Predict(x, rate, p00, p01, p11, n, dt, q1, q2, q3);
+      return;
+    case SimdLevel::kSse41:
+      Sse41Kernel::Predict(x, rate, p00, p01, p11, n, dt, q1, q2, q3);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::Predict(x, rate, p00, p01, p11, n, dt, q1, q2, q3);
+}
+
+void Invert(const float* prr, const float* prv, const float* pvv,
+            const float* paa, size_t n, float var_r, float var_v, float var_a,
+            float* irr, float* irv2, float* ivv, float* iaa) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::Invert(prr, prv, pvv, paa, n, var_r, var_v, var_a, irr,
+                           irv2, ivv, iaa);
+      return;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::Invert(prr, prv, pvv, paa, n, var_r, var_v, var_a, irr,
+                         irv2, ivv, iaa);
+      return;
+    case SimdLevel::kSse41:
+      Sse41Kernel::Invert(prr, prv, pvv, paa, n, var_r, var_v, var_a, irr,
+                          irv2, ivv, iaa);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::Invert(prr, prv, pvv, paa, n, var_r, var_v, var_a, irr, irv2,
+                       ivv, iaa);
+}
+
+void Distance(const float* r, const float* v, const float* a,
+              const float* irr, const float* irv2, const float* ivv,
+              const float* iaa, size_t n, float r0, float v0, float a0,
+              float* distances) {
+#ifdef RADAR_DSP_HAS_X86_SIMD
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      Avx512Kernel::Distance(r, v, a, irr, irv2, ivv, iaa, n, r0, v0, a0,
+                             distances);
+      return;
+    case SimdLevel::kAvx2:
+      Avx2Kernel::Distance(r, v, a, irr, irv2, ivv, iaa, n, r0, v0, a0,
+                           distances);
+      return;
+    case SimdLevel::kSse41:
+      Sse41Kernel::Distance(r, v, a, irr, irv2, ivv, iaa, n, r0, v0, a0,
+                            distances);
+      return;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  ScalarKernel::Distance(r, v, a, irr, irv2, ivv, iaa, n, r0, v0, a0,
+                         distances);
+}
+
+// Move the last element of an array to a removed one.
+template <typename T>
+void RemoveElement(std::vector<T>& values, size_t index) {
+  values[index] = values.back();
+  values.pop_back();
+}
+
+}  // namespace
+
+RadarReturnCode GetMapScale(radar_api::IRadarSensor& radar, uint8_t slot_id,
+                            MapScale& scale) {
+  uint32_t burst_period_us = 0, chirp_period_us = 0, num_chirps = 0;
+  uint32_t num_samples = 0, lower_mhz = 0, upper_mhz = 0;
+  RadarReturnCode rc = radar.GetMainParam(
+      slot_id, {RADAR_PARAM_GROUP_COMMON, RADAR_PARAM_BURST_PERIOD_US},
+      burst_period_us);
+  if (rc == RC_OK) {
+    rc = radar.GetMainParam(
+        slot_id, {RADAR_PARAM_GROUP_FMCW, FMCW_PARAM_CHIRP_PERIOD_US},
+        chirp_period_us);
+  }
+  if (rc == RC_OK) {
+    rc = radar.GetMainParam(
+        slot_id, {RADAR_PARAM_GROUP_FMCW, FMCW_PARAM_CHIRPS_PER_BURST},
+        num_chirps);
+  }
+  if (rc == RC_OK) {
+    rc = radar.GetMainParam(
+        slot_id, {RADAR_PARAM_GROUP_FMCW, FMCW_PARAM_SAMPLES_PER_CHIRP},
+        num_samples);
+  }
+  if (rc == RC_OK) {
+    rc = radar.GetMainParam(
+        slot_id, {RADAR_PARAM_GROUP_FMCW, FMCW_PARAM_LOWER_FREQ_MHZ},
+        lower_mhz);
+  }
+  if (rc == RC_OK) {
+    rc = radar.GetMainParam(
+        slot_id, {RADAR_PARAM_GROUP_FMCW, FMCW_PARAM_UPPER_FREQ_MHZ},
+        upper_mhz);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (num_chirps == 0 || num_samples == 0 || chirp_period_us == 0 ||
+      upper_mhz <= lower_mhz) {
+    return RC_BAD_INPUT;
+  }
+
+  // A beat frequency of fs / fft_size per range bin is c / (2 B) *
+  // num_samples / fft_size of range. Real chirps give half as many bins of
+  // the same size.
+  const double bandwidth_hz = 1e6 * (upper_mhz - lower_mhz);
+  const double fft_size = static_cast<double>(NextPowerOfTwo(num_samples));
+  scale.range_bin_m = static_cast<float>(
+      kSpeedOfLight / (2.0 * bandwidth_hz) * num_samples / fft_size);
+  // A Doppler frequency of 1 / (num_doppler_bins * chirp_period) per bin is
+  // wavelength / 2 of it in radial velocity.
+  const double center_hz = 0.5e6 * (static_cast<double>(lower_mhz) +
+                                    upper_mhz);
+  scale.num_doppler_bins =
+      static_cast<uint32_t>(RangeDoppler::GetNumDopplerBins(num_chirps));
+  scale.doppler_bin_mps = static_cast<float>(
+      kSpeedOfLight / center_hz /
+      (2.0 * scale.num_doppler_bins * chirp_period_us * 1e-6));
+  scale.burst_period_s = burst_period_us * 1e-6;
+  return RC_OK;
+}
+
+void TargetDetections::Clear() {
+  range_m.clear();
+  velocity_mps.clear();
+  azimuth_deg.clear();
+}
+
+void ConvertDetections(const CfarDetections& detections,
+                       const AngleEstimates& angles, const MapScale& scale,
+                       TargetDetections& targets) {
+  const size_t size = detections.Size();
+  const bool has_angles = angles.Size() == size;
+  const float zero_doppler_bin = static_cast<float>(
+      scale.num_doppler_bins / 2);
+  targets.range_m.resize(size);
+  targets.velocity_mps.resize(size);
+  targets.azimuth_deg.resize(size);
+  for (size_t i = 0; i < size; ++i) {
+    targets.range_m[i] = detections.range_bin[i] * scale.range_bin_m;
+    targets.velocity_mps[i] =
+        (detections.doppler_bin[i] - zero_doppler_bin) * scale.doppler_bin_mps;
+    targets.azimuth_deg[i] = has_angles ? angles.azimuth_deg[i] : 0.0f;
+  }
+}
+
+void Tracks::Clear() {
+  id.clear();
+  range_m.clear();
+  velocity_mps.clear();
+  azimuth_deg.clear();
+  azimuth_rate_dps.clear();
+  range_var.clear();
+  range_velocity_cov.clear();
+  velocity_var.clear();
+  azimuth_var.clear();
+  azimuth_rate_cov.clear();
+  azimuth_rate_var.clear();
+  hits.clear();
+  misses.clear();
+  is_confirmed.clear();
+}
+
+Tracker::Tracker(const TrackerConfig& config) : config_(config) {}
+
+void Tracker::Reset() {
+  tracks_.Clear();
+  has_time_ = false;
+}
+
+RadarReturnCode Tracker::Process(const RadarBurstFormat& format,
+                                 const TargetDetections& detections) {
+  if (!(config_.burst_period_s >= 0.0)) {
+    return RC_BAD_INPUT;
+  }
+  double time_s = 0.0;
+  if (has_time_) {
+    // Sequence numbers wrap around.
+    uint32_t elapsed = format.sequence_number - sequence_number_;
+    time_s = time_s_ + elapsed * config_.burst_period_s;
+  }
+  RadarReturnCode rc = Process(detections, time_s);
+  if (rc == RC_OK) {
+    sequence_number_ = format.sequence_number;
+  }
+  return rc;
+}
+
+RadarReturnCode Tracker::Process(const TargetDetections& detections,
+                                 double time_s) {
+  const size_t num_detections = detections.Size();
+  if (detections.velocity_mps.size() != num_detections ||
+      detections.azimuth_deg.size() != num_detections ||
+      (has_time_ && !(time_s >= time_s_))) {
+    return RC_BAD_INPUT;
+  }
+  if (has_time_) {
+    Predict(static_cast<float>(time_s - time_s_));
+  }
+  has_time_ = true;
+  time_s_ = time_s;
+
+  Associate(detections);
+  const size_t num_tracks = tracks_.Size();
+  for (size_t track = num_tracks; track-- > 0;) {
+    if (is_assigned_track_[track]) {
+      continue;
+    }
+    ++tracks_.misses[track];
+    if (!tracks_.is_confirmed[track] ||
+        tracks_.misses[track] > config_.max_misses) {
+      RemoveTrack(track);
+    }
+  }
+  for (size_t detection = 0; detection < num_detections; ++detection) {
+    // Assigned detections are gated too.
+    if (!is_gated_detection_[detection] &&
+        tracks_.Size() < config_.max_tracks) {
+      AddTrack(detections, detection);
+    }
+  }
+  return RC_OK;
+}
+
+void Tracker::Predict(float dt) {
+  const size_t n = tracks_.Size();
+  const float acceleration = config_.acceleration_mps2;
+  const float azimuth_acceleration = config_.azimuth_acceleration_dps2;
+  PredictBlock(tracks_.range_m.data(), tracks_.velocity_mps.data(),
+               tracks_.range_var.data(), tracks_.range_velocity_cov.data(),
+               tracks_.velocity_var.data(), n, dt,
+               acceleration * acceleration);
+  PredictBlock(tracks_.azimuth_deg.data(), tracks_.azimuth_rate_dps.data(),
+               tracks_.azimuth_var.data(), tracks_.azimuth_rate_cov.data(),
+               tracks_.azimuth_rate_var.data(), n, dt,
+               azimuth_acceleration * azimuth_acceleration);
+}
+
+void Tracker::Associate(const TargetDetections& detections) {
+  const size_t num_tracks = tracks_.Size();
+  const size_t num_detections = detections.Size();
+  is_assigned_track_.assign(num_tracks, 0);
+  is_assigned_detection_.assign(num_detections, 0);
+  is_gated_detection_.assign(num_detections, 0);
+  if (num_tracks == 0 || num_detections == 0) {
+    return;
+  }
+
+  inverse_rr_.resize(num_tracks);
+  inverse_rv2_.resize(num_tracks);
+  inverse_vv_.resize(num_tracks);
+  inverse_aa_.resize(num_tracks);
+  Invert(tracks_.range_var.data(), tracks_.range_velocity_cov.data(),
+         tracks_.velocity_var.data(), tracks_.azimuth_var.data(), num_tracks,
+         config_.range_sigma_m * config_.range_sigma_m,
+         config_.velocity_sigma_mps * config_.velocity_sigma_mps,
+         config_.azimuth_sigma_deg * config_.azimuth_sigma_deg,
+         inverse_rr_.data(), inverse_rv2_.data(), inverse_vv_.data(),
+         inverse_aa_.data());
+
+  distances_.resize(num_tracks);
+  pairs_.clear();
+  for (size_t detection = 0; detection < num_detections; ++detection) {
+    Distance(tracks_.range_m.data(), tracks_.velocity_mps.data(),
+             tracks_.azimuth_deg.data(), inverse_rr_.data(),
+             inverse_rv2_.data(), inverse_vv_.data(), inverse_aa_.data(),
+             num_tracks, detections.range_m[detection],
+             detections.velocity_mps[detection],
+             detections.azimuth_deg[detection], distances_.data());
+    for (size_t track = 0; track < num_tracks; ++track) {
+      if (distances_[track] < config_.gate) {
+        pairs_.push_back({distances_[track], static_cast<uint32_t>(track),
+                          static_cast<uint32_t>(detection)});
+        is_gated_detection_[detection] = 1;
+      }
+    }
+  }
+
+  // Global nearest neighbor, the closest pairs first.
+  std::sort(pairs_.begin(), pairs_.end(), [](const Pair& a, const Pair& b) {
+    if (a.distance != b.distance) {
+      return a.distance < b.distance;
+    }
+    return a.track != b.track ? a.track < b.track
+                              : a.detection < b.detection;
+  });
+  for (const Pair& pair : pairs_) {
+    if (is_assigned_track_[pair.track] ||
+        is_assigned_detection_[pair.detection]) {
+      continue;
+    }
+    is_assigned_track_[pair.track] = 1;
+    is_assigned_detection_[pair.detection] = 1;
+    Update(pair.track, detections, pair.detection);
+  }
+}
+
+void Tracker::Update(size_t track, const TargetDetections& detections,
+                     size_t detection) {
+  Tracks& t = tracks_;
+  const float dr = detections.range_m[detection] - t.range_m[track];
+  const float dv = detections.velocity_mps[detection] - t.velocity_mps[track];
+  const float da = detections.azimuth_deg[detection] - t.azimuth_deg[track];
+
+  // Range block, K = P S^-1 and P = (I - K) P.
+  const float prr = t.range_var[track];
+  const float prv = t.range_velocity_cov[track];
+  const float pvv = t.velocity_var[track];
+  const float irr = inverse_rr_[track];
+  const float irv = 0.5f * inverse_rv2_[track];
+  const float ivv = inverse_vv_[track];
+  const float k_rr = prr * irr + prv * irv;
+  const float k_rv = prr * irv + prv * ivv;
+  const float k_vr = prv * irr + pvv * irv;
+  const float k_vv = prv * irv + pvv * ivv;
+  t.range_m[track] += k_rr * dr + k_rv * dv;
+  t.velocity_mps[track] += k_vr * dr + k_vv * dv;
+  t.range_var[track] = prr - (k_rr * prr + k_rv * prv);
+  t.range_velocity_cov[track] = prv - (k_rr * prv + k_rv * pvv);
+  t.velocity_var[track] = pvv - (k_vr * prv + k_vv * pvv);
+
+  // Azimuth block, only the azimuth is measured.
+  const float paa = t.azimuth_var[track];
+  const float paw = t.azimuth_rate_cov[track];
+  const float k_a = paa * inverse_aa_[track];
+  const float k_w = paw * inverse_aa_[track];
+  t.azimuth_deg[track] += k_a * da;
+  t.azimuth_rate_dps[track] += k_w * da;
+  t.azimuth_var[track] = paa - k_a * paa;
+  t.azimuth_rate_cov[track] = paw - k_a * paw;
+  t.azimuth_rate_var[track] = t.azimuth_rate_var[track] - k_w * paw;
+
+  ++t.hits[track];
+  t.misses[track] = 0;
+  if (t.hits[track] >= config_.confirm_hits) {
+    t.is_confirmed[track] = 1;
+  }
+}
+
+void Tracker::AddTrack(const TargetDetections& detections,
+                       size_t detection) {
+  Tracks& t = tracks_;
+  const float rate_sigma = config_.initial_azimuth_rate_dps;
+  t.id.push_back(next_id_++);
+  t.range_m.push_back(detections.range_m[detection]);
+  t.velocity_mps.push_back(detections.velocity_mps[detection]);
+  t.azimuth_deg.push_back(detections.azimuth_deg[detection]);
+  t.azimuth_rate_dps.push_back(0.0f);
+  t.range_var.push_back(config_.range_sigma_m * config_.range_sigma_m);
+  t.range_velocity_cov.push_back(0.0f);
+  t.velocity_var.push_back(config_.velocity_sigma_mps *
+                           config_.velocity_sigma_mps);
+  t.azimuth_var.push_back(config_.azimuth_sigma_deg *
+                          config_.azimuth_sigma_deg);
+  t.azimuth_rate_cov.push_back(0.0f);
+  t.azimuth_rate_var.push_back(rate_sigma * rate_sigma);
+  t.hits.push_back(1);
+  t.misses.push_back(0);
+  t.is_confirmed.push_back(config_.confirm_hits <= 1);
+}
+
+void Tracker::RemoveTrack(size_t track) {
+  Tracks& t = tracks_;
+  RemoveElement(t.id, track);
+  RemoveElement(t.range_m, track);
+  RemoveElement(t.velocity_mps, track);
+  RemoveElement(t.azimuth_deg, track);
+  RemoveElement(t.azimuth_rate_dps, track);
+  RemoveElement(t.range_var, track);
+  RemoveElement(t.range_velocity_cov, track);
+  RemoveElement(t.velocity_var, track);
+  RemoveElement(t.azimuth_var, track);
+  RemoveElement(t.azimuth_rate_cov, track);
+  RemoveElement(t.azimuth_rate_var, track);
+  RemoveElement(t.hits, track);
+  RemoveElement(t.misses, track);
+  RemoveElement(t.is_confirmed, track);
+}
+
+}  // namespace radar_dsp
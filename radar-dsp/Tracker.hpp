@@ -0,0 +1,245 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Multi-target tracking of the detections of bursts.
+ *
+ * @details Every track follows the range, radial velocity and azimuth of
+ *          a target with a constant velocity Kalman filter. The range and
+ *          the radial velocity are measured directly and the azimuth rate is
+ *          estimated from the azimuths, so the filter is linear and its range
+ *          and azimuth blocks are independent 2 x 2 ones.
+ *
+ *          Tracks are stored as a struct of arrays, one array per state and
+ *          covariance element, so predicting every track and gating every
+ *          detection against every track run over contiguous arrays,
+ *          vectorized for the instruction set returned by GetSimdLevel.
+ *
+ *          Detections are gated on their Mahalanobis distance to the
+ *          predicted tracks and assigned by global nearest neighbor, the
+ *          closest pairs first. Detections outside the gates of all
+ *          the tracks start tentative tracks, so close targets do not split
+ *          into duplicate tracks, confirmed after confirm_hits hits.
+ *          A tentative track is deleted on its first miss, a confirmed one
+ *          after max_misses misses in a row.
+ *
+ *          Bursts are timed by their sequence numbers and the burst period,
+ *          see GetMapScale for the RADAR_PARAM_BURST_PERIOD_US of a slot, so
+ *          dropped bursts are accounted for, or by explicit timestamps.
+ *
+ *          An instance holds scratch buffers and must be used by one thread
+ *          at a time.
+ *
+ * Example:
+ * ```
+ *   radar_dsp::MapScale scale;
+ *   radar_dsp::GetMapScale(*radar, slot_id, scale);
+ *   radar_dsp::TrackerConfig config;
+ *   config.burst_period_s = scale.burst_period_s;
+ *   radar_dsp::Tracker tracker(config);
+ *   radar_dsp::ConvertDetections(detections, angles, scale, targets);
+ *   RadarReturnCode rc = tracker.Process(format, targets);
+ *   const radar_dsp::Tracks& tracks = tracker.GetTracks();
+ * ```
+ */
+#ifndef RIPPLE_RADAR_DSP_TRACKER_HPP_
+#define RIPPLE_RADAR_DSP_TRACKER_HPP_
+
+#include <IRadarSensor.hpp>
+#include <RadarCommon.h>
+
+#include <Beamformer.hpp>
+#include <Cfar.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace radar_dsp {
+
+//! Physical size of the cells of the range-Doppler maps of a config.
+struct MapScale {
+  //! Range of one range bin.
+  float range_bin_m;
+  //! Radial velocity of one Doppler bin.
+  float doppler_bin_mps;
+  //! Doppler bins of the map, zero velocity being the middle one.
+  uint32_t num_doppler_bins;
+  //! Time between the starts of consecutive bursts.
+  double burst_period_s;
+};
+
+/**
+ * @brief Get the map scale of the FMCW config of a slot.
+ *
+ * @details Reads the frequencies, samples per chirp, chirp and burst periods
+ *          of the slot. The chirps are assumed to ramp while they are
+ *          sampled and the maps to be computed by RangeDoppler.
+ *
+ * @param radar the radar sensor.
+ * @param slot_id the config slot.
+ * @param scale where the scale will be written into.
+ *
+ * @return RC_OK, RC_BAD_INPUT for a slot without chirps or bandwidth, or
+ *         the error of reading the parameters.
+ */
+RadarReturnCode GetMapScale(radar_api::IRadarSensor& radar, uint8_t slot_id,
+                            MapScale& scale);
+
+//! Detections in physical units as a struct of arrays.
+struct TargetDetections {
+  std::vector<float> range_m;
+  //! Radial velocity, positive when moving away.
+  std::vector<float> velocity_mps;
+  std::vector<float> azimuth_deg;
+
+  size_t Size() const {
+    return range_m.size();
+  }
+
+  void Clear();
+};
+
+/**
+ * @brief Convert the cells of detections to physical units.
+ *
+ * @param detections the detections on the range-Doppler map.
+ * @param angles the angles of the detections, or empty ones for an azimuth
+ *        of 0.
+ * @param scale the scale of the map.
+ * @param targets where the detections will be written into.
+ */
+void ConvertDetections(const CfarDetections& detections,
+                       const AngleEstimates& angles, const MapScale& scale,
+                       TargetDetections& targets);
+
+struct TrackerConfig {
+  //! Standard deviations of the measurement errors.
+  float range_sigma_m = 0.05f;
+  float velocity_sigma_mps = 0.1f;
+  float azimuth_sigma_deg = 2.0f;
+  //! Standard deviations of the accelerations of the targets over a second.
+  float acceleration_mps2 = 2.0f;
+  float azimuth_acceleration_dps2 = 20.0f;
+  //! Standard deviation of the azimuth rate of new tracks.
+  float initial_azimuth_rate_dps = 30.0f;
+  //! Largest squared Mahalanobis distance of a detection to its track, 11.3
+  //! keeps 99% of the detections of a track.
+  float gate = 11.3f;
+  //! Hits confirming a tentative track.
+  uint32_t confirm_hits = 3;
+  //! Misses in a row deleting a confirmed track.
+  uint32_t max_misses = 5;
+  //! Tracks kept at most, detections are not tracked beyond.
+  uint32_t max_tracks = 1024;
+  //! Time between consecutive bursts, for bursts timed by their sequence
+  //! numbers.
+  double burst_period_s = 0.05;
+};
+
+//! Tracks as a struct of arrays, one element per track.
+struct Tracks {
+  //! Unique ID of the track, never reused.
+  std::vector<uint32_t> id;
+  //! State estimates.
+  std::vector<float> range_m;
+  std::vector<float> velocity_mps;
+  std::vector<float> azimuth_deg;
+  std::vector<float> azimuth_rate_dps;
+  //! Covariances of the range block of the state.
+  std::vector<float> range_var;
+  std::vector<float> range_velocity_cov;
+  std::vector<float> velocity_var;
+  //! Covariances of the azimuth block of the state.
+  std::vector<float> azimuth_var;
+  std::vector<float> azimuth_rate_cov;
+  std::vector<float> azimuth_rate_var;
+  //! Detections assigned to the track.
+  std::vector<uint32_t> hits;
+  //! Bursts since the last detection assigned to the track.
+  std::vector<uint32_t> misses;
+  std::vector<uint8_t> is_confirmed;
+
+  size_t Size() const {
+    return id.size();
+  }
+
+  void Clear();
+};
+
+class Tracker {
+ public:
+  explicit Tracker(const TrackerConfig& config = TrackerConfig());
+
+  const TrackerConfig& GetConfig() const {
+    return config_;
+  }
+
+  /**
+   * @brief Update the tracks with the detections of a burst.
+   *
+   * @details The time since the previous burst is the difference of their
+   *          sequence numbers times burst_period_s.
+   *
+   * @param format the format of the burst.
+   * @param detections the detections of the burst.
+   *
+   * @return RC_OK or RC_BAD_INPUT for detections of different sizes or
+   *         a negative burst period.
+   */
+  RadarReturnCode Process(const RadarBurstFormat& format,
+                          const TargetDetections& detections);
+
+  /**
+   * @brief Update the tracks with the detections of a burst taken at
+   *        a given time.
+   *
+   * @return RC_OK or RC_BAD_INPUT for detections of different sizes or a time
+   *         before the one of the previous burst.
+   */
+  RadarReturnCode Process(const TargetDetections& detections, double time_s);
+
+  const Tracks& GetTracks() const {
+    return tracks_;
+  }
+
+  //! Delete all the tracks.
+  void Reset();
+
+ private:
+  void Predict(float dt);
+  void Associate(const TargetDetections& detections);
+  void Update(size_t track, const TargetDetections& detections,
+              size_t detection);
+  void AddTrack(const TargetDetections& detections, size_t detection);
+  void RemoveTrack(size_t track);
+
+  TrackerConfig config_;
+  Tracks tracks_;
+  uint32_t next_id_ = 1;
+  bool has_time_ = false;
+  double time_s_ = 0.0;
+  uint32_t sequence_number_ = 0;
+  //! Inverse innovation covariances of the tracks, the off diagonal range
+  //! term doubled.
+  std::vector<float> inverse_rr_;
+  std::vector<float> inverse_rv2_;
+  std::vector<float> inverse_vv_;
+  std::vector<float> inverse_aa_;
+  //! Distances of every detection to every track, detection major.
+  std::vector<float> distances_;
+  //! Gated pairs of a distance, a track and a detection.
+  struct Pair {
+    float distance;
+    uint32_t track;
+    uint32_t detection;
+  };
+  std::vector<Pair> pairs_;
+  std::vector<uint8_t> is_assigned_track_;
+  std::vector<uint8_t> is_assigned_detection_;
+  //! Detections within the gate of a track, which do not start tracks.
+  std::vector<uint8_t> is_gated_detection_;
+};
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_TRACKER_HPP_
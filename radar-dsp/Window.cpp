@@ -0,0 +1,66 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <Window.hpp>
+
+#include <cmath>
+
+namespace radar_dsp {
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+
+// Symmetric cosine sum window a0 - a1 cos(x) + a2 cos(2x).
+double CosineSum(double a0, double a1, double a2, size_t n, size_t size) {
+  double x = 2.0 * kPi * n / (size - 1);
+  return a0 - a1 * std::cos(x) + a2 * std::cos(2.0 * x);
+}
+
+}  // namespace
+
+std::vector<float> MakeWindow(WindowType type, size_t size) {
+  std::vector<double> window(size, 1.0);
+  if (size > 1) {
+    for (size_t n = 0; n < size; ++n) {
+      switch (type) {
+        case WindowType::kRectangular:
+          break;
+        case WindowType::kHann:
+          window[n] = CosineSum(0.5, 0.5, 0.0, n, size);
+          break;
+        case WindowType::kHamming:
+          window[n] = CosineSum(0.54, 0.46, 0.0, n, size);
+          break;
+        case WindowType::kBlackman:
+          window[n] = CosineSum(0.42, 0.5, 0.08, n, size);
+          break;
+      }
+    }
+  }
+
+  double sum = 0.0;
+  for (double value : window) {
+    sum += value;
+  }
+  std::vector<float> result(size);
+  for (size_t n = 0; n < size; ++n) {
+    result[n] = static_cast<float>(window[n] / sum);
+  }
+  return result;
+}
+
+const char* GetWindowName(WindowType type) {
+  switch (type) {
+    case WindowType::kRectangular:
+      return "rectangular";
+    case WindowType::kHann:
+      return "hann";
+    case WindowType::kHamming:
+      return "hamming";
+    case WindowType::kBlackman:
+      return "blackman";
+  }
+  return "unknown";
+}
+
+}  // namespace radar_dsp
@@ -0,0 +1,39 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Window functions applied before the FFTs.
+ */
+#ifndef RIPPLE_RADAR_DSP_WINDOW_HPP_
+#define RIPPLE_RADAR_DSP_WINDOW_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace radar_dsp {
+
+enum class WindowType {
+  kRectangular,
+  kHann,
+  kHamming,
+  kBlackman,
+};
+
+/**
+ * @brief Compute a window.
+ *
+ * @details The window is normalized to a sum of 1, so a complex tone of
+ *          amplitude A shows up with magnitude A at its FFT bin.
+ *
+ * @param type the window function.
+ * @param size the number of points.
+ *
+ * @return the window coefficients.
+ */
+std::vector<float> MakeWindow(WindowType type, size_t size);
+
+//! Get a printable name of the window.
+const char* GetWindowName(WindowType type);
+
+}  // namespace radar_dsp
+
+#endif  // RIPPLE_RADAR_DSP_WINDOW_HPP_
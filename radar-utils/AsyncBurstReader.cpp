@@ -0,0 +1,293 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <AsyncBurstReader.hpp>
+
+#include <Timespec.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace radar_utils {
+
+namespace {
+
+bool SetNonBlocking(int fd) {
+  int flags = fcntl(fd, F_GETFL, 0);
+  return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0 &&
+         fcntl(fd, F_SETFD, FD_CLOEXEC) == 0;
+}
+
+int ToPollTimeoutMs(std::chrono::steady_clock::duration remaining) {
+  if (remaining <= std::chrono::steady_clock::duration::zero()) {
+    return 0;
+  }
+  // Round up so poll does not wake up right before the deadline.
+  auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+      remaining + std::chrono::milliseconds(1) -
+      std::chrono::nanoseconds(1));
+  return static_cast<int>(std::min<int64_t>(ms.count(), 60 * 60 * 1000));
+}
+
+}  // namespace
+
+AsyncBurstReader::AsyncBurstReader()
+    : observer_(this), stop_requested_(false), stopped_(false) {
+  wakeup_fds_[0] = -1;
+  wakeup_fds_[1] = -1;
+  if (pipe(wakeup_fds_) != 0) {
+    wakeup_fds_[0] = -1;
+    wakeup_fds_[1] = -1;
+    return;
+  }
+  if (!SetNonBlocking(wakeup_fds_[0]) || !SetNonBlocking(wakeup_fds_[1])) {
+    close(wakeup_fds_[0]);
+    close(wakeup_fds_[1]);
+    wakeup_fds_[0] = -1;
+    wakeup_fds_[1] = -1;
+  }
+}
+
+AsyncBurstReader::~AsyncBurstReader() {
+  for (PendingRead& read : reads_) {
+    read.radar->RemoveObserver(&observer_);
+  }
+  if (IsValid()) {
+    close(wakeup_fds_[0]);
+    close(wakeup_fds_[1]);
+  }
+}
+
+bool AsyncBurstReader::IsValid() const {
+  return wakeup_fds_[0] >= 0;
+}
+
+RadarReturnCode AsyncBurstReader::AddSensor(radar_api::IRadarSensor* radar) {
+  if (!IsValid()) {
+    return RC_RES_LIMIT;
+  }
+  if (radar == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  if (Find(radar) != nullptr) {
+    return RC_BAD_STATE;
+  }
+
+  int fd = -1;
+  if (radar->GetBurstReadyFd(fd) != RC_OK) {
+    fd = -1;
+  }
+  // Without the descriptor the observer is the only way to get woken up.
+  RadarReturnCode rc = radar->AddObserver(&observer_);
+  if (rc != RC_OK && fd < 0) {
+    return rc;
+  }
+
+  PendingRead read;
+  read.radar = radar;
+  read.fd = fd;
+  read.is_pending = false;
+  read.try_now = false;
+  read.format = nullptr;
+  read.raw_radar_data = nullptr;
+  reads_.push_back(read);
+  return RC_OK;
+}
+
+RadarReturnCode AsyncBurstReader::RemoveSensor(
+    radar_api::IRadarSensor* radar) {
+  PendingRead* read = Find(radar);
+  if (read == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  radar->RemoveObserver(&observer_);
+
+  ReadBurstCallback callback;
+  if (read->is_pending) {
+    callback = std::move(read->callback);
+  }
+  reads_.erase(reads_.begin() + (read - reads_.data()));
+  if (callback) {
+    callback(RC_BAD_STATE);
+  }
+  return RC_OK;
+}
+
+RadarReturnCode AsyncBurstReader::ReadBurstAsync(
+    radar_api::IRadarSensor* radar, RadarBurstFormat& format,
+    std::vector<uint8_t>& raw_radar_data, timespec timeout,
+    ReadBurstCallback callback) {
+  PendingRead* read = Find(radar);
+  if (read == nullptr || !callback) {
+    return RC_BAD_INPUT;
+  }
+  if (read->is_pending) {
+    return RC_BAD_STATE;
+  }
+  read->is_pending = true;
+  // A burst may have been signaled before the read was started.
+  read->try_now = read->fd < 0;
+  read->format = &format;
+  read->raw_radar_data = &raw_radar_data;
+  read->deadline = ToDeadline(timeout);
+  read->callback = std::move(callback);
+  return RC_OK;
+}
+
+RadarReturnCode AsyncBurstReader::Poll(timespec timeout) {
+  std::chrono::steady_clock::time_point poll_deadline = ToDeadline(timeout);
+  while (true) {
+    for (PendingRead& read : reads_) {
+      if (read.is_pending && read.try_now) {
+        read.try_now = false;
+        TryRead(read);
+      }
+    }
+
+    std::chrono::steady_clock::time_point now =
+        std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point wait_until = poll_deadline;
+    for (PendingRead& read : reads_) {
+      if (!read.is_pending) {
+        continue;
+      }
+      if (read.deadline <= now) {
+        Complete(read, RC_TIMEOUT);
+      } else {
+        wait_until = std::min(wait_until, read.deadline);
+      }
+    }
+    if (DispatchCompletions()) {
+      return RC_OK;
+    }
+    if (poll_deadline <= now) {
+      return RC_TIMEOUT;
+    }
+
+    pollfds_.clear();
+    pollfd_reads_.clear();
+    pollfd wakeup = {wakeup_fds_[0], POLLIN, 0};
+    pollfds_.push_back(wakeup);
+    for (size_t i = 0; i < reads_.size(); ++i) {
+      if (reads_[i].is_pending && reads_[i].fd >= 0) {
+        pollfd ready = {reads_[i].fd, POLLIN, 0};
+        pollfds_.push_back(ready);
+        pollfd_reads_.push_back(i);
+      }
+    }
+
+    int num_ready = poll(pollfds_.data(), pollfds_.size(),
+                         ToPollTimeoutMs(wait_until - now));
+    if (num_ready < 0 && errno != EINTR) {
+      return RC_ERROR;
+    }
+    if (num_ready <= 0) {
+      continue;
+    }
+
+    if (pollfds_[0].revents != 0) {
+      DrainWakeUps();
+      if (stop_requested_.exchange(false)) {
+        stopped_ = true;
+        return RC_TIMEOUT;
+      }
+      for (PendingRead& read : reads_) {
+        read.try_now = read.is_pending && read.fd < 0;
+      }
+    }
+    for (size_t i = 1; i < pollfds_.size(); ++i) {
+      if (pollfds_[i].revents != 0) {
+        TryRead(reads_[pollfd_reads_[i - 1]]);
+      }
+    }
+    if (DispatchCompletions()) {
+      return RC_OK;
+    }
+  }
+}
+
+RadarReturnCode AsyncBurstReader::Run(void) {
+  stopped_ = false;
+  while (!stopped_ && NumPending() > 0) {
+    RadarReturnCode rc = Poll({1, 0});
+    if (rc != RC_OK && rc != RC_TIMEOUT) {
+      return rc;
+    }
+  }
+  return RC_OK;
+}
+
+void AsyncBurstReader::Stop(void) {
+  stop_requested_.store(true);
+  WakeUp();
+}
+
+void AsyncBurstReader::WakeUp(void) {
+  if (IsValid()) {
+    uint8_t byte = 1;
+    // A full pipe already guarantees the wake up.
+    ssize_t written = write(wakeup_fds_[1], &byte, 1);
+    (void) written;
+  }
+}
+
+void AsyncBurstReader::DrainWakeUps(void) {
+  uint8_t bytes[64];
+  while (read(wakeup_fds_[0], bytes, sizeof(bytes)) > 0) {
+  }
+}
+
+AsyncBurstReader::PendingRead* AsyncBurstReader::Find(
+    radar_api::IRadarSensor* radar) {
+  for (PendingRead& read : reads_) {
+    if (read.radar == radar) {
+      return &read;
+    }
+  }
+  return nullptr;
+}
+
+void AsyncBurstReader::TryRead(PendingRead& read) {
+  RadarReturnCode rc = read.radar->ReadBurst(*read.format,
+                                             *read.raw_radar_data, {0, 0});
+  if (rc != RC_TIMEOUT) {
+    Complete(read, rc);
+  }
+}
+
+void AsyncBurstReader::Complete(PendingRead& read, RadarReturnCode rc) {
+  read.is_pending = false;
+  read.try_now = false;
+  Completion completion;
+  completion.callback = std::move(read.callback);
+  completion.rc = rc;
+  read.callback = nullptr;
+  completions_.push_back(std::move(completion));
+}
+
+bool AsyncBurstReader::DispatchCompletions(void) {
+  if (completions_.empty()) {
+    return false;
+  }
+  // Callbacks may start new reads which complete in the next round.
+  dispatching_.swap(completions_);
+  for (Completion& completion : dispatching_) {
+    completion.callback(completion.rc);
+  }
+  dispatching_.clear();
+  return true;
+}
+
+size_t AsyncBurstReader::NumPending(void) const {
+  size_t num_pending = 0;
+  for (const PendingRead& read : reads_) {
+    num_pending += read.is_pending ? 1 : 0;
+  }
+  return num_pending;
+}
+
+}  // namespace radar_utils
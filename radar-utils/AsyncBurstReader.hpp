@@ -0,0 +1,242 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Asynchronous burst reads over many radars from a single thread.
+ *
+ * @details A read is started with ReadBurstAsync and completes on the thread
+ *          that calls Poll or Run. Radars that provide a burst ready file
+ *          descriptor are waited on with poll(). Other radars get an observer
+ *          added whose OnBurstReady wakes up the reader, so it composes with
+ *          the observers already registered by the application.
+ *
+ *          With C++20 coroutines a read can be awaited instead:
+ * ```
+ *   RadarReturnCode rc = co_await reader.ReadBurst(radar, format, data,
+ *                                                  {1, 0});
+ * ```
+ *
+ * @note Requires POSIX poll() and pipe().
+ */
+#ifndef RIPPLE_RADAR_UTILS_ASYNCBURSTREADER_HPP_
+#define RIPPLE_RADAR_UTILS_ASYNCBURSTREADER_HPP_
+
+#include <IRadarSensor.hpp>
+
+#include <poll.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#include <coroutine>
+#define RADAR_UTILS_HAS_COROUTINES 1
+#endif
+
+namespace radar_utils {
+
+/**
+ * @brief A completion callback of an asynchronous read.
+ *
+ * @param rc the result of the read, same as IRadarSensor::ReadBurst.
+ */
+using ReadBurstCallback = std::function<void(RadarReturnCode rc)>;
+
+class AsyncBurstReader {
+ public:
+  AsyncBurstReader();
+  ~AsyncBurstReader();
+
+  AsyncBurstReader(const AsyncBurstReader&) = delete;
+  AsyncBurstReader& operator=(const AsyncBurstReader&) = delete;
+
+  /**
+   * @brief Check if the reader has been set up successfully.
+   */
+  bool IsValid() const;
+
+  /**
+   * @brief Add a radar to read from.
+   *
+   * @param radar the radar instance. Must outlive the reader or be removed.
+   */
+  RadarReturnCode AddSensor(radar_api::IRadarSensor* radar);
+
+  /**
+   * @brief Remove a radar. A pending read completes with RC_BAD_STATE.
+   *
+   * @param radar the radar instance previously added.
+   */
+  RadarReturnCode RemoveSensor(radar_api::IRadarSensor* radar);
+
+  /**
+   * @brief Start reading a burst without blocking.
+   *
+   * @details Only one read can be pending per radar. The format and
+   *          raw_radar_data must stay valid until the callback is invoked.
+   *          The callback is invoked from Poll or Run and may start
+   *          the next read.
+   *
+   * @param radar the radar to read from.
+   * @param format where a new burst format will be written into.
+   * @param raw_radar_data where a burst data to be written.
+   * @param timeout the maximum time to wait for the burst.
+   * @param callback a function to invoke when the read completes.
+   *
+   * @return RC_OK if the read is pending, RC_BAD_INPUT if the radar
+   *         was not added, RC_BAD_STATE if a read is already pending.
+   */
+  RadarReturnCode ReadBurstAsync(radar_api::IRadarSensor* radar,
+                                 RadarBurstFormat& format,
+                                 std::vector<uint8_t>& raw_radar_data,
+                                 timespec timeout,
+                                 ReadBurstCallback callback);
+
+  /**
+   * @brief Wait for bursts and complete the pending reads.
+   *
+   * @param timeout the maximum time to wait if no read completes.
+   *
+   * @return RC_OK if at least one read has completed, RC_TIMEOUT otherwise.
+   *         A Stop consumed by Poll makes it return RC_TIMEOUT early.
+   */
+  RadarReturnCode Poll(timespec timeout);
+
+  /**
+   * @brief Complete reads until Stop is called or nothing is pending.
+   */
+  RadarReturnCode Run(void);
+
+  /**
+   * @brief Make Run return. Can be called from any thread.
+   *
+   * @details The request is consumed by the next Poll, whether it is called
+   *          directly or from Run. A Stop made while nothing polls ends the
+   *          next Run or Poll early.
+   */
+  void Stop(void);
+
+#ifdef RADAR_UTILS_HAS_COROUTINES
+  //! An awaitable returned by ReadBurst.
+  class ReadBurstAwaitable {
+   public:
+    ReadBurstAwaitable(AsyncBurstReader& reader,
+                       radar_api::IRadarSensor* radar,
+                       RadarBurstFormat& format,
+                       std::vector<uint8_t>& raw_radar_data,
+                       timespec timeout)
+        : reader_(reader), radar_(radar), format_(format),
+          raw_radar_data_(raw_radar_data), timeout_(timeout) {}
+
+    bool await_ready() const noexcept {
+      return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+      rc_ = reader_.ReadBurstAsync(radar_, format_, raw_radar_data_,
+          timeout_, [this, handle](RadarReturnCode rc) {
+            rc_ = rc;
+            handle.resume();
+          });
+      // Resume right away if the read could not be started.
+      return rc_ == RC_OK;
+    }
+
+    RadarReturnCode await_resume() const noexcept {
+      return rc_;
+    }
+
+   private:
+    AsyncBurstReader& reader_;
+    radar_api::IRadarSensor* radar_;
+    RadarBurstFormat& format_;
+    std::vector<uint8_t>& raw_radar_data_;
+    timespec timeout_;
+    RadarReturnCode rc_ = RC_UNDEFINED;
+  };
+
+  /**
+   * @brief Read a burst from a coroutine.
+   *
+   * @details The coroutine is resumed from Poll or Run with the same
+   *          result as IRadarSensor::ReadBurst.
+   */
+  ReadBurstAwaitable ReadBurst(radar_api::IRadarSensor* radar,
+                               RadarBurstFormat& format,
+                               std::vector<uint8_t>& raw_radar_data,
+                               timespec timeout) {
+    return ReadBurstAwaitable(*this, radar, format, raw_radar_data, timeout);
+  }
+#endif  // RADAR_UTILS_HAS_COROUTINES
+
+ private:
+  // Wakes up the reader from the driver thread.
+  class WakeUpObserver : public radar_api::IRadarSensorObserver {
+   public:
+    explicit WakeUpObserver(AsyncBurstReader* reader) : reader_(reader) {}
+
+    void OnBurstReady(void) {
+      reader_->WakeUp();
+    }
+
+    void OnLogMessage(RadarLogLevel level, const char* file,
+                      const char* function, int line,
+                      const std::string& message) {
+      (void) level;
+      (void) file;
+      (void) function;
+      (void) line;
+      (void) message;
+    }
+
+    void OnRegisterSet(uint32_t address, uint32_t value) {
+      (void) address;
+      (void) value;
+    }
+
+   private:
+    AsyncBurstReader* reader_;
+  };
+
+  struct PendingRead {
+    radar_api::IRadarSensor* radar;
+    // Descriptor to poll, or -1 when woken up by the observer.
+    int fd;
+    bool is_pending;
+    // Set when the read should be tried before waiting.
+    bool try_now;
+    RadarBurstFormat* format;
+    std::vector<uint8_t>* raw_radar_data;
+    std::chrono::steady_clock::time_point deadline;
+    ReadBurstCallback callback;
+  };
+
+  struct Completion {
+    ReadBurstCallback callback;
+    RadarReturnCode rc;
+  };
+
+  void WakeUp(void);
+  void DrainWakeUps(void);
+  PendingRead* Find(radar_api::IRadarSensor* radar);
+  void TryRead(PendingRead& read);
+  void Complete(PendingRead& read, RadarReturnCode rc);
+  bool DispatchCompletions(void);
+  size_t NumPending(void) const;
+
+  int wakeup_fds_[2];
+  WakeUpObserver observer_;
+  std::atomic<bool> stop_requested_;
+  bool stopped_;
+  std::vector<PendingRead> reads_;
+  std::vector<Completion> completions_;
+  std::vector<Completion> dispatching_;
+  std::vector<pollfd> pollfds_;
+  std::vector<size_t> pollfd_reads_;
+};
+
+}  // namespace radar_utils
+
+#endif  // RIPPLE_RADAR_UTILS_ASYNCBURSTREADER_HPP_
@@ -0,0 +1,208 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief A bounded burst queue between a radar driver and its reader.
+ *
+ * @details The driver pushes bursts from its acquisition thread, where it
+ *          would notify OnBurstReady, and ReadBurst pops them. Burst buffers
+ *          are recycled between both sides, so no memory is allocated once
+ *          the buffers have grown to the burst size.
+ *
+ * Example:
+ * ```
+ *   // Driver side.
+ *   BurstQueue queue(8, DropPolicy::kDropOldest);
+ *   queue.Push(format, data, size);
+ *
+ *   // ReadBurst implementation.
+ *   return queue.Pop(format, raw_radar_data, timeout);
+ * ```
+ */
+#ifndef RIPPLE_RADAR_UTILS_BURSTQUEUE_HPP_
+#define RIPPLE_RADAR_UTILS_BURSTQUEUE_HPP_
+
+#include <RadarCommon.h>
+
+#include <SpscQueue.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace radar_utils {
+
+//! A burst kept in a queue.
+struct QueuedBurst {
+  RadarBurstFormat format;
+  std::vector<uint8_t> data;
+};
+
+//! Burst queue counters.
+struct BurstQueueStats {
+  //! Counters of the underlying queue.
+  QueueStats queue;
+  //! Sequence number of the last pushed burst.
+  uint32_t last_enqueued_sequence;
+  //! Sequence number of the last burst dropped by the drop policy.
+  uint32_t last_dropped_sequence;
+  //! Sequence number of the last popped burst.
+  uint32_t last_dequeued_sequence;
+  //! Number of bursts missing in the sequence before they reached the queue.
+  //! A sequence number going backwards restarts the count from it.
+  uint64_t sequence_gaps;
+};
+
+class BurstQueue {
+ public:
+  /**
+   * @param depth the maximum number of queued bursts.
+   * @param policy what to do when a burst is pushed into a full queue.
+   * @param burst_bytes the expected burst size to preallocate buffers for.
+   */
+  BurstQueue(uint32_t depth, DropPolicy policy, uint32_t burst_bytes = 0)
+      : queue_(depth, policy) {
+    producer_burst_.data.reserve(burst_bytes);
+    consumer_burst_.data.reserve(burst_bytes);
+    queue_.InitSlots([burst_bytes](QueuedBurst& burst) {
+      burst.data.reserve(burst_bytes);
+    });
+  }
+
+  /**
+   * @brief Copy a burst into the queue. Producer side.
+   *
+   * @param format the burst format.
+   * @param data the burst data.
+   * @param size_bytes the size of the burst data.
+   * @param timeout the maximum time to wait for space with kBlock policy.
+   */
+  RadarReturnCode Push(const RadarBurstFormat& format, const uint8_t* data,
+                       uint32_t size_bytes, timespec timeout = {0, 0}) {
+    producer_burst_.format = format;
+    producer_burst_.data.assign(data, data + size_bytes);
+    return Push(producer_burst_, timeout);
+  }
+
+  /**
+   * @brief Swap a burst into the queue. Producer side.
+   *
+   * @details On return the burst holds a recycled buffer to be filled with
+   *          the next burst.
+   *
+   * @param burst the burst to push.
+   * @param timeout the maximum time to wait for space with kBlock policy.
+   */
+  RadarReturnCode Push(QueuedBurst& burst, timespec timeout = {0, 0}) {
+    uint32_t sequence = burst.format.sequence_number;
+    // A burst pushed again after a timeout is not a gap, and a sequence
+    // going backwards is a driver reset or a reordered burst.
+    int32_t step = static_cast<int32_t>(sequence - last_pushed_);
+    if (has_pushed_ && step > 1) {
+      sequence_gaps_.store(sequence_gaps_.load(std::memory_order_relaxed) +
+                               static_cast<uint32_t>(step - 1),
+                           std::memory_order_relaxed);
+    }
+    has_pushed_ = true;
+    last_pushed_ = sequence;
+
+    bool dropped_oldest = false;
+    RadarReturnCode rc = queue_.Push(burst, timeout, dropped_oldest);
+    if (rc == RC_OK) {
+      last_enqueued_sequence_.store(sequence, std::memory_order_relaxed);
+    }
+    if (dropped_oldest) {
+      // The burst holds the dropped one now.
+      last_dropped_sequence_.store(burst.format.sequence_number,
+                                   std::memory_order_relaxed);
+    } else if (rc == RC_RES_LIMIT) {
+      last_dropped_sequence_.store(sequence, std::memory_order_relaxed);
+    }
+    return rc;
+  }
+
+  /**
+   * @brief Pop the oldest burst. Consumer side.
+   *
+   * @details Has the same semantics as IRadarSensor::ReadBurst. The previous
+   *          buffer of raw_radar_data is recycled to the producer.
+   *
+   * @param format where the burst format will be written into.
+   * @param raw_radar_data where the burst data will be swapped into.
+   * @param timeout the maximum time to wait if no burst is queued.
+   */
+  RadarReturnCode Pop(RadarBurstFormat& format,
+                      std::vector<uint8_t>& raw_radar_data,
+                      timespec timeout) {
+    consumer_burst_.data.swap(raw_radar_data);
+    RadarReturnCode rc = Pop(consumer_burst_, timeout);
+    consumer_burst_.data.swap(raw_radar_data);
+    if (rc == RC_OK) {
+      format = consumer_burst_.format;
+    }
+    return rc;
+  }
+
+  /**
+   * @brief Swap the oldest burst out of the queue. Consumer side.
+   *
+   * @param burst where the burst will be swapped into.
+   * @param timeout the maximum time to wait if no burst is queued.
+   */
+  RadarReturnCode Pop(QueuedBurst& burst, timespec timeout) {
+    RadarReturnCode rc = queue_.Pop(burst, timeout);
+    if (rc == RC_OK) {
+      last_dequeued_sequence_.store(burst.format.sequence_number,
+                                    std::memory_order_relaxed);
+    }
+    return rc;
+  }
+
+  //! Check if there is no burst to pop.
+  bool IsEmpty() const {
+    return queue_.IsEmpty();
+  }
+
+  //! The number of queued bursts.
+  uint32_t Size() const {
+    return queue_.Size();
+  }
+
+  //! Close the queue and wake up waiting threads.
+  void Close() {
+    queue_.Close();
+  }
+
+  //! Get a snapshot of the counters.
+  BurstQueueStats GetStats() const {
+    BurstQueueStats stats;
+    stats.queue = queue_.GetStats();
+    stats.last_enqueued_sequence =
+        last_enqueued_sequence_.load(std::memory_order_relaxed);
+    stats.last_dropped_sequence =
+        last_dropped_sequence_.load(std::memory_order_relaxed);
+    stats.last_dequeued_sequence =
+        last_dequeued_sequence_.load(std::memory_order_relaxed);
+    stats.sequence_gaps = sequence_gaps_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+ private:
+  SpscQueue<QueuedBurst> queue_;
+
+  // Producer side.
+  QueuedBurst producer_burst_;
+  bool has_pushed_ = false;
+  uint32_t last_pushed_ = 0;
+  std::atomic<uint32_t> last_enqueued_sequence_{0};
+  std::atomic<uint32_t> last_dropped_sequence_{0};
+  std::atomic<uint64_t> sequence_gaps_{0};
+
+  // Consumer side.
+  char consumer_padding_[kCacheLineBytes];
+  QueuedBurst consumer_burst_;
+  std::atomic<uint32_t> last_dequeued_sequence_{0};
+};
+
+}  // namespace radar_utils
+
+#endif  // RIPPLE_RADAR_UTILS_BURSTQUEUE_HPP_
@@ -0,0 +1,422 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <CaptureFormat.hpp>
+
+#include <cstring>
+#include <limits>
+
+namespace radar_utils {
+
+namespace {
+
+// The params defined by the Radar API for a group, their IDs run from 1 to
+// the last one.
+struct GroupParams {
+  RadarParamGroup group;
+  RadarMainParamId last_main;
+  RadarTxParamId last_tx;
+  RadarRxParamId last_rx;
+};
+
+const GroupParams kGroupParams[] = {
+  {RADAR_PARAM_GROUP_COMMON, RADAR_PARAM_RX_ANTENNA_MASK,
+   RADAR_TX_PARAM_UNDEFINED, RADAR_RX_PARAM_UNDEFINED},
+  {RADAR_PARAM_GROUP_FMCW, FMCW_PARAM_ADC_SAMPLING_HZ,
+   FMCW_TX_PARAM_POWER_IDX, FMCW_RX_PARAM_HP_CUTOFF_KHZ},
+  {RADAR_PARAM_GROUP_PULSED, PULSED_PARAM_PRF_IDX,
+   PULSED_TX_PARAM_POWER_IDX, PULSED_RX_PARAM_VGA_IDX},
+  {RADAR_PARAM_GROUP_UWB, UWB_RADAR_NUMBER_OF_BURSTS,
+   UWB_TX_PARAM_POWER_IDX, UWB_RX_PARAM_UNDEFINED},
+};
+
+RadarParamGroup GetTypeGroup(RadarType radar_type) {
+  switch (radar_type) {
+    case RTYPE_FMCW:
+      return RADAR_PARAM_GROUP_FMCW;
+    case RTYPE_PULSED:
+      return RADAR_PARAM_GROUP_PULSED;
+    case RTYPE_UWB:
+      return RADAR_PARAM_GROUP_UWB;
+    default:
+      return RADAR_PARAM_GROUP_UNDEFINED;
+  }
+}
+
+size_t AlignUp(size_t bytes, size_t alignment) {
+  return (bytes + alignment - 1) / alignment * alignment;
+}
+
+void AddParam(CaptureParamKind kind, uint8_t slot_id, RadarParamGroup group,
+              uint32_t id, uint32_t antenna_mask, uint32_t value,
+              CaptureHeader& header) {
+  CaptureParam param;
+  param.kind = kind;
+  param.slot_id = slot_id;
+  param.group = group;
+  param.id = id;
+  param.antenna_mask = antenna_mask;
+  param.value = value;
+  header.params.push_back(param);
+}
+
+void GetSlotParams(radar_api::IRadarSensor& radar, uint8_t slot_id,
+                   RadarType radar_type,
+                   const CaptureVendorParams& vendor_params,
+                   CaptureHeader& header) {
+  const RadarParamGroup type_group = GetTypeGroup(radar_type);
+  uint32_t tx_mask = 0;
+  uint32_t rx_mask = 0;
+  radar.GetMainParam(slot_id, {RADAR_PARAM_GROUP_COMMON,
+                               RADAR_PARAM_TX_ANTENNA_MASK}, tx_mask);
+  radar.GetMainParam(slot_id, {RADAR_PARAM_GROUP_COMMON,
+                               RADAR_PARAM_RX_ANTENNA_MASK}, rx_mask);
+
+  uint32_t value = 0;
+  for (const GroupParams& group : kGroupParams) {
+    // Every group is tried for a radar of an unknown type.
+    if (group.group != RADAR_PARAM_GROUP_COMMON &&
+        type_group != RADAR_PARAM_GROUP_UNDEFINED &&
+        group.group != type_group) {
+      continue;
+    }
+    for (RadarMainParamId id = 1; id <= group.last_main; ++id) {
+      if (radar.GetMainParam(slot_id, {group.group, id}, value) == RC_OK) {
+        AddParam(CaptureParamKind::kMain, slot_id, group.group, id, 0, value,
+                 header);
+      }
+    }
+    for (uint32_t antenna = 0; antenna < 32; ++antenna) {
+      const uint32_t mask = 1u << antenna;
+      for (RadarTxParamId id = 1; (tx_mask & mask) && id <= group.last_tx;
+           ++id) {
+        if (radar.GetTxParam(slot_id, mask, {group.group, id}, value) ==
+            RC_OK) {
+          AddParam(CaptureParamKind::kTx, slot_id, group.group, id, mask,
+                   value, header);
+        }
+      }
+      for (RadarRxParamId id = 1; (rx_mask & mask) && id <= group.last_rx;
+           ++id) {
+        if (radar.GetRxParam(slot_id, mask, {group.group, id}, value) ==
+            RC_OK) {
+          AddParam(CaptureParamKind::kRx, slot_id, group.group, id, mask,
+                   value, header);
+        }
+      }
+    }
+  }
+
+  for (RadarVendorParam id : vendor_params.params) {
+    if (radar.GetVendorParam(slot_id, id, value) == RC_OK) {
+      AddParam(CaptureParamKind::kVendor, slot_id, 0, id, 0, value, header);
+    }
+  }
+  for (uint32_t antenna = 0; antenna < 32; ++antenna) {
+    const uint32_t mask = 1u << antenna;
+    for (RadarVendorTxParam id : vendor_params.tx_params) {
+      if ((tx_mask & mask) &&
+          radar.GetVendorTxParam(slot_id, mask, id, value) == RC_OK) {
+        AddParam(CaptureParamKind::kVendorTx, slot_id, 0, id, mask, value,
+                 header);
+      }
+    }
+    for (RadarVendorRxParam id : vendor_params.rx_params) {
+      if ((rx_mask & mask) &&
+          radar.GetVendorRxParam(slot_id, mask, id, value) == RC_OK) {
+        AddParam(CaptureParamKind::kVendorRx, slot_id, 0, id, mask, value,
+                 header);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+RadarReturnCode GetCaptureHeader(radar_api::IRadarSensor& radar,
+                                 const CaptureVendorParams& vendor_params,
+                                 CaptureHeader& header) {
+  SensorInfo info;
+  std::memset(&info, 0, sizeof(info));
+  RadarReturnCode rc = radar.GetSensorInfo(info);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  rc = radar.GetActiveConfigs(header.active_slots);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  header.api_version = radarGetRadarApiVersion();
+  header.name = info.name != nullptr ? info.name : "";
+  header.vendor = info.vendor != nullptr ? info.vendor : "";
+  header.device_id = info.device_id;
+  header.radar_type = info.radar_type;
+  header.driver_version = info.driver_version;
+  header.params.clear();
+  for (uint8_t slot_id : header.active_slots) {
+    GetSlotParams(radar, slot_id, info.radar_type, vendor_params, header);
+  }
+  return RC_OK;
+}
+
+RadarReturnCode SerializeCaptureHeader(const CaptureHeader& header,
+                                       std::vector<uint8_t>& bytes) {
+  if (header.name.size() > std::numeric_limits<uint16_t>::max() ||
+      header.vendor.size() > std::numeric_limits<uint16_t>::max() ||
+      header.active_slots.size() > std::numeric_limits<uint8_t>::max()) {
+    return RC_BAD_INPUT;
+  }
+  CaptureFileHeader file_header;
+  std::memset(&file_header, 0, sizeof(file_header));
+  std::memcpy(file_header.magic, kCaptureMagic, sizeof(kCaptureMagic));
+  file_header.byte_order = kCaptureByteOrder;
+  file_header.format_version = kCaptureFormatVersion;
+  file_header.api_version = header.api_version;
+  file_header.driver_version = header.driver_version;
+  file_header.device_id = header.device_id;
+  file_header.radar_type = header.radar_type;
+  file_header.num_active_slots =
+      static_cast<uint8_t>(header.active_slots.size());
+  file_header.name_bytes = static_cast<uint16_t>(header.name.size());
+  file_header.vendor_bytes = static_cast<uint16_t>(header.vendor.size());
+  file_header.num_params = static_cast<uint32_t>(header.params.size());
+
+  const size_t params_offset = AlignUp(
+      sizeof(file_header) + header.name.size() + header.vendor.size() +
+      header.active_slots.size(), alignof(CaptureParam));
+  const size_t header_bytes = AlignUp(
+      params_offset + header.params.size() * sizeof(CaptureParam),
+      kCaptureAlignment);
+  file_header.header_bytes = static_cast<uint32_t>(header_bytes);
+
+  bytes.assign(header_bytes, 0);
+  uint8_t* out = bytes.data();
+  std::memcpy(out, &file_header, sizeof(file_header));
+  out += sizeof(file_header);
+  std::memcpy(out, header.name.data(), header.name.size());
+  out += header.name.size();
+  std::memcpy(out, header.vendor.data(), header.vendor.size());
+  out += header.vendor.size();
+  if (!header.active_slots.empty()) {
+    std::memcpy(out, header.active_slots.data(), header.active_slots.size());
+  }
+  if (!header.params.empty()) {
+    std::memcpy(bytes.data() + params_offset, header.params.data(),
+                header.params.size() * sizeof(CaptureParam));
+  }
+  return RC_OK;
+}
+
+RadarReturnCode ParseCaptureHeader(const uint8_t* data, size_t size,
+                                   CaptureHeader& header,
+                                   size_t& header_bytes) {
+  CaptureFileHeader file_header;
+  if (size < sizeof(file_header)) {
+    return RC_BAD_INPUT;
+  }
+  std::memcpy(&file_header, data, sizeof(file_header));
+  if (std::memcmp(file_header.magic, kCaptureMagic,
+                  sizeof(kCaptureMagic)) != 0) {
+    return RC_BAD_INPUT;
+  }
+  if (file_header.byte_order != kCaptureByteOrder ||
+      file_header.format_version > kCaptureFormatVersion) {
+    return RC_UNSUPPORTED;
+  }
+
+  const size_t strings_offset = sizeof(file_header);
+  const size_t slots_offset = strings_offset + file_header.name_bytes +
+                              file_header.vendor_bytes;
+  const size_t params_offset = AlignUp(
+      slots_offset + file_header.num_active_slots, alignof(CaptureParam));
+  const uint64_t params_end = params_offset +
+      static_cast<uint64_t>(file_header.num_params) * sizeof(CaptureParam);
+  if (file_header.header_bytes < params_end ||
+      file_header.header_bytes % kCaptureAlignment != 0 ||
+      file_header.header_bytes > size) {
+    return RC_BAD_INPUT;
+  }
+
+  const char* strings = reinterpret_cast<const char*>(data + strings_offset);
+  header.api_version = file_header.api_version;
+  header.name.assign(strings, file_header.name_bytes);
+  header.vendor.assign(strings + file_header.name_bytes,
+                       file_header.vendor_bytes);
+  header.device_id = file_header.device_id;
+  header.radar_type = file_header.radar_type;
+  header.driver_version = file_header.driver_version;
+  header.active_slots.assign(
+      data + slots_offset, data + slots_offset + file_header.num_active_slots);
+  header.params.resize(file_header.num_params);
+  if (file_header.num_params > 0) {
+    std::memcpy(header.params.data(), data + params_offset,
+                file_header.num_params * sizeof(CaptureParam));
+  }
+  header_bytes = file_header.header_bytes;
+  return RC_OK;
+}
+
+RadarReturnCode ParseCaptureRecord(const uint8_t* data, size_t size,
+                                   CaptureRecordHeader& record) {
+  if (size < sizeof(record)) {
+    return RC_BAD_INPUT;
+  }
+  std::memcpy(&record, data, sizeof(record));
+  if (record.record_bytes < sizeof(record) || record.record_bytes > size ||
+      record.payload_bytes > record.record_bytes - sizeof(record) ||
+      record.record_bytes != GetCaptureRecordBytes(record.payload_bytes)) {
+    return RC_BAD_INPUT;
+  }
+  return RC_OK;
+}
+
+RadarReturnCode SerializeCaptureIndex(
+    const std::vector<CaptureIndexEntry>& entries, uint64_t index_offset,
+    std::vector<uint8_t>& bytes) {
+  const uint64_t payload_bytes =
+      entries.size() * sizeof(CaptureIndexEntry) + sizeof(CaptureIndexTrailer);
+  if (payload_bytes > std::numeric_limits<uint32_t>::max() -
+                          sizeof(CaptureRecordHeader) - kCaptureAlignment) {
+    return RC_BAD_INPUT;
+  }
+  CaptureRecordHeader record;
+  std::memset(&record, 0, sizeof(record));
+  record.payload_bytes = static_cast<uint32_t>(payload_bytes);
+  record.record_bytes = GetCaptureRecordBytes(record.payload_bytes);
+  record.raw_bytes = record.payload_bytes;
+  record.encoding = CaptureEncoding::kIndex;
+  CaptureIndexTrailer trailer;
+  trailer.index_offset = index_offset;
+  std::memcpy(trailer.magic, kCaptureIndexMagic, sizeof(kCaptureIndexMagic));
+
+  // The entries and the trailer are multiples of the alignment, the trailer
+  // ends the record.
+  bytes.assign(record.record_bytes, 0);
+  uint8_t* out = bytes.data();
+  std::memcpy(out, &record, sizeof(record));
+  out += sizeof(record);
+  if (!entries.empty()) {
+    std::memcpy(out, entries.data(),
+                entries.size() * sizeof(CaptureIndexEntry));
+  }
+  std::memcpy(bytes.data() + bytes.size() - sizeof(trailer), &trailer,
+              sizeof(trailer));
+  return RC_OK;
+}
+
+RadarReturnCode ParseCaptureIndex(const uint8_t* data, size_t size,
+                                  size_t header_bytes,
+                                  std::vector<CaptureIndexEntry>& entries) {
+  CaptureIndexTrailer trailer;
+  if (size < header_bytes + sizeof(CaptureRecordHeader) + sizeof(trailer)) {
+    return RC_BAD_INPUT;
+  }
+  std::memcpy(&trailer, data + size - sizeof(trailer), sizeof(trailer));
+  if (std::memcmp(trailer.magic, kCaptureIndexMagic,
+                  sizeof(kCaptureIndexMagic)) != 0 ||
+      trailer.index_offset < header_bytes ||
+      trailer.index_offset % kCaptureAlignment != 0 ||
+      trailer.index_offset > size - sizeof(CaptureRecordHeader)) {
+    return RC_BAD_INPUT;
+  }
+  const size_t index_offset = static_cast<size_t>(trailer.index_offset);
+  CaptureRecordHeader record;
+  if (ParseCaptureRecord(data + index_offset, size - index_offset, record) !=
+          RC_OK ||
+      record.encoding != CaptureEncoding::kIndex ||
+      index_offset + record.record_bytes != size ||
+      record.payload_bytes != record.record_bytes - sizeof(record) ||
+      (record.payload_bytes - sizeof(trailer)) % sizeof(CaptureIndexEntry) !=
+          0) {
+    return RC_BAD_INPUT;
+  }
+
+  const size_t num_entries =
+      (record.payload_bytes - sizeof(trailer)) / sizeof(CaptureIndexEntry);
+  entries.resize(num_entries);
+  if (num_entries > 0) {
+    std::memcpy(entries.data(), data + index_offset + sizeof(record),
+                num_entries * sizeof(CaptureIndexEntry));
+  }
+  for (const CaptureIndexEntry& entry : entries) {
+    if (entry.offset < header_bytes || entry.offset >= index_offset) {
+      entries.clear();
+      return RC_BAD_INPUT;
+    }
+  }
+  return RC_OK;
+}
+
+void BuildCaptureIndex(const uint8_t* data, size_t size, size_t header_bytes,
+                       std::vector<CaptureIndexEntry>& entries,
+                       size_t& records_end) {
+  entries.clear();
+  size_t offset = header_bytes;
+  records_end = header_bytes;
+  CaptureRecordHeader record;
+  while (offset < size &&
+         ParseCaptureRecord(data + offset, size - offset, record) == RC_OK) {
+    if (record.encoding != CaptureEncoding::kIndex) {
+      CaptureIndexEntry entry;
+      ToCaptureIndexEntry(offset, record, entry);
+      entries.push_back(entry);
+      records_end = offset + record.record_bytes;
+    }
+    offset += record.record_bytes;
+  }
+}
+
+void ToCaptureIndexEntry(uint64_t offset, const CaptureRecordHeader& record,
+                         CaptureIndexEntry& entry) {
+  std::memset(&entry, 0, sizeof(entry));
+  entry.offset = offset;
+  entry.timestamp_ns = record.timestamp_ns;
+  entry.sequence_number = record.format.sequence_number;
+  entry.config_id = record.format.config_id;
+}
+
+void ToCaptureBurstFormat(const RadarBurstFormat& format,
+                          CaptureBurstFormat& capture_format) {
+  std::memset(&capture_format, 0, sizeof(capture_format));
+  capture_format.sequence_number = format.sequence_number;
+  capture_format.sample_data_type = format.sample_data_type;
+  capture_format.radar_type = format.radar_type;
+  capture_format.config_id = format.config_id;
+  capture_format.bits_per_sample = format.bits_per_sample;
+  capture_format.num_channels = format.num_channels;
+  capture_format.is_channels_interleaved = format.is_channels_interleaved;
+  capture_format.is_big_endian = format.is_big_endian;
+  capture_format.sample_packing = format.sample_packing;
+  if (format.radar_type == RTYPE_UWB) {
+    capture_format.session_handle = format.custom.uwb.session_handle;
+    capture_format.samples = format.custom.uwb.samples_per_sweep;
+    capture_format.chirps = format.custom.uwb.sweeps_per_burst;
+  } else {
+    // The pulsed fields share the layout of the FMCW ones.
+    capture_format.samples = format.custom.fmcw.samples_per_chirp;
+    capture_format.chirps = format.custom.fmcw.chirps_per_burst;
+  }
+}
+
+void FromCaptureBurstFormat(const CaptureBurstFormat& capture_format,
+                            RadarBurstFormat& format) {
+  std::memset(&format, 0, sizeof(format));
+  format.sequence_number = capture_format.sequence_number;
+  format.sample_data_type = capture_format.sample_data_type;
+  format.radar_type = capture_format.radar_type;
+  format.config_id = capture_format.config_id;
+  format.bits_per_sample = capture_format.bits_per_sample;
+  format.num_channels = capture_format.num_channels;
+  format.is_channels_interleaved = capture_format.is_channels_interleaved;
+  format.is_big_endian = capture_format.is_big_endian;
+  format.sample_packing = capture_format.sample_packing;
+  if (capture_format.radar_type == RTYPE_UWB) {
+    format.custom.uwb.session_handle = capture_format.session_handle;
+    format.custom.uwb.samples_per_sweep = capture_format.samples;
+    format.custom.uwb.sweeps_per_burst = capture_format.chirps;
+  } else {
+    format.custom.fmcw.samples_per_chirp = capture_format.samples;
+    format.custom.fmcw.chirps_per_burst = capture_format.chirps;
+  }
+}
+
+}  // namespace radar_utils
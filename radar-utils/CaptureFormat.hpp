@@ -0,0 +1,318 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief The file format of recorded bursts.
+ *
+ * @details A capture starts with a header describing the sensor and its
+ *          configs, followed by the bursts appended one record at a time:
+ *
+ *          - CaptureFileHeader with the Radar API version, the sensor info
+ *            and the sizes of the variable parts that follow.
+ *          - The sensor name and vendor, not null terminated.
+ *          - The IDs of the active config slots.
+ *          - Padding to 4 bytes and a CaptureParam for every main, TX, RX
+ *            and vendor param read from the active slots.
+ *          - Padding up to header_bytes.
+ *          - Records, each a CaptureRecordHeader followed by the payload and
+ *            padding up to record_bytes.
+ *          - The index record, a CaptureIndexEntry for every burst record
+ *            followed by a CaptureIndexTrailer, the last bytes of the file.
+ *
+ *          The header and the records are padded to kCaptureAlignment bytes
+ *          so the record headers of a mapped capture are aligned. Values are
+ *          in the byte order of the recording machine, checked with
+ *          byte_order. A capture ends at the end of the file, or at
+ *          a truncated record left by a recording that did not complete.
+ *          Such a capture has no index, it is rebuilt by scanning the records
+ *          with BuildCaptureIndex, see CaptureReader.hpp.
+ *
+ * Example:
+ * ```
+ *   radar_utils::CaptureHeader header;
+ *   size_t header_bytes = 0;
+ *   rc = radar_utils::ParseCaptureHeader(data, size, header, header_bytes);
+ *   radar_utils::CaptureRecordHeader record;
+ *   for (size_t offset = header_bytes;
+ *        radar_utils::ParseCaptureRecord(data + offset, size - offset,
+ *                                        record) == RC_OK;
+ *        offset += record.record_bytes) {
+ *     const uint8_t* payload = data + offset + sizeof(record);
+ *   }
+ * ```
+ */
+#ifndef RIPPLE_RADAR_UTILS_CAPTUREFORMAT_HPP_
+#define RIPPLE_RADAR_UTILS_CAPTUREFORMAT_HPP_
+
+#include <IRadarSensor.hpp>
+#include <RadarCommon.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace radar_utils {
+
+//! Magic bytes starting every capture.
+constexpr char kCaptureMagic[8] = {'R', 'I', 'P', 'L', 'C', 'A', 'P', '\0'};
+//! Written as is to tell the byte order of the values.
+constexpr uint32_t kCaptureByteOrder = 0x01020304;
+//! Version of the format written.
+constexpr uint32_t kCaptureFormatVersion = 1;
+//! Alignment of the header size and of every record.
+constexpr uint32_t kCaptureAlignment = 8;
+//! Magic bytes ending a capture with an index.
+constexpr char kCaptureIndexMagic[8] = {'R', 'I', 'P', 'L', 'I', 'D', 'X',
+                                        '\0'};
+
+//! How the payload of a record is stored.
+enum class CaptureEncoding : uint16_t {
+  //! The burst data as read from the sensor.
+  kRaw = 0,
+  //! The burst data encoded with EncodeLossless, see BurstCodec.hpp.
+  kLossless = 1,
+  //! The burst data encoded with EncodeLossy, see BurstCodec.hpp.
+  kLossy = 2,
+  //! Not a burst, the index of the capture.
+  kIndex = 0xffff,
+};
+
+//! Which getter a param snapshot was read with.
+enum class CaptureParamKind : uint8_t {
+  kMain = 0,
+  kTx = 1,
+  kRx = 2,
+  kVendor = 3,
+  kVendorTx = 4,
+  kVendorRx = 5,
+};
+
+//! The fixed part of the capture header.
+struct CaptureFileHeader {
+  char magic[8];
+  uint32_t byte_order;
+  uint32_t format_version;
+  //! Bytes of the whole header, the offset of the first record.
+  uint32_t header_bytes;
+  //! Version returned by radarGetRadarApiVersion.
+  Version api_version;
+  Version driver_version;
+  uint32_t device_id;
+  RadarType radar_type;
+  uint8_t num_active_slots;
+  uint16_t name_bytes;
+  uint16_t vendor_bytes;
+  uint16_t reserved;
+  uint32_t num_params;
+};
+
+//! The value of a param in a config slot.
+struct CaptureParam {
+  CaptureParamKind kind;
+  uint8_t slot_id;
+  //! Group of main, TX and RX params, 0 for vendor params.
+  RadarParamGroup group;
+  uint32_t id;
+  //! The antenna of TX and RX params, 0 for the others.
+  uint32_t antenna_mask;
+  uint32_t value;
+};
+
+//! RadarBurstFormat with a fixed layout.
+struct CaptureBurstFormat {
+  uint32_t sequence_number;
+  RadarSampleDType sample_data_type;
+  RadarType radar_type;
+  uint8_t config_id;
+  uint8_t bits_per_sample;
+  uint8_t num_channels;
+  uint8_t is_channels_interleaved;
+  uint8_t is_big_endian;
+  RadarSamplePacking sample_packing;
+  uint8_t reserved;
+  //! The UWB session handle, 0 for other radars.
+  uint32_t session_handle;
+  //! Samples per chirp or per sweep.
+  uint16_t samples;
+  //! Chirps or sweeps per burst.
+  uint16_t chirps;
+};
+
+//! The header of a record.
+struct CaptureRecordHeader {
+  //! Bytes of the header, the payload and the padding.
+  uint32_t record_bytes;
+  uint32_t payload_bytes;
+  //! Time the burst was recorded at, nanoseconds since the Unix epoch.
+  uint64_t timestamp_ns;
+  //! Bytes of the burst once decoded.
+  uint32_t raw_bytes;
+  CaptureEncoding encoding;
+  uint16_t reserved;
+  CaptureBurstFormat format;
+};
+
+//! Where a burst is in a capture.
+struct CaptureIndexEntry {
+  //! Offset of the record in the file.
+  uint64_t offset;
+  uint64_t timestamp_ns;
+  uint32_t sequence_number;
+  uint8_t config_id;
+  uint8_t reserved[3];
+};
+
+//! The end of the index record and of an indexed capture.
+struct CaptureIndexTrailer {
+  //! Offset of the index record in the file.
+  uint64_t index_offset;
+  char magic[8];
+};
+
+static_assert(sizeof(CaptureFileHeader) == 44, "Capture header layout");
+static_assert(sizeof(CaptureParam) == 16, "Capture param layout");
+static_assert(sizeof(CaptureBurstFormat) == 24, "Burst format layout");
+static_assert(sizeof(CaptureRecordHeader) == 48, "Record header layout");
+static_assert(sizeof(CaptureRecordHeader) % kCaptureAlignment == 0,
+              "Record header alignment");
+static_assert(sizeof(CaptureIndexEntry) == 24, "Index entry layout");
+static_assert(sizeof(CaptureIndexTrailer) == 16, "Index trailer layout");
+
+//! The header of a capture.
+struct CaptureHeader {
+  Version api_version;
+  std::string name;
+  std::string vendor;
+  uint32_t device_id;
+  RadarType radar_type;
+  Version driver_version;
+  std::vector<uint8_t> active_slots;
+  std::vector<CaptureParam> params;
+};
+
+//! Vendor params to read for the header, their IDs are not known otherwise.
+struct CaptureVendorParams {
+  std::vector<RadarVendorParam> params;
+  std::vector<RadarVendorTxParam> tx_params;
+  std::vector<RadarVendorRxParam> rx_params;
+};
+
+/**
+ * @brief Read the header of a capture from a sensor.
+ *
+ * @details Reads the sensor info and every main, TX and RX param defined by
+ *          the Radar API for the common group and the group of the radar
+ *          type, for every active slot and every enabled antenna. Params
+ *          that cannot be read are left out.
+ *
+ * @param radar the radar sensor.
+ * @param vendor_params the vendor params to read as well.
+ * @param header where the header will be written into.
+ *
+ * @return RC_OK or the error of reading the sensor info or active configs.
+ */
+RadarReturnCode GetCaptureHeader(radar_api::IRadarSensor& radar,
+                                 const CaptureVendorParams& vendor_params,
+                                 CaptureHeader& header);
+
+/**
+ * @brief Serialize a capture header.
+ *
+ * @return RC_OK or RC_BAD_INPUT for a header too large for the format.
+ */
+RadarReturnCode SerializeCaptureHeader(const CaptureHeader& header,
+                                       std::vector<uint8_t>& bytes);
+
+/**
+ * @brief Parse the header at the start of a capture.
+ *
+ * @param data the capture.
+ * @param size the size of the capture.
+ * @param header where the header will be written into.
+ * @param header_bytes where the offset of the first record will be written.
+ *
+ * @return RC_OK, RC_BAD_INPUT if the data is not a capture or is truncated,
+ *         RC_UNSUPPORTED for another byte order or a newer format.
+ */
+RadarReturnCode ParseCaptureHeader(const uint8_t* data, size_t size,
+                                   CaptureHeader& header,
+                                   size_t& header_bytes);
+
+/**
+ * @brief Parse the header of a record.
+ *
+ * @param data the record.
+ * @param size the bytes left in the capture.
+ * @param record where the header will be written into.
+ *
+ * @return RC_OK, or RC_BAD_INPUT at the end of the capture or for
+ *         a truncated or corrupted record.
+ */
+RadarReturnCode ParseCaptureRecord(const uint8_t* data, size_t size,
+                                   CaptureRecordHeader& record);
+
+//! Get the bytes of a record of a payload.
+inline uint32_t GetCaptureRecordBytes(uint32_t payload_bytes) {
+  uint32_t bytes = sizeof(CaptureRecordHeader) + payload_bytes;
+  return (bytes + kCaptureAlignment - 1) / kCaptureAlignment *
+         kCaptureAlignment;
+}
+
+/**
+ * @brief Serialize the index record of a capture.
+ *
+ * @param entries the bursts of the capture, in file order.
+ * @param index_offset the offset the record will be written at, the end of
+ *        the last burst record.
+ * @param bytes where the record will be written into.
+ *
+ * @return RC_OK or RC_BAD_INPUT for an index too large for a record.
+ */
+RadarReturnCode SerializeCaptureIndex(
+    const std::vector<CaptureIndexEntry>& entries, uint64_t index_offset,
+    std::vector<uint8_t>& bytes);
+
+/**
+ * @brief Parse the index at the end of a capture.
+ *
+ * @param data the capture.
+ * @param size the size of the capture.
+ * @param header_bytes the offset of the first record.
+ * @param entries where the bursts of the capture will be written into.
+ *
+ * @return RC_OK, or RC_BAD_INPUT if the capture does not end with a valid
+ *         index.
+ */
+RadarReturnCode ParseCaptureIndex(const uint8_t* data, size_t size,
+                                  size_t header_bytes,
+                                  std::vector<CaptureIndexEntry>& entries);
+
+/**
+ * @brief Build the index of a capture by scanning its records.
+ *
+ * @param data the capture.
+ * @param size the size of the capture.
+ * @param header_bytes the offset of the first record.
+ * @param entries where the bursts of the capture will be written into.
+ * @param records_end where the end of the last burst record, complete or
+ *        not, will be written.
+ */
+void BuildCaptureIndex(const uint8_t* data, size_t size, size_t header_bytes,
+                       std::vector<CaptureIndexEntry>& entries,
+                       size_t& records_end);
+
+//! Get the index entry of a record.
+void ToCaptureIndexEntry(uint64_t offset, const CaptureRecordHeader& record,
+                         CaptureIndexEntry& entry);
+
+//! Convert a burst format to its layout in captures.
+void ToCaptureBurstFormat(const RadarBurstFormat& format,
+                          CaptureBurstFormat& capture_format);
+
+//! Convert a burst format back from its layout in captures.
+void FromCaptureBurstFormat(const CaptureBurstFormat& capture_format,
+                            RadarBurstFormat& format);
+
+}  // namespace radar_utils
+
+#endif  // RIPPLE_RADAR_UTILS_CAPTUREFORMAT_HPP_
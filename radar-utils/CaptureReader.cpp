@@ -0,0 +1,259 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <CaptureReader.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+namespace radar_utils {
+
+namespace {
+
+// Compares the positions of two bursts, or a position with a key.
+struct SequenceLess {
+  const std::vector<CaptureIndexEntry>& entries;
+
+  bool operator()(uint32_t position, uint32_t sequence_number) const {
+    return entries[position].sequence_number < sequence_number;
+  }
+  bool Sorts(uint32_t lhs, uint32_t rhs) const {
+    return entries[lhs].sequence_number < entries[rhs].sequence_number;
+  }
+};
+
+struct TimeLess {
+  const std::vector<CaptureIndexEntry>& entries;
+
+  bool operator()(uint32_t position, uint64_t timestamp_ns) const {
+    return entries[position].timestamp_ns < timestamp_ns;
+  }
+  bool Sorts(uint32_t lhs, uint32_t rhs) const {
+    return entries[lhs].timestamp_ns < entries[rhs].timestamp_ns;
+  }
+};
+
+// Bursts are recorded in order, the positions are sorted only when they are
+// not already.
+template <typename Less>
+void SortPositions(std::vector<uint32_t>& positions, Less less) {
+  auto sorts = [&less](uint32_t lhs, uint32_t rhs) {
+    return less.Sorts(lhs, rhs);
+  };
+  if (!std::is_sorted(positions.begin(), positions.end(), sorts)) {
+    std::stable_sort(positions.begin(), positions.end(), sorts);
+  }
+}
+
+}  // namespace
+
+CaptureReader::~CaptureReader() {
+  Close();
+}
+
+RadarReturnCode CaptureReader::Open(const std::string& path) {
+  if (IsOpen()) {
+    return RC_BAD_STATE;
+  }
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return RC_ERROR;
+  }
+  struct stat stat_buf;
+  void* data = MAP_FAILED;
+  size_t size = 0;
+  if (fstat(fd, &stat_buf) == 0 && stat_buf.st_size > 0) {
+    size = static_cast<size_t>(stat_buf.st_size);
+    data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  // The mapping keeps the file open.
+  close(fd);
+  if (data == MAP_FAILED) {
+    return RC_ERROR;
+  }
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  RadarReturnCode rc = ParseCaptureHeader(bytes, size, header_,
+                                          header_bytes_);
+  if (rc != RC_OK) {
+    munmap(data, size);
+    return rc;
+  }
+  data_ = bytes;
+  size_ = size;
+
+  is_index_rebuilt_ =
+      ParseCaptureIndex(data_, size_, header_bytes_, entries_) != RC_OK;
+  if (is_index_rebuilt_) {
+    BuildCaptureIndex(data_, size_, header_bytes_, entries_, records_end_);
+  } else {
+    records_end_ = static_cast<size_t>(
+        size_ - GetCaptureRecordBytes(static_cast<uint32_t>(
+                    entries_.size() * sizeof(CaptureIndexEntry) +
+                    sizeof(CaptureIndexTrailer))));
+  }
+  BuildViews();
+  return RC_OK;
+}
+
+void CaptureReader::Close(void) {
+  if (data_ != nullptr) {
+    munmap(const_cast<uint8_t*>(data_), size_);
+  }
+  data_ = nullptr;
+  size_ = 0;
+  header_bytes_ = 0;
+  records_end_ = 0;
+  is_index_rebuilt_ = false;
+  entries_.clear();
+  views_.clear();
+}
+
+RadarReturnCode CaptureReader::GetRecord(const CaptureIndexEntry& entry,
+                                         CaptureRecordHeader& record,
+                                         const uint8_t*& payload) const {
+  if (!IsOpen()) {
+    return RC_BAD_STATE;
+  }
+  if (entry.offset < header_bytes_ || entry.offset >= records_end_) {
+    return RC_BAD_INPUT;
+  }
+  const size_t offset = static_cast<size_t>(entry.offset);
+  if (ParseCaptureRecord(data_ + offset, records_end_ - offset, record) !=
+          RC_OK ||
+      record.encoding == CaptureEncoding::kIndex) {
+    return RC_BAD_INPUT;
+  }
+  payload = data_ + offset + sizeof(record);
+  return RC_OK;
+}
+
+RadarReturnCode CaptureReader::FindBySequence(
+    uint32_t first, uint32_t last, int config_id,
+    std::vector<CaptureIndexEntry>& entries) const {
+  if (!IsOpen()) {
+    return RC_BAD_STATE;
+  }
+  const View* view = GetView(config_id);
+  if (view == nullptr || first > last) {
+    return RC_BAD_INPUT;
+  }
+  const SequenceLess less{entries_};
+  auto begin = std::lower_bound(view->by_sequence.begin(),
+                                view->by_sequence.end(), first, less);
+  auto end = last == UINT32_MAX
+                 ? view->by_sequence.end()
+                 : std::lower_bound(begin, view->by_sequence.end(),
+                                    last + 1, less);
+  entries.clear();
+  entries.reserve(end - begin);
+  for (auto it = begin; it != end; ++it) {
+    entries.push_back(entries_[*it]);
+  }
+  return RC_OK;
+}
+
+RadarReturnCode CaptureReader::FindByTime(
+    uint64_t first_ns, uint64_t last_ns, int config_id,
+    std::vector<CaptureIndexEntry>& entries) const {
+  if (!IsOpen()) {
+    return RC_BAD_STATE;
+  }
+  const View* view = GetView(config_id);
+  if (view == nullptr || first_ns > last_ns) {
+    return RC_BAD_INPUT;
+  }
+  const TimeLess less{entries_};
+  auto begin = std::lower_bound(view->by_time.begin(), view->by_time.end(),
+                                first_ns, less);
+  auto end = last_ns == UINT64_MAX
+                 ? view->by_time.end()
+                 : std::lower_bound(begin, view->by_time.end(), last_ns + 1,
+                                    less);
+  entries.clear();
+  entries.reserve(end - begin);
+  for (auto it = begin; it != end; ++it) {
+    entries.push_back(entries_[*it]);
+  }
+  return RC_OK;
+}
+
+void CaptureReader::BuildViews(void) {
+  views_.assign(kNumConfigIds + 1, View());
+  View& all = views_[kNumConfigIds];
+  all.by_sequence.reserve(entries_.size());
+  for (uint32_t i = 0; i < entries_.size(); ++i) {
+    all.by_sequence.push_back(i);
+    views_[entries_[i].config_id].by_sequence.push_back(i);
+  }
+  for (View& view : views_) {
+    view.by_time = view.by_sequence;
+    SortPositions(view.by_sequence, SequenceLess{entries_});
+    SortPositions(view.by_time, TimeLess{entries_});
+  }
+}
+
+const CaptureReader::View* CaptureReader::GetView(int config_id) const {
+  if (config_id == kCaptureAnyConfig) {
+    return &views_[kNumConfigIds];
+  }
+  if (config_id < 0 || config_id >= kNumConfigIds) {
+    return nullptr;
+  }
+  return &views_[config_id];
+}
+
+RadarReturnCode RepairCapture(const std::string& path) {
+  std::vector<CaptureIndexEntry> entries;
+  size_t records_end = 0;
+  {
+    CaptureReader reader;
+    RadarReturnCode rc = reader.Open(path);
+    if (rc != RC_OK) {
+      return rc;
+    }
+    if (!reader.IsIndexRebuilt()) {
+      return RC_OK;
+    }
+    entries = reader.GetEntries();
+    records_end = reader.GetRecordsEnd();
+  }
+
+  std::vector<uint8_t> index_bytes;
+  RadarReturnCode rc = SerializeCaptureIndex(entries, records_end,
+                                             index_bytes);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  int fd = open(path.c_str(), O_WRONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return RC_ERROR;
+  }
+  rc = RC_OK;
+  if (ftruncate(fd, static_cast<off_t>(records_end)) != 0 ||
+      lseek(fd, static_cast<off_t>(records_end), SEEK_SET) < 0) {
+    rc = RC_ERROR;
+  }
+  const uint8_t* data = index_bytes.data();
+  size_t size = index_bytes.size();
+  while (rc == RC_OK && size > 0) {
+    ssize_t bytes = write(fd, data, size);
+    if (bytes < 0) {
+      if (errno != EINTR) {
+        rc = RC_ERROR;
+      }
+      continue;
+    }
+    data += bytes;
+    size -= bytes;
+  }
+  if (close(fd) != 0 && rc == RC_OK) {
+    rc = RC_ERROR;
+  }
+  return rc;
+}
+
+}  // namespace radar_utils
@@ -0,0 +1,181 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Random access to the bursts of a capture file.
+ *
+ * @details The capture is mapped into memory and its index is loaded from
+ *          the end of the file, so the bursts of a range of sequence numbers
+ *          or of recording times are found with a binary search instead of
+ *          a scan of the records. Ranges can be restricted to the bursts of
+ *          one config. See CaptureFormat.hpp for the file format.
+ *
+ *          A capture without a valid index, such as one left truncated by
+ *          a recording that did not complete, is opened all the same: its
+ *          index is rebuilt in memory by scanning the complete records.
+ *          RepairCapture writes the rebuilt index to the file, so the scan
+ *          is done once.
+ *
+ *          A reader is not modified once open, its const members can be
+ *          called from any thread.
+ *
+ * @note Requires POSIX.
+ *
+ * Example:
+ * ```
+ *   radar_utils::CaptureReader reader;
+ *   rc = reader.Open("bursts.cap");
+ *   std::vector<radar_utils::CaptureIndexEntry> entries;
+ *   rc = reader.FindBySequence(1000, 1999, 0, entries);
+ *   for (const radar_utils::CaptureIndexEntry& entry : entries) {
+ *     rc = reader.GetRecord(entry, record, payload);
+ *   }
+ * ```
+ */
+#ifndef RIPPLE_RADAR_UTILS_CAPTUREREADER_HPP_
+#define RIPPLE_RADAR_UTILS_CAPTUREREADER_HPP_
+
+#include <RadarCommon.h>
+
+#include <CaptureFormat.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace radar_utils {
+
+//! The config ID to find the bursts of every config.
+constexpr int kCaptureAnyConfig = -1;
+
+class CaptureReader {
+ public:
+  CaptureReader() = default;
+  //! Close the capture if still open.
+  ~CaptureReader();
+
+  CaptureReader(const CaptureReader&) = delete;
+  CaptureReader& operator=(const CaptureReader&) = delete;
+
+  /**
+   * @brief Map a capture and load its index, or rebuild it.
+   *
+   * @param path the capture.
+   *
+   * @return RC_OK, RC_BAD_STATE if a capture is open, RC_ERROR if the file
+   *         cannot be mapped, or the error of parsing the header.
+   */
+  RadarReturnCode Open(const std::string& path);
+
+  //! Unmap the capture.
+  void Close(void);
+
+  bool IsOpen(void) const {
+    return data_ != nullptr;
+  }
+
+  //! Check if the index was rebuilt because the capture has none.
+  bool IsIndexRebuilt(void) const {
+    return is_index_rebuilt_;
+  }
+
+  const CaptureHeader& GetHeader(void) const {
+    return header_;
+  }
+
+  //! Get the mapped capture.
+  const uint8_t* GetData(void) const {
+    return data_;
+  }
+
+  size_t GetSize(void) const {
+    return size_;
+  }
+
+  //! Get the end of the last complete burst record.
+  size_t GetRecordsEnd(void) const {
+    return records_end_;
+  }
+
+  //! Get the bursts of the capture, in file order.
+  const std::vector<CaptureIndexEntry>& GetEntries(void) const {
+    return entries_;
+  }
+
+  /**
+   * @brief Get the record of a burst.
+   *
+   * @param entry the burst, from the index of this capture.
+   * @param record where the record header will be written.
+   * @param payload where a pointer to the payload in the mapping will be
+   *        written, valid until Close.
+   *
+   * @return RC_OK, RC_BAD_STATE if no capture is open, RC_BAD_INPUT if the
+   *         entry is not a burst record of the capture.
+   */
+  RadarReturnCode GetRecord(const CaptureIndexEntry& entry,
+                            CaptureRecordHeader& record,
+                            const uint8_t*& payload) const;
+
+  /**
+   * @brief Find the bursts of a range of sequence numbers.
+   *
+   * @param first the first sequence number of the range.
+   * @param last the last sequence number of the range, included.
+   * @param config_id the config of the bursts, or kCaptureAnyConfig.
+   * @param entries where the bursts will be written, by sequence number and
+   *        in file order for equal ones.
+   *
+   * @return RC_OK, RC_BAD_STATE if no capture is open, RC_BAD_INPUT for an
+   *         empty range or an invalid config ID.
+   */
+  RadarReturnCode FindBySequence(uint32_t first, uint32_t last,
+                                 int config_id,
+                                 std::vector<CaptureIndexEntry>& entries)
+      const;
+
+  //! Find the bursts recorded in a range of time, nanoseconds since the Unix
+  //! epoch, as FindBySequence.
+  RadarReturnCode FindByTime(uint64_t first_ns, uint64_t last_ns,
+                             int config_id,
+                             std::vector<CaptureIndexEntry>& entries) const;
+
+ private:
+  static const int kNumConfigIds = 256;
+
+  //! Positions in entries_ of the bursts of a config, or of every burst.
+  struct View {
+    std::vector<uint32_t> by_sequence;
+    std::vector<uint32_t> by_time;
+  };
+
+  void BuildViews(void);
+  const View* GetView(int config_id) const;
+
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+  size_t header_bytes_ = 0;
+  size_t records_end_ = 0;
+  bool is_index_rebuilt_ = false;
+  CaptureHeader header_;
+  std::vector<CaptureIndexEntry> entries_;
+  //! The views of every config, then the view of every burst.
+  std::vector<View> views_;
+};
+
+/**
+ * @brief Write the index of a capture that has none.
+ *
+ * @details The truncated record left by a recording that did not complete is
+ *          removed, so the capture can be repaired once.
+ *
+ * @param path the capture.
+ *
+ * @return RC_OK, also for a capture with an index, RC_ERROR if the file
+ *         cannot be written, or the error of opening it.
+ */
+RadarReturnCode RepairCapture(const std::string& path);
+
+}  // namespace radar_utils
+
+#endif  // RIPPLE_RADAR_UTILS_CAPTUREREADER_HPP_
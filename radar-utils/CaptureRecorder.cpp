@@ -0,0 +1,316 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <CaptureRecorder.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace radar_utils {
+
+namespace {
+
+size_t GetWriteBytes(const CaptureRecorderConfig& config) {
+  size_t bytes = std::max<size_t>(config.write_bytes, 1);
+  return (bytes + kCaptureWriteAlignment - 1) / kCaptureWriteAlignment *
+         kCaptureWriteAlignment;
+}
+
+uint64_t GetTimestampNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+CaptureRecorder::CaptureRecorder(const CaptureRecorderConfig& config)
+    : config_(config),
+      write_bytes_(GetWriteBytes(config)),
+      ring_bytes_(write_bytes_ * std::max<uint32_t>(config.num_writes, 1)) {}
+
+CaptureRecorder::~CaptureRecorder() {
+  if (IsOpen()) {
+    Close();
+  }
+}
+
+RadarReturnCode CaptureRecorder::Open(const std::string& path,
+                                      radar_api::IRadarSensor& radar) {
+  if (IsOpen()) {
+    return RC_BAD_STATE;
+  }
+  CaptureHeader header;
+  RadarReturnCode rc = GetCaptureHeader(radar, config_.vendor_params, header);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  return Open(path, header);
+}
+
+RadarReturnCode CaptureRecorder::Open(const std::string& path,
+                                      const CaptureHeader& header) {
+  if (IsOpen()) {
+    return RC_BAD_STATE;
+  }
+  std::vector<uint8_t> header_bytes;
+  RadarReturnCode rc = SerializeCaptureHeader(header, header_bytes);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (header_bytes.size() > ring_bytes_) {
+    return RC_BAD_INPUT;
+  }
+  if (!ring_) {
+    void* ring = nullptr;
+    if (posix_memalign(&ring, kCaptureWriteAlignment, ring_bytes_) != 0) {
+      return RC_RES_LIMIT;
+    }
+    ring_.reset(static_cast<uint8_t*>(ring));
+  }
+
+  const int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+  is_direct_io_ = false;
+#ifdef O_DIRECT
+  if (config_.use_direct_io) {
+    fd_ = open(path.c_str(), flags | O_DIRECT, 0644);
+    is_direct_io_ = fd_ >= 0;
+  }
+#endif
+  if (fd_ < 0) {
+    fd_ = open(path.c_str(), flags, 0644);
+  }
+  if (fd_ < 0) {
+    return RC_ERROR;
+  }
+
+  head_ = 0;
+  index_.clear();
+  published_.store(0, std::memory_order_relaxed);
+  recorded_.store(0, std::memory_order_relaxed);
+  dropped_.store(0, std::memory_order_relaxed);
+  high_watermark_.store(0, std::memory_order_relaxed);
+  raw_bytes_.store(0, std::memory_order_relaxed);
+  payload_bytes_.store(0, std::memory_order_relaxed);
+  written_.store(0, std::memory_order_relaxed);
+  error_.store(RC_OK, std::memory_order_relaxed);
+  stopping_.store(false, std::memory_order_relaxed);
+  Append(header_bytes.data(), header_bytes.size());
+  writer_ = std::thread(&CaptureRecorder::Write, this);
+  return RC_OK;
+}
+
+RadarReturnCode CaptureRecorder::Record(const RadarBurstFormat& format,
+                                        const uint8_t* data,
+                                        uint32_t size_bytes) {
+  return Record(format, data, size_bytes, GetTimestampNs());
+}
+
+RadarReturnCode CaptureRecorder::Record(const RadarBurstFormat& format,
+                                        const uint8_t* data,
+                                        uint32_t size_bytes,
+                                        uint64_t timestamp_ns) {
+  if (!IsOpen()) {
+    return RC_BAD_STATE;
+  }
+  const uint8_t* payload = data;
+  uint32_t payload_bytes = size_bytes;
+  CaptureEncoding encoding = CaptureEncoding::kRaw;
+  RadarReturnCode encode_rc = RC_UNSUPPORTED;
+  if (config_.encoding == CaptureEncoding::kLossless) {
+    encode_rc = radar_dsp::EncodeLossless(format, data, size_bytes, encoded_);
+  } else if (config_.encoding == CaptureEncoding::kLossy) {
+    encode_rc = radar_dsp::EncodeLossy(format, data, size_bytes,
+                                       config_.lossy, encoded_);
+  }
+  if (encode_rc == RC_OK && encoded_.size() < size_bytes) {
+    payload = encoded_.data();
+    payload_bytes = static_cast<uint32_t>(encoded_.size());
+    encoding = config_.encoding;
+  }
+  RadarReturnCode rc = error_.load(std::memory_order_relaxed);
+  if (rc == RC_OK &&
+      payload_bytes > ring_bytes_ - sizeof(CaptureRecordHeader)) {
+    rc = RC_BAD_INPUT;
+  }
+  const uint32_t record_bytes = GetCaptureRecordBytes(payload_bytes);
+  const uint64_t pending = head_ + record_bytes -
+                           written_.load(std::memory_order_acquire);
+  if (rc == RC_OK && pending > ring_bytes_) {
+    rc = RC_RES_LIMIT;
+  }
+  if (rc != RC_OK) {
+    dropped_.store(dropped_.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_relaxed);
+    return rc;
+  }
+
+  CaptureRecordHeader record;
+  std::memset(&record, 0, sizeof(record));
+  record.record_bytes = record_bytes;
+  record.payload_bytes = payload_bytes;
+  record.timestamp_ns = timestamp_ns;
+  record.raw_bytes = size_bytes;
+  record.encoding = encoding;
+  ToCaptureBurstFormat(format, record.format);
+  if (config_.write_index) {
+    CaptureIndexEntry entry;
+    ToCaptureIndexEntry(head_, record, entry);
+    index_.push_back(entry);
+  }
+  Append(&record, sizeof(record));
+  Append(payload, payload_bytes);
+  static const uint8_t kPadding[kCaptureAlignment] = {};
+  Append(kPadding, record_bytes - sizeof(record) - payload_bytes);
+
+  recorded_.store(recorded_.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
+  raw_bytes_.store(raw_bytes_.load(std::memory_order_relaxed) + size_bytes,
+                   std::memory_order_relaxed);
+  payload_bytes_.store(
+      payload_bytes_.load(std::memory_order_relaxed) + payload_bytes,
+      std::memory_order_relaxed);
+  if (pending > high_watermark_.load(std::memory_order_relaxed)) {
+    high_watermark_.store(pending, std::memory_order_relaxed);
+  }
+  // Only whole writes are handed to the writer until Close.
+  Publish(head_ - head_ % write_bytes_);
+  return RC_OK;
+}
+
+RadarReturnCode CaptureRecorder::Close() {
+  if (!IsOpen()) {
+    return RC_BAD_STATE;
+  }
+  Publish(head_);
+  {
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    stopping_.store(true, std::memory_order_release);
+  }
+  wait_cv_.notify_all();
+  writer_.join();
+
+  RadarReturnCode rc = error_.load(std::memory_order_relaxed);
+  if (rc == RC_OK && config_.write_index) {
+    // The head is the end of the file once the ring is written.
+    std::vector<uint8_t> index_bytes;
+    rc = SerializeCaptureIndex(index_, head_, index_bytes);
+    if (rc == RC_OK && !WriteAll(index_bytes.data(), index_bytes.size())) {
+      rc = RC_ERROR;
+    }
+    if (rc == RC_OK) {
+      written_.store(written_.load(std::memory_order_relaxed) +
+                     index_bytes.size(), std::memory_order_relaxed);
+    }
+  }
+  index_.clear();
+  index_.shrink_to_fit();
+  if (close(fd_) != 0 && rc == RC_OK) {
+    rc = RC_ERROR;
+  }
+  fd_ = -1;
+  return rc;
+}
+
+CaptureRecorderStats CaptureRecorder::GetStats() const {
+  CaptureRecorderStats stats;
+  stats.recorded = recorded_.load(std::memory_order_relaxed);
+  stats.dropped = dropped_.load(std::memory_order_relaxed);
+  stats.bytes_written = written_.load(std::memory_order_relaxed);
+  stats.raw_bytes = raw_bytes_.load(std::memory_order_relaxed);
+  stats.payload_bytes = payload_bytes_.load(std::memory_order_relaxed);
+  stats.high_watermark_bytes =
+      high_watermark_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void CaptureRecorder::Append(const void* data, size_t size) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  while (size > 0) {
+    // The ring is contiguous, copies wrap around once at most.
+    size_t offset = head_ % ring_bytes_;
+    size_t chunk = std::min(size, ring_bytes_ - offset);
+    std::memcpy(ring_.get() + offset, bytes, chunk);
+    head_ += chunk;
+    bytes += chunk;
+    size -= chunk;
+  }
+}
+
+void CaptureRecorder::Publish(uint64_t end) {
+  if (end == published_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  published_.store(end, std::memory_order_release);
+  // Orders the published bytes before checking for a waiting writer, pairs
+  // with the fence in Write.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (writer_waiting_.load(std::memory_order_relaxed)) {
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    wait_cv_.notify_all();
+  }
+}
+
+void CaptureRecorder::Write() {
+  while (true) {
+    uint64_t written = written_.load(std::memory_order_relaxed);
+    uint64_t published = published_.load(std::memory_order_acquire);
+    if (published == written) {
+      if (stopping_.load(std::memory_order_acquire) &&
+          published_.load(std::memory_order_acquire) == written) {
+        return;
+      }
+      std::unique_lock<std::mutex> lock(wait_mutex_);
+      writer_waiting_.store(true, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      wait_cv_.wait(lock, [this, written] {
+        return published_.load(std::memory_order_acquire) != written ||
+               stopping_.load(std::memory_order_acquire);
+      });
+      writer_waiting_.store(false, std::memory_order_relaxed);
+      continue;
+    }
+
+    // Up to the end of the ring, the rest is written next round.
+    size_t offset = written % ring_bytes_;
+    size_t size = std::min<uint64_t>(published - written,
+                                     ring_bytes_ - offset);
+    if (error_.load(std::memory_order_relaxed) == RC_OK &&
+        !WriteAll(ring_.get() + offset, size)) {
+      error_.store(RC_ERROR, std::memory_order_relaxed);
+    }
+    written_.store(written + size, std::memory_order_release);
+  }
+}
+
+bool CaptureRecorder::WriteAll(const uint8_t* data, size_t size) {
+#ifdef O_DIRECT
+  if (is_direct_io_ &&
+      (size % kCaptureWriteAlignment != 0 ||
+       reinterpret_cast<uintptr_t>(data) % kCaptureWriteAlignment != 0)) {
+    // The tail and the index written by Close are not whole aligned blocks.
+    int flags = fcntl(fd_, F_GETFL);
+    if (flags < 0 || fcntl(fd_, F_SETFL, flags & ~O_DIRECT) != 0) {
+      return false;
+    }
+    is_direct_io_ = false;
+  }
+#endif
+  while (size > 0) {
+    ssize_t bytes = write(fd_, data, size);
+    if (bytes < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += bytes;
+    size -= bytes;
+  }
+  return true;
+}
+
+}  // namespace radar_utils
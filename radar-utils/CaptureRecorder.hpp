@@ -0,0 +1,214 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Recording of bursts into a capture file from a background thread.
+ *
+ * @details Record copies a burst into a ring of aligned memory and returns,
+ *          a writer thread writes the ring to the file in large writes of
+ *          write_bytes, aligned in memory and in the file. The thread reading
+ *          the bursts never waits for the disk: when the ring is full because
+ *          the disk falls behind, the burst is dropped and counted instead.
+ *
+ *          With use_direct_io the file bypasses the page cache on Linux, so
+ *          long captures do not evict the data of the processing. It falls
+ *          back to buffered writes where direct I/O is not supported.
+ *
+ *          The bursts left in the ring are written by Close, followed by the
+ *          index of the capture with write_index. A recording that does not
+ *          complete loses them and ends with a truncated record, ignored by
+ *          the readers, and has no index, see CaptureReader.hpp.
+ *
+ *          With CaptureEncoding::kLossless the bursts are compressed by
+ *          Record before they are copied, for the formats supported by
+ *          BurstCodec.hpp. CaptureEncoding::kLossy compresses them further
+ *          for archival, within the error allowed by the lossy config. The
+ *          other formats, and the bursts that fail to encode or would not
+ *          get smaller, are recorded raw.
+ *
+ *          Record and Close must be called from one thread at a time.
+ *
+ * @note Requires POSIX.
+ *
+ * Example:
+ * ```
+ *   radar_utils::CaptureRecorder recorder;
+ *   rc = recorder.Open("bursts.cap", *radar);
+ *   while (radar->ReadBurst(format, raw_radar_data, timeout) == RC_OK) {
+ *     recorder.Record(format, raw_radar_data);
+ *   }
+ *   rc = recorder.Close();
+ * ```
+ */
+#ifndef RIPPLE_RADAR_UTILS_CAPTURERECORDER_HPP_
+#define RIPPLE_RADAR_UTILS_CAPTURERECORDER_HPP_
+
+#include <IRadarSensor.hpp>
+#include <RadarCommon.h>
+
+#include <BurstCodec.hpp>
+#include <CaptureFormat.hpp>
+#include <SpscQueue.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace radar_utils {
+
+//! Alignment of the ring, the writes and their offsets in the file.
+constexpr uint32_t kCaptureWriteAlignment = 4096;
+
+struct CaptureRecorderConfig {
+  //! Bytes of every write, rounded up to kCaptureWriteAlignment.
+  uint32_t write_bytes = 1 << 20;
+  //! Writes the ring holds, bursts are dropped when they are all pending.
+  uint32_t num_writes = 64;
+  //! Bypass the page cache when supported.
+  bool use_direct_io = false;
+  //! Write the index of the bursts at the end of the capture on Close.
+  bool write_index = true;
+  //! Encoding of the recorded bursts, kRaw, kLossless or kLossy.
+  CaptureEncoding encoding = CaptureEncoding::kRaw;
+  //! Error allowed by kLossy.
+  radar_dsp::LossyConfig lossy;
+  //! Vendor params to store in the header of captures opened from a sensor.
+  CaptureVendorParams vendor_params;
+};
+
+//! Recorder counters.
+struct CaptureRecorderStats {
+  //! Bursts copied into the ring.
+  uint64_t recorded;
+  //! Bursts dropped because the ring was full or the file failed.
+  uint64_t dropped;
+  //! Bytes written to the file.
+  uint64_t bytes_written;
+  //! Bytes of the recorded bursts, before and after they were encoded.
+  uint64_t raw_bytes;
+  uint64_t payload_bytes;
+  //! The maximum number of bytes that were waiting to be written.
+  uint64_t high_watermark_bytes;
+};
+
+class CaptureRecorder {
+ public:
+  explicit CaptureRecorder(
+      const CaptureRecorderConfig& config = CaptureRecorderConfig());
+  //! Close the capture if still open.
+  ~CaptureRecorder();
+
+  CaptureRecorder(const CaptureRecorder&) = delete;
+  CaptureRecorder& operator=(const CaptureRecorder&) = delete;
+
+  /**
+   * @brief Create a capture with the header of a sensor.
+   *
+   * @details Reads the header with GetCaptureHeader, so the configs to be
+   *          recorded should be active.
+   *
+   * @param path the file to create, truncated if it exists.
+   * @param radar the radar sensor.
+   *
+   * @return RC_OK, RC_BAD_STATE if a capture is open, RC_ERROR if the file
+   *         cannot be created, RC_RES_LIMIT if the ring cannot be allocated,
+   *         or the error of reading the header.
+   */
+  RadarReturnCode Open(const std::string& path,
+                       radar_api::IRadarSensor& radar);
+
+  //! Create a capture with a given header.
+  RadarReturnCode Open(const std::string& path, const CaptureHeader& header);
+
+  bool IsOpen() const {
+    return fd_ >= 0;
+  }
+
+  /**
+   * @brief Copy a burst into the ring to be written. Never waits.
+   *
+   * @param format the burst format.
+   * @param data the burst data.
+   * @param size_bytes the size of the burst data.
+   *
+   * @return RC_OK, RC_RES_LIMIT if the burst was dropped because the ring is
+   *         full, RC_BAD_INPUT for a burst larger than the ring, RC_BAD_STATE
+   *         if no capture is open, RC_ERROR if writing the file failed.
+   */
+  RadarReturnCode Record(const RadarBurstFormat& format, const uint8_t* data,
+                         uint32_t size_bytes);
+
+  //! Record a burst with the time it was read at, nanoseconds since
+  //! the Unix epoch.
+  RadarReturnCode Record(const RadarBurstFormat& format, const uint8_t* data,
+                         uint32_t size_bytes, uint64_t timestamp_ns);
+
+  RadarReturnCode Record(const RadarBurstFormat& format,
+                         const std::vector<uint8_t>& raw_radar_data) {
+    return Record(format, raw_radar_data.data(),
+                  static_cast<uint32_t>(raw_radar_data.size()));
+  }
+
+  /**
+   * @brief Write the bursts left in the ring and the index, and close the
+   *        file.
+   *
+   * @return RC_OK, RC_BAD_STATE if no capture is open, RC_ERROR if writing
+   *         or closing the file failed.
+   */
+  RadarReturnCode Close();
+
+  //! Get a snapshot of the counters of the capture.
+  CaptureRecorderStats GetStats() const;
+
+ private:
+  struct FreeDeleter {
+    void operator()(uint8_t* data) const {
+      free(data);
+    }
+  };
+
+  void Append(const void* data, size_t size);
+  void Publish(uint64_t end);
+  void Write();
+  bool WriteAll(const uint8_t* data, size_t size);
+
+  const CaptureRecorderConfig config_;
+  const size_t write_bytes_;
+  const size_t ring_bytes_;
+  std::unique_ptr<uint8_t, FreeDeleter> ring_;
+  int fd_ = -1;
+  bool is_direct_io_ = false;
+  std::thread writer_;
+
+  // Written by the recording thread only.
+  uint64_t head_ = 0;
+  std::vector<CaptureIndexEntry> index_;
+  std::vector<uint8_t> encoded_;
+  std::atomic<uint64_t> raw_bytes_{0};
+  std::atomic<uint64_t> payload_bytes_{0};
+  std::atomic<uint64_t> published_{0};
+  std::atomic<uint64_t> recorded_{0};
+  std::atomic<uint64_t> dropped_{0};
+  std::atomic<uint64_t> high_watermark_{0};
+  char written_padding_[kCacheLineBytes];
+  // Written by the writer thread only.
+  std::atomic<uint64_t> written_{0};
+  std::atomic<RadarReturnCode> error_{RC_OK};
+  char flags_padding_[kCacheLineBytes];
+
+  std::atomic<bool> stopping_{false};
+  std::atomic<bool> writer_waiting_{false};
+  std::mutex wait_mutex_;
+  std::condition_variable wait_cv_;
+};
+
+}  // namespace radar_utils
+
+#endif  // RIPPLE_RADAR_UTILS_CAPTURERECORDER_HPP_
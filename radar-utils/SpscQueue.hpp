@@ -0,0 +1,358 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief A bounded lock-free single-producer/single-consumer queue.
+ *
+ * @details Elements are exchanged with std::swap so buffers owned by
+ *          the elements are recycled between the producer and the consumer
+ *          instead of being allocated per element. Waiting for data or for
+ *          space is done on a condition variable that is touched only when
+ *          the other side is actually waiting.
+ */
+#ifndef RIPPLE_RADAR_UTILS_SPSCQUEUE_HPP_
+#define RIPPLE_RADAR_UTILS_SPSCQUEUE_HPP_
+
+#include <RadarCommon.h>
+
+#include <Timespec.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace radar_utils {
+
+//! Size of a cache line used to pad data shared between threads.
+constexpr size_t kCacheLineBytes = 64;
+
+//! What to do when an element is pushed into a full queue.
+enum class DropPolicy {
+  //! Drop the oldest queued element to make space for the new one.
+  kDropOldest,
+  //! Drop the element being pushed.
+  kDropNewest,
+  //! Wait for the consumer to make space.
+  kBlock,
+};
+
+//! Queue counters.
+struct QueueStats {
+  //! Number of elements pushed into the queue.
+  uint64_t enqueued;
+  //! Number of elements popped by the consumer.
+  uint64_t dequeued;
+  //! Number of elements dropped by the drop policy.
+  uint64_t dropped;
+  //! The maximum number of elements that were queued at the same time.
+  uint32_t high_watermark;
+  //! Number of elements currently queued.
+  uint32_t size;
+};
+
+template <typename T>
+class SpscQueue {
+ public:
+  /**
+   * @param depth the maximum number of queued elements.
+   * @param policy what to do when pushing into a full queue.
+   */
+  SpscQueue(uint32_t depth, DropPolicy policy)
+      : depth_(depth > 0 ? depth : 1), policy_(policy), slots_(nullptr) {
+    // Every slot starts on its own cache line, which new does not
+    // guarantee for over-aligned types before C++17.
+    void* slots = nullptr;
+    if (posix_memalign(&slots, alignof(Slot), depth_ * sizeof(Slot)) != 0) {
+      throw std::bad_alloc();
+    }
+    slots_ = static_cast<Slot*>(slots);
+    for (uint32_t i = 0; i < depth_; ++i) {
+      new (&slots_[i]) Slot();
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  ~SpscQueue() {
+    for (uint32_t i = 0; i < depth_; ++i) {
+      slots_[i].~Slot();
+    }
+    free(slots_);
+  }
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  /**
+   * @brief Push an element. Must be called from the producer thread only.
+   *
+   * @details The element is swapped into the queue. On return the item
+   *          holds a recycled element that can be reused for the next push,
+   *          or the dropped oldest element when dropped_oldest is set.
+   *
+   * @param item the element to push.
+   * @param timeout the maximum time to wait for space with kBlock policy.
+   * @param dropped_oldest where it is set if the oldest element was dropped.
+   *
+   * @return RC_OK if pushed, RC_RES_LIMIT if dropped with kDropNewest policy,
+   *         RC_TIMEOUT if no space was made in time with kBlock policy,
+   *         RC_BAD_STATE if the queue is closed.
+   */
+  RadarReturnCode Push(T& item, timespec timeout, bool& dropped_oldest) {
+    dropped_oldest = false;
+    bool has_deadline = false;
+    std::chrono::steady_clock::time_point deadline;
+    while (true) {
+      if (closed_.load(std::memory_order_acquire)) {
+        return RC_BAD_STATE;
+      }
+      uint64_t pos = tail_.load(std::memory_order_relaxed);
+      Slot& slot = slots_[pos % depth_];
+      uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+      if (seq == pos) {
+        Publish(slot, pos, item);
+        return RC_OK;
+      }
+
+      uint64_t head = head_.load(std::memory_order_acquire);
+      if (pos - head < depth_) {
+        // The consumer has claimed the slot and is swapping it out.
+        std::this_thread::yield();
+        continue;
+      }
+
+      // The queue is full.
+      if (policy_ == DropPolicy::kDropNewest) {
+        dropped_.store(dropped_.load(std::memory_order_relaxed) + 1,
+                       std::memory_order_relaxed);
+        return RC_RES_LIMIT;
+      }
+      if (policy_ == DropPolicy::kDropOldest) {
+        // Claim the oldest element like a consumer would. When full,
+        // it lives in the very slot the new element goes to.
+        if (head_.compare_exchange_strong(head, head + 1,
+                                          std::memory_order_acq_rel)) {
+          dropped_.store(dropped_.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+          dropped_oldest = true;
+          Publish(slot, pos, item);
+          return RC_OK;
+        }
+        continue;
+      }
+
+      if (!has_deadline) {
+        deadline = ToDeadline(timeout);
+        has_deadline = true;
+      }
+      if (!WaitFor(producer_waiting_, deadline, [this, pos] {
+            return slots_[pos % depth_].sequence.load(
+                std::memory_order_acquire) == pos;
+          })) {
+        return closed_.load(std::memory_order_acquire) ? RC_BAD_STATE
+                                                       : RC_TIMEOUT;
+      }
+    }
+  }
+
+  //! Push an element when it does not matter if the oldest was dropped.
+  RadarReturnCode Push(T& item, timespec timeout) {
+    bool dropped_oldest = false;
+    return Push(item, timeout, dropped_oldest);
+  }
+
+  /**
+   * @brief Pop the oldest element. Must be called from the consumer only.
+   *
+   * @details The element is swapped out of the queue, the previous content
+   *          of item is recycled to the producer.
+   *
+   * @param item where the element will be swapped into.
+   * @param timeout the maximum time to wait if the queue is empty.
+   *
+   * @return RC_OK if popped, RC_TIMEOUT if nothing arrived in time,
+   *         RC_BAD_STATE if the queue is closed and empty.
+   */
+  RadarReturnCode Pop(T& item, timespec timeout) {
+    bool has_deadline = false;
+    std::chrono::steady_clock::time_point deadline;
+    while (true) {
+      uint64_t head = head_.load(std::memory_order_acquire);
+      Slot& slot = slots_[head % depth_];
+      uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+      if (seq == head + 1) {
+        // The producer can claim the same element to drop it.
+        if (!head_.compare_exchange_strong(head, head + 1,
+                                           std::memory_order_acq_rel)) {
+          continue;
+        }
+        std::swap(slot.value, item);
+        slot.sequence.store(head + depth_, std::memory_order_release);
+        dequeued_.store(dequeued_.load(std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+        Notify(producer_waiting_);
+        return RC_OK;
+      }
+      if (seq > head + 1) {
+        // The head has been moved by the producer dropping the oldest.
+        continue;
+      }
+
+      if (closed_.load(std::memory_order_acquire)) {
+        return RC_BAD_STATE;
+      }
+      if (IsZero(timeout)) {
+        return RC_TIMEOUT;
+      }
+      if (!has_deadline) {
+        deadline = ToDeadline(timeout);
+        has_deadline = true;
+      }
+      if (!WaitFor(consumer_waiting_, deadline, [this] {
+            return !IsEmpty();
+          })) {
+        return IsEmpty() && closed_.load(std::memory_order_acquire)
+                   ? RC_BAD_STATE
+                   : RC_TIMEOUT;
+      }
+    }
+  }
+
+  /**
+   * @brief Initialize the recycled element of every slot.
+   *
+   * @details Allows to preallocate buffers owned by the elements. Must be
+   *          called before the queue is used by the producer and consumer.
+   *
+   * @param init a function called with a reference to every slot element.
+   */
+  template <typename Function>
+  void InitSlots(Function init) {
+    for (uint32_t i = 0; i < depth_; ++i) {
+      init(slots_[i].value);
+    }
+  }
+
+  //! Check if there is nothing to pop.
+  bool IsEmpty() const {
+    return Size() == 0;
+  }
+
+  //! The number of queued elements.
+  uint32_t Size() const {
+    uint64_t head = head_.load(std::memory_order_acquire);
+    uint64_t tail = tail_.load(std::memory_order_acquire);
+    return tail > head ? static_cast<uint32_t>(tail - head) : 0;
+  }
+
+  //! The maximum number of queued elements.
+  uint32_t Depth() const {
+    return depth_;
+  }
+
+  //! Get a snapshot of the queue counters.
+  QueueStats GetStats() const {
+    QueueStats stats;
+    stats.enqueued = enqueued_.load(std::memory_order_relaxed);
+    stats.dequeued = dequeued_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    stats.high_watermark = high_watermark_.load(std::memory_order_relaxed);
+    stats.size = Size();
+    return stats;
+  }
+
+  /**
+   * @brief Close the queue and wake up the waiting threads.
+   *
+   * @details Pushes fail after the queue is closed. Elements queued before
+   *          can still be popped.
+   */
+  void Close() {
+    closed_.store(true, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    wait_cv_.notify_all();
+  }
+
+  //! Check if the queue has been closed.
+  bool IsClosed() const {
+    return closed_.load(std::memory_order_acquire);
+  }
+
+ private:
+  // Aligned so neighbour slots touched by the producer and the consumer
+  // do not share a cache line.
+  struct alignas(kCacheLineBytes) Slot {
+    std::atomic<uint64_t> sequence;
+    T value;
+  };
+
+  void Publish(Slot& slot, uint64_t pos, T& item) {
+    std::swap(slot.value, item);
+    slot.sequence.store(pos + 1, std::memory_order_release);
+    tail_.store(pos + 1, std::memory_order_release);
+
+    enqueued_.store(enqueued_.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+    uint32_t size = Size();
+    if (size > high_watermark_.load(std::memory_order_relaxed)) {
+      high_watermark_.store(size, std::memory_order_relaxed);
+    }
+    Notify(consumer_waiting_);
+  }
+
+  void Notify(std::atomic<bool>& waiting) {
+    // Orders the published slot before checking for a waiter, pairs with
+    // the fence in WaitFor.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting.load(std::memory_order_relaxed)) {
+      std::lock_guard<std::mutex> lock(wait_mutex_);
+      wait_cv_.notify_all();
+    }
+  }
+
+  template <typename Predicate>
+  bool WaitFor(std::atomic<bool>& waiting,
+               const std::chrono::steady_clock::time_point& deadline,
+               Predicate ready) {
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    waiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool is_ready = wait_cv_.wait_until(lock, deadline, [this, &ready] {
+      return ready() || closed_.load(std::memory_order_acquire);
+    });
+    waiting.store(false, std::memory_order_relaxed);
+    return is_ready && ready();
+  }
+
+  const uint32_t depth_;
+  const DropPolicy policy_;
+  Slot* slots_;
+
+  // Claimed by the consumer, and by the producer to drop the oldest.
+  char head_padding_[kCacheLineBytes];
+  std::atomic<uint64_t> head_{0};
+  char tail_padding_[kCacheLineBytes];
+  // Written by the producer only.
+  std::atomic<uint64_t> tail_{0};
+  std::atomic<uint64_t> enqueued_{0};
+  std::atomic<uint64_t> dropped_{0};
+  std::atomic<uint32_t> high_watermark_{0};
+  char dequeued_padding_[kCacheLineBytes];
+  // Written by the consumer only.
+  std::atomic<uint64_t> dequeued_{0};
+  char flags_padding_[kCacheLineBytes];
+
+  std::atomic<bool> closed_{false};
+  std::atomic<bool> producer_waiting_{false};
+  std::atomic<bool> consumer_waiting_{false};
+  std::mutex wait_mutex_;
+  std::condition_variable wait_cv_;
+};
+
+}  // namespace radar_utils
+
+#endif  // RIPPLE_RADAR_UTILS_SPSCQUEUE_HPP_
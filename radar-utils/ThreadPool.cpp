@@ -0,0 +1,246 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <ThreadPool.hpp>
+
+#include <algorithm>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace radar_utils {
+
+namespace {
+
+// Rounds of looking for tasks before an idle worker goes to sleep.
+const int kSpinRounds = 64;
+
+// The pool of the calling thread, if it is a worker or has a slot, and its
+// index.
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local size_t current_thread = 0;
+
+size_t CountWorkers(const ThreadPoolConfig& config) {
+  if (config.num_workers > 0) {
+    return config.num_workers;
+  }
+  unsigned num_cpus = std::thread::hardware_concurrency();
+  return num_cpus > 1 ? num_cpus - 1 : 0;
+}
+
+}  // namespace
+
+ThreadPool::ThreadPool(const ThreadPoolConfig& config)
+    : config_(config),
+      num_workers_(CountWorkers(config)),
+      num_threads_(num_workers_ +
+                   std::max<size_t>(config.num_outside_threads, 1)),
+      deques_(new Deque[num_threads_]) {
+  const size_t depth = std::max<size_t>(config.queue_depth, 1);
+  for (size_t i = 0; i < num_threads_; ++i) {
+    deques_[i].tasks.resize(depth);
+  }
+  // Slot 0 is taken first, the one of outside threads without a slot.
+  for (size_t i = num_threads_ - 1; i > num_workers_; --i) {
+    free_slots_.push_back(i);
+  }
+  free_slots_.push_back(0);
+  for (size_t i = 1; i <= num_workers_; ++i) {
+    workers_.emplace_back(&ThreadPool::Work, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wake_up_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+size_t ThreadPool::GetThreadIndex() const {
+  return current_pool == this ? current_thread : 0;
+}
+
+ThreadPool::ThreadSlot::ThreadSlot(ThreadPool& pool)
+    : pool_(pool), index_(current_thread), is_taken_(current_pool != &pool),
+      previous_pool_(current_pool), previous_index_(current_thread) {
+  if (!is_taken_) {
+    return;
+  }
+  {
+    std::unique_lock<std::mutex> lock(pool_.slots_mutex_);
+    pool_.slot_freed_.wait(lock, [this] {
+      return !pool_.free_slots_.empty();
+    });
+    index_ = pool_.free_slots_.back();
+    pool_.free_slots_.pop_back();
+  }
+  current_pool = &pool_;
+  current_thread = index_;
+}
+
+ThreadPool::ThreadSlot::~ThreadSlot() {
+  if (!is_taken_) {
+    return;
+  }
+  current_pool = previous_pool_;
+  current_thread = previous_index_;
+  {
+    std::lock_guard<std::mutex> lock(pool_.slots_mutex_);
+    pool_.free_slots_.push_back(index_);
+  }
+  pool_.slot_freed_.notify_one();
+}
+
+bool ThreadPool::Push(size_t thread, const Task& task) {
+  Deque& deque = deques_[thread];
+  {
+    std::lock_guard<std::mutex> lock(deque.mutex);
+    if (deque.bottom - deque.top == deque.tasks.size()) {
+      return false;
+    }
+    deque.tasks[deque.bottom % deque.tasks.size()] = task;
+    ++deque.bottom;
+  }
+  queued_.fetch_add(1);
+  // Paired with the sleeping workers checking queued_ after counting
+  // themselves, one of the two sees the other.
+  if (sleeping_.load() > 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wake_up_.notify_one();
+  }
+  return true;
+}
+
+bool ThreadPool::Pop(size_t thread, const TaskGroup* group, Task& task) {
+  Deque& deque = deques_[thread];
+  std::lock_guard<std::mutex> lock(deque.mutex);
+  if (deque.bottom == deque.top) {
+    return false;
+  }
+  const Task& last = deque.tasks[(deque.bottom - 1) % deque.tasks.size()];
+  if (group != nullptr && last.group != group) {
+    return false;
+  }
+  task = last;
+  --deque.bottom;
+  queued_.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+bool ThreadPool::Steal(size_t thread, const TaskGroup* group, Task& task) {
+  Deque& deque = deques_[thread];
+  std::lock_guard<std::mutex> lock(deque.mutex);
+  if (deque.bottom == deque.top) {
+    return false;
+  }
+  const Task& first = deque.tasks[deque.top % deque.tasks.size()];
+  if (group != nullptr && first.group != group) {
+    return false;
+  }
+  task = first;
+  ++deque.top;
+  queued_.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+bool ThreadPool::Find(size_t thread, const TaskGroup* group, Task& task) {
+  if (Pop(thread, group, task)) {
+    return true;
+  }
+  if (queued_.load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+  for (size_t i = 1; i < num_threads_; ++i) {
+    size_t victim = (thread + i) % num_threads_;
+    if (Steal(victim, group, task)) {
+      return true;
+    }
+  }
+  // Tasks of the group submitted by outside threads without a slot may sit
+  // under others in the deque of slot 0.
+  return group != nullptr && Steal(thread, group, task);
+}
+
+void ThreadPool::Execute(size_t thread, Task& task) {
+  TaskGroup* group = task.group;
+  while (task.end - task.begin > task.grain) {
+    Task upper = task;
+    upper.begin = task.begin + (task.end - task.begin) / 2;
+    group->pending_.fetch_add(1, std::memory_order_relaxed);
+    if (!Push(thread, upper)) {
+      // The deque is full, run the whole range here.
+      group->pending_.fetch_sub(1, std::memory_order_relaxed);
+      break;
+    }
+    task.end = upper.begin;
+  }
+  task.invoke(task.function, task.begin, task.end);
+  group->pending_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void ThreadPool::Wait(TaskGroup& group) {
+  ThreadSlot slot(*this);
+  const size_t thread = slot.GetIndex();
+  Task task;
+  while (!group.IsDone()) {
+    if (Find(thread, &group, task)) {
+      Execute(thread, task);
+    } else {
+      // The last tasks of the group are running on other threads.
+      std::this_thread::yield();
+    }
+  }
+}
+
+void ThreadPool::Work(size_t thread) {
+  current_pool = this;
+  current_thread = thread;
+  PinThread(thread);
+  Task task;
+  while (true) {
+    bool found = false;
+    for (int round = 0; round < kSpinRounds && !found; ++round) {
+      found = Find(thread, nullptr, task);
+      if (!found) {
+        std::this_thread::yield();
+      }
+    }
+    if (found) {
+      Execute(thread, task);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    sleeping_.fetch_add(1);
+    while (queued_.load() == 0 && !stopping_) {
+      wake_up_.wait(lock);
+    }
+    sleeping_.fetch_sub(1);
+    if (stopping_ && queued_.load() == 0) {
+      return;
+    }
+  }
+}
+
+void ThreadPool::PinThread(size_t thread) {
+#ifdef __linux__
+  if (config_.first_cpu < 0) {
+    return;
+  }
+  unsigned num_cpus = std::max(1u, std::thread::hardware_concurrency());
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET((config_.first_cpu + thread - 1) % num_cpus, &cpus);
+  // Pinning is a hint, the worker runs anywhere if it fails.
+  pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+#else
+  (void) thread;
+#endif
+}
+
+}  // namespace radar_utils
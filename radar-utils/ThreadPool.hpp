@@ -0,0 +1,262 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief A work-stealing thread pool for splitting bursts across cores.
+ *
+ * @details ParallelFor splits the work of one burst, chirps, channels or
+ *          range bins, across the threads to cut its latency. Submit queues
+ *          independent tasks, whole bursts, to spread them across the threads
+ *          for throughput. Both can be mixed, a submitted task can run its
+ *          own ParallelFor.
+ *
+ *          Every worker has a deque of tasks. A thread splits its range in
+ *          halves, pushes the upper halves at the bottom of its deque and
+ *          keeps working on the lower one, so it pops back the freshest and
+ *          smallest halves while idle workers steal the oldest and largest
+ *          ones from the top and split them further.
+ *
+ *          A thread outside the pool takes one of num_outside_threads slots
+ *          while it runs tasks in ParallelFor or Wait, with a thread index
+ *          and a deque of its own, so per-thread state indexed by
+ *          GetThreadIndex is never shared. Callers beyond that number wait
+ *          for a slot to be free.
+ *
+ *          Tasks are small values held in rings allocated by the constructor
+ *          and functions are called through a pointer to the caller's
+ *          object, so nothing is allocated per task. A task that does not fit
+ *          in a full ring is run right away by the thread pushing it.
+ *
+ *          A thread waiting for its tasks runs the tasks of the same group
+ *          meanwhile, never others, so per-thread state held across the wait
+ *          is not used underneath it. Idle workers spin for a while, then
+ *          sleep until tasks are pushed.
+ *
+ *          Workers can be pinned to consecutive CPUs, and Submit takes
+ *          the worker a task should preferably run on, to keep the plans of
+ *          a config in the caches of the same core. Other workers still steal
+ *          it when that one is busy.
+ *
+ * Example:
+ * ```
+ *   radar_utils::ThreadPool pool;
+ *   std::vector<radar_dsp::RangeFft> range_ffts(pool.GetNumThreads());
+ *   pool.ParallelFor(0, num_rows, 0, [&](size_t begin, size_t end) {
+ *     radar_dsp::RangeFft& range_fft = range_ffts[pool.GetThreadIndex()];
+ *     // Transform rows begin to end - 1.
+ *   });
+ * ```
+ */
+#ifndef RIPPLE_RADAR_UTILS_THREADPOOL_HPP_
+#define RIPPLE_RADAR_UTILS_THREADPOOL_HPP_
+
+#include <SpscQueue.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace radar_utils {
+
+struct ThreadPoolConfig {
+  //! Worker threads, 0 for one per CPU but the one of the calling thread.
+  uint32_t num_workers = 0;
+  //! Tasks every deque can hold.
+  uint32_t queue_depth = 256;
+  //! Pin the workers to consecutive CPUs from this one, -1 not to pin them.
+  //! Only supported on Linux.
+  int first_cpu = -1;
+  //! Threads outside the pool that can run tasks at the same time.
+  uint32_t num_outside_threads = 1;
+};
+
+//! Tasks waited for together.
+class TaskGroup {
+ public:
+  TaskGroup() = default;
+
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+  //! Check if all the tasks of the group have run.
+  bool IsDone() const {
+    return pending_.load(std::memory_order_acquire) == 0;
+  }
+
+ private:
+  friend class ThreadPool;
+
+  std::atomic<size_t> pending_{0};
+};
+
+class ThreadPool {
+ public:
+  explicit ThreadPool(const ThreadPoolConfig& config = ThreadPoolConfig());
+  //! Wait for the queued tasks and stop the workers.
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  //! Get the number of threads that run tasks, the workers and the slots of
+  //! the threads outside the pool, to size per-thread state.
+  size_t GetNumThreads() const {
+    return num_threads_;
+  }
+
+  size_t GetNumWorkers() const {
+    return num_workers_;
+  }
+
+  //! Get the index of the calling thread, from 1 for the workers, 0 or past
+  //! the workers for a thread outside the pool running tasks, 0 for the
+  //! others.
+  size_t GetThreadIndex() const;
+
+  /**
+   * @brief Call a function over a range, split across the threads.
+   *
+   * @details Returns when the function has been called over the whole range.
+   *          The calling thread takes part. The function is called from
+   *          several threads at a time with disjoint subranges.
+   *
+   * @param begin the first index.
+   * @param end the index past the last one.
+   * @param grain the largest subrange that is not split further, 0 for about
+   *        four subranges per thread.
+   * @param function called as function(size_t begin, size_t end).
+   */
+  template <typename Function>
+  void ParallelFor(size_t begin, size_t end, size_t grain,
+                   const Function& function) {
+    if (begin >= end) {
+      return;
+    }
+    if (grain == 0) {
+      size_t num_ranges = 4 * GetNumThreads();
+      grain = (end - begin + num_ranges - 1) / num_ranges;
+    }
+    TaskGroup group;
+    group.pending_.store(1, std::memory_order_relaxed);
+    Task task = {&InvokeRange<Function>, &function, begin, end, grain,
+                 &group};
+    ThreadSlot slot(*this);
+    Execute(slot.GetIndex(), task);
+    Wait(group);
+  }
+
+  /**
+   * @brief Queue a task.
+   *
+   * @param group the group to wait for the task with.
+   * @param function called as function(size_t index). Must outlive the task.
+   * @param index the argument of the function.
+   * @param worker the worker the task should preferably run on, between 1
+   *        and GetNumWorkers(), 0 for the deque of the calling thread.
+   */
+  template <typename Function>
+  void Submit(TaskGroup& group, const Function& function, size_t index,
+              size_t worker = 0) {
+    group.pending_.fetch_add(1, std::memory_order_relaxed);
+    Task task = {&InvokeIndex<Function>, &function, index, index + 1, 1,
+                 &group};
+    size_t thread = worker > 0 && worker <= GetNumWorkers()
+                        ? worker
+                        : GetThreadIndex();
+    if (!Push(thread, task)) {
+      ThreadSlot slot(*this);
+      Execute(slot.GetIndex(), task);
+    }
+  }
+
+  //! Wait for the tasks of a group, running them meanwhile.
+  void Wait(TaskGroup& group);
+
+ private:
+  struct Task {
+    void (*invoke)(const void* function, size_t begin, size_t end);
+    const void* function;
+    size_t begin;
+    size_t end;
+    size_t grain;
+    TaskGroup* group;
+  };
+
+  // A ring of tasks, pushed and popped at the bottom by its threads and
+  // stolen from the top by the others.
+  struct Deque {
+    std::mutex mutex;
+    std::vector<Task> tasks;
+    size_t top = 0;
+    size_t bottom = 0;
+    char padding[kCacheLineBytes];
+  };
+
+  // Gives the calling thread a slot while it runs tasks, unless it is
+  // a worker or already has one.
+  class ThreadSlot {
+   public:
+    explicit ThreadSlot(ThreadPool& pool);
+    ~ThreadSlot();
+
+    ThreadSlot(const ThreadSlot&) = delete;
+    ThreadSlot& operator=(const ThreadSlot&) = delete;
+
+    size_t GetIndex() const {
+      return index_;
+    }
+
+   private:
+    ThreadPool& pool_;
+    size_t index_;
+    bool is_taken_;
+    //! The pool and index of the thread before, for nested pools.
+    const ThreadPool* previous_pool_;
+    size_t previous_index_;
+  };
+
+  template <typename Function>
+  static void InvokeRange(const void* function, size_t begin, size_t end) {
+    (*static_cast<const Function*>(function))(begin, end);
+  }
+
+  template <typename Function>
+  static void InvokeIndex(const void* function, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      (*static_cast<const Function*>(function))(i);
+    }
+  }
+
+  bool Push(size_t thread, const Task& task);
+  bool Pop(size_t thread, const TaskGroup* group, Task& task);
+  bool Steal(size_t thread, const TaskGroup* group, Task& task);
+  bool Find(size_t thread, const TaskGroup* group, Task& task);
+  void Execute(size_t thread, Task& task);
+  void Work(size_t thread);
+  void PinThread(size_t thread);
+
+  const ThreadPoolConfig config_;
+  const size_t num_workers_;
+  const size_t num_threads_;
+  //! One deque per thread index.
+  std::unique_ptr<Deque[]> deques_;
+  //! Tasks queued in all the deques.
+  std::atomic<size_t> queued_{0};
+  std::atomic<size_t> sleeping_{0};
+  bool stopping_ = false;
+  std::mutex mutex_;
+  std::condition_variable wake_up_;
+  std::vector<std::thread> workers_;
+  //! Thread indices of the free outside slots.
+  std::mutex slots_mutex_;
+  std::condition_variable slot_freed_;
+  std::vector<size_t> free_slots_;
+};
+
+}  // namespace radar_utils
+
+#endif  // RIPPLE_RADAR_UTILS_THREADPOOL_HPP_
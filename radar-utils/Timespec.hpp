@@ -0,0 +1,33 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Helpers to convert the timespec timeouts of the Ripple Radar API.
+ */
+#ifndef RIPPLE_RADAR_UTILS_TIMESPEC_HPP_
+#define RIPPLE_RADAR_UTILS_TIMESPEC_HPP_
+
+#include <chrono>
+#include <time.h>
+
+namespace radar_utils {
+
+//! Convert a relative timeout to a duration.
+inline std::chrono::nanoseconds ToDuration(const timespec& timeout) {
+  return std::chrono::seconds(timeout.tv_sec) +
+         std::chrono::nanoseconds(timeout.tv_nsec);
+}
+
+//! Convert a relative timeout to an absolute steady clock deadline.
+inline std::chrono::steady_clock::time_point ToDeadline(
+    const timespec& timeout) {
+  return std::chrono::steady_clock::now() + ToDuration(timeout);
+}
+
+//! Check if a timeout requests not to wait at all.
+inline bool IsZero(const timespec& timeout) {
+  return timeout.tv_sec == 0 && timeout.tv_nsec == 0;
+}
+
+}  // namespace radar_utils
+
+#endif  // RIPPLE_RADAR_UTILS_TIMESPEC_HPP_
@@ -297,6 +297,12 @@ RadarReturnCode radarIsBurstReady(RadarHandle* handle, bool* is_ready) {
   return RC_UNSUPPORTED;
 }
 
+RadarReturnCode radarGetBurstReadyFd(RadarHandle* handle, int* fd) {
+  (void) handle;
+  (void) fd;
+  return RC_UNSUPPORTED;
+}
+
 RadarReturnCode radarReadBurst(RadarHandle* handle, RadarBurstFormat* format,
                                uint8_t* buffer, uint32_t* read_bytes,
                                struct timespec timeout) {
@@ -308,6 +314,78 @@ RadarReturnCode radarReadBurst(RadarHandle* handle, RadarBurstFormat* format,
   return RC_UNSUPPORTED;
 }
 
+RadarReturnCode radarReadBursts(RadarHandle* handle, uint32_t max_count,
+                                RadarBurstFormat* formats,
+                                uint32_t* burst_bytes, uint32_t* count,
+                                uint8_t* arena, uint32_t* arena_bytes,
+                                struct timespec timeout) {
+  (void) handle;
+  (void) max_count;
+  (void) formats;
+  (void) burst_bytes;
+  (void) count;
+  (void) arena;
+  (void) arena_bytes;
+  (void) timeout;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode radarAcquireBurst(RadarHandle* handle, RadarBurstLease* lease,
+                                  struct timespec timeout) {
+  (void) handle;
+  (void) lease;
+  (void) timeout;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode radarReleaseBurst(RadarHandle* handle,
+                                  const RadarBurstLease* lease) {
+  (void) handle;
+  (void) lease;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode radarRegisterBurstBuffers(RadarHandle* handle,
+                                          uint8_t* const* buffers,
+                                          uint32_t num_buffers,
+                                          uint32_t buffer_bytes) {
+  (void) handle;
+  (void) buffers;
+  (void) num_buffers;
+  (void) buffer_bytes;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode radarUnregisterBurstBuffers(RadarHandle* handle) {
+  (void) handle;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode radarWaitBurstBuffer(RadarHandle* handle, uint32_t* index,
+                                     RadarBurstFormat* format,
+                                     uint32_t* read_bytes,
+                                     struct timespec timeout) {
+  (void) handle;
+  (void) index;
+  (void) format;
+  (void) read_bytes;
+  (void) timeout;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode radarReturnBurstBuffer(RadarHandle* handle, uint32_t index) {
+  (void) handle;
+  (void) index;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode radarGetBurstBufferStats(RadarHandle* handle,
+                                         RadarBurstBufferStats* stats) {
+  (void) handle;
+  (void) stats;
+  return RC_UNSUPPORTED;
+}
+
 // Feedback.
 
 RadarReturnCode radarSetBurstReadyCb(RadarHandle* handle, RadarBurstReadyCB cb,
@@ -0,0 +1,562 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief The C Radar API over ReplayRadar.
+ *
+ * @details radarCreate reads the capture of the sensor from the environment
+ *          like CreateRadarSensor, see GetReplayConfig, and returns NULL if
+ *          there is none or it cannot be opened. The callbacks are invoked
+ *          through an observer of the radar.
+ */
+#include <IRadarSensor.h>
+
+#include <ReplayRadar.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+class CallbackObserver : public radar_api::IRadarSensorObserver {
+ public:
+  void SetBurstReadyCb(RadarBurstReadyCB cb, void* user_data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    burst_ready_cb_ = cb;
+    burst_ready_data_ = user_data;
+  }
+
+  void SetLogCb(RadarLogCB cb, void* user_data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    log_cb_ = cb;
+    log_data_ = user_data;
+  }
+
+  void SetRegisterSetCb(RadarRegisterSetCB cb, void* user_data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    register_set_cb_ = cb;
+    register_set_data_ = user_data;
+  }
+
+  void OnBurstReady(void) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (burst_ready_cb_ != nullptr) {
+      burst_ready_cb_(burst_ready_data_);
+    }
+  }
+
+  void OnLogMessage(RadarLogLevel level, const char* file,
+                    const char* function, int line,
+                    const std::string& message) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (log_cb_ != nullptr) {
+      log_cb_(level, file, function, line, log_data_, message.c_str());
+    }
+  }
+
+  void OnRegisterSet(uint32_t address, uint32_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (register_set_cb_ != nullptr) {
+      register_set_cb_(address, value, register_set_data_);
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  RadarBurstReadyCB burst_ready_cb_ = nullptr;
+  void* burst_ready_data_ = nullptr;
+  RadarLogCB log_cb_ = nullptr;
+  void* log_data_ = nullptr;
+  RadarRegisterSetCB register_set_cb_ = nullptr;
+  void* register_set_data_ = nullptr;
+};
+
+}  // namespace
+
+struct RadarHandleImpl {
+  RadarHandleImpl(int32_t id, const radar_api::ReplayConfig& config)
+      : radar(id, config) {
+    radar.AddObserver(&observer);
+  }
+
+  CallbackObserver observer;
+  radar_api::ReplayRadar radar;
+};
+
+//--------------------------------------
+//----- API ----------------------------
+//--------------------------------------
+
+// Lifecycle.
+
+RadarReturnCode radarInit(void) {
+  return RC_OK;
+}
+
+RadarReturnCode radarDeinit(void) {
+  return RC_OK;
+}
+
+RadarHandle* radarCreate(int32_t id) {
+  radar_api::ReplayConfig config;
+  if (!radar_api::GetReplayConfig(id, config)) {
+    return nullptr;
+  }
+  RadarHandle* handle = new RadarHandleImpl(id, config);
+  if (!handle->radar.IsValid()) {
+    delete handle;
+    return nullptr;
+  }
+  return handle;
+}
+
+RadarReturnCode radarDestroy(RadarHandle* handle) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  delete handle;
+  return RC_OK;
+}
+
+RadarReturnCode radarGetState(RadarHandle* handle, RadarState* state) {
+  if (handle == nullptr || state == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetRadarState(*state);
+}
+
+RadarReturnCode radarTurnOn(RadarHandle* handle) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.TurnOn();
+}
+
+RadarReturnCode radarTurnOff(RadarHandle* handle) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.TurnOff();
+}
+
+RadarReturnCode radarGoSleep(RadarHandle* handle) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GoSleep();
+}
+
+RadarReturnCode radarWakeUp(RadarHandle* handle) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.WakeUp();
+}
+
+// Configuration.
+
+RadarReturnCode radarGetNumConfigSlots(RadarHandle* handle,
+                                       uint8_t* num_slots) {
+  if (handle == nullptr || num_slots == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetNumConfigSlots(*num_slots);
+}
+
+RadarReturnCode radarGetMaxActiveConfigSlots(RadarHandle* handle,
+    uint8_t* num_slots) {
+  if (handle == nullptr || num_slots == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetMaxActiveConfigSlots(*num_slots);
+}
+
+RadarReturnCode radarActivateConfig(RadarHandle* handle, uint8_t slot_id) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.ActivateConfig(slot_id);
+}
+
+RadarReturnCode radarDeactivateConfig(RadarHandle* handle, uint8_t slot_id) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.DeactivateConfig(slot_id);
+}
+
+RadarReturnCode radarIsActiveConfig(RadarHandle* handle, uint8_t slot_id,
+    bool* is_active) {
+  if (handle == nullptr || is_active == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  std::vector<uint8_t> slot_ids;
+  RadarReturnCode rc = handle->radar.GetActiveConfigs(slot_ids);
+  if (rc == RC_OK) {
+    *is_active = std::find(slot_ids.begin(), slot_ids.end(), slot_id) !=
+                 slot_ids.end();
+  }
+  return rc;
+}
+
+RadarReturnCode radarGetMainParam(RadarHandle* handle, uint8_t slot_id,
+    RadarMainParam param, uint32_t* value) {
+  if (handle == nullptr || value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetMainParam(slot_id, param, *value);
+}
+
+RadarReturnCode radarSetMainParam(RadarHandle* handle, uint8_t slot_id,
+    RadarMainParam param, uint32_t value) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.SetMainParam(slot_id, param, value);
+}
+
+RadarReturnCode radarGetMainParamRange(RadarHandle* handle,
+    RadarMainParam param, uint32_t* min_value, uint32_t* max_value) {
+  if (handle == nullptr || min_value == nullptr || max_value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetMainParamRange(param, *min_value, *max_value);
+}
+
+RadarReturnCode radarGetTxParam(RadarHandle* handle, uint8_t slot_id,
+    uint32_t antenna_mask, RadarTxParam param, uint32_t* value) {
+  if (handle == nullptr || value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetTxParam(slot_id, antenna_mask, param, *value);
+}
+
+RadarReturnCode radarSetTxParam(RadarHandle* handle, uint8_t slot_id,
+    uint32_t antenna_mask, RadarTxParam param, uint32_t value) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.SetTxParam(slot_id, antenna_mask, param, value);
+}
+
+RadarReturnCode radarGetTxParamRange(RadarHandle* handle,
+    RadarTxParam id, uint32_t* min_value, uint32_t* max_value) {
+  if (handle == nullptr || min_value == nullptr || max_value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetTxParamRange(id, *min_value, *max_value);
+}
+
+RadarReturnCode radarGetRxParam(RadarHandle* handle, uint8_t slot_id,
+    uint32_t antenna_mask, RadarRxParam param, uint32_t* value) {
+  if (handle == nullptr || value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetRxParam(slot_id, antenna_mask, param, *value);
+}
+
+RadarReturnCode radarSetRxParam(RadarHandle* handle, uint8_t slot_id,
+    uint32_t antenna_mask, RadarRxParam param, uint32_t value) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.SetRxParam(slot_id, antenna_mask, param, value);
+}
+
+RadarReturnCode radarGetRxParamRange(RadarHandle* handle,
+    RadarRxParam param, uint32_t* min_value, uint32_t* max_value) {
+  if (handle == nullptr || min_value == nullptr || max_value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetRxParamRange(param, *min_value, *max_value);
+}
+
+RadarReturnCode radarGetVendorParam(RadarHandle* handle, uint8_t slot_id,
+    RadarVendorParam param, uint32_t* value) {
+  if (handle == nullptr || value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetVendorParam(slot_id, param, *value);
+}
+
+RadarReturnCode radarSetVendorParam(RadarHandle* handle, uint8_t slot_id,
+    RadarVendorParam param, uint32_t value) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.SetVendorParam(slot_id, param, value);
+}
+
+RadarReturnCode radarGetVendorParamRange(RadarHandle* handle,
+    RadarVendorParam id, uint32_t* min_value, uint32_t* max_value) {
+  if (handle == nullptr || min_value == nullptr || max_value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetVendorParamRange(id, *min_value, *max_value);
+}
+
+RadarReturnCode radarGetVendorTxParam(RadarHandle* handle, uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorTxParam id, uint32_t* value) {
+  if (handle == nullptr || value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetVendorTxParam(slot_id, antenna_mask, id, *value);
+}
+
+RadarReturnCode radarSetVendorTxParam(RadarHandle* handle, uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorTxParam id, uint32_t value) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.SetVendorTxParam(slot_id, antenna_mask, id, value);
+}
+
+RadarReturnCode radarGetVendorTxParamRange(RadarHandle* handle,
+    RadarVendorTxParam id, uint32_t* min_value, uint32_t* max_value) {
+  if (handle == nullptr || min_value == nullptr || max_value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetVendorTxParamRange(id, *min_value, *max_value);
+}
+
+RadarReturnCode radarGetVendorRxParam(RadarHandle* handle, uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorRxParam id, uint32_t* value) {
+  if (handle == nullptr || value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetVendorRxParam(slot_id, antenna_mask, id, *value);
+}
+
+RadarReturnCode radarSetVendorRxParam(RadarHandle* handle, uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorRxParam id, uint32_t value) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.SetVendorRxParam(slot_id, antenna_mask, id, value);
+}
+
+RadarReturnCode radarGetVendorRxParamRange(RadarHandle* handle,
+    RadarVendorRxParam id, uint32_t* min_value, uint32_t* max_value) {
+  if (handle == nullptr || min_value == nullptr || max_value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetVendorRxParamRange(id, *min_value, *max_value);
+}
+
+// Data streaming.
+
+RadarReturnCode radarStartDataStreaming(RadarHandle* handle) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.StartDataStreaming();
+}
+
+RadarReturnCode radarStopDataStreaming(RadarHandle* handle) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.StopDataStreaming();
+}
+
+RadarReturnCode radarIsBurstReady(RadarHandle* handle, bool* is_ready) {
+  if (handle == nullptr || is_ready == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.IsBurstReady(*is_ready);
+}
+
+RadarReturnCode radarGetBurstReadyFd(RadarHandle* handle, int* fd) {
+  if (handle == nullptr || fd == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetBurstReadyFd(*fd);
+}
+
+RadarReturnCode radarReadBurst(RadarHandle* handle, RadarBurstFormat* format,
+    uint8_t* buffer, uint32_t* read_bytes, struct timespec timeout) {
+  if (handle == nullptr || format == nullptr || read_bytes == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.ReadBurst(*format, buffer, *read_bytes, timeout);
+}
+
+RadarReturnCode radarReadBursts(RadarHandle* handle, uint32_t max_count,
+    RadarBurstFormat* formats, uint32_t* burst_bytes, uint32_t* count,
+    uint8_t* arena, uint32_t* arena_bytes, struct timespec timeout) {
+  if (handle == nullptr || count == nullptr || arena_bytes == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.ReadBursts(max_count, formats, burst_bytes, *count,
+                                  arena, *arena_bytes, timeout);
+}
+
+RadarReturnCode radarAcquireBurst(RadarHandle* handle, RadarBurstLease* lease,
+    struct timespec timeout) {
+  if (handle == nullptr || lease == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.AcquireBurst(*lease, timeout);
+}
+
+RadarReturnCode radarReleaseBurst(RadarHandle* handle,
+    const RadarBurstLease* lease) {
+  if (handle == nullptr || lease == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.ReleaseBurst(*lease);
+}
+
+RadarReturnCode radarRegisterBurstBuffers(RadarHandle* handle,
+    uint8_t* const* buffers, uint32_t num_buffers, uint32_t buffer_bytes) {
+  if (handle == nullptr || buffers == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.RegisterBurstBuffers(
+      std::vector<uint8_t*>(buffers, buffers + num_buffers), buffer_bytes);
+}
+
+RadarReturnCode radarUnregisterBurstBuffers(RadarHandle* handle) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.UnregisterBurstBuffers();
+}
+
+RadarReturnCode radarWaitBurstBuffer(RadarHandle* handle, uint32_t* index,
+    RadarBurstFormat* format, uint32_t* read_bytes, struct timespec timeout) {
+  if (handle == nullptr || index == nullptr || format == nullptr ||
+      read_bytes == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.WaitBurstBuffer(*index, *format, *read_bytes, timeout);
+}
+
+RadarReturnCode radarReturnBurstBuffer(RadarHandle* handle, uint32_t index) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.ReturnBurstBuffer(index);
+}
+
+RadarReturnCode radarGetBurstBufferStats(RadarHandle* handle,
+    RadarBurstBufferStats* stats) {
+  if (handle == nullptr || stats == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetBurstBufferStats(*stats);
+}
+
+// Feedback.
+
+RadarReturnCode radarSetBurstReadyCb(RadarHandle* handle, RadarBurstReadyCB cb,
+    void* user_data) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  handle->observer.SetBurstReadyCb(cb, user_data);
+  return RC_OK;
+}
+
+RadarReturnCode radarSetLogCb(RadarHandle* handle, RadarLogCB cb,
+    void* user_data) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  handle->observer.SetLogCb(cb, user_data);
+  return RC_OK;
+}
+
+RadarReturnCode radarSetRegisterSetCb(RadarHandle* handle,
+    RadarRegisterSetCB cb, void* user_data) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  handle->observer.SetRegisterSetCb(cb, user_data);
+  return RC_OK;
+}
+
+// Miscellaneous.
+
+RadarReturnCode radarCheckCountryCode(RadarHandle* handle,
+    const char* country_code) {
+  if (handle == nullptr || country_code == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.CheckCountryCode(country_code);
+}
+
+RadarReturnCode radarGetSensorInfo(RadarHandle* handle, SensorInfo* info) {
+  if (handle == nullptr || info == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetSensorInfo(*info);
+}
+
+RadarReturnCode radarLogSensorDetails(RadarHandle* handle) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.LogSensorDetails();
+}
+
+RadarReturnCode radarGetTxPosition(RadarHandle* handle,
+    uint32_t tx_mask, int32_t* x, int32_t* y, int32_t* z) {
+  if (handle == nullptr || x == nullptr || y == nullptr || z == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetTxPosition(tx_mask, *x, *y, *z);
+}
+
+RadarReturnCode radarGetRxPosition(RadarHandle* handle,
+    uint32_t rx_mask, int32_t* x, int32_t* y, int32_t* z) {
+  if (handle == nullptr || x == nullptr || y == nullptr || z == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetRxPosition(rx_mask, *x, *y, *z);
+}
+
+RadarReturnCode radarSetLogLevel(RadarHandle* handle, RadarLogLevel level) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.SetLogLevel(level);
+}
+
+// Registers.
+
+RadarReturnCode radarGetAllRegisters(RadarHandle* handle, uint32_t* addresses,
+    uint32_t* values, uint32_t* count) {
+  if (handle == nullptr || addresses == nullptr || values == nullptr ||
+      count == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  std::vector<std::pair<uint32_t, uint32_t>> registers;
+  RadarReturnCode rc = handle->radar.GetAllRegisters(registers);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  *count = std::min(*count, static_cast<uint32_t>(registers.size()));
+  for (uint32_t i = 0; i < *count; ++i) {
+    addresses[i] = registers[i].first;
+    values[i] = registers[i].second;
+  }
+  return RC_OK;
+}
+
+RadarReturnCode radarGetRegister(RadarHandle* handle, uint32_t address,
+    uint32_t* value) {
+  if (handle == nullptr || value == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.GetRegister(address, *value);
+}
+
+RadarReturnCode radarSetRegister(RadarHandle* handle, uint32_t address,
+    uint32_t value) {
+  if (handle == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  return handle->radar.SetRegister(address, value);
+}
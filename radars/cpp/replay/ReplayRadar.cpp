@@ -0,0 +1,1093 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <ReplayRadar.hpp>
+
+#include <BurstCodec.hpp>
+#include <Timespec.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/timerfd.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#define REPLAY_LOG(level, ...) Log(level, __func__, __LINE__, __VA_ARGS__)
+
+namespace radar_api {
+
+namespace {
+
+using radar_utils::CaptureParamKind;
+
+bool IsAntennaParam(CaptureParamKind kind) {
+  return kind == CaptureParamKind::kTx || kind == CaptureParamKind::kRx ||
+         kind == CaptureParamKind::kVendorTx ||
+         kind == CaptureParamKind::kVendorRx;
+}
+
+const char* GetEnv(const std::string& name) {
+  const char* value = getenv(name.c_str());
+  return value != nullptr && value[0] != '\0' ? value : nullptr;
+}
+
+}  // namespace
+
+bool GetReplayConfig(int32_t id, ReplayConfig& config) {
+  const char* path = GetEnv("RIPPLE_REPLAY_CAPTURE_" + std::to_string(id));
+  if (path == nullptr) {
+    path = GetEnv("RIPPLE_REPLAY_CAPTURE");
+  }
+  if (path == nullptr) {
+    return false;
+  }
+  config.path = path;
+  const char* is_real_time = GetEnv("RIPPLE_REPLAY_REAL_TIME");
+  config.is_real_time = is_real_time == nullptr || atoi(is_real_time) != 0;
+  const char* is_looping = GetEnv("RIPPLE_REPLAY_LOOP");
+  config.is_looping = is_looping != nullptr && atoi(is_looping) != 0;
+  return true;
+}
+
+ReplayRadar::ReplayRadar(int32_t id, const ReplayConfig& config)
+    : id_(id), config_(config), state_(RSTATE_OFF), log_level_(RLOG_WRN),
+      is_streaming_(false), has_next_(false), next_position_(0),
+      next_payload_(nullptr), has_last_(false), num_taken_(0),
+      buffer_bytes_(0), ready_fd_(-1), is_ready_fd_used_(false) {
+  memset(burst_period_us_, 0, sizeof(burst_period_us_));
+  memset(is_active_, 0, sizeof(is_active_));
+  memset(is_replay_active_, 0, sizeof(is_replay_active_));
+  for (Lease& lease : leases_) {
+    lease.in_use = false;
+    lease.generation = 0;
+  }
+  memset(&buffer_stats_, 0, sizeof(buffer_stats_));
+#ifdef __linux__
+  ready_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+#endif
+
+  if (reader_.Open(config_.path) != RC_OK) {
+    return;
+  }
+  // Bursts are replayed in order, read ahead of them.
+  posix_madvise(const_cast<uint8_t*>(reader_.GetData()), reader_.GetSize(),
+                POSIX_MADV_SEQUENTIAL);
+
+  for (const radar_utils::CaptureParam& param : reader_.GetHeader().params) {
+    if (param.kind == CaptureParamKind::kMain &&
+        param.group == RADAR_PARAM_GROUP_COMMON &&
+        param.id == RADAR_PARAM_BURST_PERIOD_US) {
+      burst_period_us_[param.slot_id] = param.value;
+    }
+  }
+}
+
+ReplayRadar::~ReplayRadar() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (state_ == RSTATE_ACTIVE) {
+      StopStreamingLocked(lock);
+    }
+  }
+  if (ready_fd_ >= 0) {
+    close(ready_fd_);
+  }
+}
+
+//--------------------------------------
+//----- Observers ----------------------
+//--------------------------------------
+
+RadarReturnCode ReplayRadar::AddObserver(IRadarSensorObserver* observer) {
+  if (observer == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  std::lock_guard<std::mutex> lock(observers_mutex_);
+  if (std::find(observers_.begin(), observers_.end(), observer) !=
+      observers_.end()) {
+    return RC_BAD_INPUT;
+  }
+  observers_.push_back(observer);
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::RemoveObserver(IRadarSensorObserver* observer) {
+  std::lock_guard<std::mutex> lock(observers_mutex_);
+  auto it = std::find(observers_.begin(), observers_.end(), observer);
+  if (it == observers_.end()) {
+    return RC_BAD_INPUT;
+  }
+  observers_.erase(it);
+  return RC_OK;
+}
+
+void ReplayRadar::Log(RadarLogLevel level, const char* function, int line,
+                      const char* format, ...) {
+  if (level <= RLOG_OFF || level > log_level_.load()) {
+    return;
+  }
+  char message[256];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(message, sizeof(message), format, args);
+  va_end(args);
+
+  std::lock_guard<std::mutex> lock(observers_mutex_);
+  for (IRadarSensorObserver* observer : observers_) {
+    observer->OnLogMessage(level, __FILE__, function, line, message);
+  }
+}
+
+void ReplayRadar::NotifyBurstReady(void) {
+  std::lock_guard<std::mutex> lock(observers_mutex_);
+  for (IRadarSensorObserver* observer : observers_) {
+    observer->OnBurstReady();
+  }
+}
+
+//--------------------------------------
+//----- Power states -------------------
+//--------------------------------------
+
+RadarReturnCode ReplayRadar::GetRadarState(RadarState& state) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  state = state_;
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::TurnOn(void) {
+  if (!IsValid()) {
+    return RC_BAD_STATE;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_ == RSTATE_IDLE) {
+      return RC_OK;
+    }
+    if (state_ != RSTATE_OFF) {
+      return RC_BAD_STATE;
+    }
+    state_ = RSTATE_IDLE;
+  }
+  REPLAY_LOG(RLOG_INF, "Radar %d turned on, replaying %s", id_,
+             config_.path.c_str());
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::TurnOff(void) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (state_ == RSTATE_OFF) {
+      return RC_OK;
+    }
+    if (state_ == RSTATE_ACTIVE) {
+      RadarReturnCode rc = StopStreamingLocked(lock);
+      if (rc != RC_OK) {
+        return rc;
+      }
+    }
+    state_ = RSTATE_OFF;
+    memset(is_active_, 0, sizeof(is_active_));
+  }
+  REPLAY_LOG(RLOG_INF, "Radar %d turned off", id_);
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::GoSleep(void) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (state_ == RSTATE_SLEEP) {
+    return RC_OK;
+  }
+  if (state_ != RSTATE_IDLE) {
+    return RC_BAD_STATE;
+  }
+  state_ = RSTATE_SLEEP;
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::WakeUp(void) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (state_ == RSTATE_IDLE) {
+    return RC_OK;
+  }
+  if (state_ != RSTATE_SLEEP) {
+    return RC_BAD_STATE;
+  }
+  state_ = RSTATE_IDLE;
+  return RC_OK;
+}
+
+//--------------------------------------
+//----- Config slots -------------------
+//--------------------------------------
+
+bool ReplayRadar::IsRecordedSlot(uint8_t slot_id) const {
+  const radar_utils::CaptureHeader& header = reader_.GetHeader();
+  return std::find(header.active_slots.begin(), header.active_slots.end(),
+                   slot_id) != header.active_slots.end();
+}
+
+RadarReturnCode ReplayRadar::GetNumConfigSlots(uint8_t& num_slots) {
+  num_slots = 0;
+  for (uint8_t slot_id : reader_.GetHeader().active_slots) {
+    num_slots = std::max<uint8_t>(num_slots, slot_id + 1);
+  }
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::GetMaxActiveConfigSlots(uint8_t& num_slots) {
+  num_slots = static_cast<uint8_t>(reader_.GetHeader().active_slots.size());
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::ActivateConfig(uint8_t slot_id) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_ == RSTATE_OFF || state_ == RSTATE_ACTIVE) {
+      return RC_BAD_STATE;
+    }
+    if (IsRecordedSlot(slot_id)) {
+      is_active_[slot_id] = true;
+      return RC_OK;
+    }
+  }
+  REPLAY_LOG(RLOG_ERR, "Config %u was not recorded", slot_id);
+  return RC_BAD_INPUT;
+}
+
+RadarReturnCode ReplayRadar::DeactivateConfig(uint8_t slot_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (state_ == RSTATE_ACTIVE) {
+    return RC_BAD_STATE;
+  }
+  is_active_[slot_id] = false;
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::GetActiveConfigs(
+    std::vector<uint8_t>& slot_ids) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  slot_ids.clear();
+  for (uint8_t slot_id : reader_.GetHeader().active_slots) {
+    if (is_active_[slot_id]) {
+      slot_ids.push_back(slot_id);
+    }
+  }
+  std::sort(slot_ids.begin(), slot_ids.end());
+  return RC_OK;
+}
+
+//--------------------------------------
+//----- Params -------------------------
+//--------------------------------------
+
+RadarReturnCode ReplayRadar::FindParam(CaptureParamKind kind,
+                                       uint8_t slot_id,
+                                       RadarParamGroup group, uint32_t id,
+                                       uint32_t antenna_mask,
+                                       uint32_t& value) const {
+  if (!IsRecordedSlot(slot_id)) {
+    return RC_BAD_INPUT;
+  }
+  for (const radar_utils::CaptureParam& param : reader_.GetHeader().params) {
+    if (param.kind == kind && param.slot_id == slot_id &&
+        param.group == group && param.id == id &&
+        param.antenna_mask == antenna_mask) {
+      value = param.value;
+      return RC_OK;
+    }
+  }
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode ReplayRadar::FindParamRange(CaptureParamKind kind,
+                                            RadarParamGroup group,
+                                            uint32_t id, uint32_t& min_value,
+                                            uint32_t& max_value) const {
+  bool is_found = false;
+  for (const radar_utils::CaptureParam& param : reader_.GetHeader().params) {
+    if (param.kind == kind && param.group == group && param.id == id) {
+      min_value = is_found ? std::min(min_value, param.value) : param.value;
+      max_value = is_found ? std::max(max_value, param.value) : param.value;
+      is_found = true;
+    }
+  }
+  return is_found ? RC_OK : RC_UNSUPPORTED;
+}
+
+RadarReturnCode ReplayRadar::CheckParam(CaptureParamKind kind,
+                                        uint8_t slot_id,
+                                        RadarParamGroup group, uint32_t id,
+                                        uint32_t antenna_mask,
+                                        uint32_t value) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_ == RSTATE_OFF) {
+      return RC_BAD_STATE;
+    }
+  }
+  const bool is_antenna_param = IsAntennaParam(kind);
+  if (is_antenna_param && antenna_mask == 0) {
+    return RC_BAD_INPUT;
+  }
+  // Antenna params are recorded per antenna, every antenna of the mask
+  // has to match.
+  for (int bit = 0; bit < 32; ++bit) {
+    const uint32_t mask = is_antenna_param ? 1u << bit : 0;
+    if (is_antenna_param && (antenna_mask & mask) == 0) {
+      continue;
+    }
+    uint32_t recorded = 0;
+    RadarReturnCode rc = FindParam(kind, slot_id, group, id, mask, recorded);
+    if (rc != RC_OK) {
+      return rc;
+    }
+    if (recorded != value) {
+      REPLAY_LOG(RLOG_ERR, "Param %u.%u of config %u was recorded as %u, "
+                 "not %u", group, id, slot_id, recorded, value);
+      return RC_BAD_INPUT;
+    }
+    if (!is_antenna_param) {
+      break;
+    }
+  }
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::GetMainParam(uint8_t slot_id, RadarMainParam id,
+                                          uint32_t& value) {
+  return FindParam(CaptureParamKind::kMain, slot_id, id.group, id.id, 0,
+                   value);
+}
+
+RadarReturnCode ReplayRadar::SetMainParam(uint8_t slot_id, RadarMainParam id,
+                                          uint32_t value) {
+  return CheckParam(CaptureParamKind::kMain, slot_id, id.group, id.id, 0,
+                    value);
+}
+
+RadarReturnCode ReplayRadar::GetMainParamRange(RadarMainParam id,
+                                               uint32_t& min_value,
+                                               uint32_t& max_value) {
+  return FindParamRange(CaptureParamKind::kMain, id.group, id.id, min_value,
+                        max_value);
+}
+
+RadarReturnCode ReplayRadar::GetTxParam(uint8_t slot_id,
+                                        uint32_t antenna_mask,
+                                        RadarTxParam id, uint32_t& value) {
+  return FindParam(CaptureParamKind::kTx, slot_id, id.group, id.id,
+                   antenna_mask, value);
+}
+
+RadarReturnCode ReplayRadar::SetTxParam(uint8_t slot_id,
+                                        uint32_t antenna_mask,
+                                        RadarTxParam id, uint32_t value) {
+  return CheckParam(CaptureParamKind::kTx, slot_id, id.group, id.id,
+                    antenna_mask, value);
+}
+
+RadarReturnCode ReplayRadar::GetTxParamRange(RadarTxParam id,
+                                             uint32_t& min_value,
+                                             uint32_t& max_value) {
+  return FindParamRange(CaptureParamKind::kTx, id.group, id.id, min_value,
+                        max_value);
+}
+
+RadarReturnCode ReplayRadar::GetRxParam(uint8_t slot_id,
+                                        uint32_t antenna_mask,
+                                        RadarRxParam id, uint32_t& value) {
+  return FindParam(CaptureParamKind::kRx, slot_id, id.group, id.id,
+                   antenna_mask, value);
+}
+
+RadarReturnCode ReplayRadar::SetRxParam(uint8_t slot_id,
+                                        uint32_t antenna_mask,
+                                        RadarRxParam id, uint32_t value) {
+  return CheckParam(CaptureParamKind::kRx, slot_id, id.group, id.id,
+                    antenna_mask, value);
+}
+
+RadarReturnCode ReplayRadar::GetRxParamRange(RadarRxParam id,
+                                             uint32_t& min_value,
+                                             uint32_t& max_value) {
+  return FindParamRange(CaptureParamKind::kRx, id.group, id.id, min_value,
+                        max_value);
+}
+
+RadarReturnCode ReplayRadar::GetVendorParam(uint8_t slot_id,
+                                            RadarVendorParam id,
+                                            uint32_t& value) {
+  return FindParam(CaptureParamKind::kVendor, slot_id, 0, id, 0, value);
+}
+
+RadarReturnCode ReplayRadar::SetVendorParam(uint8_t slot_id,
+                                            RadarVendorParam id,
+                                            uint32_t value) {
+  return CheckParam(CaptureParamKind::kVendor, slot_id, 0, id, 0, value);
+}
+
+RadarReturnCode ReplayRadar::GetVendorParamRange(RadarVendorParam id,
+                                                 uint32_t& min_value,
+                                                 uint32_t& max_value) {
+  return FindParamRange(CaptureParamKind::kVendor, 0, id, min_value,
+                        max_value);
+}
+
+RadarReturnCode ReplayRadar::GetVendorTxParam(uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorTxParam id, uint32_t& value) {
+  return FindParam(CaptureParamKind::kVendorTx, slot_id, 0, id, antenna_mask,
+                   value);
+}
+
+RadarReturnCode ReplayRadar::SetVendorTxParam(uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorTxParam id, uint32_t value) {
+  return CheckParam(CaptureParamKind::kVendorTx, slot_id, 0, id,
+                    antenna_mask, value);
+}
+
+RadarReturnCode ReplayRadar::GetVendorTxParamRange(RadarVendorTxParam id,
+    uint32_t& min_value, uint32_t& max_value) {
+  return FindParamRange(CaptureParamKind::kVendorTx, 0, id, min_value,
+                        max_value);
+}
+
+RadarReturnCode ReplayRadar::GetVendorRxParam(uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorRxParam id, uint32_t& value) {
+  return FindParam(CaptureParamKind::kVendorRx, slot_id, 0, id, antenna_mask,
+                   value);
+}
+
+RadarReturnCode ReplayRadar::SetVendorRxParam(uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorRxParam id, uint32_t value) {
+  return CheckParam(CaptureParamKind::kVendorRx, slot_id, 0, id,
+                    antenna_mask, value);
+}
+
+RadarReturnCode ReplayRadar::GetVendorRxParamRange(RadarVendorRxParam id,
+    uint32_t& min_value, uint32_t& max_value) {
+  return FindParamRange(CaptureParamKind::kVendorRx, 0, id, min_value,
+                        max_value);
+}
+
+//--------------------------------------
+//----- Streaming ----------------------
+//--------------------------------------
+
+RadarReturnCode ReplayRadar::StartDataStreaming(void) {
+  size_t num_active = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_ != RSTATE_IDLE || notifier_.joinable()) {
+      return RC_BAD_STATE;
+    }
+    for (uint8_t slot_id : reader_.GetHeader().active_slots) {
+      num_active += is_active_[slot_id] ? 1 : 0;
+    }
+    if (num_active == 0) {
+      return RC_BAD_STATE;
+    }
+    {
+      std::lock_guard<std::mutex> stream_lock(stream_mutex_);
+      memcpy(is_replay_active_, is_active_, sizeof(is_replay_active_));
+      is_streaming_ = true;
+      Rewind();
+    }
+    state_ = RSTATE_ACTIVE;
+    notifier_ = std::thread(&ReplayRadar::Notify, this);
+  }
+  REPLAY_LOG(RLOG_INF, "Radar %d replaying %zu configs in %s mode", id_,
+             num_active, config_.is_real_time ? "real time" : "fast");
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::StopDataStreaming(void) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (state_ != RSTATE_ACTIVE) {
+    return RC_BAD_STATE;
+  }
+  return StopStreamingLocked(lock);
+}
+
+RadarReturnCode ReplayRadar::StopStreamingLocked(
+    std::unique_lock<std::mutex>& lock) {
+  if (!notifier_.joinable()) {
+    // Another thread is stopping the streaming.
+    return RC_BAD_STATE;
+  }
+  {
+    std::lock_guard<std::mutex> stream_lock(stream_mutex_);
+    is_streaming_ = false;
+    UpdateReady();
+  }
+  stream_cv_.notify_all();
+
+  // Observers called from the notifier thread may use the radar.
+  std::thread notifier;
+  notifier.swap(notifier_);
+  lock.unlock();
+  notifier.join();
+  lock.lock();
+  state_ = RSTATE_IDLE;
+  return RC_OK;
+}
+
+void ReplayRadar::Rewind(void) {
+  next_position_ = 0;
+  has_last_ = false;
+  FindNext();
+  UpdateReady();
+}
+
+bool ReplayRadar::FindNext(void) {
+  const std::vector<radar_utils::CaptureIndexEntry>& entries =
+      reader_.GetEntries();
+  radar_utils::CaptureRecordHeader record;
+  const uint8_t* payload = nullptr;
+  bool has_wrapped = false;
+  while (true) {
+    if (next_position_ >= entries.size()) {
+      // A whole pass without a burst of an active config ends a loop as
+      // well.
+      if (!config_.is_looping || has_wrapped) {
+        has_next_ = false;
+        return false;
+      }
+      has_wrapped = true;
+      next_position_ = 0;
+      continue;
+    }
+    const radar_utils::CaptureIndexEntry& entry = entries[next_position_];
+    if (is_replay_active_[entry.config_id] &&
+        reader_.GetRecord(entry, record, payload) == RC_OK) {
+      break;
+    }
+    ++next_position_;
+  }
+  next_record_ = record;
+  next_payload_ = payload;
+  has_next_ = true;
+
+  if (!config_.is_real_time) {
+    next_ready_ = Clock::time_point();
+  } else if (!has_last_) {
+    next_ready_ = Clock::now();
+  } else {
+    // The recorded period of the last config, times the bursts dropped
+    // while recording. Loops start over one period later.
+    const uint32_t period_us =
+        burst_period_us_[last_record_.format.config_id];
+    const uint32_t last_sequence_number =
+        last_record_.format.sequence_number;
+    const uint32_t sequence_number = record.format.sequence_number;
+    const uint64_t num_periods = sequence_number > last_sequence_number
+                                     ? sequence_number - last_sequence_number
+                                     : 1;
+    if (period_us != 0) {
+      next_ready_ = last_ready_ +
+                    std::chrono::microseconds(period_us * num_periods);
+    } else if (record.timestamp_ns > last_record_.timestamp_ns) {
+      // Without a recorded period follow the recording time.
+      next_ready_ = last_ready_ + std::chrono::nanoseconds(
+          record.timestamp_ns - last_record_.timestamp_ns);
+    } else {
+      next_ready_ = last_ready_;
+    }
+  }
+  return true;
+}
+
+RadarReturnCode ReplayRadar::TakeBurst(Clock::time_point deadline,
+                                       uint32_t max_bytes,
+                                       ReplayBurst& burst) {
+  std::unique_lock<std::mutex> lock(stream_mutex_);
+  while (true) {
+    if (!is_streaming_ || !has_next_) {
+      return RC_BAD_STATE;
+    }
+    Clock::time_point now = Clock::now();
+    if (now >= next_ready_) {
+      break;
+    }
+    if (now >= deadline) {
+      return RC_TIMEOUT;
+    }
+    stream_cv_.wait_until(lock, std::min(next_ready_, deadline));
+  }
+  if (next_record_.raw_bytes > max_bytes) {
+    return RC_RES_LIMIT;
+  }
+
+  radar_utils::FromCaptureBurstFormat(next_record_.format, burst.format);
+  burst.payload = next_payload_;
+  burst.payload_bytes = next_record_.payload_bytes;
+  burst.raw_bytes = next_record_.raw_bytes;
+  burst.encoding = next_record_.encoding;
+
+  if (config_.is_real_time) {
+    // A reader more than a period late moves the following bursts instead
+    // of reading them all at once to catch up.
+    const std::chrono::microseconds period(
+        burst_period_us_[next_record_.format.config_id]);
+    const Clock::time_point now = Clock::now();
+    last_ready_ = now > next_ready_ + period ? now : next_ready_;
+  }
+  last_record_ = next_record_;
+  has_last_ = true;
+  ++next_position_;
+  ++num_taken_;
+  FindNext();
+  UpdateReady();
+  lock.unlock();
+  stream_cv_.notify_all();
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::CopyBurst(const ReplayBurst& burst,
+                                       uint8_t* data) {
+  RadarReturnCode rc = RC_UNSUPPORTED;
+  if (burst.encoding == radar_utils::CaptureEncoding::kRaw &&
+      burst.payload_bytes == burst.raw_bytes) {
+    memcpy(data, burst.payload, burst.payload_bytes);
+    rc = RC_OK;
+  } else if (burst.encoding == radar_utils::CaptureEncoding::kLossless ||
+             burst.encoding == radar_utils::CaptureEncoding::kLossy) {
+    rc = radar_dsp::DecodeBurst(burst.format, burst.payload,
+                                burst.payload_bytes, data, burst.raw_bytes);
+  }
+  if (rc != RC_OK) {
+    REPLAY_LOG(RLOG_ERR, "Failed to decode burst %u of encoding %u: %d",
+               burst.format.sequence_number,
+               static_cast<unsigned>(burst.encoding), rc);
+  }
+  return rc;
+}
+
+void ReplayRadar::Notify(void) {
+  std::unique_lock<std::mutex> lock(stream_mutex_);
+  // The number of bursts taken when the last notification was sent, so
+  // every burst is notified once.
+  uint64_t notified = std::numeric_limits<uint64_t>::max();
+  while (is_streaming_) {
+    if (!has_next_ || notified == num_taken_) {
+      stream_cv_.wait(lock);
+      continue;
+    }
+    if (Clock::now() < next_ready_) {
+      stream_cv_.wait_until(lock, next_ready_);
+      continue;
+    }
+    notified = num_taken_;
+    lock.unlock();
+    NotifyBurstReady();
+    lock.lock();
+  }
+}
+
+void ReplayRadar::UpdateReady(void) {
+#ifdef __linux__
+  if (!is_ready_fd_used_ || ready_fd_ < 0) {
+    return;
+  }
+  // The steady clock is CLOCK_MONOTONIC on Linux. A timer is disarmed by
+  // a zero time, the bursts always ready are armed in the past.
+  itimerspec timer;
+  memset(&timer, 0, sizeof(timer));
+  if (is_streaming_ && has_next_) {
+    const int64_t ns = std::max<int64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            next_ready_.time_since_epoch()).count(), 1);
+    timer.it_value.tv_sec = static_cast<time_t>(ns / 1000000000);
+    timer.it_value.tv_nsec = static_cast<long>(ns % 1000000000);
+  }
+  timerfd_settime(ready_fd_, TFD_TIMER_ABSTIME, &timer, nullptr);
+#endif
+}
+
+RadarReturnCode ReplayRadar::IsBurstReady(bool& is_ready) {
+  std::lock_guard<std::mutex> lock(stream_mutex_);
+  is_ready = is_streaming_ && has_next_ && Clock::now() >= next_ready_;
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::GetBurstReadyFd(int& fd) {
+#ifdef __linux__
+  if (ready_fd_ < 0) {
+    return RC_ERROR;
+  }
+  std::lock_guard<std::mutex> lock(stream_mutex_);
+  if (!is_ready_fd_used_) {
+    is_ready_fd_used_ = true;
+    UpdateReady();
+  }
+  fd = ready_fd_;
+  return RC_OK;
+#else
+  (void) fd;
+  return RC_UNSUPPORTED;
+#endif
+}
+
+RadarReturnCode ReplayRadar::ReadBurst(RadarBurstFormat& format,
+                                       std::vector<uint8_t>& raw_radar_data,
+                                       timespec timeout) {
+  ReplayBurst burst;
+  RadarReturnCode rc = TakeBurst(radar_utils::ToDeadline(timeout),
+                                 std::numeric_limits<uint32_t>::max(), burst);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  format = burst.format;
+  raw_radar_data.resize(burst.raw_bytes);
+  return CopyBurst(burst, raw_radar_data.data());
+}
+
+RadarReturnCode ReplayRadar::ReadBurst(RadarBurstFormat& format,
+                                       uint8_t* buffer, uint32_t& read_bytes,
+                                       timespec timeout) {
+  if (buffer == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  ReplayBurst burst;
+  RadarReturnCode rc = TakeBurst(radar_utils::ToDeadline(timeout),
+                                 read_bytes, burst);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  format = burst.format;
+  read_bytes = burst.raw_bytes;
+  return CopyBurst(burst, buffer);
+}
+
+RadarReturnCode ReplayRadar::ReadBursts(uint32_t max_count,
+                                        std::vector<RadarBurstFormat>& formats,
+                                        std::vector<uint32_t>& burst_bytes,
+                                        std::vector<uint8_t>& arena,
+                                        timespec timeout) {
+  if (max_count == 0) {
+    return RC_BAD_INPUT;
+  }
+  formats.clear();
+  burst_bytes.clear();
+  arena.clear();
+
+  ReplayBurst burst;
+  Clock::time_point deadline = radar_utils::ToDeadline(timeout);
+  RadarReturnCode rc = RC_OK;
+  while (formats.size() < max_count) {
+    rc = TakeBurst(deadline, std::numeric_limits<uint32_t>::max(), burst);
+    if (rc != RC_OK) {
+      break;
+    }
+    // Only the first burst is waited for.
+    deadline = Clock::time_point();
+    const size_t offset = arena.size();
+    arena.resize(offset + burst.raw_bytes);
+    rc = CopyBurst(burst, arena.data() + offset);
+    if (rc != RC_OK) {
+      arena.resize(offset);
+      break;
+    }
+    formats.push_back(burst.format);
+    burst_bytes.push_back(burst.raw_bytes);
+  }
+  return formats.empty() ? rc : RC_OK;
+}
+
+RadarReturnCode ReplayRadar::ReadBursts(uint32_t max_count,
+                                        RadarBurstFormat* formats,
+                                        uint32_t* burst_bytes,
+                                        uint32_t& count, uint8_t* arena,
+                                        uint32_t& arena_bytes,
+                                        timespec timeout) {
+  if (max_count == 0 || formats == nullptr || burst_bytes == nullptr ||
+      arena == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  ReplayBurst burst;
+  Clock::time_point deadline = radar_utils::ToDeadline(timeout);
+  RadarReturnCode rc = RC_OK;
+  uint32_t offset = 0;
+  count = 0;
+  while (count < max_count) {
+    rc = TakeBurst(deadline, arena_bytes - offset, burst);
+    if (rc != RC_OK) {
+      break;
+    }
+    deadline = Clock::time_point();
+    rc = CopyBurst(burst, arena + offset);
+    if (rc != RC_OK) {
+      break;
+    }
+    formats[count] = burst.format;
+    burst_bytes[count] = burst.raw_bytes;
+    offset += burst.raw_bytes;
+    ++count;
+  }
+  arena_bytes = offset;
+  return count == 0 ? rc : RC_OK;
+}
+
+RadarReturnCode ReplayRadar::AcquireBurst(RadarBurstLease& lease,
+                                          timespec timeout) {
+  int index = -1;
+  {
+    std::lock_guard<std::mutex> lock(leases_mutex_);
+    for (int i = 0; i < kNumLeases && index < 0; ++i) {
+      if (!leases_[i].in_use) {
+        index = i;
+        leases_[i].in_use = true;
+      }
+    }
+  }
+  if (index < 0) {
+    return RC_RES_LIMIT;
+  }
+
+  ReplayBurst burst;
+  RadarReturnCode rc = TakeBurst(radar_utils::ToDeadline(timeout),
+                                 std::numeric_limits<uint32_t>::max(), burst);
+  // Raw bursts are not copied, the mapping outlives the leases. Encoded ones
+  // are decoded into the buffer of the lease, only used by its owner.
+  const uint8_t* data = burst.payload;
+  if (rc == RC_OK && burst.encoding != radar_utils::CaptureEncoding::kRaw) {
+    std::vector<uint8_t>& decoded = leases_[index].decoded;
+    decoded.resize(burst.raw_bytes);
+    rc = CopyBurst(burst, decoded.data());
+    data = decoded.data();
+  }
+  std::lock_guard<std::mutex> lock(leases_mutex_);
+  Lease& slot = leases_[index];
+  if (rc != RC_OK) {
+    slot.in_use = false;
+    return rc;
+  }
+  ++slot.generation;
+  lease.lease_id = (slot.generation << 8) | static_cast<uint32_t>(index);
+  lease.size_bytes = burst.raw_bytes;
+  lease.data = data;
+  lease.format = burst.format;
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::ReleaseBurst(const RadarBurstLease& lease) {
+  uint32_t index = lease.lease_id & 0xff;
+  std::lock_guard<std::mutex> lock(leases_mutex_);
+  if (index >= kNumLeases || !leases_[index].in_use ||
+      leases_[index].generation != (lease.lease_id >> 8)) {
+    return RC_BAD_INPUT;
+  }
+  leases_[index].in_use = false;
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::RegisterBurstBuffers(
+    const std::vector<uint8_t*>& buffers, uint32_t buffer_bytes) {
+  if (buffers.empty() || buffer_bytes == 0) {
+    return RC_BAD_INPUT;
+  }
+  for (uint8_t* buffer : buffers) {
+    if (buffer == nullptr ||
+        reinterpret_cast<uintptr_t>(buffer) % RADAR_BURST_BUFFER_ALIGNMENT) {
+      return RC_BAD_INPUT;
+    }
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (state_ == RSTATE_ACTIVE) {
+    return RC_BAD_STATE;
+  }
+  std::lock_guard<std::mutex> buffers_lock(buffers_mutex_);
+  buffers_ = buffers;
+  buffer_bytes_ = buffer_bytes;
+  free_buffers_.clear();
+  for (uint32_t i = 0; i < buffers.size(); ++i) {
+    free_buffers_.push_back(i);
+  }
+  app_owned_.assign(buffers.size(), false);
+  memset(&buffer_stats_, 0, sizeof(buffer_stats_));
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::UnregisterBurstBuffers(void) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (state_ == RSTATE_ACTIVE) {
+    return RC_BAD_STATE;
+  }
+  std::lock_guard<std::mutex> buffers_lock(buffers_mutex_);
+  buffers_.clear();
+  buffer_bytes_ = 0;
+  free_buffers_.clear();
+  app_owned_.clear();
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::WaitBurstBuffer(uint32_t& index,
+                                             RadarBurstFormat& format,
+                                             uint32_t& read_bytes,
+                                             timespec timeout) {
+  uint8_t* buffer = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    if (buffers_.empty()) {
+      return RC_BAD_STATE;
+    }
+    // Bursts wait in the capture until a buffer is returned, nothing is
+    // dropped for the lack of a buffer.
+    if (free_buffers_.empty()) {
+      return RC_RES_LIMIT;
+    }
+    index = free_buffers_.front();
+    free_buffers_.pop_front();
+    buffer = buffers_[index];
+  }
+
+  // Bursts larger than the buffers are dropped.
+  ReplayBurst burst;
+  Clock::time_point deadline = radar_utils::ToDeadline(timeout);
+  RadarReturnCode rc = RC_OK;
+  while (true) {
+    rc = TakeBurst(deadline, std::numeric_limits<uint32_t>::max(), burst);
+    if (rc != RC_OK || burst.raw_bytes <= buffer_bytes_) {
+      break;
+    }
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    ++buffer_stats_.dropped_oversize;
+  }
+  if (rc == RC_OK) {
+    rc = CopyBurst(burst, buffer);
+  }
+
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  if (rc != RC_OK) {
+    free_buffers_.push_front(index);
+    return rc;
+  }
+  format = burst.format;
+  read_bytes = burst.raw_bytes;
+  app_owned_[index] = true;
+  ++buffer_stats_.filled;
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::ReturnBurstBuffer(uint32_t index) {
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  if (index >= app_owned_.size() || !app_owned_[index]) {
+    return RC_BAD_INPUT;
+  }
+  app_owned_[index] = false;
+  free_buffers_.push_back(index);
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::GetBurstBufferStats(
+    RadarBurstBufferStats& stats) {
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  stats = buffer_stats_;
+  stats.app_owned = static_cast<uint32_t>(
+      std::count(app_owned_.begin(), app_owned_.end(), true));
+  stats.driver_owned = static_cast<uint32_t>(buffers_.size()) -
+                       stats.app_owned;
+  return RC_OK;
+}
+
+//--------------------------------------
+//----- Sensor info --------------------
+//--------------------------------------
+
+RadarReturnCode ReplayRadar::CheckCountryCode(
+    const std::string& country_code) {
+  // Nothing is transmitted.
+  if (country_code.size() != 2 || !isupper(country_code[0]) ||
+      !isupper(country_code[1])) {
+    return RC_BAD_INPUT;
+  }
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::GetSensorInfo(SensorInfo& info) {
+  if (!IsValid()) {
+    return RC_BAD_STATE;
+  }
+  const radar_utils::CaptureHeader& header = reader_.GetHeader();
+  info.name = header.name.c_str();
+  info.vendor = header.vendor.c_str();
+  info.device_id = header.device_id;
+  info.radar_type = header.radar_type;
+  info.driver_version = header.driver_version;
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::LogSensorDetails(void) {
+  const radar_utils::CaptureHeader& header = reader_.GetHeader();
+  REPLAY_LOG(RLOG_INF, "Replay of %s by %s, device %u, from %s",
+             header.name.c_str(), header.vendor.c_str(), header.device_id,
+             config_.path.c_str());
+  REPLAY_LOG(RLOG_INF, "Recorded with Radar API %u.%u.%u, driver %u.%u.%u",
+             header.api_version.major, header.api_version.minor,
+             header.api_version.patch, header.driver_version.major,
+             header.driver_version.minor, header.driver_version.patch);
+  REPLAY_LOG(RLOG_INF, "%zu recorded configs, %zu params, %s mode%s",
+             header.active_slots.size(), header.params.size(),
+             config_.is_real_time ? "real time" : "fast",
+             config_.is_looping ? ", looping" : "");
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::GetTxPosition(uint32_t tx_mask, int32_t& x,
+                                           int32_t& y, int32_t& z) {
+  // Antenna positions are not recorded.
+  (void) tx_mask;
+  (void) x;
+  (void) y;
+  (void) z;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode ReplayRadar::GetRxPosition(uint32_t rx_mask, int32_t& x,
+                                           int32_t& y, int32_t& z) {
+  (void) rx_mask;
+  (void) x;
+  (void) y;
+  (void) z;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode ReplayRadar::SetLogLevel(RadarLogLevel level) {
+  if (level < RLOG_OFF || level > RLOG_DBG) {
+    return RC_BAD_INPUT;
+  }
+  log_level_ = level;
+  return RC_OK;
+}
+
+//--------------------------------------
+//----- Registers ----------------------
+//--------------------------------------
+
+RadarReturnCode ReplayRadar::GetAllRegisters(
+    std::vector<std::pair<uint32_t, uint32_t>>& registers) {
+  // Registers are not recorded.
+  registers.clear();
+  return RC_OK;
+}
+
+RadarReturnCode ReplayRadar::GetRegister(uint32_t address, uint32_t& value) {
+  (void) address;
+  (void) value;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode ReplayRadar::SetRegister(uint32_t address, uint32_t value) {
+  (void) address;
+  (void) value;
+  return RC_UNSUPPORTED;
+}
+
+}  // namespace radar_api
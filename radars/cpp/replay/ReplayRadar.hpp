@@ -0,0 +1,330 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief A driver replaying the bursts of a capture file.
+ *
+ * @details The capture is mapped into memory, so bursts are served straight
+ *          from the page cache: ReadBurst copies them once and AcquireBurst
+ *          leases point into the mapping without any copy. Bursts recorded
+ *          with a lossless or lossy encoding are decoded instead, into
+ *          a buffer of the lease for AcquireBurst. The bursts are
+ *          found through the index of the capture, rebuilt for captures that
+ *          have none, see CaptureReader.hpp.
+ *
+ *          The sensor info, the config slots and the params are the ones
+ *          stored in the capture header, so processing code configured from
+ *          the getters runs unmodified. Setting a param to its recorded value
+ *          succeeds, any other value is rejected with RC_BAD_INPUT. Only the
+ *          recorded config slots can be activated, and bursts of the configs
+ *          that are not active are skipped.
+ *
+ *          In real time mode bursts are ready at the recorded burst period of
+ *          their config, keeping the gaps of the bursts dropped while
+ *          recording. A reader falling behind slows the replay down instead
+ *          of dropping bursts. Otherwise every burst is ready as soon as
+ *          the previous one is read, to process captures as fast as possible.
+ *
+ *          Every StartDataStreaming replays the capture from its first burst.
+ *          Once the last burst is read the reads fail with RC_BAD_STATE, as
+ *          after streaming stops, unless the replay loops.
+ *
+ *          CreateRadarSensor and radarCreate read the capture of the sensor
+ *          from the environment, see GetReplayConfig. The burst ready
+ *          descriptor requires Linux, the rest requires POSIX.
+ *
+ * Example:
+ * ```
+ *   radar_api::ReplayConfig config;
+ *   config.path = "bursts.cap";
+ *   config.is_real_time = false;
+ *   radar_api::ReplayRadar radar(0, config);
+ *   radar.TurnOn();
+ *   radar.ActivateConfig(0);
+ *   radar.StartDataStreaming();
+ *   while (radar.AcquireBurst(lease, timeout) == RC_OK) {
+ *     radar.ReleaseBurst(lease);
+ *   }
+ * ```
+ */
+#ifndef RIPPLE_RADAR_REPLAY_REPLAYRADAR_HPP_
+#define RIPPLE_RADAR_REPLAY_REPLAYRADAR_HPP_
+
+#include <IRadarSensor.hpp>
+
+#include <CaptureFormat.hpp>
+#include <CaptureReader.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace radar_api {
+
+struct ReplayConfig {
+  //! The capture to replay.
+  std::string path;
+  //! Follow the recorded burst period when true, replay as fast as
+  //! the bursts are read otherwise.
+  bool is_real_time = true;
+  //! Start over from the first burst at the end of the capture.
+  bool is_looping = false;
+};
+
+/**
+ * @brief Get the replay config of a sensor from the environment.
+ *
+ * @details The capture is RIPPLE_REPLAY_CAPTURE_<id>, or
+ *          RIPPLE_REPLAY_CAPTURE for every sensor. RIPPLE_REPLAY_REAL_TIME
+ *          set to 0 replays as fast as possible and RIPPLE_REPLAY_LOOP set
+ *          to 1 loops.
+ *
+ * @return false if no capture is set for the sensor.
+ */
+bool GetReplayConfig(int32_t id, ReplayConfig& config);
+
+class ReplayRadar : public IRadarSensor {
+ public:
+  ReplayRadar(int32_t id, const ReplayConfig& config);
+  ~ReplayRadar();
+
+  //! Check if the capture was mapped and its header parsed.
+  bool IsValid(void) const {
+    return reader_.IsOpen();
+  }
+
+  //! Get the header of the capture.
+  const radar_utils::CaptureHeader& GetCaptureHeader(void) const {
+    return reader_.GetHeader();
+  }
+
+  RadarReturnCode AddObserver(IRadarSensorObserver* observer);
+  RadarReturnCode RemoveObserver(IRadarSensorObserver* observer);
+
+  RadarReturnCode GetRadarState(RadarState& state);
+  RadarReturnCode TurnOn(void);
+  RadarReturnCode TurnOff(void);
+  RadarReturnCode GoSleep(void);
+  RadarReturnCode WakeUp(void);
+
+  RadarReturnCode GetNumConfigSlots(uint8_t& num_slots);
+  RadarReturnCode GetMaxActiveConfigSlots(uint8_t& num_slots);
+  RadarReturnCode ActivateConfig(uint8_t slot_id);
+  RadarReturnCode DeactivateConfig(uint8_t slot_id);
+  RadarReturnCode GetActiveConfigs(std::vector<uint8_t>& slot_ids);
+
+  RadarReturnCode GetMainParam(uint8_t slot_id, RadarMainParam id,
+                               uint32_t& value);
+  RadarReturnCode SetMainParam(uint8_t slot_id, RadarMainParam id,
+                               uint32_t value);
+  RadarReturnCode GetMainParamRange(RadarMainParam id, uint32_t& min_value,
+                                    uint32_t& max_value);
+
+  RadarReturnCode GetTxParam(uint8_t slot_id, uint32_t antenna_mask,
+                             RadarTxParam id, uint32_t& value);
+  RadarReturnCode SetTxParam(uint8_t slot_id, uint32_t antenna_mask,
+                             RadarTxParam id, uint32_t value);
+  RadarReturnCode GetTxParamRange(RadarTxParam id, uint32_t& min_value,
+                                  uint32_t& max_value);
+
+  RadarReturnCode GetRxParam(uint8_t slot_id, uint32_t antenna_mask,
+                             RadarRxParam id, uint32_t& value);
+  RadarReturnCode SetRxParam(uint8_t slot_id, uint32_t antenna_mask,
+                             RadarRxParam id, uint32_t value);
+  RadarReturnCode GetRxParamRange(RadarRxParam id, uint32_t& min_value,
+                                  uint32_t& max_value);
+
+  RadarReturnCode GetVendorParam(uint8_t slot_id, RadarVendorParam id,
+                                 uint32_t& value);
+  RadarReturnCode SetVendorParam(uint8_t slot_id, RadarVendorParam id,
+                                 uint32_t value);
+  RadarReturnCode GetVendorParamRange(RadarVendorParam id,
+                                      uint32_t& min_value,
+                                      uint32_t& max_value);
+
+  RadarReturnCode GetVendorTxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                   RadarVendorTxParam id, uint32_t& value);
+  RadarReturnCode SetVendorTxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                   RadarVendorTxParam id, uint32_t value);
+  RadarReturnCode GetVendorTxParamRange(RadarVendorTxParam id,
+                                        uint32_t& min_value,
+                                        uint32_t& max_value);
+
+  RadarReturnCode GetVendorRxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                   RadarVendorRxParam id, uint32_t& value);
+  RadarReturnCode SetVendorRxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                   RadarVendorRxParam id, uint32_t value);
+  RadarReturnCode GetVendorRxParamRange(RadarVendorRxParam id,
+                                        uint32_t& min_value,
+                                        uint32_t& max_value);
+
+  RadarReturnCode StartDataStreaming(void);
+  RadarReturnCode StopDataStreaming(void);
+  RadarReturnCode IsBurstReady(bool& is_ready);
+  RadarReturnCode GetBurstReadyFd(int& fd);
+  RadarReturnCode ReadBurst(RadarBurstFormat& format,
+                            std::vector<uint8_t>& raw_radar_data,
+                            timespec timeout);
+  RadarReturnCode ReadBursts(uint32_t max_count,
+                             std::vector<RadarBurstFormat>& formats,
+                             std::vector<uint32_t>& burst_bytes,
+                             std::vector<uint8_t>& arena,
+                             timespec timeout);
+  RadarReturnCode AcquireBurst(RadarBurstLease& lease, timespec timeout);
+  RadarReturnCode ReleaseBurst(const RadarBurstLease& lease);
+  RadarReturnCode RegisterBurstBuffers(const std::vector<uint8_t*>& buffers,
+                                       uint32_t buffer_bytes);
+  RadarReturnCode UnregisterBurstBuffers(void);
+  RadarReturnCode WaitBurstBuffer(uint32_t& index, RadarBurstFormat& format,
+                                  uint32_t& read_bytes, timespec timeout);
+  RadarReturnCode ReturnBurstBuffer(uint32_t index);
+  RadarReturnCode GetBurstBufferStats(RadarBurstBufferStats& stats);
+
+  /**
+   * @brief Read a burst into a caller buffer, for the C API.
+   *
+   * @param read_bytes the size of the buffer, set to the bytes read.
+   *
+   * @return RC_RES_LIMIT if the burst does not fit, it stays pending.
+   */
+  RadarReturnCode ReadBurst(RadarBurstFormat& format, uint8_t* buffer,
+                            uint32_t& read_bytes, timespec timeout);
+
+  /**
+   * @brief Read the pending bursts into a caller arena, for the C API.
+   *
+   * @param arena_bytes the size of the arena, set to the bytes read.
+   *
+   * @return RC_RES_LIMIT if the first burst does not fit, it stays pending.
+   */
+  RadarReturnCode ReadBursts(uint32_t max_count, RadarBurstFormat* formats,
+                             uint32_t* burst_bytes, uint32_t& count,
+                             uint8_t* arena, uint32_t& arena_bytes,
+                             timespec timeout);
+
+  RadarReturnCode CheckCountryCode(const std::string& country_code);
+  RadarReturnCode GetSensorInfo(SensorInfo& info);
+  RadarReturnCode LogSensorDetails(void);
+  RadarReturnCode GetTxPosition(uint32_t tx_mask, int32_t& x, int32_t& y,
+                                int32_t& z);
+  RadarReturnCode GetRxPosition(uint32_t rx_mask, int32_t& x, int32_t& y,
+                                int32_t& z);
+  RadarReturnCode SetLogLevel(RadarLogLevel level);
+  RadarReturnCode GetAllRegisters(
+      std::vector<std::pair<uint32_t, uint32_t>>& registers);
+  RadarReturnCode GetRegister(uint32_t address, uint32_t& value);
+  RadarReturnCode SetRegister(uint32_t address, uint32_t value);
+
+ private:
+  static const int kNumLeases = 8;
+  static const int kNumSlotIds = 256;
+
+  using Clock = std::chrono::steady_clock;
+
+  //! A record of the capture taken by a reader.
+  struct ReplayBurst {
+    RadarBurstFormat format;
+    const uint8_t* payload;
+    uint32_t payload_bytes;
+    uint32_t raw_bytes;
+    radar_utils::CaptureEncoding encoding;
+  };
+
+  struct Lease {
+    bool in_use;
+    uint32_t generation;
+    //! The burst of the lease when it is encoded in the capture.
+    std::vector<uint8_t> decoded;
+  };
+
+  bool IsRecordedSlot(uint8_t slot_id) const;
+  RadarReturnCode FindParam(radar_utils::CaptureParamKind kind,
+                            uint8_t slot_id, RadarParamGroup group,
+                            uint32_t id, uint32_t antenna_mask,
+                            uint32_t& value) const;
+  RadarReturnCode FindParamRange(radar_utils::CaptureParamKind kind,
+                                 RadarParamGroup group, uint32_t id,
+                                 uint32_t& min_value,
+                                 uint32_t& max_value) const;
+  RadarReturnCode CheckParam(radar_utils::CaptureParamKind kind,
+                             uint8_t slot_id, RadarParamGroup group,
+                             uint32_t id, uint32_t antenna_mask,
+                             uint32_t value);
+  RadarReturnCode StopStreamingLocked(std::unique_lock<std::mutex>& lock);
+
+  void Rewind(void);
+  bool FindNext(void);
+  RadarReturnCode TakeBurst(Clock::time_point deadline, uint32_t max_bytes,
+                            ReplayBurst& burst);
+  RadarReturnCode CopyBurst(const ReplayBurst& burst, uint8_t* data);
+  void Notify(void);
+
+  void UpdateReady(void);
+  void NotifyBurstReady(void);
+
+  void Log(RadarLogLevel level, const char* function, int line,
+           const char* format, ...)
+#if defined(__GNUC__) || defined(__clang__)
+      __attribute__((format(printf, 5, 6)))
+#endif
+      ;
+
+  const int32_t id_;
+  const ReplayConfig config_;
+
+  //! The mapped capture, its header and its index.
+  radar_utils::CaptureReader reader_;
+  //! BURST_PERIOD_US of the recorded configs, 0 if unknown.
+  uint32_t burst_period_us_[kNumSlotIds];
+
+  //! Guards the radar state and the active configs.
+  std::mutex mutex_;
+  RadarState state_;
+  bool is_active_[kNumSlotIds];
+
+  std::mutex observers_mutex_;
+  std::vector<IRadarSensorObserver*> observers_;
+  std::atomic<RadarLogLevel> log_level_;
+
+  //! Guards the replay position, wakes up the readers and the notifier.
+  std::mutex stream_mutex_;
+  std::condition_variable stream_cv_;
+  bool is_streaming_;
+  bool is_replay_active_[kNumSlotIds];
+  //! The next record to replay, valid while has_next_, and its position in
+  //! the index.
+  bool has_next_;
+  size_t next_position_;
+  const uint8_t* next_payload_;
+  radar_utils::CaptureRecordHeader next_record_;
+  Clock::time_point next_ready_;
+  //! The last record taken, for the pacing of the next one.
+  bool has_last_;
+  Clock::time_point last_ready_;
+  radar_utils::CaptureRecordHeader last_record_;
+  uint64_t num_taken_;
+  std::thread notifier_;
+
+  std::mutex leases_mutex_;
+  Lease leases_[kNumLeases];
+
+  //! Registered burst buffers, filled when they are waited for.
+  std::mutex buffers_mutex_;
+  std::vector<uint8_t*> buffers_;
+  uint32_t buffer_bytes_;
+  std::deque<uint32_t> free_buffers_;
+  std::vector<bool> app_owned_;
+  RadarBurstBufferStats buffer_stats_;
+
+  //! Timer that is readable while a burst is ready, armed once requested.
+  int ready_fd_;
+  bool is_ready_fd_used_;
+};
+
+}  // namespace radar_api
+
+#endif  // RIPPLE_RADAR_REPLAY_REPLAYRADAR_HPP_
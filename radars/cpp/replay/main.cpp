@@ -0,0 +1,30 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <IRadarSensor.hpp>
+#include <ReplayRadar.hpp>
+
+Version radarGetRadarApiVersion(void) {
+  return {2, 0, 0, 0};
+}
+
+namespace radar_api {
+
+IRadarSensor* CreateRadarSensor(int32_t id) {
+  ReplayConfig config;
+  if (!GetReplayConfig(id, config)) {
+    return nullptr;
+  }
+  ReplayRadar* radar = new ReplayRadar(id, config);
+  if (!radar->IsValid()) {
+    delete radar;
+    return nullptr;
+  }
+  return radar;
+}
+
+RadarReturnCode DestroyRadarSensor(IRadarSensor* radar) {
+  delete radar;
+  return RC_OK;
+}
+
+}  // namespace radar_api
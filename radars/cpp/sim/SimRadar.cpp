@@ -0,0 +1,1339 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <SimRadar.hpp>
+
+#include <SamplePacking.hpp>
+#include <Timespec.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+#define SIM_LOG(level, ...) Log(level, __func__, __LINE__, __VA_ARGS__)
+
+namespace radar_api {
+
+namespace {
+
+struct ParamRange {
+  uint32_t min_value;
+  uint32_t max_value;
+  uint32_t default_value;
+};
+
+// Param ranges indexed by the param IDs, 0 is the undefined ID.
+const ParamRange kCommonParams[] = {
+  {0, 0, 0},
+  {RSTATE_ACTIVE, RSTATE_SLEEP, RSTATE_IDLE},  // AFTERBURST_POWER_MODE
+  {1000, 10000000, 50000},                     // BURST_PERIOD_US
+  {0x1, 0x3, 0x1},                             // TX_ANTENNA_MASK
+  {0x1, 0xf, 0xf},                             // RX_ANTENNA_MASK
+};
+
+const ParamRange kFmcwParams[] = {
+  {0, 0, 0},
+  {RSTATE_ACTIVE, RSTATE_SLEEP, RSTATE_IDLE},  // INTERCHIRP_POWER_MODE
+  {20, 10000, 100},                            // CHIRP_PERIOD_US
+  {1, 1024, 32},                               // CHIRPS_PER_BURST
+  {8, 2048, 64},                               // SAMPLES_PER_CHIRP
+  {57000, 64000, 58000},                       // LOWER_FREQ_MHZ
+  {57000, 64000, 63000},                       // UPPER_FREQ_MHZ
+  {100000, 20000000, 2000000},                 // ADC_SAMPLING_HZ
+};
+
+const ParamRange kTxParams[] = {
+  {0, 0, 0},
+  {0, 31, 31},  // POWER_IDX
+};
+
+const ParamRange kRxParams[] = {
+  {0, 0, 0},
+  {0, 31, 16},   // VGA_IDX
+  {0, 3, 1},     // HP_GAIN_IDX
+  {20, 800, 80}, // HP_CUTOFF_KHZ
+};
+
+const ParamRange kVendorParams[] = {
+  {0, 0, 0},
+  {0, 1, 1},      // REAL_TIME
+  {0, 1000, 4},   // NOISE_LSB
+  {0, 1, 1},      // INTERLEAVED
+  {12, 16, 16},   // SAMPLE_BITS
+  {1, 64, 8},     // QUEUE_DEPTH
+};
+
+// Antennas half a wavelength apart at 60.5 GHz, the second TX antenna
+// past the last RX one, so both TX antennas form a uniform virtual array
+// of 8 elements. Positions in micrometers.
+const int32_t kTxPositions[][3] = {{0, 0, 0}, {9912, 0, 0}};
+const int32_t kRxPositions[][3] = {
+  {0, 0, 0}, {2478, 0, 0}, {4956, 0, 0}, {7434, 0, 0}};
+
+const uint32_t kMaxBurstBytes = 64 << 20;
+const double kSpeedOfLight = 299792458.0;
+// How long a blocked producer waits before checking if it has to stop.
+const timespec kPushTimeout = {0, 100000000};  // 100 ms.
+
+const char kSensorName[] = "Ripple simulated FMCW radar";
+const char kVendorName[] = "CTA Radar API Technical Project";
+
+template <size_t N>
+RadarReturnCode FindParam(const ParamRange (&table)[N], uint32_t id,
+                          const ParamRange*& range) {
+  if (id == 0 || id >= N) {
+    return RC_BAD_INPUT;
+  }
+  range = &table[id];
+  return RC_OK;
+}
+
+RadarReturnCode FindMainParam(RadarMainParam id, const ParamRange*& range) {
+  switch (id.group) {
+    case RADAR_PARAM_GROUP_COMMON:
+      return FindParam(kCommonParams, id.id, range);
+    case RADAR_PARAM_GROUP_FMCW:
+      return FindParam(kFmcwParams, id.id, range);
+  }
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode FindTxParam(RadarTxParam id, const ParamRange*& range) {
+  if (id.group != RADAR_PARAM_GROUP_FMCW) {
+    return RC_UNSUPPORTED;
+  }
+  return FindParam(kTxParams, id.id, range);
+}
+
+RadarReturnCode FindRxParam(RadarRxParam id, const ParamRange*& range) {
+  if (id.group != RADAR_PARAM_GROUP_FMCW) {
+    return RC_UNSUPPORTED;
+  }
+  return FindParam(kRxParams, id.id, range);
+}
+
+bool IsInRange(const ParamRange& range, uint32_t value) {
+  return value >= range.min_value && value <= range.max_value;
+}
+
+// Get the index of the only bit set in a mask of num_bits.
+bool GetSingleBit(uint32_t mask, int num_bits, int& index) {
+  if (mask == 0 || (mask & (mask - 1)) != 0) {
+    return false;
+  }
+  for (index = 0; index < num_bits; ++index) {
+    if (mask == (1u << index)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int CountBits(uint32_t mask) {
+  int count = 0;
+  for (; mask != 0; mask &= mask - 1) {
+    ++count;
+  }
+  return count;
+}
+
+SimPosition ToMeters(const int32_t position[3]) {
+  SimPosition meters = {position[0] * 1e-6, position[1] * 1e-6,
+                        position[2] * 1e-6};
+  return meters;
+}
+
+bool IsPacked(const RadarBurstFormat& format) {
+  return format.sample_packing == RSAMPLE_PACKING_PACKED;
+}
+
+// Get the size of the burst data of the components of a burst.
+size_t GetEncodedBytes(const RadarBurstFormat& format,
+                       const std::vector<int16_t>& iq) {
+  if (!IsPacked(format)) {
+    return iq.size() * 2;
+  }
+  radar_dsp::SampleLayout layout;
+  radar_dsp::GetSampleLayout(format, layout);
+  return radar_dsp::GetBurstBytes(format, iq.size() / layout.components);
+}
+
+// Write the padded little endian samples of a burst into size_bytes of
+// GetEncodedBytes, packing them when the format asks for it.
+void Encode(const RadarBurstFormat& format, const std::vector<int16_t>& iq,
+            std::vector<uint8_t>& padded, uint8_t* data, size_t size_bytes) {
+  uint8_t* out = data;
+  if (IsPacked(format)) {
+    padded.resize(iq.size() * 2);
+    out = padded.data();
+  }
+  for (size_t i = 0; i < iq.size(); ++i) {
+    uint16_t value = static_cast<uint16_t>(iq[i]);
+    out[2 * i] = static_cast<uint8_t>(value);
+    out[2 * i + 1] = static_cast<uint8_t>(value >> 8);
+  }
+  if (out != data) {
+    radar_dsp::PackSamples(format, padded.data(), padded.size(), data,
+                           size_bytes);
+  }
+}
+
+}  // namespace
+
+SimRadar::SimRadar(int32_t id)
+    : id_(id), scene_(static_cast<uint32_t>(id) + 1), state_(RSTATE_OFF),
+      log_level_(RLOG_WRN), is_streaming_(false), buffer_bytes_(0),
+      is_ready_signaled_(false) {
+  ResetSlots();
+  for (int i = 0; i <= kNumVendorParams; ++i) {
+    vendor_params_[i] = kVendorParams[i].default_value;
+  }
+  scene_.SetNoise(
+      static_cast<float>(vendor_params_[SIM_VENDOR_PARAM_NOISE_LSB]));
+
+  // A person walking away, one walking closer and a static reflector.
+  std::vector<SimTarget> targets;
+  SimTarget walking_away = {0.8f, 0.5f, 20.0f, 0.0f, 0.1f};
+  SimTarget walking_closer = {1.4f, -0.3f, -30.0f, 0.0f, 0.05f};
+  SimTarget reflector = {0.4f, 0.0f, 0.0f, 0.0f, 0.2f};
+  targets.push_back(walking_away);
+  targets.push_back(walking_closer);
+  targets.push_back(reflector);
+  scene_.SetTargets(targets);
+
+  registers_[0x0000] = 0x52500001;  // Chip ID.
+  registers_[0x0004] = 0x00000001;  // Revision.
+  registers_[0x0010] = 0x00000000;  // Control.
+
+  // Nothing is streamed before StartDataStreaming.
+  queue_.reset(new radar_utils::BurstQueue(
+      1, radar_utils::DropPolicy::kDropOldest));
+  queue_->Close();
+  for (Lease& lease : leases_) {
+    lease.in_use = false;
+    lease.generation = 0;
+  }
+  memset(&buffer_stats_, 0, sizeof(buffer_stats_));
+
+  if (pipe(ready_pipe_) == 0) {
+    for (int fd : ready_pipe_) {
+      fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+      fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+  } else {
+    ready_pipe_[0] = ready_pipe_[1] = -1;
+  }
+}
+
+SimRadar::~SimRadar() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (state_ == RSTATE_ACTIVE) {
+    StopStreamingLocked(lock);
+  }
+  for (int fd : ready_pipe_) {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+}
+
+void SimRadar::SetTargets(const std::vector<SimTarget>& targets) {
+  scene_.SetTargets(targets);
+}
+
+std::vector<SimTarget> SimRadar::GetTargets(void) {
+  return scene_.GetTargets();
+}
+
+//--------------------------------------
+//----- Observers ----------------------
+//--------------------------------------
+
+RadarReturnCode SimRadar::AddObserver(IRadarSensorObserver* observer) {
+  if (observer == nullptr) {
+    return RC_BAD_INPUT;
+  }
+  std::lock_guard<std::mutex> lock(observers_mutex_);
+  if (std::find(observers_.begin(), observers_.end(), observer) !=
+      observers_.end()) {
+    return RC_BAD_INPUT;
+  }
+  observers_.push_back(observer);
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::RemoveObserver(IRadarSensorObserver* observer) {
+  std::lock_guard<std::mutex> lock(observers_mutex_);
+  auto it = std::find(observers_.begin(), observers_.end(), observer);
+  if (it == observers_.end()) {
+    return RC_BAD_INPUT;
+  }
+  observers_.erase(it);
+  return RC_OK;
+}
+
+void SimRadar::Log(RadarLogLevel level, const char* function, int line,
+                   const char* format, ...) {
+  if (level <= RLOG_OFF || level > log_level_.load()) {
+    return;
+  }
+  char message[256];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(message, sizeof(message), format, args);
+  va_end(args);
+
+  std::lock_guard<std::mutex> lock(observers_mutex_);
+  for (IRadarSensorObserver* observer : observers_) {
+    observer->OnLogMessage(level, __FILE__, function, line, message);
+  }
+}
+
+void SimRadar::NotifyBurstReady(void) {
+  std::lock_guard<std::mutex> lock(observers_mutex_);
+  for (IRadarSensorObserver* observer : observers_) {
+    observer->OnBurstReady();
+  }
+}
+
+//--------------------------------------
+//----- Power states -------------------
+//--------------------------------------
+
+RadarReturnCode SimRadar::GetRadarState(RadarState& state) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  state = state_;
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::TurnOn(void) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_ == RSTATE_IDLE) {
+      return RC_OK;
+    }
+    if (state_ != RSTATE_OFF) {
+      return RC_BAD_STATE;
+    }
+    state_ = RSTATE_IDLE;
+  }
+  SIM_LOG(RLOG_INF, "Radar %d turned on", id_);
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::TurnOff(void) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (state_ == RSTATE_OFF) {
+      return RC_OK;
+    }
+    if (state_ == RSTATE_ACTIVE) {
+      RadarReturnCode rc = StopStreamingLocked(lock);
+      if (rc != RC_OK) {
+        return rc;
+      }
+    }
+    // The configuration does not survive a power cycle.
+    state_ = RSTATE_OFF;
+    ResetSlots();
+  }
+  SIM_LOG(RLOG_INF, "Radar %d turned off", id_);
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GoSleep(void) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (state_ == RSTATE_SLEEP) {
+    return RC_OK;
+  }
+  if (state_ != RSTATE_IDLE) {
+    return RC_BAD_STATE;
+  }
+  state_ = RSTATE_SLEEP;
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::WakeUp(void) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (state_ == RSTATE_IDLE) {
+    return RC_OK;
+  }
+  if (state_ != RSTATE_SLEEP) {
+    return RC_BAD_STATE;
+  }
+  state_ = RSTATE_IDLE;
+  return RC_OK;
+}
+
+//--------------------------------------
+//----- Config slots -------------------
+//--------------------------------------
+
+void SimRadar::ResetSlots(void) {
+  for (SlotConfig& slot : slots_) {
+    slot.is_active = false;
+    for (int i = 0; i <= kNumCommonParams; ++i) {
+      slot.common[i] = kCommonParams[i].default_value;
+    }
+    for (int i = 0; i <= kNumFmcwParams; ++i) {
+      slot.fmcw[i] = kFmcwParams[i].default_value;
+    }
+    for (int tx = 0; tx < kNumTx; ++tx) {
+      slot.tx_power[tx] = kTxParams[FMCW_TX_PARAM_POWER_IDX].default_value;
+    }
+    for (int rx = 0; rx < kNumRx; ++rx) {
+      for (int i = 0; i <= kNumRxParams; ++i) {
+        slot.rx[rx][i] = kRxParams[i].default_value;
+      }
+    }
+  }
+}
+
+RadarReturnCode SimRadar::CheckSlot(uint8_t slot_id) const {
+  return slot_id < kNumSlots ? RC_OK : RC_BAD_INPUT;
+}
+
+const char* SimRadar::CheckConfig(const SlotConfig& slot) const {
+  uint64_t samples = slot.fmcw[FMCW_PARAM_SAMPLES_PER_CHIRP];
+  uint64_t chirps = slot.fmcw[FMCW_PARAM_CHIRPS_PER_BURST];
+  uint64_t chirp_period_us = slot.fmcw[FMCW_PARAM_CHIRP_PERIOD_US];
+  if (samples * 1000000 >
+      chirp_period_us * slot.fmcw[FMCW_PARAM_ADC_SAMPLING_HZ]) {
+    return "the samples of a chirp take longer than the chirp period";
+  }
+  if (chirps * chirp_period_us > slot.common[RADAR_PARAM_BURST_PERIOD_US]) {
+    return "the chirps of a burst take longer than the burst period";
+  }
+  if (slot.fmcw[FMCW_PARAM_LOWER_FREQ_MHZ] >=
+      slot.fmcw[FMCW_PARAM_UPPER_FREQ_MHZ]) {
+    return "the lower frequency is not below the upper frequency";
+  }
+  uint64_t bytes = samples * chirps *
+                   CountBits(slot.common[RADAR_PARAM_RX_ANTENNA_MASK]) * 4;
+  if (bytes > kMaxBurstBytes) {
+    return "the burst is too large";
+  }
+  return nullptr;
+}
+
+RadarReturnCode SimRadar::GetNumConfigSlots(uint8_t& num_slots) {
+  num_slots = kNumSlots;
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetMaxActiveConfigSlots(uint8_t& num_slots) {
+  num_slots = kMaxActiveSlots;
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::ActivateConfig(uint8_t slot_id) {
+  RadarReturnCode rc = CheckSlot(slot_id);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  const char* error = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_ == RSTATE_OFF || state_ == RSTATE_ACTIVE) {
+      return RC_BAD_STATE;
+    }
+    SlotConfig& slot = slots_[slot_id];
+    if (slot.is_active) {
+      return RC_OK;
+    }
+    int num_active = 0;
+    for (const SlotConfig& other : slots_) {
+      num_active += other.is_active ? 1 : 0;
+    }
+    if (num_active >= kMaxActiveSlots) {
+      return RC_RES_LIMIT;
+    }
+    error = CheckConfig(slot);
+    if (error == nullptr) {
+      slot.is_active = true;
+    }
+  }
+  if (error != nullptr) {
+    SIM_LOG(RLOG_ERR, "Config %u rejected, %s", slot_id, error);
+    return RC_BAD_INPUT;
+  }
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::DeactivateConfig(uint8_t slot_id) {
+  RadarReturnCode rc = CheckSlot(slot_id);
+  if (rc != RC_OK) {
+    return rc;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (state_ == RSTATE_ACTIVE) {
+    return RC_BAD_STATE;
+  }
+  slots_[slot_id].is_active = false;
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetActiveConfigs(std::vector<uint8_t>& slot_ids) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  slot_ids.clear();
+  for (uint8_t i = 0; i < kNumSlots; ++i) {
+    if (slots_[i].is_active) {
+      slot_ids.push_back(i);
+    }
+  }
+  return RC_OK;
+}
+
+//--------------------------------------
+//----- Params -------------------------
+//--------------------------------------
+
+RadarReturnCode SimRadar::GetMainParam(uint8_t slot_id, RadarMainParam id,
+                                       uint32_t& value) {
+  const ParamRange* range = nullptr;
+  RadarReturnCode rc = CheckSlot(slot_id);
+  if (rc == RC_OK) {
+    rc = FindMainParam(id, range);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  const SlotConfig& slot = slots_[slot_id];
+  value = id.group == RADAR_PARAM_GROUP_COMMON ? slot.common[id.id]
+                                               : slot.fmcw[id.id];
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::SetMainParam(uint8_t slot_id, RadarMainParam id,
+                                       uint32_t value) {
+  const ParamRange* range = nullptr;
+  RadarReturnCode rc = CheckSlot(slot_id);
+  if (rc == RC_OK) {
+    rc = FindMainParam(id, range);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (!IsInRange(*range, value)) {
+    return RC_BAD_INPUT;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  SlotConfig& slot = slots_[slot_id];
+  if (state_ == RSTATE_OFF || (state_ == RSTATE_ACTIVE && slot.is_active)) {
+    return RC_BAD_STATE;
+  }
+  uint32_t* values =
+      id.group == RADAR_PARAM_GROUP_COMMON ? slot.common : slot.fmcw;
+  values[id.id] = value;
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetMainParamRange(RadarMainParam id,
+                                            uint32_t& min_value,
+                                            uint32_t& max_value) {
+  const ParamRange* range = nullptr;
+  RadarReturnCode rc = FindMainParam(id, range);
+  if (rc == RC_OK) {
+    min_value = range->min_value;
+    max_value = range->max_value;
+  }
+  return rc;
+}
+
+RadarReturnCode SimRadar::GetTxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                     RadarTxParam id, uint32_t& value) {
+  const ParamRange* range = nullptr;
+  int tx = 0;
+  RadarReturnCode rc = CheckSlot(slot_id);
+  if (rc == RC_OK) {
+    rc = FindTxParam(id, range);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (!GetSingleBit(antenna_mask, kNumTx, tx)) {
+    return RC_BAD_INPUT;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  value = slots_[slot_id].tx_power[tx];
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::SetTxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                     RadarTxParam id, uint32_t value) {
+  const ParamRange* range = nullptr;
+  RadarReturnCode rc = CheckSlot(slot_id);
+  if (rc == RC_OK) {
+    rc = FindTxParam(id, range);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (!IsInRange(*range, value) || antenna_mask == 0 ||
+      antenna_mask >= (1u << kNumTx)) {
+    return RC_BAD_INPUT;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  SlotConfig& slot = slots_[slot_id];
+  if (state_ == RSTATE_OFF || (state_ == RSTATE_ACTIVE && slot.is_active)) {
+    return RC_BAD_STATE;
+  }
+  for (int tx = 0; tx < kNumTx; ++tx) {
+    if (antenna_mask & (1u << tx)) {
+      slot.tx_power[tx] = value;
+    }
+  }
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetTxParamRange(RadarTxParam id,
+                                          uint32_t& min_value,
+                                          uint32_t& max_value) {
+  const ParamRange* range = nullptr;
+  RadarReturnCode rc = FindTxParam(id, range);
+  if (rc == RC_OK) {
+    min_value = range->min_value;
+    max_value = range->max_value;
+  }
+  return rc;
+}
+
+RadarReturnCode SimRadar::GetRxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                     RadarRxParam id, uint32_t& value) {
+  const ParamRange* range = nullptr;
+  int rx = 0;
+  RadarReturnCode rc = CheckSlot(slot_id);
+  if (rc == RC_OK) {
+    rc = FindRxParam(id, range);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (!GetSingleBit(antenna_mask, kNumRx, rx)) {
+    return RC_BAD_INPUT;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  value = slots_[slot_id].rx[rx][id.id];
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::SetRxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                     RadarRxParam id, uint32_t value) {
+  const ParamRange* range = nullptr;
+  RadarReturnCode rc = CheckSlot(slot_id);
+  if (rc == RC_OK) {
+    rc = FindRxParam(id, range);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (!IsInRange(*range, value) || antenna_mask == 0 ||
+      antenna_mask >= (1u << kNumRx)) {
+    return RC_BAD_INPUT;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  SlotConfig& slot = slots_[slot_id];
+  if (state_ == RSTATE_OFF || (state_ == RSTATE_ACTIVE && slot.is_active)) {
+    return RC_BAD_STATE;
+  }
+  for (int rx = 0; rx < kNumRx; ++rx) {
+    if (antenna_mask & (1u << rx)) {
+      slot.rx[rx][id.id] = value;
+    }
+  }
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetRxParamRange(RadarRxParam id,
+                                          uint32_t& min_value,
+                                          uint32_t& max_value) {
+  const ParamRange* range = nullptr;
+  RadarReturnCode rc = FindRxParam(id, range);
+  if (rc == RC_OK) {
+    min_value = range->min_value;
+    max_value = range->max_value;
+  }
+  return rc;
+}
+
+RadarReturnCode SimRadar::GetVendorParam(uint8_t slot_id, RadarVendorParam id,
+                                         uint32_t& value) {
+  const ParamRange* range = nullptr;
+  RadarReturnCode rc = CheckSlot(slot_id);
+  if (rc == RC_OK) {
+    rc = FindParam(kVendorParams, id, range);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  value = vendor_params_[id];
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::SetVendorParam(uint8_t slot_id, RadarVendorParam id,
+                                         uint32_t value) {
+  const ParamRange* range = nullptr;
+  RadarReturnCode rc = CheckSlot(slot_id);
+  if (rc == RC_OK) {
+    rc = FindParam(kVendorParams, id, range);
+  }
+  if (rc != RC_OK) {
+    return rc;
+  }
+  if (!IsInRange(*range, value) ||
+      (id == SIM_VENDOR_PARAM_SAMPLE_BITS && value != 12 && value != 16)) {
+    return RC_BAD_INPUT;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (id == SIM_VENDOR_PARAM_NOISE_LSB) {
+    // The noise can change while streaming.
+    scene_.SetNoise(static_cast<float>(value));
+  } else if (state_ == RSTATE_ACTIVE) {
+    return RC_BAD_STATE;
+  }
+  vendor_params_[id] = value;
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetVendorParamRange(RadarVendorParam id,
+                                              uint32_t& min_value,
+                                              uint32_t& max_value) {
+  const ParamRange* range = nullptr;
+  RadarReturnCode rc = FindParam(kVendorParams, id, range);
+  if (rc == RC_OK) {
+    min_value = range->min_value;
+    max_value = range->max_value;
+  }
+  return rc;
+}
+
+RadarReturnCode SimRadar::GetVendorTxParam(uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorTxParam id, uint32_t& value) {
+  (void) slot_id;
+  (void) antenna_mask;
+  (void) id;
+  (void) value;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode SimRadar::SetVendorTxParam(uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorTxParam id, uint32_t value) {
+  (void) slot_id;
+  (void) antenna_mask;
+  (void) id;
+  (void) value;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode SimRadar::GetVendorTxParamRange(RadarVendorTxParam id,
+    uint32_t& min_value, uint32_t& max_value) {
+  (void) id;
+  (void) min_value;
+  (void) max_value;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode SimRadar::GetVendorRxParam(uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorRxParam id, uint32_t& value) {
+  (void) slot_id;
+  (void) antenna_mask;
+  (void) id;
+  (void) value;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode SimRadar::SetVendorRxParam(uint8_t slot_id,
+    uint32_t antenna_mask, RadarVendorRxParam id, uint32_t value) {
+  (void) slot_id;
+  (void) antenna_mask;
+  (void) id;
+  (void) value;
+  return RC_UNSUPPORTED;
+}
+
+RadarReturnCode SimRadar::GetVendorRxParamRange(RadarVendorRxParam id,
+    uint32_t& min_value, uint32_t& max_value) {
+  (void) id;
+  (void) min_value;
+  (void) max_value;
+  return RC_UNSUPPORTED;
+}
+
+//--------------------------------------
+//----- Streaming ----------------------
+//--------------------------------------
+
+SimRadar::StreamConfig SimRadar::MakeStreamConfig(
+    uint8_t slot_id, const SlotConfig& slot) const {
+  uint32_t tx_mask = slot.common[RADAR_PARAM_TX_ANTENNA_MASK];
+  uint32_t rx_mask = slot.common[RADAR_PARAM_RX_ANTENNA_MASK];
+  uint32_t bits = vendor_params_[SIM_VENDOR_PARAM_SAMPLE_BITS];
+
+  StreamConfig config;
+  memset(&config.format, 0, sizeof(config.format));
+  config.format.radar_type = RTYPE_FMCW;
+  config.format.config_id = slot_id;
+  config.format.sample_data_type = RSAMPLE_DTYPE_CINT;
+  config.format.bits_per_sample = static_cast<uint8_t>(2 * bits);
+  config.format.num_channels = static_cast<uint8_t>(CountBits(rx_mask));
+  config.format.is_channels_interleaved =
+      vendor_params_[SIM_VENDOR_PARAM_INTERLEAVED] != 0;
+  config.format.is_big_endian = false;
+  config.format.sample_packing = bits < 16 ? RSAMPLE_PACKING_PACKED
+                                           : RSAMPLE_PACKING_PADDED;
+  config.format.custom.fmcw.samples_per_chirp =
+      static_cast<uint16_t>(slot.fmcw[FMCW_PARAM_SAMPLES_PER_CHIRP]);
+  config.format.custom.fmcw.chirps_per_burst =
+      static_cast<uint16_t>(slot.fmcw[FMCW_PARAM_CHIRPS_PER_BURST]);
+
+  SimBurstConfig& burst = config.burst;
+  burst.samples_per_chirp = slot.fmcw[FMCW_PARAM_SAMPLES_PER_CHIRP];
+  burst.chirps_per_burst = slot.fmcw[FMCW_PARAM_CHIRPS_PER_BURST];
+  burst.chirp_period_s = slot.fmcw[FMCW_PARAM_CHIRP_PERIOD_US] * 1e-6;
+  burst.adc_sampling_hz = slot.fmcw[FMCW_PARAM_ADC_SAMPLING_HZ];
+  burst.lower_freq_hz = slot.fmcw[FMCW_PARAM_LOWER_FREQ_MHZ] * 1e6;
+  burst.upper_freq_hz = slot.fmcw[FMCW_PARAM_UPPER_FREQ_MHZ] * 1e6;
+  for (int tx = 0; tx < kNumTx; ++tx) {
+    if (tx_mask & (1u << tx)) {
+      burst.tx.push_back(ToMeters(kTxPositions[tx]));
+    }
+  }
+  for (int rx = 0; rx < kNumRx; ++rx) {
+    if (rx_mask & (1u << rx)) {
+      burst.rx.push_back(ToMeters(kRxPositions[rx]));
+    }
+  }
+  burst.is_channels_interleaved = config.format.is_channels_interleaved != 0;
+  burst.full_scale = (1 << (bits - 1)) - 1;
+
+  config.burst_period_us = slot.common[RADAR_PARAM_BURST_PERIOD_US];
+  // Complex sampling sees beat frequencies up to the sampling rate.
+  config.max_range_m = burst.samples_per_chirp * kSpeedOfLight /
+                       (2.0 * (burst.upper_freq_hz - burst.lower_freq_hz));
+  return config;
+}
+
+RadarReturnCode SimRadar::StartDataStreaming(void) {
+  std::vector<StreamConfig> configs;
+  bool is_real_time = true;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_ != RSTATE_IDLE || thread_.joinable()) {
+      return RC_BAD_STATE;
+    }
+    uint32_t max_bytes = 0;
+    for (uint8_t i = 0; i < kNumSlots; ++i) {
+      if (slots_[i].is_active) {
+        configs.push_back(MakeStreamConfig(i, slots_[i]));
+        const StreamConfig& config = configs.back();
+        max_bytes = std::max(max_bytes, static_cast<uint32_t>(
+            config.burst.samples_per_chirp * config.burst.chirps_per_burst *
+            config.burst.rx.size() * 4));
+      }
+    }
+    if (configs.empty()) {
+      return RC_BAD_STATE;
+    }
+    is_real_time = vendor_params_[SIM_VENDOR_PARAM_REAL_TIME] != 0;
+
+    {
+      // Readers only touch the closed queue while streaming is stopped.
+      std::lock_guard<std::mutex> read_lock(read_mutex_);
+      std::lock_guard<std::mutex> ready_lock(ready_mutex_);
+      // Real time bursts keep coming, so the oldest ones are dropped when
+      // the reader falls behind. Otherwise the reader sets the pace.
+      queue_.reset(new radar_utils::BurstQueue(
+          vendor_params_[SIM_VENDOR_PARAM_QUEUE_DEPTH],
+          is_real_time ? radar_utils::DropPolicy::kDropOldest
+                       : radar_utils::DropPolicy::kBlock,
+          max_bytes));
+    }
+    {
+      std::lock_guard<std::mutex> stream_lock(stream_mutex_);
+      is_streaming_ = true;
+    }
+    state_ = RSTATE_ACTIVE;
+    thread_ = std::thread(&SimRadar::Acquire, this, configs, is_real_time);
+  }
+  SIM_LOG(RLOG_INF, "Radar %d streaming %zu configs in %s mode", id_,
+          configs.size(), is_real_time ? "real time" : "fast");
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::StopDataStreaming(void) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (state_ != RSTATE_ACTIVE) {
+    return RC_BAD_STATE;
+  }
+  return StopStreamingLocked(lock);
+}
+
+RadarReturnCode SimRadar::StopStreamingLocked(
+    std::unique_lock<std::mutex>& lock) {
+  if (!thread_.joinable()) {
+    // Another thread is stopping the streaming.
+    return RC_BAD_STATE;
+  }
+  {
+    std::lock_guard<std::mutex> stream_lock(stream_mutex_);
+    is_streaming_ = false;
+  }
+  stream_cv_.notify_all();
+  {
+    std::lock_guard<std::mutex> buffers_lock(buffers_mutex_);
+  }
+  buffers_cv_.notify_all();
+  // Wakes up the producer and the readers, queued bursts can still be read.
+  queue_->Close();
+
+  // Observers called from the acquisition thread may use the radar.
+  std::thread thread;
+  thread.swap(thread_);
+  lock.unlock();
+  thread.join();
+  lock.lock();
+  state_ = RSTATE_IDLE;
+  return RC_OK;
+}
+
+bool SimRadar::WaitUntil(std::chrono::steady_clock::time_point deadline) {
+  std::unique_lock<std::mutex> lock(stream_mutex_);
+  stream_cv_.wait_until(lock, deadline, [this] { return !is_streaming_; });
+  return is_streaming_;
+}
+
+void SimRadar::Acquire(std::vector<StreamConfig> configs, bool is_real_time) {
+  radar_utils::QueuedBurst burst;
+  std::vector<int16_t> iq;
+  std::vector<uint8_t> padded;
+  uint32_t sequence_number = 0;
+  bool has_overrun = false;
+  std::chrono::steady_clock::time_point burst_start =
+      std::chrono::steady_clock::now();
+
+  for (size_t i = 0; is_streaming_; i = (i + 1) % configs.size()) {
+    const StreamConfig& config = configs[i];
+    scene_.Generate(config.burst, iq);
+    RadarBurstFormat format = config.format;
+    format.sequence_number = sequence_number++;
+
+    std::chrono::microseconds burst_period(config.burst_period_us);
+    if (is_real_time) {
+      // The burst is complete once its last chirp is sampled.
+      std::chrono::duration<double> chirps_time(
+          config.burst.chirps_per_burst * config.burst.chirp_period_s);
+      if (!WaitUntil(burst_start +
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                  chirps_time))) {
+        break;
+      }
+      burst_start += burst_period;
+      std::chrono::steady_clock::time_point now =
+          std::chrono::steady_clock::now();
+      if (now > burst_start + burst_period) {
+        // Too far behind to catch up, skip the missed bursts.
+        burst_start = now;
+        if (!has_overrun) {
+          has_overrun = true;
+          SIM_LOG(RLOG_WRN, "Radar %d can not keep up with the burst period",
+                  id_);
+        }
+      }
+    }
+    scene_.Advance(config.burst_period_us * 1e-6, config.max_range_m);
+
+    if (!Deliver(format, iq, padded, burst, is_real_time)) {
+      break;
+    }
+  }
+}
+
+bool SimRadar::Deliver(const RadarBurstFormat& format,
+                       const std::vector<int16_t>& iq,
+                       std::vector<uint8_t>& padded,
+                       radar_utils::QueuedBurst& burst, bool is_real_time) {
+  bool is_registered;
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    is_registered = !buffers_.empty();
+  }
+  if (is_registered) {
+    if (!FillBuffer(format, iq, padded, is_real_time)) {
+      return is_streaming_;
+    }
+  } else {
+    burst.format = format;
+    burst.data.resize(GetEncodedBytes(format, iq));
+    Encode(format, iq, padded, burst.data.data(), burst.data.size());
+    RadarReturnCode rc;
+    do {
+      rc = queue_->Push(burst, kPushTimeout);
+    } while (rc == RC_TIMEOUT && is_streaming_);
+    if (rc != RC_OK) {
+      return false;
+    }
+  }
+  UpdateReady();
+  NotifyBurstReady();
+  return true;
+}
+
+bool SimRadar::FillBuffer(const RadarBurstFormat& format,
+                          const std::vector<int16_t>& iq,
+                          std::vector<uint8_t>& padded, bool is_real_time) {
+  FilledBuffer filled;
+  filled.format = format;
+  filled.read_bytes = static_cast<uint32_t>(GetEncodedBytes(format, iq));
+  {
+    std::unique_lock<std::mutex> lock(buffers_mutex_);
+    if (!is_real_time) {
+      buffers_cv_.wait(lock, [this] {
+        return !free_buffers_.empty() || !is_streaming_;
+      });
+    }
+    if (free_buffers_.empty()) {
+      ++buffer_stats_.dropped_no_buffer;
+      return false;
+    }
+    if (filled.read_bytes > buffer_bytes_) {
+      ++buffer_stats_.dropped_oversize;
+      return false;
+    }
+    filled.index = free_buffers_.front();
+    free_buffers_.pop_front();
+  }
+  // The buffer is neither free nor filled, so it is encoded into without
+  // the lock. Buffers are not registered again while streaming.
+  Encode(format, iq, padded, buffers_[filled.index], filled.read_bytes);
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    filled_buffers_.push_back(filled);
+    ++buffer_stats_.filled;
+  }
+  buffers_cv_.notify_all();
+  return true;
+}
+
+bool SimRadar::HasPendingBursts(void) {
+  if (!queue_->IsEmpty()) {
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  return !filled_buffers_.empty();
+}
+
+void SimRadar::UpdateReady(void) {
+  std::lock_guard<std::mutex> lock(ready_mutex_);
+  bool is_pending = HasPendingBursts();
+  if (is_pending && !is_ready_signaled_) {
+    uint8_t byte = 1;
+    is_ready_signaled_ = write(ready_pipe_[1], &byte, 1) == 1;
+  } else if (!is_pending && is_ready_signaled_) {
+    uint8_t byte;
+    is_ready_signaled_ = read(ready_pipe_[0], &byte, 1) != 1;
+  }
+}
+
+RadarReturnCode SimRadar::IsBurstReady(bool& is_ready) {
+  std::lock_guard<std::mutex> lock(ready_mutex_);
+  is_ready = HasPendingBursts();
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetBurstReadyFd(int& fd) {
+  if (ready_pipe_[0] < 0) {
+    return RC_ERROR;
+  }
+  fd = ready_pipe_[0];
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::ReadBurst(RadarBurstFormat& format,
+                                    std::vector<uint8_t>& raw_radar_data,
+                                    timespec timeout) {
+  std::lock_guard<std::mutex> lock(read_mutex_);
+  RadarReturnCode rc = queue_->Pop(format, raw_radar_data, timeout);
+  UpdateReady();
+  return rc;
+}
+
+RadarReturnCode SimRadar::ReadBursts(uint32_t max_count,
+                                     std::vector<RadarBurstFormat>& formats,
+                                     std::vector<uint32_t>& burst_bytes,
+                                     std::vector<uint8_t>& arena,
+                                     timespec timeout) {
+  if (max_count == 0) {
+    return RC_BAD_INPUT;
+  }
+  formats.clear();
+  burst_bytes.clear();
+  arena.clear();
+
+  std::lock_guard<std::mutex> lock(read_mutex_);
+  RadarReturnCode rc = queue_->Pop(read_burst_, timeout);
+  while (rc == RC_OK) {
+    formats.push_back(read_burst_.format);
+    burst_bytes.push_back(static_cast<uint32_t>(read_burst_.data.size()));
+    arena.insert(arena.end(), read_burst_.data.begin(),
+                 read_burst_.data.end());
+    if (formats.size() == max_count) {
+      break;
+    }
+    rc = queue_->Pop(read_burst_, timespec{0, 0});
+  }
+  UpdateReady();
+  return formats.empty() ? rc : RC_OK;
+}
+
+RadarReturnCode SimRadar::AcquireBurst(RadarBurstLease& lease,
+                                       timespec timeout) {
+  std::lock_guard<std::mutex> lock(read_mutex_);
+  int index = -1;
+  {
+    std::lock_guard<std::mutex> leases_lock(leases_mutex_);
+    for (int i = 0; i < kNumLeases && index < 0; ++i) {
+      if (!leases_[i].in_use) {
+        index = i;
+        leases_[i].in_use = true;
+      }
+    }
+  }
+  if (index < 0) {
+    return RC_RES_LIMIT;
+  }
+
+  Lease& slot = leases_[index];
+  RadarReturnCode rc = queue_->Pop(slot.burst, timeout);
+  UpdateReady();
+  std::lock_guard<std::mutex> leases_lock(leases_mutex_);
+  if (rc != RC_OK) {
+    slot.in_use = false;
+    return rc;
+  }
+  ++slot.generation;
+  lease.lease_id = (slot.generation << 8) | static_cast<uint32_t>(index);
+  lease.size_bytes = static_cast<uint32_t>(slot.burst.data.size());
+  lease.data = slot.burst.data.data();
+  lease.format = slot.burst.format;
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::ReleaseBurst(const RadarBurstLease& lease) {
+  uint32_t index = lease.lease_id & 0xff;
+  std::lock_guard<std::mutex> lock(leases_mutex_);
+  if (index >= kNumLeases || !leases_[index].in_use ||
+      leases_[index].generation != (lease.lease_id >> 8)) {
+    return RC_BAD_INPUT;
+  }
+  leases_[index].in_use = false;
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::RegisterBurstBuffers(
+    const std::vector<uint8_t*>& buffers, uint32_t buffer_bytes) {
+  if (buffers.empty() || buffer_bytes == 0) {
+    return RC_BAD_INPUT;
+  }
+  for (uint8_t* buffer : buffers) {
+    if (buffer == nullptr ||
+        reinterpret_cast<uintptr_t>(buffer) % RADAR_BURST_BUFFER_ALIGNMENT) {
+      return RC_BAD_INPUT;
+    }
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (state_ == RSTATE_ACTIVE) {
+    return RC_BAD_STATE;
+  }
+  std::lock_guard<std::mutex> buffers_lock(buffers_mutex_);
+  buffers_ = buffers;
+  buffer_bytes_ = buffer_bytes;
+  free_buffers_.clear();
+  for (uint32_t i = 0; i < buffers.size(); ++i) {
+    free_buffers_.push_back(i);
+  }
+  filled_buffers_.clear();
+  app_owned_.assign(buffers.size(), false);
+  memset(&buffer_stats_, 0, sizeof(buffer_stats_));
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::UnregisterBurstBuffers(void) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_ == RSTATE_ACTIVE) {
+      return RC_BAD_STATE;
+    }
+    std::lock_guard<std::mutex> buffers_lock(buffers_mutex_);
+    buffers_.clear();
+    buffer_bytes_ = 0;
+    free_buffers_.clear();
+    filled_buffers_.clear();
+    app_owned_.clear();
+  }
+  UpdateReady();
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::WaitBurstBuffer(uint32_t& index,
+                                          RadarBurstFormat& format,
+                                          uint32_t& read_bytes,
+                                          timespec timeout) {
+  {
+    std::unique_lock<std::mutex> lock(buffers_mutex_);
+    if (buffers_.empty()) {
+      return RC_BAD_STATE;
+    }
+    buffers_cv_.wait_until(lock, radar_utils::ToDeadline(timeout), [this] {
+      return !filled_buffers_.empty() || !is_streaming_;
+    });
+    if (filled_buffers_.empty()) {
+      return is_streaming_ ? RC_TIMEOUT : RC_BAD_STATE;
+    }
+    const FilledBuffer& filled = filled_buffers_.front();
+    index = filled.index;
+    format = filled.format;
+    read_bytes = filled.read_bytes;
+    app_owned_[index] = true;
+    filled_buffers_.pop_front();
+  }
+  UpdateReady();
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::ReturnBurstBuffer(uint32_t index) {
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  if (index >= app_owned_.size() || !app_owned_[index]) {
+    return RC_BAD_INPUT;
+  }
+  app_owned_[index] = false;
+  free_buffers_.push_back(index);
+  buffers_cv_.notify_all();
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetBurstBufferStats(RadarBurstBufferStats& stats) {
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  stats = buffer_stats_;
+  stats.app_owned = static_cast<uint32_t>(
+      std::count(app_owned_.begin(), app_owned_.end(), true));
+  stats.driver_owned = static_cast<uint32_t>(buffers_.size()) -
+                       stats.app_owned;
+  return RC_OK;
+}
+
+//--------------------------------------
+//----- Sensor info --------------------
+//--------------------------------------
+
+RadarReturnCode SimRadar::CheckCountryCode(const std::string& country_code) {
+  // The simulated 57-64 GHz band is allowed everywhere.
+  if (country_code.size() != 2 || !isupper(country_code[0]) ||
+      !isupper(country_code[1])) {
+    return RC_BAD_INPUT;
+  }
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetSensorInfo(SensorInfo& info) {
+  info.name = kSensorName;
+  info.vendor = kVendorName;
+  info.device_id = static_cast<uint32_t>(id_);
+  info.radar_type = RTYPE_FMCW;
+  info.driver_version.major = 1;
+  info.driver_version.minor = 0;
+  info.driver_version.patch = 0;
+  info.driver_version.build = 0;
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::LogSensorDetails(void) {
+  std::vector<uint8_t> active;
+  GetActiveConfigs(active);
+  uint32_t is_real_time = 0;
+  GetVendorParam(0, SIM_VENDOR_PARAM_REAL_TIME, is_real_time);
+  std::vector<SimTarget> targets = scene_.GetTargets();
+
+  SIM_LOG(RLOG_INF, "%s by %s, device %d", kSensorName, kVendorName, id_);
+  SIM_LOG(RLOG_INF, "%d TX and %d RX antennas, %d config slots", kNumTx,
+          kNumRx, kNumSlots);
+  SIM_LOG(RLOG_INF, "%zu active configs, %s mode", active.size(),
+          is_real_time ? "real time" : "fast");
+  for (const SimTarget& target : targets) {
+    SIM_LOG(RLOG_INF, "Target at %.2f m, %.2f m/s, azimuth %.1f deg",
+            target.range_m, target.velocity_mps, target.azimuth_deg);
+  }
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetTxPosition(uint32_t tx_mask, int32_t& x,
+                                        int32_t& y, int32_t& z) {
+  int tx = 0;
+  if (!GetSingleBit(tx_mask, kNumTx, tx)) {
+    return RC_BAD_INPUT;
+  }
+  x = kTxPositions[tx][0];
+  y = kTxPositions[tx][1];
+  z = kTxPositions[tx][2];
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetRxPosition(uint32_t rx_mask, int32_t& x,
+                                        int32_t& y, int32_t& z) {
+  int rx = 0;
+  if (!GetSingleBit(rx_mask, kNumRx, rx)) {
+    return RC_BAD_INPUT;
+  }
+  x = kRxPositions[rx][0];
+  y = kRxPositions[rx][1];
+  z = kRxPositions[rx][2];
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::SetLogLevel(RadarLogLevel level) {
+  if (level < RLOG_OFF || level > RLOG_DBG) {
+    return RC_BAD_INPUT;
+  }
+  log_level_ = level;
+  return RC_OK;
+}
+
+//--------------------------------------
+//----- Registers ----------------------
+//--------------------------------------
+
+RadarReturnCode SimRadar::GetAllRegisters(
+    std::vector<std::pair<uint32_t, uint32_t>>& registers) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  registers.assign(registers_.begin(), registers_.end());
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::GetRegister(uint32_t address, uint32_t& value) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = registers_.find(address);
+  if (it == registers_.end()) {
+    return RC_BAD_INPUT;
+  }
+  value = it->second;
+  return RC_OK;
+}
+
+RadarReturnCode SimRadar::SetRegister(uint32_t address, uint32_t value) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    registers_[address] = value;
+  }
+  std::lock_guard<std::mutex> lock(observers_mutex_);
+  for (IRadarSensorObserver* observer : observers_) {
+    observer->OnRegisterSet(address, value);
+  }
+  return RC_OK;
+}
+
+}  // namespace radar_api
@@ -0,0 +1,278 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief A simulated FMCW radar driver.
+ *
+ * @details Implements the IRadarSensor state machine, config slots and
+ *          parameter ranges of a 60 GHz radar with 2 TX and 4 RX antennas
+ *          and streams synthetic IF signals of point targets, see SimScene.
+ *          Bursts follow the burst and chirp periods of the active configs
+ *          in real time, or are produced as fast as the reader consumes them
+ *          when SIM_VENDOR_PARAM_REAL_TIME is cleared, for throughput tests.
+ *
+ *          The TX antennas of a config take turns chirp by chirp and every
+ *          enabled RX antenna is a channel of complex 16-bit samples, or
+ *          packed 12-bit ones with SIM_VENDOR_PARAM_SAMPLE_BITS. With several
+ *          active configs bursts of every config take turns.
+ *
+ *          Vendor params apply to the whole radar, the slot ID is ignored.
+ *          The burst read APIs must not be called from several threads at
+ *          the same time. Requires POSIX for the burst ready descriptor.
+ *
+ * Example:
+ * ```
+ *   radar->TurnOn();
+ *   radar->SetVendorParam(0, SIM_VENDOR_PARAM_REAL_TIME, 0);
+ *   radar->ActivateConfig(0);
+ *   radar->StartDataStreaming();
+ * ```
+ */
+#ifndef RIPPLE_RADAR_SIM_SIMRADAR_HPP_
+#define RIPPLE_RADAR_SIM_SIMRADAR_HPP_
+
+#include <IRadarSensor.hpp>
+
+#include <BurstQueue.hpp>
+#include <SimScene.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//! Produce bursts in real time when 1, as fast as they are read when 0.
+#define SIM_VENDOR_PARAM_REAL_TIME          1
+//! Standard deviation of the noise added to every sample, in ADC LSBs.
+#define SIM_VENDOR_PARAM_NOISE_LSB          2
+//! Interleave the channels of every sample when 1.
+#define SIM_VENDOR_PARAM_INTERLEAVED        3
+//! Bits per sample component, 16 padded or 12 packed.
+#define SIM_VENDOR_PARAM_SAMPLE_BITS        4
+//! Number of bursts queued for ReadBurst before they are dropped.
+#define SIM_VENDOR_PARAM_QUEUE_DEPTH        5
+
+namespace radar_api {
+
+class SimRadar : public IRadarSensor {
+ public:
+  explicit SimRadar(int32_t id);
+  ~SimRadar();
+
+  //! Replace the targets in front of the radar.
+  void SetTargets(const std::vector<SimTarget>& targets);
+
+  //! Get the targets at their current position.
+  std::vector<SimTarget> GetTargets(void);
+
+  RadarReturnCode AddObserver(IRadarSensorObserver* observer);
+  RadarReturnCode RemoveObserver(IRadarSensorObserver* observer);
+
+  RadarReturnCode GetRadarState(RadarState& state);
+  RadarReturnCode TurnOn(void);
+  RadarReturnCode TurnOff(void);
+  RadarReturnCode GoSleep(void);
+  RadarReturnCode WakeUp(void);
+
+  RadarReturnCode GetNumConfigSlots(uint8_t& num_slots);
+  RadarReturnCode GetMaxActiveConfigSlots(uint8_t& num_slots);
+  RadarReturnCode ActivateConfig(uint8_t slot_id);
+  RadarReturnCode DeactivateConfig(uint8_t slot_id);
+  RadarReturnCode GetActiveConfigs(std::vector<uint8_t>& slot_ids);
+
+  RadarReturnCode GetMainParam(uint8_t slot_id, RadarMainParam id,
+                               uint32_t& value);
+  RadarReturnCode SetMainParam(uint8_t slot_id, RadarMainParam id,
+                               uint32_t value);
+  RadarReturnCode GetMainParamRange(RadarMainParam id, uint32_t& min_value,
+                                    uint32_t& max_value);
+
+  RadarReturnCode GetTxParam(uint8_t slot_id, uint32_t antenna_mask,
+                             RadarTxParam id, uint32_t& value);
+  RadarReturnCode SetTxParam(uint8_t slot_id, uint32_t antenna_mask,
+                             RadarTxParam id, uint32_t value);
+  RadarReturnCode GetTxParamRange(RadarTxParam id, uint32_t& min_value,
+                                  uint32_t& max_value);
+
+  RadarReturnCode GetRxParam(uint8_t slot_id, uint32_t antenna_mask,
+                             RadarRxParam id, uint32_t& value);
+  RadarReturnCode SetRxParam(uint8_t slot_id, uint32_t antenna_mask,
+                             RadarRxParam id, uint32_t value);
+  RadarReturnCode GetRxParamRange(RadarRxParam id, uint32_t& min_value,
+                                  uint32_t& max_value);
+
+  RadarReturnCode GetVendorParam(uint8_t slot_id, RadarVendorParam id,
+                                 uint32_t& value);
+  RadarReturnCode SetVendorParam(uint8_t slot_id, RadarVendorParam id,
+                                 uint32_t value);
+  RadarReturnCode GetVendorParamRange(RadarVendorParam id,
+                                      uint32_t& min_value,
+                                      uint32_t& max_value);
+
+  RadarReturnCode GetVendorTxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                   RadarVendorTxParam id, uint32_t& value);
+  RadarReturnCode SetVendorTxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                   RadarVendorTxParam id, uint32_t value);
+  RadarReturnCode GetVendorTxParamRange(RadarVendorTxParam id,
+                                        uint32_t& min_value,
+                                        uint32_t& max_value);
+
+  RadarReturnCode GetVendorRxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                   RadarVendorRxParam id, uint32_t& value);
+  RadarReturnCode SetVendorRxParam(uint8_t slot_id, uint32_t antenna_mask,
+                                   RadarVendorRxParam id, uint32_t value);
+  RadarReturnCode GetVendorRxParamRange(RadarVendorRxParam id,
+                                        uint32_t& min_value,
+                                        uint32_t& max_value);
+
+  RadarReturnCode StartDataStreaming(void);
+  RadarReturnCode StopDataStreaming(void);
+  RadarReturnCode IsBurstReady(bool& is_ready);
+  RadarReturnCode GetBurstReadyFd(int& fd);
+  RadarReturnCode ReadBurst(RadarBurstFormat& format,
+                            std::vector<uint8_t>& raw_radar_data,
+                            timespec timeout);
+  RadarReturnCode ReadBursts(uint32_t max_count,
+                             std::vector<RadarBurstFormat>& formats,
+                             std::vector<uint32_t>& burst_bytes,
+                             std::vector<uint8_t>& arena,
+                             timespec timeout);
+  RadarReturnCode AcquireBurst(RadarBurstLease& lease, timespec timeout);
+  RadarReturnCode ReleaseBurst(const RadarBurstLease& lease);
+  RadarReturnCode RegisterBurstBuffers(const std::vector<uint8_t*>& buffers,
+                                       uint32_t buffer_bytes);
+  RadarReturnCode UnregisterBurstBuffers(void);
+  RadarReturnCode WaitBurstBuffer(uint32_t& index, RadarBurstFormat& format,
+                                  uint32_t& read_bytes, timespec timeout);
+  RadarReturnCode ReturnBurstBuffer(uint32_t index);
+  RadarReturnCode GetBurstBufferStats(RadarBurstBufferStats& stats);
+
+  RadarReturnCode CheckCountryCode(const std::string& country_code);
+  RadarReturnCode GetSensorInfo(SensorInfo& info);
+  RadarReturnCode LogSensorDetails(void);
+  RadarReturnCode GetTxPosition(uint32_t tx_mask, int32_t& x, int32_t& y,
+                                int32_t& z);
+  RadarReturnCode GetRxPosition(uint32_t rx_mask, int32_t& x, int32_t& y,
+                                int32_t& z);
+  RadarReturnCode SetLogLevel(RadarLogLevel level);
+  RadarReturnCode GetAllRegisters(
+      std::vector<std::pair<uint32_t, uint32_t>>& registers);
+  RadarReturnCode GetRegister(uint32_t address, uint32_t& value);
+  RadarReturnCode SetRegister(uint32_t address, uint32_t value);
+
+  static const int kNumSlots = 4;
+  static const int kMaxActiveSlots = 2;
+  static const int kNumTx = 2;
+  static const int kNumRx = 4;
+
+ private:
+  static const int kNumCommonParams = 4;
+  static const int kNumFmcwParams = 7;
+  static const int kNumRxParams = 3;
+  static const int kNumVendorParams = 5;
+  static const int kNumLeases = 4;
+
+  //! Parameters of a config slot, indexed by their IDs.
+  struct SlotConfig {
+    bool is_active;
+    uint32_t common[kNumCommonParams + 1];
+    uint32_t fmcw[kNumFmcwParams + 1];
+    uint32_t tx_power[kNumTx];
+    uint32_t rx[kNumRx][kNumRxParams + 1];
+  };
+
+  //! What the acquisition thread needs to produce the bursts of a config.
+  struct StreamConfig {
+    RadarBurstFormat format;
+    SimBurstConfig burst;
+    uint32_t burst_period_us;
+    double max_range_m;
+  };
+
+  struct Lease {
+    radar_utils::QueuedBurst burst;
+    bool in_use;
+    uint32_t generation;
+  };
+
+  struct FilledBuffer {
+    uint32_t index;
+    RadarBurstFormat format;
+    uint32_t read_bytes;
+  };
+
+  void ResetSlots(void);
+  RadarReturnCode CheckSlot(uint8_t slot_id) const;
+  const char* CheckConfig(const SlotConfig& slot) const;
+  StreamConfig MakeStreamConfig(uint8_t slot_id, const SlotConfig& slot) const;
+  RadarReturnCode StopStreamingLocked(std::unique_lock<std::mutex>& lock);
+
+  void Acquire(std::vector<StreamConfig> configs, bool is_real_time);
+  bool Deliver(const RadarBurstFormat& format, const std::vector<int16_t>& iq,
+               std::vector<uint8_t>& padded, radar_utils::QueuedBurst& burst,
+               bool is_real_time);
+  bool FillBuffer(const RadarBurstFormat& format,
+                  const std::vector<int16_t>& iq,
+                  std::vector<uint8_t>& padded, bool is_real_time);
+  bool WaitUntil(std::chrono::steady_clock::time_point deadline);
+
+  bool HasPendingBursts(void);
+  void UpdateReady(void);
+  void NotifyBurstReady(void);
+
+  void Log(RadarLogLevel level, const char* function, int line,
+           const char* format, ...)
+#if defined(__GNUC__) || defined(__clang__)
+      __attribute__((format(printf, 5, 6)))
+#endif
+      ;
+
+  const int32_t id_;
+  SimScene scene_;
+
+  //! Guards the radar state, the config slots and the registers.
+  std::mutex mutex_;
+  RadarState state_;
+  SlotConfig slots_[kNumSlots];
+  uint32_t vendor_params_[kNumVendorParams + 1];
+  std::map<uint32_t, uint32_t> registers_;
+
+  std::mutex observers_mutex_;
+  std::vector<IRadarSensorObserver*> observers_;
+  std::atomic<RadarLogLevel> log_level_;
+
+  //! Wakes up the acquisition thread when streaming stops.
+  std::mutex stream_mutex_;
+  std::condition_variable stream_cv_;
+  std::atomic<bool> is_streaming_;
+  std::thread thread_;
+
+  //! Serializes the burst readers and the queue replacement.
+  std::mutex read_mutex_;
+  std::unique_ptr<radar_utils::BurstQueue> queue_;
+  radar_utils::QueuedBurst read_burst_;
+  std::mutex leases_mutex_;
+  Lease leases_[kNumLeases];
+
+  //! Registered burst buffers.
+  std::mutex buffers_mutex_;
+  std::condition_variable buffers_cv_;
+  std::vector<uint8_t*> buffers_;
+  uint32_t buffer_bytes_;
+  std::deque<uint32_t> free_buffers_;
+  std::deque<FilledBuffer> filled_buffers_;
+  std::vector<bool> app_owned_;
+  RadarBurstBufferStats buffer_stats_;
+
+  //! Pipe that is readable while bursts are pending.
+  std::mutex ready_mutex_;
+  int ready_pipe_[2];
+  bool is_ready_signaled_;
+};
+
+}  // namespace radar_api
+
+#endif  // RIPPLE_RADAR_SIM_SIMRADAR_HPP_
@@ -0,0 +1,216 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <SimScene.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+
+namespace radar_api {
+
+namespace {
+
+const double kSpeedOfLight = 299792458.0;
+const double kPi = 3.14159265358979323846;
+// Targets closer than this bounce back.
+const double kMinRangeM = 0.1;
+// Gaussian noise drawn once, read from a random offset per block.
+const size_t kNoiseTableSize = 1 << 16;
+const size_t kNoiseSamples = 128;
+
+double ToRadians(float degrees) {
+  return degrees * kPi / 180.0;
+}
+
+// Round half away from zero within the full scale.
+int16_t Quantize(float value, float limit) {
+  value = std::max(-limit, std::min(limit, value));
+  return static_cast<int16_t>(value + (value < 0.0f ? -0.5f : 0.5f));
+}
+
+// Add a complex tone to a chirp. The tone is stepped in kToneLanes
+// interleaved phasors, so the recurrence vectorizes and the single
+// precision error grows only every kToneLanes samples.
+const size_t kToneLanes = 8;
+
+void AddTone(std::complex<double> phasor, std::complex<double> step,
+             size_t num_samples, float* re, float* im) {
+  float lane_re[kToneLanes];
+  float lane_im[kToneLanes];
+  std::complex<double> lanes_step(1.0, 0.0);
+  for (size_t lane = 0; lane < kToneLanes; ++lane) {
+    lane_re[lane] = static_cast<float>(phasor.real());
+    lane_im[lane] = static_cast<float>(phasor.imag());
+    phasor *= step;
+    lanes_step *= step;
+  }
+  const float step_re = static_cast<float>(lanes_step.real());
+  const float step_im = static_cast<float>(lanes_step.imag());
+
+  size_t sample = 0;
+  for (; sample + kToneLanes <= num_samples; sample += kToneLanes) {
+    for (size_t lane = 0; lane < kToneLanes; ++lane) {
+      re[sample + lane] += lane_re[lane];
+      im[sample + lane] += lane_im[lane];
+      float next_re = lane_re[lane] * step_re - lane_im[lane] * step_im;
+      lane_im[lane] = lane_re[lane] * step_im + lane_im[lane] * step_re;
+      lane_re[lane] = next_re;
+    }
+  }
+  for (size_t lane = 0; sample < num_samples; ++sample, ++lane) {
+    re[sample] += lane_re[lane];
+    im[sample] += lane_im[lane];
+  }
+}
+
+}  // namespace
+
+SimScene::SimScene(uint32_t seed)
+    : noise_lsb_(0.0f), random_(seed),
+      noise_table_(kNoiseTableSize + 2 * kNoiseSamples) {
+  std::normal_distribution<float> noise(0.0f, 1.0f);
+  for (float& value : noise_table_) {
+    value = noise(random_);
+  }
+}
+
+void SimScene::SetTargets(const std::vector<SimTarget>& targets) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  targets_ = targets;
+}
+
+std::vector<SimTarget> SimScene::GetTargets(void) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return targets_;
+}
+
+void SimScene::SetNoise(float noise_lsb) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  noise_lsb_ = noise_lsb;
+}
+
+void SimScene::Generate(const SimBurstConfig& config,
+                        std::vector<int16_t>& iq) {
+  std::vector<SimTarget> targets;
+  float noise_lsb;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    targets = targets_;
+    noise_lsb = noise_lsb_;
+  }
+
+  const size_t num_samples = config.samples_per_chirp;
+  const size_t num_chirps = config.chirps_per_burst;
+  const size_t num_channels = config.rx.size();
+  const size_t num_tx = config.tx.size();
+  const size_t size = num_samples * num_chirps * num_channels;
+  signal_re_.assign(size, 0.0f);
+  signal_im_.assign(size, 0.0f);
+  iq.resize(2 * size);
+  if (size == 0 || num_tx == 0) {
+    return;
+  }
+
+  const double ramp_s = num_samples / config.adc_sampling_hz;
+  const double slope = (config.upper_freq_hz - config.lower_freq_hz) / ramp_s;
+  std::vector<std::complex<double>> phasors(num_tx * num_channels);
+  std::vector<std::complex<double>> steps(num_tx * num_channels);
+  for (const SimTarget& target : targets) {
+    double azimuth = ToRadians(target.azimuth_deg);
+    double elevation = ToRadians(target.elevation_deg);
+    double ux = std::cos(elevation) * std::sin(azimuth);
+    double uy = std::sin(elevation);
+    double uz = std::cos(elevation) * std::cos(azimuth);
+    double amplitude = target.amplitude * config.full_scale;
+
+    // The phase of the first sample and the phase step between samples of
+    // the first chirp, for every pair of antennas. The antennas are closer
+    // to the target by their projection onto the target direction.
+    for (size_t t = 0; t < num_tx; ++t) {
+      const SimPosition& tx = config.tx[t];
+      for (size_t channel = 0; channel < num_channels; ++channel) {
+        const SimPosition& rx = config.rx[channel];
+        double offset = (tx.x + rx.x) * ux + (tx.y + rx.y) * uy +
+                        (tx.z + rx.z) * uz;
+        double delay = (2.0 * target.range_m - offset) / kSpeedOfLight;
+        phasors[t * num_channels + channel] = std::polar(
+            amplitude,
+            2.0 * kPi * std::fmod(config.lower_freq_hz * delay, 1.0));
+        steps[t * num_channels + channel] = std::polar(
+            1.0, 2.0 * kPi * slope * delay / config.adc_sampling_hz);
+      }
+    }
+    // Both move by the same rotation from chirp to chirp, as the target
+    // moves by the same distance.
+    double chirp_delay = 2.0 * target.velocity_mps * config.chirp_period_s /
+                         kSpeedOfLight;
+    std::complex<double> doppler = std::polar(
+        1.0, 2.0 * kPi * std::fmod(config.lower_freq_hz * chirp_delay, 1.0));
+    std::complex<double> migration = std::polar(
+        1.0, 2.0 * kPi * slope * chirp_delay / config.adc_sampling_hz);
+    std::complex<double> chirp_doppler(1.0, 0.0);
+    std::complex<double> chirp_migration(1.0, 0.0);
+
+    for (size_t chirp = 0; chirp < num_chirps; ++chirp) {
+      size_t t = chirp % num_tx;
+      for (size_t channel = 0; channel < num_channels; ++channel) {
+        size_t row = channel * num_chirps + chirp;
+        AddTone(phasors[t * num_channels + channel] * chirp_doppler,
+                steps[t * num_channels + channel] * chirp_migration,
+                num_samples, &signal_re_[row * num_samples],
+                &signal_im_[row * num_samples]);
+      }
+      chirp_doppler *= doppler;
+      chirp_migration *= migration;
+    }
+  }
+
+  // Strides of the chirp, sample and channel dimensions in samples.
+  size_t chirp_stride, sample_stride, channel_stride;
+  if (config.is_channels_interleaved) {
+    channel_stride = 1;
+    sample_stride = num_channels;
+    chirp_stride = num_samples * num_channels;
+  } else {
+    sample_stride = 1;
+    chirp_stride = num_samples;
+    channel_stride = num_chirps * num_samples;
+  }
+
+  const float limit = static_cast<float>(config.full_scale);
+  for (size_t channel = 0; channel < num_channels; ++channel) {
+    for (size_t chirp = 0; chirp < num_chirps; ++chirp) {
+      size_t row = (channel * num_chirps + chirp) * num_samples;
+      int16_t* out = iq.data() +
+                     2 * (chirp * chirp_stride + channel * channel_stride);
+      for (size_t start = 0; start < num_samples; start += kNoiseSamples) {
+        // Every block reads the noise from a random offset into the table.
+        const float* noise = &noise_table_[random_() % kNoiseTableSize];
+        size_t count = std::min(kNoiseSamples, num_samples - start);
+        for (size_t i = 0; i < count; ++i) {
+          size_t sample = start + i;
+          size_t index = 2 * sample * sample_stride;
+          out[index] = Quantize(
+              signal_re_[row + sample] + noise_lsb * noise[2 * i], limit);
+          out[index + 1] = Quantize(
+              signal_im_[row + sample] + noise_lsb * noise[2 * i + 1],
+              limit);
+        }
+      }
+    }
+  }
+}
+
+void SimScene::Advance(double seconds, double max_range_m) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (SimTarget& target : targets_) {
+    double range = target.range_m + target.velocity_mps * seconds;
+    if ((range < kMinRangeM && target.velocity_mps < 0) ||
+        (range > max_range_m && target.velocity_mps > 0)) {
+      target.velocity_mps = -target.velocity_mps;
+    }
+    target.range_m = static_cast<float>(range);
+  }
+}
+
+}  // namespace radar_api
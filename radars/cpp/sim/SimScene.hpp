@@ -0,0 +1,109 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+/**
+ * @brief Point targets seen by the simulated radar and the IF signal they
+ *        produce.
+ *
+ * @details Every target reflects the chirps from its current range, so its
+ *          IF signal is a complex tone at the beat frequency 2 * R * S / c,
+ *          where S is the chirp slope. The phase of the tone moves from chirp
+ *          to chirp with the target velocity and from antenna to antenna with
+ *          the target direction, so range, Doppler and angle processing see
+ *          the targets where they are placed.
+ */
+#ifndef RIPPLE_RADAR_SIM_SIMSCENE_HPP_
+#define RIPPLE_RADAR_SIM_SIMSCENE_HPP_
+
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <vector>
+
+namespace radar_api {
+
+//! A point target.
+struct SimTarget {
+  //! Distance from the origin of the antenna positions in meters.
+  float range_m;
+  //! Radial velocity in meters per second, positive when moving away.
+  float velocity_mps;
+  //! Angle from boresight towards the positive x axis in degrees.
+  float azimuth_deg;
+  //! Angle from boresight towards the positive y axis in degrees.
+  float elevation_deg;
+  //! Amplitude of the reflection relative to the ADC full scale.
+  float amplitude;
+};
+
+//! Antenna position in meters.
+struct SimPosition {
+  double x;
+  double y;
+  double z;
+};
+
+//! Chirp and acquisition settings of a simulated burst.
+struct SimBurstConfig {
+  uint32_t samples_per_chirp;
+  uint32_t chirps_per_burst;
+  double chirp_period_s;
+  double adc_sampling_hz;
+  double lower_freq_hz;
+  double upper_freq_hz;
+  //! Enabled TX antennas, taking turns chirp by chirp.
+  std::vector<SimPosition> tx;
+  //! Enabled RX antennas, one channel each.
+  std::vector<SimPosition> rx;
+  bool is_channels_interleaved;
+  //! Largest magnitude of a sample component.
+  int32_t full_scale;
+};
+
+class SimScene {
+ public:
+  explicit SimScene(uint32_t seed);
+
+  //! Replace the targets.
+  void SetTargets(const std::vector<SimTarget>& targets);
+
+  std::vector<SimTarget> GetTargets(void);
+
+  //! Set the standard deviation of the noise added to every component.
+  void SetNoise(float noise_lsb);
+
+  /**
+   * @brief Synthesize the IF samples of a burst.
+   *
+   * @param config the burst settings.
+   * @param iq where interleaved real and imaginary components are written,
+   *        laid out as chirp x sample x channel when the channels are
+   *        interleaved, otherwise as channel x chirp x sample.
+   */
+  void Generate(const SimBurstConfig& config, std::vector<int16_t>& iq);
+
+  /**
+   * @brief Move the targets along their velocity.
+   *
+   * @details Targets bounce back when they leave the range of the radar.
+   *
+   * @param seconds the time passed since the last move.
+   * @param max_range_m the largest range the radar can measure.
+   */
+  void Advance(double seconds, double max_range_m);
+
+ private:
+  std::mutex mutex_;
+  std::vector<SimTarget> targets_;
+  float noise_lsb_;
+  std::minstd_rand random_;
+  //! Unit Gaussian noise, with a block of margin to read past the end.
+  std::vector<float> noise_table_;
+  //! Accumulated real and imaginary parts of one burst, laid out as
+  //! channel x chirp x sample.
+  std::vector<float> signal_re_;
+  std::vector<float> signal_im_;
+};
+
+}  // namespace radar_api
+
+#endif  // RIPPLE_RADAR_SIM_SIMSCENE_HPP_
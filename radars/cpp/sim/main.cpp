@@ -0,0 +1,21 @@
+// Copyright 2026 CTA Radar API Technical Project
+
+#include <IRadarSensor.hpp>
+#include <SimRadar.hpp>
+
+Version radarGetRadarApiVersion(void) {
+  return {2, 0, 0, 0};
+}
+
+namespace radar_api {
+
+IRadarSensor* CreateRadarSensor(int32_t id) {
+  return new SimRadar(id);
+}
+
+RadarReturnCode DestroyRadarSensor(IRadarSensor* radar) {
+  delete radar;
+  return RC_OK;
+}
+
+}  // namespace radar_api
@@ -4,7 +4,8 @@
  *
  * @brief Stub implementation for Ripple Radar API C++.
  *        All the returns are default or RC_UNSUPPORTED
- *        except Create/Destroy radar.
+ *        except Create/Destroy radar and GetBurstReadyFd, which
+ *        provides a descriptor that never becomes readable.
  *
  */
 #ifndef RIPPLE_RADARS_CPP_STUBRADAR_HPP_
@@ -12,15 +13,28 @@
 
 #include <IRadarSensor.hpp>
 
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
 namespace radar_api {
 class StubRadar: public IRadarSensor {
  public:
-  StubRadar(int32_t id) {
+  StubRadar(int32_t id) : burst_ready_fd(-1) {
     (void) id;
     (void) stub_field;
+#ifdef __linux__
+    burst_ready_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+#endif
   }
 
   ~StubRadar() {
+#ifdef __linux__
+    if (burst_ready_fd >= 0) {
+      close(burst_ready_fd);
+    }
+#endif
   }
 
   // RadarSensor interface.
@@ -253,6 +267,15 @@ class StubRadar: public IRadarSensor {
     return RC_UNSUPPORTED;
   }
 
+  RadarReturnCode GetBurstReadyFd(int& fd) {
+    // No bursts are ever produced, so the descriptor is never signaled.
+    if (burst_ready_fd < 0) {
+      return RC_UNSUPPORTED;
+    }
+    fd = burst_ready_fd;
+    return RC_OK;
+  }
+
   RadarReturnCode ReadBurst(RadarBurstFormat& format,
                             std::vector<uint8_t>& raw_radar_data,
                             timespec timeout) {
@@ -262,6 +285,60 @@ class StubRadar: public IRadarSensor {
     return RC_UNSUPPORTED;
   }
 
+  RadarReturnCode ReadBursts(uint32_t max_count,
+                             std::vector<RadarBurstFormat>& formats,
+                             std::vector<uint32_t>& burst_bytes,
+                             std::vector<uint8_t>& arena,
+                             timespec timeout) {
+    (void) max_count;
+    (void) formats;
+    (void) burst_bytes;
+    (void) arena;
+    (void) timeout;
+    return RC_UNSUPPORTED;
+  }
+
+  RadarReturnCode AcquireBurst(RadarBurstLease& lease, timespec timeout) {
+    (void) lease;
+    (void) timeout;
+    return RC_UNSUPPORTED;
+  }
+
+  RadarReturnCode ReleaseBurst(const RadarBurstLease& lease) {
+    (void) lease;
+    return RC_UNSUPPORTED;
+  }
+
+  RadarReturnCode RegisterBurstBuffers(const std::vector<uint8_t*>& buffers,
+                                       uint32_t buffer_bytes) {
+    (void) buffers;
+    (void) buffer_bytes;
+    return RC_UNSUPPORTED;
+  }
+
+  RadarReturnCode UnregisterBurstBuffers(void) {
+    return RC_UNSUPPORTED;
+  }
+
+  RadarReturnCode WaitBurstBuffer(uint32_t& index, RadarBurstFormat& format,
+                                  uint32_t& read_bytes, timespec timeout) {
+    (void) index;
+    (void) format;
+    (void) read_bytes;
+    (void) timeout;
+    return RC_UNSUPPORTED;
+  }
+
+  RadarReturnCode ReturnBurstBuffer(uint32_t index) {
+    (void) index;
+    return RC_UNSUPPORTED;
+  }
+
+  RadarReturnCode GetBurstBufferStats(RadarBurstBufferStats& stats) {
+    (void) stats;
+    return RC_UNSUPPORTED;
+  }
+
   RadarReturnCode CheckCountryCode(const std::string& country_code) {
     (void) country_code;
     return RC_UNSUPPORTED;
@@ -319,6 +396,7 @@ class StubRadar: public IRadarSensor {
 
  private:
   int stub_field;
+  int burst_ready_fd;
 };
 
 }  // namespace radar_api